@@ -0,0 +1,63 @@
+/**
+ * Quick performance test: SIMD Box-Muller pairs vs. the ziggurat normal paths
+ *
+ * This script measures normalArray() throughput for each Xoroshiro128+ and Xoshiro256+
+ * variant (the scalar ziggurat, and the SIMD ziggurat fast path), and normalPairArray()
+ * throughput for the SIMD variants that offer it, to pick the faster normal generator
+ * for each engine on the current runtime.
+ */
+
+import { RandomGenerator, PRNGType } from '../dist/index.mjs';
+
+const ITERATIONS = 20000;
+const ARRAY_SIZE = 1000;
+const WARMUP_ITERATIONS = 1000;
+
+const ENGINES = [
+    PRNGType.Xoroshiro128Plus,
+    PRNGType.Xoroshiro128Plus_SIMD,
+    PRNGType.Xoshiro256Plus,
+    PRNGType.Xoshiro256Plus_SIMD
+];
+
+/** Times `ITERATIONS` calls of `fill`, after a short warm-up, returning milliseconds. */
+function time(fill) {
+    for (let i = 0; i < WARMUP_ITERATIONS; i++) {
+        fill();
+    }
+
+    const start = performance.now();
+    for (let i = 0; i < ITERATIONS; i++) {
+        fill();
+    }
+    return performance.now() - start;
+}
+
+/** Millions of values per second for `ms` spent filling `ITERATIONS` arrays. */
+function mValuesPerSec(ms) {
+    return (ARRAY_SIZE * ITERATIONS / ms / 1000).toFixed(1);
+}
+
+console.log('Normal Distribution Throughput Test');
+console.log('===================================\n');
+console.log(`Array Size: ${ARRAY_SIZE} elements, ${ITERATIONS} iterations (M values/sec)\n`);
+console.log(`${'PRNG Type'.padEnd(28)}${'normalArray'.padStart(14)}${'normalPairArray'.padStart(18)}${'Faster'.padStart(18)}`);
+console.log('-'.repeat(78));
+
+for (const prngType of ENGINES) {
+    const gen = new RandomGenerator(prngType, null, null, ARRAY_SIZE);
+    const zigguratMs = time(() => gen.normalArray());
+
+    // only the SIMD variants offer Box-Muller pairs
+    let pairColumn = '-';
+    let faster = 'normalArray';
+    try {
+        const pairMs = time(() => gen.normalPairArray());
+        pairColumn = mValuesPerSec(pairMs);
+        if (pairMs < zigguratMs) faster = 'normalPairArray';
+    } catch {
+        // not supported by this generator type
+    }
+
+    console.log(`${prngType.padEnd(28)}${mValuesPerSec(zigguratMs).padStart(14)}${pairColumn.padStart(18)}${faster.padStart(18)}`);
+}
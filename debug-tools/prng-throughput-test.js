@@ -0,0 +1,57 @@
+/**
+ * Quick performance test: Bulk array throughput of every PRNG type
+ *
+ * This script measures int64Array() and floatArray() throughput for each
+ * generator, to compare the engines against each other (e.g. SFC64 and
+ * the Romu family against the xoshiro family) on the current runtime.
+ */
+
+import { RandomGenerator, PRNGType } from '../dist/index.mjs';
+
+const ITERATIONS = 20000;
+const ARRAY_SIZE = 1000;
+const WARMUP_ITERATIONS = 1000;
+
+/** Times `ITERATIONS` calls of `fill`, after a short warm-up, returning milliseconds. */
+function time(fill) {
+    for (let i = 0; i < WARMUP_ITERATIONS; i++) {
+        fill();
+    }
+
+    const start = performance.now();
+    for (let i = 0; i < ITERATIONS; i++) {
+        fill();
+    }
+    return performance.now() - start;
+}
+
+/** Millions of values per second for `ms` spent filling `ITERATIONS` arrays. */
+function mValuesPerSec(ms) {
+    return (ARRAY_SIZE * ITERATIONS / ms / 1000).toFixed(1);
+}
+
+console.log('PRNG Bulk Array Throughput Test');
+console.log('===============================\n');
+console.log(`Array Size: ${ARRAY_SIZE} elements, ${ITERATIONS} iterations (M values/sec)\n`);
+console.log(`${'PRNG Type'.padEnd(28)}${'int64Array'.padStart(12)}${'floatArray'.padStart(12)}`);
+console.log('-'.repeat(52));
+
+const results = [];
+
+for (const prngType of Object.values(PRNGType)) {
+    const gen = new RandomGenerator(prngType, null, null, ARRAY_SIZE);
+
+    const intMs = time(() => gen.int64Array());
+    const floatMs = time(() => gen.floatArray());
+    results.push({ prngType, floatMs });
+
+    console.log(`${prngType.padEnd(28)}${mValuesPerSec(intMs).padStart(12)}${mValuesPerSec(floatMs).padStart(12)}`);
+}
+
+results.sort((a, b) => a.floatMs - b.floatMs);
+
+console.log('\n\nFastest floatArray():');
+console.log('=====================');
+for (const { prngType, floatMs } of results.slice(0, 5)) {
+    console.log(`${prngType.padEnd(28)}${mValuesPerSec(floatMs).padStart(12)}`);
+}
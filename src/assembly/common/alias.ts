@@ -0,0 +1,122 @@
+/**
+ * Helpers for categorical output from Walker's alias method, as built by Vose.
+ *
+ * A table for n categories splits the unit interval into n equal columns. Each column holds
+ * its own category up to a threshold, and a single alias category above it, so a draw needs
+ * just one column and one comparison however many categories there are.
+ *
+ * Each column is a single `u64`: its threshold as a 32-bit fraction in the high bits, and its
+ * alias in the low bits. A draw multiplies one random 64-bit value by n, taking the column
+ * from the high word of the 128-bit product and the fraction to compare with its threshold
+ * from the low word, so it uses one random number and no division.
+ * @packageDocumentation
+ */
+
+/*
+* Based on "A Linear Algorithm For Generating Random Numbers With a Given Distribution"
+* Michael D. Vose, IEEE Transactions on Software Engineering, 1991
+* https://doi.org/10.1109/32.92917
+*/
+
+import { mulHigh64 } from './uint128';
+
+// 2^32, to scale a column's threshold to a 32-bit fraction
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const BIT_32: f64 = 4294967296.0;
+
+// a threshold that keeps the column's own category for every fraction but the last,
+// for columns that are entirely their own (whose alias is then also their own)
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const THRESHOLD_FULL: u64 = 0xFFFFFFFF;
+
+/**
+ * Finds the first column from `from` whose scaled weight is below 1, or `size`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function nextSmall(weights: Float64Array, size: i32, from: i32): i32 {
+    while (from < size && unchecked(weights[from]) >= 1.0) from++;
+    return from;
+}
+
+/**
+ * Finds the first column from `from` whose scaled weight is at least 1, or `size`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function nextLarge(weights: Float64Array, size: i32, from: i32): i32 {
+    while (from < size && unchecked(weights[from]) < 1.0) from++;
+    return from;
+}
+
+/**
+ * Builds an alias table into `table`, with a category for each of its elements, so that each
+ * category is drawn with probability proportional to its weight.
+ *
+ * Takes O(n) time and no memory beyond the table: instead of Vose's lists of small and large
+ * columns, 2 cursors scan for them in place. Columns left over at the end (in exact arithmetic,
+ * only those filled exactly, but also any that rounding leaves within a hair of 1) keep their
+ * own category throughout.
+ *
+ * @param weights The categories' weights, each finite and at least 0, with a sum above 0.
+ * Only the first `table.length` are used, and they're rescaled in place while the table is
+ * built, so are overwritten.
+ * @param table The table to build, or rebuild, for use with {@link aliasPick}.
+ */
+export function aliasTableBuild(weights: Float64Array, table: Uint64Array): void {
+    const size: i32 = table.length;
+
+    // rescaled to average 1, so a column is filled by 1
+    let sum: f64 = 0.0;
+    for (let k: i32 = 0; k < size; k++) sum += unchecked(weights[k]);
+    const scale: f64 = <f64>size / sum;
+    for (let k: i32 = 0; k < size; k++) {
+        unchecked(weights[k] *= scale);
+        unchecked(table[k] = (THRESHOLD_FULL << 32) | <u64>k);
+    }
+
+    // `small` scans ahead for small columns, and `current` is the one being filled: usually
+    // `small`, but a large column that's been drawn down below 1 behind `small` goes next
+    let small: i32 = nextSmall(weights, size, 0);
+    let large: i32 = nextLarge(weights, size, 0);
+    let current: i32 = small;
+
+    while (current < size && large < size) {
+        const weight: f64 = unchecked(weights[current]);
+        unchecked(table[current] = (<u64>(weight * BIT_32) << 32) | <u64>large);
+        unchecked(weights[large] -= 1.0 - weight);
+
+        if (current == small) small = nextSmall(weights, size, small + 1);
+
+        if (unchecked(weights[large]) < 1.0) {
+            // once drawn down, it's small: filled next if `small` has passed it, or else
+            // when `small` reaches it
+            const drawnDown: i32 = large;
+            large = nextLarge(weights, size, large + 1);
+            current = drawnDown < small ? drawnDown : small;
+        } else {
+            current = small;
+        }
+    }
+}
+
+/**
+ * Picks a category from an alias table, given a random 64-bit value.
+ *
+ * @param next The random 64-bit value.
+ * @param entries A pointer to the table's first column.
+ * @param size The number of categories.
+ *
+ * @returns The category, from 0 to `size` - 1, as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function aliasPick(next: u64, entries: usize, size: u64): f64 {
+    const column: u64 = mulHigh64(next, size);
+    const fraction: u64 = (next * size) >>> 32;
+    const entry: u64 = load<u64>(entries + (<usize>column << 3));
+
+    return <f64>(fraction < (entry >>> 32) ? column : entry & 0xFFFFFFFF);
+}
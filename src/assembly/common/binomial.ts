@@ -0,0 +1,206 @@
+/**
+ * Helpers for binomially distributed output, choosing an algorithm by the mean.
+ *
+ * Numbers are drawn for the smaller of `p` and 1 - `p`, and flipped to `n` - the count
+ * if `p` was the larger. While `n` times the smaller is below 30, they're drawn by inversion:
+ * a single uniform number is walked up through the probabilities of 0, 1, 2... successes
+ * until it's used up. From 30 up, Kachitvichyanukul and Schmeiser's BTPE algorithm maps
+ * 2 uniform numbers to a candidate count under a hat of a triangle, 2 parallelograms and
+ * 2 exponential tails. Candidates in the triangle (a third to over two thirds of them,
+ * growing with the variance) are accepted without a density test, and the rest are
+ * tested with a short product or Stirling's approximation.
+ *
+ * Parameters that depend only on `n` and `p` are kept from one call to the next, so
+ * repeated calls with the same `n` and `p` only set up once.
+ * @packageDocumentation
+ */
+
+/*
+* Based on "Binomial Random Variate Generation"
+* Voratas Kachitvichyanukul and Bruce W. Schmeiser, Communications of the ACM, 1988
+* https://doi.org/10.1145/42372.42381
+*/
+
+// means below this are drawn by inversion
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const INVERSION_MAX: f64 = 30.0;
+
+// n and p that the parameters below were set up for
+let trials: f64 = -1.0;
+let probability: f64 = NaN;
+
+// the smaller of p and 1 - p (r), its complement (q), and whether counts are flipped
+let r: f64 = 0.0;
+let q: f64 = 0.0;
+let flipped: bool = false;
+
+// inversion: q^n, and the count past which a rounded-off search starts over
+let qn: f64 = 0.0;
+let inversionBound: f64 = 0.0;
+
+// BTPE: the mode, the hat's regions, and their cumulative areas p1 to p4
+let nrq: f64 = 0.0;
+let m: f64 = 0.0;
+let xm: f64 = 0.0;
+let xl: f64 = 0.0;
+let xr: f64 = 0.0;
+let c: f64 = 0.0;
+let lambdaL: f64 = 0.0;
+let lambdaR: f64 = 0.0;
+let p1: f64 = 0.0;
+let p2: f64 = 0.0;
+let p3: f64 = 0.0;
+let p4: f64 = 0.0;
+
+/**
+ * Sets up the parameters for binomial numbers with `n` trials and success probability `p`,
+ * unless they're already set up.
+ */
+export function binomialSetup(n: f64, p: f64): void {
+    if (n == trials && p == probability) return;
+    trials = n;
+    probability = p;
+
+    flipped = p > 0.5;
+    r = flipped ? 1.0 - p : p;
+    q = 1.0 - r;
+
+    if (n * r < INVERSION_MAX) {
+        qn = Math.exp(n * Math.log(q));
+        const mean: f64 = n * r;
+        inversionBound = Math.min(n, mean + 10.0 * Math.sqrt(mean * q + 1.0));
+    } else {
+        nrq = n * r * q;
+        const fm: f64 = n * r + r;
+        m = Math.floor(fm);
+        p1 = Math.floor(2.195 * Math.sqrt(nrq) - 4.6 * q) + 0.5;
+        xm = m + 0.5;
+        xl = xm - p1;
+        xr = xm + p1;
+        c = 0.134 + 20.5 / (15.3 + m);
+        let a: f64 = (fm - xl) / (fm - xl * r);
+        lambdaL = a * (1.0 + 0.5 * a);
+        a = (xr - fm) / (xr * q);
+        lambdaR = a * (1.0 + 0.5 * a);
+        p2 = p1 * (1.0 + 2.0 * c);
+        p3 = p2 + c / lambdaL;
+        p4 = p3 + c / lambdaR;
+    }
+}
+
+/**
+ * Tests whether the set up mean is small enough to be drawn by {@link binomialInversion},
+ * rather than {@link binomialBtpe}.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function binomialInverts(): bool {
+    return trials * r < INVERSION_MAX;
+}
+
+/**
+ * Turns a count drawn for the smaller of `p` and 1 - `p` into a count for `p`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function binomialFlip(k: f64): f64 {
+    return flipped ? trials - k : k;
+}
+
+/**
+ * Draws a binomial number for the set up `n` and `p` by inversion, given a uniform number
+ * in range [0, 1). Its result must still be passed to {@link binomialFlip}.
+ *
+ * @returns The number of successes, or `NaN` in the vanishingly rare case that rounding
+ * leaves the uniform number unused well past every likely count, to be redrawn.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function binomialInversion(u: f64): f64 {
+    let k: f64 = 0.0;
+    let px: f64 = qn;
+
+    while (u > px) {
+        u -= px;
+        k += 1.0;
+        if (k > inversionBound) return NaN;
+        px *= (trials - k + 1.0) * r / (k * q);
+    }
+
+    return k;
+}
+
+/**
+ * Gets the Stirling series correction term of the BTPE acceptance test for `x`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function stirlingCorrection(x: f64): f64 {
+    const x2: f64 = x * x;
+    return (13680.0 - (462.0 - (132.0 - (99.0 - 140.0 / x2) / x2) / x2) / x2) / x / 166320.0;
+}
+
+/**
+ * Draws a candidate binomial number for the set up `n` and `p` with BTPE, given 2 uniform
+ * numbers in range [0, 1). An accepted result must still be passed to {@link binomialFlip}.
+ *
+ * @returns The number of successes, or `NaN` if the candidate is rejected.
+ */
+export function binomialBtpe(u: f64, v: f64): f64 {
+    u *= p4;
+    let y: f64;
+
+    // the triangle, accepted without a density test
+    if (u <= p1) return Math.floor(xm - p1 * v + u);
+
+    if (u <= p2) {
+        // the parallelograms
+        const x: f64 = xl + (u - p1) / c;
+        v = v * c + 1.0 - Math.abs(m - x + 0.5) / p1;
+        if (v > 1.0) return NaN;
+        y = Math.floor(x);
+    } else if (u <= p3) {
+        // the left exponential tail
+        y = Math.floor(xl + Math.log(v) / lambdaL);
+        if (y < 0.0 || v == 0.0) return NaN;
+        v = v * (u - p2) * lambdaL;
+    } else {
+        // the right exponential tail
+        y = Math.floor(xr - Math.log(v) / lambdaR);
+        if (y > trials || v == 0.0) return NaN;
+        v = v * (u - p3) * lambdaR;
+    }
+
+    const k: f64 = Math.abs(y - m);
+    if (k <= 20.0 || k >= 0.5 * nrq - 1.0) {
+        // near the mode (or far out in a narrow distribution), the density ratio to the
+        // mode is a short product
+        const s: f64 = r / q;
+        const a: f64 = s * (trials + 1.0);
+        let f: f64 = 1.0;
+        if (m < y) {
+            for (let i: f64 = m + 1.0; i <= y; i++) f *= a / i - s;
+        } else if (m > y) {
+            for (let i: f64 = y + 1.0; i <= m; i++) f /= a / i - s;
+        }
+        return v > f ? NaN : y;
+    }
+
+    // otherwise, a squeeze on the log of the ratio, then Stirling's approximation
+    const rho: f64 = (k / nrq) * ((k * (k / 3.0 + 0.625) + 0.16666666666666666) / nrq + 0.5);
+    const t: f64 = -k * k / (2.0 * nrq);
+    const logV: f64 = Math.log(v);
+    if (logV < t - rho) return y;
+    if (logV > t + rho) return NaN;
+
+    const x1: f64 = y + 1.0;
+    const f1: f64 = m + 1.0;
+    const z: f64 = trials + 1.0 - m;
+    const w: f64 = trials - y + 1.0;
+    const bound: f64 = xm * Math.log(f1 / x1)
+        + (trials - m + 0.5) * Math.log(z / w)
+        + (y - m) * Math.log(w * r / (x1 * q))
+        + stirlingCorrection(f1) + stirlingCorrection(z) + stirlingCorrection(x1) + stirlingCorrection(w);
+    return logV > bound ? NaN : y;
+}
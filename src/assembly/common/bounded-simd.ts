@@ -0,0 +1,76 @@
+/**
+ * SIMD versions of the Lemire bounded integer helpers in `bounded.ts`, operating on
+ * 2 random 32-bit values at once, each in the low half of a 64-bit lane.
+ * @packageDocumentation
+ */
+
+const LOW_32x2: v128 = i64x2.splat(0xFFFFFFFF);
+
+/**
+ * Multiplies 2 random 32-bit values by `bound` (up to 2^32, in both lanes).
+ * The high 32 bits of each product are the candidate bounded integers.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function lemireProductx2(x: v128, bound: v128): v128 {
+    // both factors fit in 32 bits (or bound is exactly 2^32), so the 64-bit lane product is exact
+    return i64x2.mul(x, bound);
+}
+
+/**
+ * Tests whether either of 2 {@link lemireProductx2} products should be rejected,
+ * because its low 32 bits are below `threshold` (2^32 mod bound, in both lanes).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function lemireRejectx2(product: v128, threshold: v128): bool {
+    // both sides are below 2^32, so the signed comparison is exact
+    return v128.any_true(i64x2.lt_s(v128.and(product, LOW_32x2), threshold));
+}
+
+/**
+ * Extracts the bounded integers (high 32 bits) of 2 accepted products,
+ * as `f64`s so that the JS runtime converts them to `number`s.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function lemireResultx2(product: v128): v128 {
+    // gather the high 32 bits of both products into the low 2 32-bit lanes, then convert
+    return f64x2.convert_low_i32x4_u(v128.shuffle<u32>(product, product, 1, 3, 1, 3));
+}
+
+const SIGN_64x2: v128 = i64x2.splat(0x8000000000000000);
+
+/**
+ * Extracts the next integer in range [0, `bound`) from the fractions in both lanes of `x`,
+ * as `f64`s. SIMD version of `recycleDigit`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function recycleDigitx2(x: v128, bound: v128): v128 {
+    const low: v128 = i64x2.shr_u(i64x2.mul(v128.and(x, LOW_32x2), bound), 32);
+    const digit: v128 = i64x2.shr_u(i64x2.add(i64x2.mul(i64x2.shr_u(x, 32), bound), low), 32);
+
+    // each digit is below 2^32, so it's entirely in the low 32-bit half of its lane
+    return f64x2.convert_low_i32x4_u(v128.shuffle<u32>(digit, digit, 0, 2, 0, 2));
+}
+
+/**
+ * Gets the fractions left in both lanes of `x` after {@link recycleDigitx2}.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function recycleFractionx2(x: v128, bound: v128): v128 {
+    return i64x2.mul(x, bound);
+}
+
+/**
+ * Tests whether either lane's final fraction is below `threshold`
+ * (2^64 mod `bound`^`count`, in both lanes), rejecting the batch.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function recycleRejectx2(x: v128, threshold: v128): bool {
+    // flipping the sign bits turns the signed comparison into an unsigned one
+    return v128.any_true(i64x2.lt_s(v128.xor(x, SIGN_64x2), v128.xor(threshold, SIGN_64x2)));
+}
@@ -0,0 +1,132 @@
+/**
+ * Helpers for unbiased bounded integer output, using Lemire's nearly divisionless
+ * multiply-shift method.
+ *
+ * A random 32-bit `x` multiplied by `bound` gives a 64-bit product whose high 32 bits
+ * are in range [0, `bound`). They're only biased when the product's low 32 bits fall
+ * below 2^32 mod `bound`, so those products are rejected and redrawn. That threshold is
+ * itself below `bound`, so the modulo is only needed in the rare case that the low bits are.
+ *
+ * Bounds are handled as `u64`s so that a full 2^32 range (e.g. every `i32`) needs no
+ * special case: its products are never rejected.
+ * @packageDocumentation
+ */
+
+/*
+* Based on "Fast Random Integer Generation in an Interval"
+* Daniel Lemire, ACM Transactions on Modeling and Computer Simulation, 2019
+* https://arxiv.org/abs/1805.10941
+*/
+
+/**
+ * Multiplies a random 32-bit value by `bound` (up to 2^32).
+ * The high 32 bits of the product are the candidate bounded integer.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function lemireProduct(x: u32, bound: u64): u64 {
+    return <u64>x * bound;
+}
+
+/**
+ * Gets the low 32 bits of a {@link lemireProduct}, which decide whether it's rejected.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function lemireFraction(product: u64): u64 {
+    return product & 0xFFFFFFFF;
+}
+
+/**
+ * Computes 2^32 mod `bound`: products whose {@link lemireFraction} is below this are rejected.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function lemireThreshold(bound: u64): u64 {
+    return ((<u64>1 << 32) - bound) % bound;
+}
+
+/**
+ * Gets the number of integers in the inclusive range [`min`, `max`], from 1 to 2^32.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function rangeToBound(min: i32, max: i32): u64 {
+    return <u64>(<i64>max - <i64>min + 1);
+}
+
+/*
+* Bit recycling for small ranges
+*
+* A random 64-bit `x`, read as a fraction of 2^64, is multiplied by `bound` to extract
+* one integer in range [0, `bound`) from the product's high 64 bits, and the low 64 bits
+* are the remaining fraction to extract the next one from. After `count` extractions,
+* the integers are exactly the base-`bound` digits of Lemire's product of `x` and
+* `bound`^`count`, and the final fraction is that product's low 64 bits: rejecting the
+* whole batch when it falls below 2^64 mod `bound`^`count` leaves every integer unbiased.
+*/
+
+/**
+ * Chooses how many integers in range [0, `bound`) to extract from each random 64-bit
+ * value, maximizing the integers kept per value once rejected batches are accounted for.
+ */
+export function recycleCount(bound: u64): i32 {
+    let power: u64 = 1;
+    let bestCount: i32 = 1;
+    let bestYield: f64 = 0;
+
+    for (let count: i32 = 1; count <= 64 && power <= u64.MAX_VALUE / bound; count++) {
+        power *= bound;
+
+        // expected integers kept per random value: `count` times the batch's acceptance rate
+        const kept: f64 = <f64>count * (1.0 - <f64>recycleThreshold(power) / 18446744073709551616.0);
+        if (kept > bestYield) {
+            bestYield = kept;
+            bestCount = count;
+        }
+    }
+
+    return bestCount;
+}
+
+/**
+ * Computes `bound`^`count`, the number of equally likely batches of `count` integers.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function recyclePower(bound: u64, count: i32): u64 {
+    let power: u64 = 1;
+    for (let i: i32 = 0; i < count; i++) {
+        power *= bound;
+    }
+    return power;
+}
+
+/**
+ * Computes 2^64 mod `power`: batches whose final fraction is below this are rejected.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function recycleThreshold(power: u64): u64 {
+    return (0 - power) % power;
+}
+
+/**
+ * Extracts the next integer in range [0, `bound`) from fraction `x`: the high 64 bits
+ * of `x` * `bound`, for a `bound` below 2^32.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function recycleDigit(x: u64, bound: u64): u64 {
+    // 32x32-bit partial products can't overflow, since `bound` fits in 32 bits
+    return ((x >>> 32) * bound + (((x & 0xFFFFFFFF) * bound) >>> 32)) >>> 32;
+}
+
+/**
+ * Gets the fraction left in `x` after {@link recycleDigit}: the low 64 bits of `x` * `bound`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function recycleFraction(x: u64, bound: u64): u64 {
+    return x * bound;
+}
@@ -10,6 +10,43 @@ export const JUMP_128: StaticArray<u64> = [0xdf900294d8f554a5, 0x170865df4b3201f
 @inline
 export const JUMP_256: StaticArray<u64> = [0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c];
 
+// used to long-jump xoshiro / xoroshiro state (2^96 / 2^192 steps)
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const LONG_JUMP_128: StaticArray<u64> = [0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1];
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const LONG_JUMP_256: StaticArray<u64> = [0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635];
+
+// characteristic polynomials of the xoroshiro128 / xoshiro256 linear engines (leading
+// x^128 / x^256 term omitted), used to compute arbitrary jump polynomials.
+// The JUMP constants above are x^(2^64) and x^(2^128) reduced mod these polynomials
+// (and the LONG_JUMP constants x^(2^96) and x^(2^192)).
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const CHAR_POLY_128: StaticArray<u64> = [0x095b8f76579aa001, 0x0008828e513b43d5];
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const CHAR_POLY_256: StaticArray<u64> = [0x9d116f2bb0f0f001, 0x0280002bcefd1a5e, 0x04b4edcf26259f85, 0x0003c03c3f3ecb19];
+
+// xoroshiro128++ uses different rotation / shift constants than xoroshiro128+ and xoroshiro128**,
+// so its linear engine has its own jump, long jump and characteristic polynomials.
+// (xoshiro256++ and xoshiro256** share the xoshiro256+ engine and its polynomials.)
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const JUMP_128_PP: StaticArray<u64> = [0x2bd7a6a6e99c2ddc, 0x0992ccaf6a6fca05];
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const LONG_JUMP_128_PP: StaticArray<u64> = [0x360fd5f2cf8d5d99, 0x9c6e6877736c46e3];
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const CHAR_POLY_128_PP: StaticArray<u64> = [0x8dae70779760b081, 0x0031bcf2f855d6e5];
+
+// the polynomial x (a single step of any linear engine), used to compute advance polynomials
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const POLY_X: StaticArray<u64> = [2, 0, 0, 0];
+
 /**
  * Bit-shifts the given `u64` to limit it to 53 bits,
  * and casts as an `f64` so that JS runtime converts it to `number`.
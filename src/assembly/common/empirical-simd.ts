@@ -0,0 +1,31 @@
+/**
+ * SIMD version of the empirical table inversion in `empirical.ts`, operating on
+ * 2 uniform numbers at once.
+ * @packageDocumentation
+ */
+
+import { empiricalSegment } from './empirical';
+
+/**
+ * Draws 2 values from an empirical table by inversion, given 2 uniform numbers.
+ * Each lane matches `empiricalValue` for the same uniform number.
+ *
+ * @param u 2 uniform numbers in range [0, 1).
+ * @param entries A pointer to the table's first element.
+ * @param segments The table's number of segments.
+ *
+ * @returns 2 values, interpolated back from their segments' upper ends.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function empiricalValuex2(u: v128, entries: usize, segments: i32): v128 {
+    const segment0: usize = empiricalSegment(f64x2.extract_lane(u, 0), entries, segments);
+    const segment1: usize = empiricalSegment(f64x2.extract_lane(u, 1), entries, segments);
+
+    // WASM SIMD has no gather, so each lane's segment entries are loaded on their own
+    const upperF: v128 = f64x2(load<f64>(segment0), load<f64>(segment1));
+    const upperX: v128 = f64x2(load<f64>(segment0, 8), load<f64>(segment1, 8));
+    const slope: v128 = f64x2(load<f64>(segment0, 16), load<f64>(segment1, 16));
+
+    return f64x2.sub(upperX, f64x2.mul(f64x2.sub(upperF, u), slope));
+}
@@ -0,0 +1,113 @@
+/**
+ * Helpers for sampling from a tabulated, piecewise-linear CDF, such as an empirical
+ * distribution of latencies or sizes, by inversion.
+ *
+ * A CDF tabulated at n points has n - 1 segments, each spanning a range of cumulative
+ * probabilities over which the value rises linearly. Inverting it means finding the segment
+ * that holds a uniform number `u`, and interpolating within it. A binary search would take
+ * log2(n) steps, so a guide table in the style of Chen and Asau splits [0, 1) into n - 1
+ * equal cells instead, each recording the first segment that reaches into it. A search
+ * starts from `u`'s cell, and takes under 2 steps on average, whatever the shape of the CDF.
+ *
+ * A table for n points is a `Float64Array` of 4(n - 1) elements: each segment's upper
+ * cumulative probability, upper value and slope, in turn, followed by the guide table.
+ * @packageDocumentation
+ */
+
+/*
+* Based on "On the generation of random variables with a given discrete distribution"
+* Hui-Chuan Chen and Yoshinori Asau, Annals of the Institute of Statistical Mathematics, 1974
+* https://doi.org/10.1007/BF02479646
+*/
+
+// size in bytes of each segment's entry: its upper cumulative probability, upper value and slope
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const SEGMENT_SIZE: usize = 24;
+
+/**
+ * Gets the number of segments in an empirical table of `length` elements.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function empiricalSegments(length: i32): i32 {
+    return length >> 2;
+}
+
+/**
+ * Builds an empirical table from a tabulated CDF into `table`, whose length sets the number
+ * of points used: one more than a quarter of its length.
+ *
+ * Cumulative probabilities are rescaled to run from exactly 0 to exactly 1. Points with equal
+ * values make a jump in the CDF, drawn as that value; points with equal probabilities make
+ * a gap, which is never drawn.
+ *
+ * @param points The tabulated CDF, as each point's value and then its cumulative probability,
+ * in turn. Both must be finite and non-decreasing, and the probabilities must rise overall.
+ * @param table The table to build, or rebuild, for use with {@link empiricalValue}.
+ */
+export function empiricalTableBuild(points: Float64Array, table: Float64Array): void {
+    const segments: i32 = empiricalSegments(table.length);
+    const first: f64 = unchecked(points[1]);
+    const scale: f64 = 1.0 / (unchecked(points[2 * segments + 1]) - first);
+
+    let lowerX: f64 = unchecked(points[0]);
+    let lowerF: f64 = 0.0;
+    for (let j: i32 = 0; j < segments; j++) {
+        const upperX: f64 = unchecked(points[2 * j + 2]);
+        const upperF: f64 = j == segments - 1 ? 1.0 : (unchecked(points[2 * j + 3]) - first) * scale;
+
+        unchecked(table[3 * j] = upperF);
+        unchecked(table[3 * j + 1] = upperX);
+        // gaps are never drawn, so are given a slope of 0 rather than dividing by 0
+        unchecked(table[3 * j + 2] = upperF > lowerF ? (upperX - lowerX) / (upperF - lowerF) : 0.0);
+
+        lowerX = upperX;
+        lowerF = upperF;
+    }
+
+    // each cell's first segment, whose upper probability is past the start of the cell
+    const cells: f64 = <f64>segments;
+    let j: i32 = 0;
+    for (let cell: i32 = 0; cell < segments; cell++) {
+        while (unchecked(table[3 * j]) <= <f64>cell / cells) j++;
+        unchecked(table[3 * segments + cell] = <f64>j);
+    }
+}
+
+/**
+ * Finds the segment of an empirical table that holds a uniform number, starting from its
+ * guide table cell.
+ *
+ * @param u A uniform number in range [0, 1).
+ * @param entries A pointer to the table's first element.
+ * @param segments The table's number of segments.
+ *
+ * @returns A pointer to the segment's entry.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function empiricalSegment(u: f64, entries: usize, segments: i32): usize {
+    const guide: usize = entries + <usize>segments * SEGMENT_SIZE;
+    const cell: usize = <usize>(u * <f64>segments);
+
+    let segment: usize = entries + <usize>load<f64>(guide + (cell << 3)) * SEGMENT_SIZE;
+    while (load<f64>(segment) <= u) segment += SEGMENT_SIZE;
+    return segment;
+}
+
+/**
+ * Draws a value from an empirical table by inversion, given a uniform number.
+ *
+ * @param u A uniform number in range [0, 1).
+ * @param entries A pointer to the table's first element.
+ * @param segments The table's number of segments.
+ *
+ * @returns The value, interpolated back from its segment's upper end.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function empiricalValue(u: f64, entries: usize, segments: i32): f64 {
+    const segment: usize = empiricalSegment(u, entries, segments);
+    return load<f64>(segment, 8) - (load<f64>(segment) - u) * load<f64>(segment, 16);
+}
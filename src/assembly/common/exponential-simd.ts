@@ -0,0 +1,56 @@
+/**
+ * SIMD versions of the ziggurat exponential helpers in `exponential.ts`, operating on
+ * 2 random 64-bit values at once.
+ * @packageDocumentation
+ */
+
+import { ONEx2 } from './conversion-simd';
+import { exponentialLayer } from './exponential';
+import { EXPONENTIAL_X } from './ziggurat-tables';
+
+const EXPONENT_ONEx2: v128 = i64x2.splat(0x3FF0000000000000);
+const NANx2: v128 = f64x2.splat(NaN);
+const ZEROx2: v128 = f64x2.splat(0.0);
+
+/**
+ * Derives 2 exponential numbers with rate 1 from 2 random 64-bit values, when their
+ * points are inside their layers. Each lane matches `exponentialFast` for the same value.
+ *
+ * @returns 2 exponential numbers, with `NaN` in any lane whose value must be
+ * finished with the generator's own wedge loop.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponentialFastx2(next: v128): v128 {
+    const layer0: i32 = exponentialLayer(v128.extract_lane<u64>(next, 0));
+    const layer1: i32 = exponentialLayer(v128.extract_lane<u64>(next, 1));
+
+    // WASM SIMD has no gather, so each lane's table entries are loaded on their own
+    const width: v128 = f64x2(unchecked(EXPONENTIAL_X[layer0]), unchecked(EXPONENTIAL_X[layer1]));
+    const inner: v128 = f64x2(unchecked(EXPONENTIAL_X[layer0 + 1]), unchecked(EXPONENTIAL_X[layer1 + 1]));
+
+    // same mantissa trick as `normalFastx2`, exact for 52 point bits
+    const point: v128 = f64x2.sub(v128.or(i64x2.shr_u(next, 12), EXPONENT_ONEx2), ONEx2);
+    const z: v128 = f64x2.mul(point, width);
+
+    return v128.bitselect(z, NANx2, f64x2.lt(z, inner));
+}
+
+/**
+ * Tests whether either lane of an {@link exponentialFastx2} result must be finished
+ * with the generator's own wedge loop.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponentialRejectx2(z: v128): bool {
+    return v128.any_true(f64x2.ne(z, z));
+}
+
+/**
+ * Gets the running totals of both lanes of `x`: [`x0`, `x0` + `x1`].
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function prefixSumx2(x: v128): v128 {
+    return f64x2.add(x, v128.shuffle<f64>(ZEROx2, x, 0, 2));
+}
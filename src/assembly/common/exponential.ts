@@ -0,0 +1,100 @@
+/**
+ * Helpers for exponentially distributed output, using Marsaglia and Tsang's ziggurat method.
+ *
+ * Works like the normal ziggurat in `normal.ts`, over the one-sided density exp(-x): each
+ * random 64-bit value picks one of 256 layers of equal area and a point across its width.
+ * About 97.8% of points fall inside the part of a layer that's entirely under the curve,
+ * and are accepted with a single multiply and compare. The rest need the density or a
+ * logarithm: each generator draws those with its own {@link exponentialWedge} loop.
+ *
+ * The tail needs no rejection loop, since the exponential distribution is memoryless:
+ * past the base layer's rectangle, it's just another exponential number, shifted.
+ *
+ * A value's 8 layer bits (bits 4-11) are kept apart from its 52 point bits (bits 12-63),
+ * the same bits the normal ziggurat uses.
+ * @packageDocumentation
+ */
+
+/*
+* Based on "The Ziggurat Method for Generating Random Variables"
+* George Marsaglia and Wai Wan Tsang, Journal of Statistical Software, 2000
+* https://www.jstatsoft.org/article/view/v005i08
+*/
+
+import { BIT_53 } from './conversion';
+import { EXPONENTIAL_R, EXPONENTIAL_X, EXPONENTIAL_Y } from './ziggurat-tables';
+
+// 2^-52, to scale 52 random bits into range [0, 1)
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const BIT_52_INV: f64 = 2.220446049250313e-16;
+
+/**
+ * Gets the ziggurat layer (0 to 255) selected by a random 64-bit value.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponentialLayer(next: u64): i32 {
+    return <i32>((next >>> 4) & 0xFF);
+}
+
+/**
+ * Gets the distance from 0 of the point a random 64-bit value selects across its layer.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponentialMagnitude(next: u64, layer: i32): f64 {
+    return <f64>(next >>> 12) * BIT_52_INV * unchecked(EXPONENTIAL_X[layer]);
+}
+
+/**
+ * Tests whether a point at distance `z` from 0 is inside the part of `layer` that's
+ * entirely under the curve, where it can be accepted without evaluating the density.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponentialInside(z: f64, layer: i32): bool {
+    return z < unchecked(EXPONENTIAL_X[layer + 1]);
+}
+
+/**
+ * Derives an exponential number with rate 1 from a random 64-bit value, when its point
+ * is inside its layer: the fast path, taken about 97.8% of the time.
+ *
+ * @returns An exponential number, or `NaN` if the value must be finished
+ * with the generator's own wedge loop.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponentialFast(next: u64): f64 {
+    const layer: i32 = exponentialLayer(next);
+    const z: f64 = exponentialMagnitude(next, layer);
+    return exponentialInside(z, layer) ? z : NaN;
+}
+
+/**
+ * Tests whether a point at distance `z` in `layer`'s wedge (outside {@link exponentialInside})
+ * is under the curve, given a random 64-bit value for its height within the layer.
+ * Not used for the base layer (0), whose points past its rectangle are in the tail.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponentialWedge(z: f64, layer: i32, next: u64): bool {
+    const y0: f64 = unchecked(EXPONENTIAL_Y[layer]);
+    const height: f64 = <f64>(next >>> 11) / BIT_53;
+    return y0 + height * (unchecked(EXPONENTIAL_Y[layer + 1]) - y0) < Math.exp(-z);
+}
+
+/**
+ * Draws a distance in the tail past the base layer's rectangle, given a random 64-bit value.
+ * Never rejected: by the memoryless property, it's {@link EXPONENTIAL_R} plus an
+ * exponential number, drawn here by inversion.
+ *
+ * @returns A distance beyond {@link EXPONENTIAL_R}.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponentialTail(next: u64): f64 {
+    // uniform in (0, 1], so the logarithm is finite
+    return EXPONENTIAL_R - Math.log(<f64>((next >>> 11) + 1) / BIT_53);
+}
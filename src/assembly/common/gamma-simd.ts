@@ -0,0 +1,55 @@
+/**
+ * SIMD versions of the Marsaglia and Tsang gamma helpers in `gamma.ts`, operating on
+ * 2 candidates at once.
+ * @packageDocumentation
+ */
+
+import { ONEx2, TWOx2 } from './conversion-simd';
+import { logx2, expx2 } from './math-simd';
+
+const EXPONENT_ONEx2: v128 = i64x2.splat(0x3FF0000000000000);
+const ZEROx2: v128 = f64x2.splat(0.0);
+const SQUEEZEx2: v128 = f64x2.splat(0.0331);
+
+/**
+ * Gets 2 uniform numbers in range (0, 1] from 2 random 64-bit values.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gammaUniformx2(next: v128): v128 {
+    // 52 random bits as the mantissa of a float in [1, 2), subtracted from 2
+    return f64x2.sub(TWOx2, v128.or(i64x2.shr_u(next, 12), EXPONENT_ONEx2));
+}
+
+/**
+ * Gets the candidates (1 + `c``x`)^3 for 2 standard normal numbers.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gammaCubex2(x: v128, c: v128): v128 {
+    const v: v128 = f64x2.add(ONEx2, f64x2.mul(c, x));
+    return f64x2.mul(f64x2.mul(v, v), v);
+}
+
+/**
+ * Tests whether either of 2 candidates isn't positive, or fails the `gammaSqueeze` for
+ * its normal `x` and uniform `u`, and so must be finished with the full test.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gammaRejectx2(x: v128, v: v128, u: v128): bool {
+    const x2: v128 = f64x2.mul(x, x);
+    const squeeze: v128 = f64x2.sub(ONEx2, f64x2.mul(SQUEEZEx2, f64x2.mul(x2, x2)));
+    return !v128.all_true(v128.and(f64x2.gt(v, ZEROx2), f64x2.lt(u, squeeze)));
+}
+
+/**
+ * Gets the boost factors `u`^`power` for 2 gamma numbers, from 2 random 64-bit values,
+ * as e^(`power` ln(`u`)) with the `exp` and `log` of `math-simd.ts`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gammaBoostx2(next: v128, power: f64): v128 {
+    const u: v128 = gammaUniformx2(next);
+    return expx2(f64x2.mul(logx2(u), f64x2.splat(power)));
+}
@@ -0,0 +1,74 @@
+/**
+ * Helpers for geometric distributed output, and the sparse Bernoulli and random graph
+ * output built on it.
+ *
+ * The number of failed trials before a success with probability `p` is geometric, and
+ * is drawn from a single uniform number `u` as floor(log(`u`) / log(1 - `p`)). Skipping
+ * that many trials at a time finds every success in a long run of Bernoulli trials for
+ * one random number each, so the cost follows the number of successes rather than trials.
+ *
+ * A G(n, p) random graph includes each of the n(n - 1) / 2 possible edges with probability
+ * `p`, so its edges are the successes among those pairs, numbered in the order
+ * (0, 1), (0, 2), (1, 2), (0, 3)... as in Batagelj and Brandes' method.
+ * @packageDocumentation
+ */
+
+/*
+* Based on "Efficient generation of large random networks"
+* Vladimir Batagelj and Ulrik Brandes, Physical Review E, 2005
+* https://doi.org/10.1103/PhysRevE.71.036113
+*/
+
+import { BIT_53 } from './conversion';
+
+/**
+ * Gets the factor, 1 / log(1 - `p`), that turns the logarithm of a uniform number into
+ * a geometric number. It's -0 for a `p` of 1 (never skipping) and -∞ for a `p` of 0
+ * (skipping past every trial).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function geometricScale(p: f64): f64 {
+    return 1.0 / Math.log1p(-p);
+}
+
+/**
+ * Gets a geometric number from a random 64-bit value and the `p`'s {@link geometricScale}:
+ * the number of failed trials before the next success.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function geometricSkip(next: u64, scale: f64): f64 {
+    // a uniform number in range (0, 1), so its logarithm is finite and never -0
+    const u: f64 = (<f64>(next >>> 11) + 0.5) / BIT_53;
+    return Math.floor(Math.log(u) * scale);
+}
+
+/**
+ * Gets the number of possible edges between `nodes` nodes, n(n - 1) / 2.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function pairCount(nodes: f64): f64 {
+    return nodes * (nodes - 1.0) * 0.5;
+}
+
+/**
+ * Replaces the first `count` pair indices in `arr` with the edges they stand for, each as
+ * its lower node and then its higher node, filling the first 2 * `count` elements.
+ */
+export function pairsToEdges(arr: Float64Array, count: i32): void {
+    // from the back, so each edge only overwrites indices that were already replaced
+    for (let i: i32 = count - 1; i >= 0; i--) {
+        const index: f64 = unchecked(arr[i]);
+
+        // edges to `high` start at index high(high - 1) / 2; the square root can be off
+        // by one for large indices, so it's corrected in both directions
+        let high: f64 = Math.floor((1.0 + Math.sqrt(1.0 + 8.0 * index)) * 0.5);
+        while (pairCount(high) > index) high -= 1.0;
+        while (pairCount(high + 1.0) <= index) high += 1.0;
+
+        unchecked(arr[2 * i] = index - pairCount(high));
+        unchecked(arr[2 * i + 1] = high);
+    }
+}
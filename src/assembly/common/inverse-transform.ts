@@ -0,0 +1,88 @@
+/**
+ * Helpers for distributions with a closed-form inverse CDF, drawn by inverse transform:
+ * Cauchy, Laplace, logistic, Gumbel, Weibull and Pareto.
+ *
+ * Each takes a uniform number from {@link inverseUniform}, which is never 0 or 1, so the
+ * logarithms and powers of the inverse CDFs stay finite, and symmetric distributions
+ * get tails of the same reach on both sides. Location and scale are applied by the
+ * generators' own loops, so the same helpers serve both single values and arrays.
+ * @packageDocumentation
+ */
+
+// 2^-52, to scale 52 random bits into range [0, 1)
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const BIT_52_INV: f64 = 2.220446049250313e-16;
+
+/**
+ * Gets a uniform number in range (0, 1) from a random 64-bit value: the midpoint of one
+ * of 2^52 equal cells, which is exact, and symmetric about 0.5.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function inverseUniform(next: u64): f64 {
+    return (<f64>(next >>> 12) + 0.5) * BIT_52_INV;
+}
+
+/**
+ * Inverts the standard Cauchy CDF at `u`: tan(π(`u` - 0.5)).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function cauchyInverse(u: f64): f64 {
+    return Math.tan(Math.PI * (u - 0.5));
+}
+
+/**
+ * Inverts the standard Laplace CDF at `u`, taking the logarithm of whichever side
+ * of 0.5 it's on, where it's exact.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function laplaceInverse(u: f64): f64 {
+    return u < 0.5 ? Math.log(2.0 * u) : -Math.log(2.0 - 2.0 * u);
+}
+
+/**
+ * Inverts the standard logistic CDF at `u`: its log-odds, ln(`u` / (1 - `u`)).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function logisticInverse(u: f64): f64 {
+    return Math.log(u / (1.0 - u));
+}
+
+/**
+ * Inverts the standard Gumbel (maximum) CDF at `u`: -ln(-ln(`u`)).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gumbelInverse(u: f64): f64 {
+    return -Math.log(-Math.log(u));
+}
+
+/**
+ * Inverts the Weibull CDF with scale 1 at 1 - `u`, which is as uniform as `u`:
+ * (-ln(`u`))^(1 / shape).
+ *
+ * @param u A uniform number from {@link inverseUniform}.
+ * @param invShape 1 / the distribution's shape (`k`).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function weibullInverse(u: f64, invShape: f64): f64 {
+    return Math.pow(-Math.log(u), invShape);
+}
+
+/**
+ * Inverts the Pareto CDF with scale (minimum) 1 at 1 - `u`, which is as uniform as `u`:
+ * `u`^(-1 / shape).
+ *
+ * @param u A uniform number from {@link inverseUniform}.
+ * @param invShape 1 / the distribution's shape (`α`).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function paretoInverse(u: f64, invShape: f64): f64 {
+    return Math.pow(u, -invShape);
+}
@@ -0,0 +1,71 @@
+/**
+ * SIMD versions of the ziggurat normal helpers in `normal.ts`, operating on
+ * 2 random 64-bit values at once.
+ * @packageDocumentation
+ */
+
+import { ONEx2 } from './conversion-simd';
+import { logx2 } from './math-simd';
+import { normalLayer } from './normal';
+import { NORMAL_X } from './ziggurat-tables';
+
+const EXPONENT_ONEx2: v128 = i64x2.splat(0x3FF0000000000000);
+const SIGN_BITx2: v128 = i64x2.splat(8);
+const NANx2: v128 = f64x2.splat(NaN);
+const MINUS_TWOx2: v128 = f64x2.splat(-2.0);
+const TWO_PIx2: v128 = f64x2.splat(2.0 * Math.PI);
+
+/**
+ * Derives 2 standard normal numbers from 2 random 64-bit values, when their points are
+ * inside their layers. Each lane matches `normalFast` for the same value.
+ *
+ * @returns 2 standard normal numbers, with `NaN` in any lane whose value must be
+ * finished with the generator's own wedge and tail loop.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normalFastx2(next: v128): v128 {
+    const layer0: i32 = normalLayer(v128.extract_lane<u64>(next, 0));
+    const layer1: i32 = normalLayer(v128.extract_lane<u64>(next, 1));
+
+    // WASM SIMD has no gather, so each lane's table entries are loaded on their own
+    const width: v128 = f64x2(unchecked(NORMAL_X[layer0]), unchecked(NORMAL_X[layer1]));
+    const inner: v128 = f64x2(unchecked(NORMAL_X[layer0 + 1]), unchecked(NORMAL_X[layer1 + 1]));
+
+    // the 52 point bits as the mantissa of a float in [1, 2), less 1, is the same [0, 1) point
+    // as the scalar conversion, without converting 64-bit integers one lane at a time
+    const point: v128 = f64x2.sub(v128.or(i64x2.shr_u(next, 12), EXPONENT_ONEx2), ONEx2);
+    const z: v128 = f64x2.mul(point, width);
+    const signed: v128 = v128.or(z, i64x2.shl(v128.and(next, SIGN_BITx2), 60));
+
+    return v128.bitselect(signed, NANx2, f64x2.lt(z, inner));
+}
+
+/**
+ * Tests whether either lane of a {@link normalFastx2} result must be finished
+ * with the generator's own wedge and tail loop.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normalRejectx2(z: v128): bool {
+    return v128.any_true(f64x2.ne(z, z));
+}
+
+/**
+ * Gets the radii sqrt(-2 ln(`u`)) of 2 Box-Muller pairs, from 2 uniform numbers in (0, 1).
+ * Each pair's normal numbers are its radius times the cosine and sine of a uniform angle.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function boxMullerRadiusx2(u: v128): v128 {
+    return f64x2.sqrt(f64x2.mul(MINUS_TWOx2, logx2(u)));
+}
+
+/**
+ * Gets the angles 2π`u` of 2 Box-Muller pairs, from 2 uniform numbers in (0, 1).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function boxMullerAnglex2(u: v128): v128 {
+    return f64x2.mul(u, TWO_PIx2);
+}
@@ -0,0 +1,108 @@
+/**
+ * Helpers for normally distributed output, using Marsaglia and Tsang's ziggurat method.
+ *
+ * The area under the normal density is covered by 256 horizontal layers of equal area:
+ * 255 rectangles, and a base layer that also holds the infinite tail. Each random 64-bit
+ * value picks a layer and a point across its width. About 98.5% of points fall inside the
+ * part of a layer that's entirely under the curve, and are accepted with a single multiply
+ * and compare. The rest, in a layer's wedge or the tail, need the density or a logarithm:
+ * each generator draws those with its own {@link normalWedge} and {@link normalTail} loop.
+ *
+ * A value's 8 layer bits (bits 4-11) and sign bit (bit 3) are kept apart from its 52 point
+ * bits (bits 12-63), skipping the lowest bits, which are the weakest bits of the + scramblers.
+ * @packageDocumentation
+ */
+
+/*
+* Based on "The Ziggurat Method for Generating Random Variables"
+* George Marsaglia and Wai Wan Tsang, Journal of Statistical Software, 2000
+* https://www.jstatsoft.org/article/view/v005i08
+*/
+
+import { BIT_53 } from './conversion';
+import { NORMAL_R, NORMAL_X, NORMAL_Y } from './ziggurat-tables';
+
+// 2^-52, to scale 52 random bits into range [0, 1)
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const BIT_52_INV: f64 = 2.220446049250313e-16;
+
+/**
+ * Gets the ziggurat layer (0 to 255) selected by a random 64-bit value.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normalLayer(next: u64): i32 {
+    return <i32>((next >>> 4) & 0xFF);
+}
+
+/**
+ * Gets the distance from 0 of the point a random 64-bit value selects across its layer.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normalMagnitude(next: u64, layer: i32): f64 {
+    return <f64>(next >>> 12) * BIT_52_INV * unchecked(NORMAL_X[layer]);
+}
+
+/**
+ * Tests whether a point at distance `z` from 0 is inside the part of `layer` that's
+ * entirely under the curve, where it can be accepted without evaluating the density.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normalInside(z: f64, layer: i32): bool {
+    return z < unchecked(NORMAL_X[layer + 1]);
+}
+
+/**
+ * Applies a random 64-bit value's sign bit to distance `z`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normalSign(next: u64, z: f64): f64 {
+    return reinterpret<f64>(reinterpret<u64>(z) | ((next & 8) << 60));
+}
+
+/**
+ * Derives a standard normal number from a random 64-bit value, when its point is inside
+ * its layer: the fast path, taken about 98.5% of the time.
+ *
+ * @returns A standard normal number, or `NaN` if the value must be finished
+ * with the generator's own wedge and tail loop.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normalFast(next: u64): f64 {
+    const layer: i32 = normalLayer(next);
+    const z: f64 = normalMagnitude(next, layer);
+    return normalInside(z, layer) ? normalSign(next, z) : NaN;
+}
+
+/**
+ * Tests whether a point at distance `z` in `layer`'s wedge (outside {@link normalInside})
+ * is under the curve, given a random 64-bit value for its height within the layer.
+ * Not used for the base layer (0), whose points past its rectangle are in the tail.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normalWedge(z: f64, layer: i32, next: u64): bool {
+    const y0: f64 = unchecked(NORMAL_Y[layer]);
+    const height: f64 = <f64>(next >>> 11) / BIT_53;
+    return y0 + height * (unchecked(NORMAL_Y[layer + 1]) - y0) < Math.exp(-0.5 * z * z);
+}
+
+/**
+ * Draws a candidate distance from 0 in the tail past the base layer's rectangle,
+ * given 2 random 64-bit values, using Marsaglia's exponential rejection method.
+ *
+ * @returns A distance beyond {@link NORMAL_R}, or `NaN` if rejected.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normalTail(next1: u64, next2: u64): f64 {
+    // uniform in (0, 1], so the logarithms are finite
+    const a: f64 = -Math.log(<f64>((next1 >>> 11) + 1) / BIT_53) / NORMAL_R;
+    const b: f64 = -Math.log(<f64>((next2 >>> 11) + 1) / BIT_53);
+    return b + b > a * a ? NORMAL_R + a : NaN;
+}
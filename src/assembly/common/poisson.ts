@@ -0,0 +1,150 @@
+/**
+ * Helpers for Poisson distributed output, choosing an algorithm by the mean λ.
+ *
+ * Below a λ of 10, numbers are drawn by inversion: a single uniform number is walked up
+ * through the probabilities of 0, 1, 2... events until it's used up, which takes about
+ * λ + 1 steps. From 10 up, that would be too slow, so Hörmann's transformed rejection
+ * with squeeze (PTRS) maps 2 uniform numbers to a candidate count instead. A cheap test
+ * accepts about a third of candidates at λ = 10, rising to three quarters for large λ,
+ * and the rest are tested against the density with a log-gamma.
+ *
+ * Parameters that depend only on λ are kept from one call to the next, so repeated
+ * calls with the same λ (e.g. one per agent in a simulation) only set up once.
+ * @packageDocumentation
+ */
+
+/*
+* Based on "The Transformed Rejection Method for Generating Poisson Random Variables"
+* Wolfgang Hörmann, Insurance: Mathematics and Economics, 1993
+* https://doi.org/10.1016/0167-6687(93)90997-4
+*/
+
+// λs below this are drawn by inversion
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const INVERSION_MAX: f64 = 10.0;
+
+// log(2π)
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const LOG_2PI: f64 = 1.8378770664093453;
+
+// Stirling series coefficients for log(Γ(x)), from the 1/x term up
+const STIRLING: StaticArray<f64> = [
+    8.333333333333333e-02, -2.777777777777778e-03,
+    7.936507936507937e-04, -5.952380952380952e-04,
+    8.417508417508418e-04, -1.917526917526918e-03,
+    6.410256410256410e-03, -2.955065359477124e-02,
+    1.796443723688307e-01, -1.39243221690590e+00
+];
+
+// λ that the parameters below were set up for
+let lambda: f64 = NaN;
+
+// inversion: e^-λ, and the count past which a rounded-off search starts over
+let expNegLambda: f64 = 0.0;
+let inversionBound: f64 = 0.0;
+
+// transformed rejection
+let logLambda: f64 = 0.0;
+let ptrsA: f64 = 0.0;
+let ptrsB: f64 = 0.0;
+let ptrsLogInvAlpha: f64 = 0.0;
+let ptrsVr: f64 = 0.0;
+
+/**
+ * Computes log(Γ(`x`)) for `x` of at least 1, e.g. log(`k`!) as log(Γ(`k` + 1)).
+ */
+export function logGamma(x: f64): f64 {
+    if (x == 1.0 || x == 2.0) return 0.0;
+
+    // the series converges quickly from 7 up, so smaller `x` are shifted up and back
+    const shift: f64 = x < 7.0 ? Math.floor(7.0 - x) : 0.0;
+    let x0: f64 = x + shift;
+    const x2: f64 = 1.0 / (x0 * x0);
+
+    let series: f64 = unchecked(STIRLING[9]);
+    for (let i: i32 = 8; i >= 0; i--) {
+        series = series * x2 + unchecked(STIRLING[i]);
+    }
+    let result: f64 = series / x0 + 0.5 * LOG_2PI + (x0 - 0.5) * Math.log(x0) - x0;
+
+    for (let i: f64 = 0; i < shift; i++) {
+        x0 -= 1.0;
+        result -= Math.log(x0);
+    }
+    return result;
+}
+
+/**
+ * Sets up the parameters for Poisson numbers with mean `mean`, unless they're already set up.
+ */
+export function poissonSetup(mean: f64): void {
+    if (mean == lambda) return;
+    lambda = mean;
+
+    if (mean < INVERSION_MAX) {
+        expNegLambda = Math.exp(-mean);
+        inversionBound = mean + 10.0 * Math.sqrt(mean + 1.0);
+    } else {
+        ptrsB = 0.931 + 2.53 * Math.sqrt(mean);
+        ptrsA = -0.059 + 0.02483 * ptrsB;
+        ptrsLogInvAlpha = Math.log(1.1239 + 1.1328 / (ptrsB - 3.4));
+        ptrsVr = 0.9277 - 3.6224 / (ptrsB - 2.0);
+        logLambda = Math.log(mean);
+    }
+}
+
+/**
+ * Tests whether the set up λ is small enough to be drawn by {@link poissonInversion},
+ * rather than {@link poissonTransformedRejection}.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function poissonInverts(): bool {
+    return lambda < INVERSION_MAX;
+}
+
+/**
+ * Draws a Poisson number for the set up λ by inversion, given a uniform number in range [0, 1).
+ *
+ * @returns The number of events, or `NaN` in the vanishingly rare case that rounding
+ * leaves the uniform number unused well past every likely count, to be redrawn.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function poissonInversion(u: f64): f64 {
+    let k: f64 = 0.0;
+    let p: f64 = expNegLambda;
+
+    while (u > p) {
+        u -= p;
+        k += 1.0;
+        if (k > inversionBound) return NaN;
+        p *= lambda / k;
+    }
+
+    return k;
+}
+
+/**
+ * Draws a candidate Poisson number for the set up λ by transformed rejection,
+ * given 2 uniform numbers in range [0, 1).
+ *
+ * @returns The number of events, or `NaN` if the candidate is rejected.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function poissonTransformedRejection(u: f64, v: f64): f64 {
+    const x: f64 = u - 0.5;
+    const us: f64 = 0.5 - Math.abs(x);
+    const k: f64 = Math.floor((2.0 * ptrsA / us + ptrsB) * x + lambda + 0.43);
+
+    // the squeeze: accepted without evaluating the density
+    if (us >= 0.07 && v <= ptrsVr) return k;
+    if (k < 0.0 || (us < 0.013 && v > us)) return NaN;
+
+    const accept: bool = Math.log(v) + ptrsLogInvAlpha - Math.log(ptrsA / (us * us) + ptrsB)
+        <= k * logLambda - lambda - logGamma(k + 1.0);
+    return accept ? k : NaN;
+}
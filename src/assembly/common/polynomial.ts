@@ -0,0 +1,105 @@
+/**
+ * Polynomial arithmetic over GF(2), used to compute arbitrary jump polynomials
+ * for the xoshiro / xoroshiro family of generators.
+ *
+ * These generators are linear engines: each step multiplies the state by a fixed
+ * matrix T over GF(2). Jumping ahead by n steps is equivalent to applying T^n, and
+ * by the Cayley-Hamilton theorem T^n can be expressed as q(T), where
+ * q(x) = x^n mod P(x) and P(x) is the characteristic polynomial of T.
+ *
+ * The reference `JUMP` constants are exactly such polynomials (for n = 2^64, 2^128),
+ * so raising them to a power k (mod P) gives the polynomial for k jumps, which is
+ * then applied to the state with the same loop as the reference jump function.
+ *
+ * Polynomials are stored as arrays of `u64` words, lowest degree coefficients first:
+ * bit `b` of word `w` is the coefficient of x^(64w + b). Characteristic polynomials
+ * omit their leading (monic) term, so a degree 128 polynomial occupies 2 words.
+ * @packageDocumentation
+ */
+
+// Largest supported polynomial size (in 64-bit words), for 256 bits of state
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const MAX_WORDS: i32 = 4;
+
+// Scratch space: allocated once, since the stub runtime can't free memory
+const product = new StaticArray<u64>(MAX_WORDS);
+const square = new StaticArray<u64>(MAX_WORDS);
+
+/**
+ * Computes `(a * b) mod charPoly` and writes it into `out`.
+ *
+ * `out` may be the same array as `a` or `b`.
+ */
+function polyMulMod(
+    a: StaticArray<u64>,
+    b: StaticArray<u64>,
+    charPoly: StaticArray<u64>,
+    out: StaticArray<u64>
+): void {
+    const words: i32 = charPoly.length;
+
+    for (let w: i32 = 0; w < words; w++) {
+        unchecked(product[w] = 0);
+    }
+
+    // Horner's rule over the coefficients of b, highest degree first:
+    // product = product * x + b[i] * a
+    for (let i: i32 = (words << 6) - 1; i >= 0; i--) {
+        // Multiply by x, reducing by charPoly if the x^degree term gets shifted out
+        const reduce: u64 = <u64>0 - (unchecked(product[words - 1]) >>> 63);
+        for (let w: i32 = words - 1; w > 0; w--) {
+            unchecked(product[w] = (product[w] << 1) | (product[w - 1] >>> 63));
+        }
+        unchecked(product[0] = product[0] << 1);
+
+        // Add a if the current coefficient of b is set (addition is XOR in GF(2))
+        const add: u64 = <u64>0 - ((unchecked(b[i >>> 6]) >>> (<u64>i & 63)) & 1);
+
+        for (let w: i32 = 0; w < words; w++) {
+            unchecked(product[w] ^= (charPoly[w] & reduce) ^ (a[w] & add));
+        }
+    }
+
+    for (let w: i32 = 0; w < words; w++) {
+        unchecked(out[w] = product[w]);
+    }
+}
+
+/**
+ * Computes `base^exponent mod charPoly` using square-and-multiply, and writes it into `out`.
+ *
+ * Requires O(log exponent) polynomial multiplications.
+ *
+ * @param base A polynomial already reduced mod `charPoly` (e.g. a reference jump polynomial).
+ * @param exponent The power to raise `base` to.
+ * @param charPoly The generator's characteristic polynomial, without its leading term.
+ * @param out Receives the result. Must hold at least `charPoly.length` words.
+ */
+export function polyPowMod(
+    base: StaticArray<u64>,
+    exponent: u64,
+    charPoly: StaticArray<u64>,
+    out: StaticArray<u64>
+): void {
+    const words: i32 = charPoly.length;
+
+    // out = 1, square = base
+    for (let w: i32 = 0; w < words; w++) {
+        unchecked(out[w] = 0);
+        unchecked(square[w] = base[w]);
+    }
+    unchecked(out[0] = 1);
+
+    while (exponent != 0) {
+        if ((exponent & 1) != 0) {
+            polyMulMod(out, square, charPoly, out);
+        }
+
+        exponent >>>= 1;
+
+        if (exponent != 0) {
+            polyMulMod(square, square, charPoly, square);
+        }
+    }
+}
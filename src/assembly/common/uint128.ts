@@ -0,0 +1,32 @@
+/**
+ * 128-bit integer helpers, for generators and distributions that need wider
+ * arithmetic than WebAssembly's native 64-bit integers provide.
+ *
+ * 128-bit values are handled as pairs of `u64` words (high, low).
+ * @packageDocumentation
+ */
+
+/**
+ * Computes the high 64 bits of the full 128-bit product of two `u64`s.
+ * (The low 64 bits are simply `a * b`.)
+ *
+ * WebAssembly has no widening 64-bit multiply, so this combines four
+ * 32 x 32 -> 64-bit partial products.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function mulHigh64(a: u64, b: u64): u64 {
+    const aLo: u64 = a & 0xFFFFFFFF;
+    const aHi: u64 = a >>> 32;
+    const bLo: u64 = b & 0xFFFFFFFF;
+    const bHi: u64 = b >>> 32;
+
+    const lolo: u64 = aLo * bLo;
+    const lohi: u64 = aLo * bHi;
+    const hilo: u64 = aHi * bLo;
+
+    // sum of the partial products' middle 32-bit columns, whose carry reaches the high word
+    const middle: u64 = (lolo >>> 32) + (lohi & 0xFFFFFFFF) + (hilo & 0xFFFFFFFF);
+
+    return aHi * bHi + (lohi >>> 32) + (hilo >>> 32) + (middle >>> 32);
+}
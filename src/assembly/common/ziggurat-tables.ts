@@ -0,0 +1,1090 @@
+/**
+ * Ziggurat tables for the normal and exponential distributions, generated by
+ * util/gen-ziggurat-tables.mjs. Do not edit by hand.
+ * @packageDocumentation
+ */
+
+/** Number of layers in every ziggurat. */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const ZIGGURAT_LAYERS: i32 = 256;
+
+// 256-layer ziggurat for the standard normal distribution
+
+/** Right edge of the base layer's rectangle, where the tail begins. */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const NORMAL_R: f64 = 3.6541528853610075;
+
+/** Area of every layer, including the base layer's tail. */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const NORMAL_V: f64 = 0.0049286732339746528;
+
+/**
+ * Width of each layer's rectangle, from the base layer (index 0) up to the
+ * topmost layer (index 255), followed by 0 at the peak.
+ */
+export const NORMAL_X: StaticArray<f64> = [
+    3.9107579595248958,
+    3.6541528853610075,
+    3.4492782985614308,
+    3.3202447338398251,
+    3.2245750520478014,
+    3.1478892895180004,
+    3.0835261320021430,
+    3.0278377917695933,
+    2.9786032798818431,
+    2.9343668672088876,
+    2.8941210536134121,
+    2.8571387308732246,
+    2.8228773968264429,
+    2.7909211740019275,
+    2.7609440052799865,
+    2.7326853590440114,
+    2.7059336561230620,
+    2.6805146432857447,
+    2.6562830375767428,
+    2.6331163936315822,
+    2.6109105184888231,
+    2.5895759867082861,
+    2.5690354526818435,
+    2.5492215503247828,
+    2.5300752321598541,
+    2.5115444416266941,
+    2.4935830412710467,
+    2.4761499396705231,
+    2.4592083743347048,
+    2.4427253182003641,
+    2.4266709849371466,
+    2.4110184139011195,
+    2.3957431197819274,
+    2.3808227951720857,
+    2.3662370567172908,
+    2.3519672273791445,
+    2.3379961487965284,
+    2.3243080188711325,
+    2.3108882506013719,
+    2.2977233489028634,
+    2.2848008027244919,
+    2.2721089902283818,
+    2.2596370951737876,
+    2.2473750329473892,
+    2.2353133849299209,
+    2.2234433400925102,
+    2.2117566428841604,
+    2.2002455466112760,
+    2.1889027716263603,
+    2.1777214677402923,
+    2.1666951803543077,
+    2.1558178198767366,
+    2.1450836340478880,
+    2.1344871828460161,
+    2.1240233156895227,
+    2.1136871506866526,
+    2.1034740557148766,
+    2.0933796311387911,
+    2.0833996939983037,
+    2.0735302635187423,
+    2.0637675478117314,
+    2.0541079316506514,
+    2.0445479652175309,
+    2.0350843537296184,
+    2.0257139478638537,
+    2.0164337349062036,
+    2.0072408305605283,
+    1.9981324713584190,
+    1.9891060076174376,
+    1.9801588969004760,
+    1.9712886979336588,
+    1.9624930649443624,
+    1.9537697423846461,
+    1.9451165600086775,
+    1.9365314282756938,
+    1.9280123340526649,
+    1.9195573365931873,
+    1.9111645637712527,
+    1.9028322085504286,
+    1.8945585256707040,
+    1.8863418285367821,
+    1.8781804862929952,
+    1.8700729210712661,
+    1.8620176053996733,
+    1.8540130597602011,
+    1.8460578502851848,
+    1.8381505865828058,
+    1.8302899196827560,
+    1.8224745400938849,
+    1.8147031759662817,
+    1.8069745913508199,
+    1.7992875845497194,
+    1.7916409865521616,
+    1.7840336595494406,
+    1.7764644955245219,
+    1.7689324149112675,
+    1.7614363653189093,
+    1.7539753203176707,
+    1.7465482782817217,
+    1.7391542612859108,
+    1.7317923140529623,
+    1.7244615029480441,
+    1.7171609150178224,
+    1.7098896570713011,
+    1.7026468547999225,
+    1.6954316519345609,
+    1.6882432094371949,
+    1.6810807047251735,
+    1.6739433309261247,
+    1.6668302961616650,
+    1.6597408228581820,
+    1.6526741470830553,
+    1.6456295179047817,
+    1.6386061967755470,
+    1.6316034569348727,
+    1.6246205828330340,
+    1.6176568695730149,
+    1.6107116223698297,
+    1.6037841560260941,
+    1.5968737944227878,
+    1.5899798700241905,
+    1.5831017233960292,
+    1.5762387027359062,
+    1.5693901634151235,
+    1.5625554675310447,
+    1.5557339834691761,
+    1.5489250854741734,
+    1.5421281532290019,
+    1.5353425714415141,
+    1.5285677294377122,
+    1.5218030207609978,
+    1.5150478427767144,
+    1.5083015962813113,
+    1.5015636851154637,
+    1.4948335157804935,
+    1.4881104970574475,
+    1.4813940396281875,
+    1.4746835556978555,
+    1.4679784586180797,
+    1.4612781625102758,
+    1.4545820818884105,
+    1.4478896312805765,
+    1.4412002248487243,
+    1.4345132760058925,
+    1.4278281970302564,
+    1.4211443986753096,
+    1.4144612897754718,
+    1.4077782768463996,
+    1.4010947636792515,
+    1.3944101509281415,
+    1.3877238356899766,
+    1.3810352110758559,
+    1.3743436657731667,
+    1.3676485835974765,
+    1.3609493430332833,
+    1.3542453167626354,
+    1.3475358711805876,
+    1.3408203658964044,
+    1.3340981532193603,
+    1.3273685776279260,
+    1.3206309752210565,
+    1.3138846731502207,
+    1.3071289890307312,
+    1.3003632303308372,
+    1.2935866937369478,
+    1.2867986644932436,
+    1.2799984157138180,
+    1.2731852076653565,
+    1.2663582870182295,
+    1.2595168860637143,
+    1.2526602218948972,
+    1.2457874955486272,
+    1.2388978911056872,
+    1.2319905747461359,
+    1.2250646937565306,
+    1.2181193754854813,
+    1.2111537262436989,
+    1.2041668301443811,
+    1.1971577478794411,
+    1.1901255154266916,
+    1.1830691426826865,
+    1.1759876120154518,
+    1.1688798767308330,
+    1.1617448594456115,
+    1.1545814503599279,
+    1.1473885054208490,
+    1.1401648443681511,
+    1.1329092486525338,
+    1.1256204592155334,
+    1.1182971741193453,
+    1.1109380460135758,
+    1.1035416794246400,
+    1.0961066278520217,
+    1.0886313906539802,
+    1.0811144097034042,
+    1.0735540657924365,
+    1.0659486747621230,
+    1.0582964833306754,
+    1.0505956645909302,
+    1.0428443131441494,
+    1.0350404398334412,
+    1.0271819660356460,
+    1.0192667174654846,
+    1.0112924174399962,
+    1.0032566795446736,
+    0.99515699963509163,
+    0.98699074709906309,
+    0.97875515529422530,
+    0.97044731106422510,
+    0.96206414322304112,
+    0.95360240988108669,
+    0.94505868446816610,
+    0.93642934028657587,
+    0.92771053340200083,
+    0.91889818364959130,
+    0.90998795349671913,
+    0.90097522446122225,
+    0.89185507073294212,
+    0.88262222958516623,
+    0.87327106808886135,
+    0.86379554555330951,
+    0.85418917100816449,
+    0.84444495490915461,
+    0.83455535408638282,
+    0.82451220875229281,
+    0.81430667013521585,
+    0.80392911698997160,
+    0.79336905884062381,
+    0.78261502330723354,
+    0.77165442422456842,
+    0.76047340643010852,
+    0.74905666201781562,
+    0.73738721143429597,
+    0.72544614091000004,
+    0.71321228519097635,
+    0.70066184110681551,
+    0.68776789279578898,
+    0.67449982283729437,
+    0.66082257424442037,
+    0.64669571489499433,
+    0.63207223638606180,
+    0.61689699000775222,
+    0.60110461775599333,
+    0.58461676610638014,
+    0.56733825705381957,
+    0.54915170232716592,
+    0.52990972066155906,
+    0.50942332960209280,
+    0.48744396613923707,
+    0.46363433679088339,
+    0.43751840220787303,
+    0.40838913461199267,
+    0.37512133287838234,
+    0.33573751921442752,
+    0.28617459179207555,
+    0.21524189598488636,
+    0.0
+];
+
+/**
+ * Unnormalized density exp(-x^2 / 2) at each of the {@link NORMAL_X} widths,
+ * the lower edge of each layer, followed by 1 at the peak.
+ */
+export const NORMAL_Y: StaticArray<f64> = [
+    0.00047746776460942523,
+    0.0012602859304986034,
+    0.0026090727461021684,
+    0.0040379725933630374,
+    0.0055224032992510011,
+    0.0070508754713732354,
+    0.0086165827693987420,
+    0.010214971439701478,
+    0.011842757857907889,
+    0.013497450601739878,
+    0.015177088307935337,
+    0.016880083152543170,
+    0.018605121275724647,
+    0.020351096230044510,
+    0.022117062707308850,
+    0.023902203305795879,
+    0.025705804008548910,
+    0.027527235669603113,
+    0.029365939758133359,
+    0.031221417191920300,
+    0.033093219458578578,
+    0.034980941461716125,
+    0.036884215688567305,
+    0.038802707404526147,
+    0.040736110655940939,
+    0.042684144916474459,
+    0.044646552251294463,
+    0.046623094901930381,
+    0.048613553215868549,
+    0.050617723860947782,
+    0.052635418276792190,
+    0.054666461324888921,
+    0.056710690106202902,
+    0.058767952920933737,
+    0.060838108349539885,
+    0.062921024437758141,
+    0.065016577971242884,
+    0.067124653827788497,
+    0.069245144397006755,
+    0.071377949058890403,
+    0.073522973713981310,
+    0.075680130358927108,
+    0.077849336702096053,
+    0.080030515814663084,
+    0.082223595813202904,
+    0.084428509570353472,
+    0.086645194450558072,
+    0.088873592068275886,
+    0.091113648066373759,
+    0.093365311912691012,
+    0.095628536713008999,
+    0.097903279038862465,
+    0.10018949876881002,
+    0.10248715894193525,
+    0.10479622562248705,
+    0.10711666777468380,
+    0.10944845714681181,
+    0.11179156816383819,
+    0.11414597782783859,
+    0.11651166562561098,
+    0.11888861344291017,
+    0.12127680548479042,
+    0.12367622820159668,
+    0.12608687022018600,
+    0.12850872227999968,
+    0.13094177717364447,
+    0.13338602969166929,
+    0.13584147657125392,
+    0.13830811644855087,
+    0.14078594981444487,
+    0.14327497897351360,
+    0.14577520800599425,
+    0.14828664273257475,
+    0.15080929068184593,
+    0.15334316106026311,
+    0.15588826472447948,
+    0.15844461415592456,
+    0.16101222343751131,
+    0.16359110823236594,
+    0.16618128576448229,
+    0.16878277480121173,
+    0.17139559563750617,
+    0.17401977008183897,
+    0.17665532144373527,
+    0.17930227452284792,
+    0.18196065559952285,
+    0.18463049242679958,
+    0.18731181422380061,
+    0.19000465167046532,
+    0.19270903690358948,
+    0.19542500351413461,
+    0.19815258654577544,
+    0.20089182249465690,
+    0.20364274931033521,
+    0.20640540639788113,
+    0.20917983462112541,
+    0.21196607630703052,
+    0.21476417525117392,
+    0.21757417672433146,
+    0.22039612748015233,
+    0.22323007576391782,
+    0.22607607132238053,
+    0.22893416541468053,
+    0.23180441082433889,
+    0.23468686187233018,
+    0.23758157443123826,
+    0.24048860594050062,
+    0.24340801542275031,
+    0.24633986350126383,
+    0.24928421241852852,
+    0.25224112605594218,
+    0.25521066995466196,
+    0.25819291133761924,
+    0.26118791913272121,
+    0.26419576399726119,
+    0.26721651834356147,
+    0.27025025636587546,
+    0.27329705406857707,
+    0.27635698929566832,
+    0.27943014176163794,
+    0.28251659308370758,
+    0.28561642681550165,
+    0.28872972848218281,
+    0.29185658561709510,
+    0.29499708779996175,
+    0.29815132669668543,
+    0.30131939610080294,
+    0.30450139197664994,
+    0.30769741250429200,
+    0.31090755812628645,
+    0.31413193159633718,
+    0.31737063802991361,
+    0.32062378495690536,
+    0.32389148237639109,
+    0.32717384281360140,
+    0.33047098137916348,
+    0.33378301583071823,
+    0.33711006663700593,
+    0.34045225704452164,
+    0.34380971314685049,
+    0.34718256395679337,
+    0.35057094148140577,
+    0.35397498080007644,
+    0.35739482014578011,
+    0.36083060098964759,
+    0.36428246812900344,
+    0.36775056977903198,
+    0.37123505766823894,
+    0.37473608713789064,
+    0.37825381724561874,
+    0.38178841087339316,
+    0.38534003484007684,
+    0.38890886001878838,
+    0.39249506145931523,
+    0.39609881851583206,
+    0.39972031498019689,
+    0.40335973922111412,
+    0.40701728432947304,
+    0.41069314827018794,
+    0.41438753404089085,
+    0.41810064983784789,
+    0.42183270922949567,
+    0.42558393133802180,
+    0.42935454102944132,
+    0.43314476911265209,
+    0.43695485254798538,
+    0.44078503466580377,
+    0.44463556539573912,
+    0.44850670150720279,
+    0.45239870686184830,
+    0.45631185267871621,
+    0.46024641781284259,
+    0.46420268904817413,
+    0.46818096140569332,
+    0.47218153846772998,
+    0.47620473271950575,
+    0.48025086590904664,
+    0.48432026942668321,
+    0.48841328470545792,
+    0.49253026364386843,
+    0.49667156905248960,
+    0.50083757512614857,
+    0.50502866794346790,
+    0.50924524599574761,
+    0.51348772074732651,
+    0.51775651722975602,
+    0.52205207467232151,
+    0.52637484717168403,
+    0.53072530440366150,
+    0.53510393238045706,
+    0.53951123425695158,
+    0.54394773119002571,
+    0.54841396325526526,
+    0.55291049042583174,
+    0.55743789361876539,
+    0.56199677581452379,
+    0.56658776325616378,
+    0.57121150673525256,
+    0.57586868297235305,
+    0.58055999610079023,
+    0.58528617926337079,
+    0.59004799633282534,
+    0.59484624376798678,
+    0.59968175261912460,
+    0.60455539069746711,
+    0.60946806492577277,
+    0.61442072388891322,
+    0.61941436060583366,
+    0.62445001554702584,
+    0.62952877992483602,
+    0.63465179928762294,
+    0.63982027745305592,
+    0.64503548082082163,
+    0.65029874311081604,
+    0.65561147057969660,
+    0.66097514777666255,
+    0.66639134390874954,
+    0.67186171989708143,
+    0.67738803621877275,
+    0.68297216164499408,
+    0.68861608300467103,
+    0.69432191612611593,
+    0.70009191813651084,
+    0.70592850133275353,
+    0.71183424887824764,
+    0.71781193263072129,
+    0.72386453346862956,
+    0.72999526456147557,
+    0.73620759812686210,
+    0.74250529634015050,
+    0.74889244721915627,
+    0.75537350650709556,
+    0.76195334683679472,
+    0.76863731579848560,
+    0.77543130498118651,
+    0.78234183265480184,
+    0.78937614356602392,
+    0.79654233042295830,
+    0.80384948317096361,
+    0.81130787431265561,
+    0.81892919160370170,
+    0.82672683394622071,
+    0.83471629298688277,
+    0.84291565311220351,
+    0.85134625845867729,
+    0.86003362119633087,
+    0.86900868803685627,
+    0.87830965580891662,
+    0.88798466075583260,
+    0.89809592189834264,
+    0.90872644005212999,
+    0.91999150503934612,
+    0.93206007595922957,
+    0.94519895344229865,
+    0.95987909180010555,
+    0.97710170126767026,
+    1.0
+];
+
+// 256-layer ziggurat for the exponential distribution with rate 1
+
+/** Right edge of the base layer's rectangle, where the tail begins. */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const EXPONENTIAL_R: f64 = 7.6971174701310510;
+
+/** Area of every layer, including the base layer's tail. */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const EXPONENTIAL_V: f64 = 0.0039496598225815527;
+
+/**
+ * Width of each layer's rectangle, from the base layer (index 0) up to the
+ * topmost layer (index 255), followed by 0 at the peak.
+ */
+export const EXPONENTIAL_X: StaticArray<f64> = [
+    8.6971174701310510,
+    7.6971174701310510,
+    6.9410336293772135,
+    6.4783784938325715,
+    6.1441646657724744,
+    5.8821443157954008,
+    5.6664101674540346,
+    5.4828906275260643,
+    5.3230905057543998,
+    5.1814872813015018,
+    5.0542884899813059,
+    4.9387770859012523,
+    4.8329397410251138,
+    4.7352429966017429,
+    4.6444918854200870,
+    4.5597370617073532,
+    4.4802117465284237,
+    4.4052876934735741,
+    4.3344436803172739,
+    4.2672424802773667,
+    4.2033137137351853,
+    4.1423408656640524,
+    4.0840513104082987,
+    4.0282085446479377,
+    3.9746060666737897,
+    3.9230625001354911,
+    3.8734176703995105,
+    3.8255294185223381,
+    3.7792709924116692,
+    3.7345288940397987,
+    3.6912010902374202,
+    3.6491955157608551,
+    3.6084288131289108,
+    3.5688252656483388,
+    3.5303158891293451,
+    3.4928376547740614,
+    3.4563328211327620,
+    3.4207483572511217,
+    3.3860354424603032,
+    3.3521490309001116,
+    3.3190474709707503,
+    3.2866921715990705,
+    3.2550473085704517,
+    3.2240795652862659,
+    3.1937579032122425,
+    3.1640533580259751,
+    3.1349388580844422,
+    3.1063890623398258,
+    3.0783802152540920,
+    3.0508900166154569,
+    3.0238975044556784,
+    2.9973829495161324,
+    2.9713277599210914,
+    2.9457143948950475,
+    2.9205262865127426,
+    2.8957477686001436,
+    2.8713640120155381,
+    2.8473609656351906,
+    2.8237253024500375,
+    2.8004443702507400,
+    2.7775061464397588,
+    2.7548991965623473,
+    2.7326126361947027,
+    2.7106360958679314,
+    2.6889596887418059,
+    2.6675739807732688,
+    2.6464699631518114,
+    2.6256390267977907,
+    2.6050729387408378,
+    2.5847638202141430,
+    2.5647041263169075,
+    2.5448866271118722,
+    2.5253043900378302,
+    2.5059507635285962,
+    2.4868193617402121,
+    2.4679040502973675,
+    2.4491989329782524,
+    2.4306983392644224,
+    2.4123968126888733,
+    2.3942890999214610,
+    2.3763701405361433,
+    2.3586350574093400,
+    2.3410791477030375,
+    2.3236978743901990,
+    2.3064868582835825,
+    2.2894418705322721,
+    2.2725588255531575,
+    2.2558337743672219,
+    2.2392628983129117,
+    2.2228425031110395,
+    2.2065690132576665,
+    2.1904389667232227,
+    2.1744490099377773,
+    2.1585958930438887,
+    2.1428764653998447,
+    2.1272876713173710,
+    2.1118265460190448,
+    2.0964902118017177,
+    2.0812758743932278,
+    2.0661808194905786,
+    2.0512024094685883,
+    2.0363380802487732,
+    2.0215853383189297,
+    2.0069417578945217,
+    1.9924049782135798,
+    1.9779727009573635,
+    1.9636426877895512,
+    1.9494127580071876,
+    1.9352807862970542,
+    1.9212447005915307,
+    1.9073024800183902,
+    1.8934521529393107,
+    1.8796917950722138,
+    1.8660195276928306,
+    1.8524335159111782,
+    1.8389319670188824,
+    1.8255131289035222,
+    1.8121752885263931,
+    1.7989167704602935,
+    1.7857359354841287,
+    1.7726311792313083,
+    1.7596009308890774,
+    1.7466436519460771,
+    1.7337578349855745,
+    1.7209420025219382,
+    1.7081947058780607,
+    1.6955145241015410,
+    1.6829000629175570,
+    1.6703499537164552,
+    1.6578628525741759,
+    1.6454374393037268,
+    1.6330724165359947,
+    1.6207665088282612,
+    1.6085184617988615,
+    1.5963270412864865,
+    1.5841910325326920,
+    1.5721092393862328,
+    1.5600804835278912,
+    1.5481036037145166,
+    1.5361774550410352,
+    1.5243009082192294,
+    1.5124728488721200,
+    1.5006921768428196,
+    1.4889578055167487,
+    1.4772686611561365,
+    1.4656236822457480,
+    1.4540218188487961,
+    1.4424620319720152,
+    1.4309432929388823,
+    1.4194645827699859,
+    1.4080248915695384,
+    1.3966232179170446,
+    1.3852585682631247,
+    1.3739299563284932,
+    1.3626364025050894,
+    1.3513769332583379,
+    1.3401505805295075,
+    1.3289563811371192,
+    1.3177933761763276,
+    1.3066606104151768,
+    1.2955571316866037,
+    1.2844819902750155,
+    1.2734342382962440,
+    1.2624129290696182,
+    1.2514171164808552,
+    1.2404458543344090,
+    1.2294981956938518,
+    1.2185731922087930,
+    1.2076698934267640,
+    1.1967873460884060,
+    1.1859245934042053,
+    1.1750806743109148,
+    1.1642546227056823,
+    1.1534454666557781,
+    1.1426522275816762,
+    1.1318739194110821,
+    1.1211095477013340,
+    1.1103581087274146,
+    1.0996185885326009,
+    1.0888899619385504,
+    1.0781711915113756,
+    1.0674612264799710,
+    1.0567590016025548,
+    1.0460634359770475,
+    1.0353734317905319,
+    1.0246878730026208,
+    1.0140056239571000,
+    1.0033255279157003,
+    0.99264640550727923,
+    0.98196705308506582,
+    0.97128624098390670,
+    0.96060271166866984,
+    0.94991517776407941,
+    0.93922231995526584,
+    0.92852278474721395,
+    0.91781518207004775,
+    0.90709808271569381,
+    0.89637001558989338,
+    0.88562946476175497,
+    0.87487486629102862,
+    0.86410460481100804,
+    0.85331700984237679,
+    0.84251035181037215,
+    0.83168283773427676,
+    0.82083260655441537,
+    0.80995772405742195,
+    0.79905617735549084,
+    0.78812586886949620,
+    0.77716460975913348,
+    0.76617011273543845,
+    0.75513998418198591,
+    0.74407171550051177,
+    0.73296267358436906,
+    0.72181009030875987,
+    0.71061105090965881,
+    0.69936248110323584,
+    0.68806113277375180,
+    0.67670356802952658,
+    0.66528614139268183,
+    0.65380497984766905,
+    0.64225596042454036,
+    0.63063468493349450,
+    0.61893645139488018,
+    0.60715622162030436,
+    0.59528858429150711,
+    0.58332771274877371,
+    0.57126731653259244,
+    0.55910058551154473,
+    0.54682012516331457,
+    0.53441788123716971,
+    0.52188505159213938,
+    0.50921198244365873,
+    0.49638804551867532,
+    0.48340149165346596,
+    0.47023927508217328,
+    0.45688684093142462,
+    0.44332786607355690,
+    0.42954394022541531,
+    0.41551416960036108,
+    0.40121467889628259,
+    0.38661797794112451,
+    0.37169214532992223,
+    0.35639976025839887,
+    0.34069648106485445,
+    0.32452911701691484,
+    0.30783295467493776,
+    0.29052795549123622,
+    0.27251318547847081,
+    0.25365836338591846,
+    0.23379048305968148,
+    0.21267151063097378,
+    0.18995868962243964,
+    0.16512762256419594,
+    0.13730498094002253,
+    0.10483850756583074,
+    0.063852163815017654,
+    0.0
+];
+
+/**
+ * Unnormalized density exp(-x) at each of the {@link EXPONENTIAL_X} widths,
+ * the lower edge of each layer, followed by 1 at the peak.
+ */
+export const EXPONENTIAL_Y: StaticArray<f64> = [
+    0.00016706669230796367,
+    0.00045413435384149617,
+    0.00096726928232717345,
+    0.0015362997803015700,
+    0.0021459677437189032,
+    0.0027887987935740731,
+    0.0034602647778369010,
+    0.0041572951208337892,
+    0.0048776559835423871,
+    0.0056196422072054787,
+    0.0063819059373191721,
+    0.0071633531836349778,
+    0.0079630774380170296,
+    0.0087803149858089614,
+    0.0096144136425021960,
+    0.010464810181029963,
+    0.011331013597834581,
+    0.012212592426255367,
+    0.013109164931254979,
+    0.014020391403181929,
+    0.014945968011691135,
+    0.015885621839973142,
+    0.016839106826039923,
+    0.017806200410911341,
+    0.018786700744696006,
+    0.019780424338009712,
+    0.020787204072578086,
+    0.021806887504283553,
+    0.022839335406385209,
+    0.023884420511558143,
+    0.024942026419731752,
+    0.026012046645134186,
+    0.027094383780955765,
+    0.028188948763978594,
+    0.029295660224637358,
+    0.030414443910466570,
+    0.031545232172893567,
+    0.032687963508959493,
+    0.033842582150874281,
+    0.035009037697397355,
+    0.036187284781931367,
+    0.037377282772959312,
+    0.038578995503074802,
+    0.039792391023374063,
+    0.041017441380414750,
+    0.042254122413316164,
+    0.043502413568888121,
+    0.044762297732943226,
+    0.046033761076175100,
+    0.047316792913181478,
+    0.048611385573379413,
+    0.049917534282706288,
+    0.051235237055126184,
+    0.052564494593071595,
+    0.053905310196045983,
+    0.055257689676696933,
+    0.056621641283742766,
+    0.057997175631200555,
+    0.059384305633420148,
+    0.060783046445479529,
+    0.062193415408540897,
+    0.063615431999807209,
+    0.065049117786753624,
+    0.066494496385339649,
+    0.067951593421936490,
+    0.069420436498728630,
+    0.070901055162371690,
+    0.072393480875708585,
+    0.073897746992364580,
+    0.075413888734058243,
+    0.076941943170480351,
+    0.078481949201606255,
+    0.080033947542319725,
+    0.081597980709237239,
+    0.083174093009632175,
+    0.084762330532367910,
+    0.086362741140756691,
+    0.087975374467269996,
+    0.089600281910032636,
+    0.091237516631039919,
+    0.092887133556043319,
+    0.094549189376055609,
+    0.096223742550432534,
+    0.097910853311491949,
+    0.099610583670636868,
+    0.10132299742595337,
+    0.10304816017125742,
+    0.10478613930656987,
+    0.10653700405000134,
+    0.10830082545103346,
+    0.11007767640518507,
+    0.11186763167005599,
+    0.11367076788274398,
+    0.11548716357863319,
+    0.11731689921155522,
+    0.11916005717532734,
+    0.12101672182667447,
+    0.12288697950954477,
+    0.12477091858083060,
+    0.12666862943751026,
+    0.12858020454522773,
+    0.13050573846833033,
+    0.13244532790138705,
+    0.13439907170221319,
+    0.13636707092642841,
+    0.13834942886357976,
+    0.14034625107486201,
+    0.14235764543247176,
+    0.14438372216063430,
+    0.14642459387834450,
+    0.14848037564386635,
+    0.15055118500103945,
+    0.15263714202744241,
+    0.15473836938446761,
+    0.15685499236936473,
+    0.15898713896931371,
+    0.16113493991759154,
+    0.16329852875190132,
+    0.16547804187493548,
+    0.16767361861724964,
+    0.16988540130252711,
+    0.17211353531531950,
+    0.17435816917135294,
+    0.17661945459049433,
+    0.17889754657247775,
+    0.18119260347549573,
+    0.18350478709776685,
+    0.18583426276219650,
+    0.18818119940425368,
+    0.19054576966319475,
+    0.19292814997677069,
+    0.19532852067956255,
+    0.19774706610509818,
+    0.20018397469191060,
+    0.20263943909370835,
+    0.20511365629383702,
+    0.20760682772422134,
+    0.21011915938898756,
+    0.21265086199297756,
+    0.21520215107537796,
+    0.21777324714869981,
+    0.22036437584335880,
+    0.22297576805811947,
+    0.22560766011668337,
+    0.22826029393071601,
+    0.23093391716962675,
+    0.23362878343743265,
+    0.23634515245705895,
+    0.23908329026244846,
+    0.24184346939887649,
+    0.24462596913189139,
+    0.24743107566532693,
+    0.25025908236886157,
+    0.25311029001562874,
+    0.25598500703041460,
+    0.25888354974901545,
+    0.26180624268936220,
+    0.26475341883506143,
+    0.26772541993204402,
+    0.27072259679905925,
+    0.27374530965280219,
+    0.27679392844851652,
+    0.27986883323697209,
+    0.28297041453877997,
+    0.28609907373707610,
+    0.28925522348967697,
+    0.29243928816189180,
+    0.29565170428126042,
+    0.29889292101558096,
+    0.30216340067569269,
+    0.30546361924458931,
+    0.30879406693455924,
+    0.31215524877417855,
+    0.31554768522712789,
+    0.31897191284495618,
+    0.32242848495608806,
+    0.32591797239355513,
+    0.32944096426413527,
+    0.33299806876180793,
+    0.33658991402867655,
+    0.34021714906677902,
+    0.34388044470450146,
+    0.34758049462163598,
+    0.35131801643748228,
+    0.35509375286678646,
+    0.35890847294874872,
+    0.36276297335481672,
+    0.36665807978151310,
+    0.37059464843514500,
+    0.37457356761590116,
+    0.37859575940957979,
+    0.38266218149600878,
+    0.38677382908413660,
+    0.39093173698479600,
+    0.39513698183328905,
+    0.39939068447522996,
+    0.40369401253052917,
+    0.40804818315203129,
+    0.41245446599716007,
+    0.41691418643300171,
+    0.42142872899761541,
+    0.42599954114303318,
+    0.43062813728845761,
+    0.43531610321563535,
+    0.44006510084235262,
+    0.44487687341454724,
+    0.44975325116275366,
+    0.45469615747461412,
+    0.45970761564213630,
+    0.46478975625042479,
+    0.46994482528395859,
+    0.47517519303737593,
+    0.48048336393045277,
+    0.48587198734188347,
+    0.49134386959403104,
+    0.49690198724154799,
+    0.50254950184134606,
+    0.50828977641064121,
+    0.51412639381474690,
+    0.52006317736823182,
+    0.52610421398361795,
+    0.53225388026304143,
+    0.53851687200286003,
+    0.54489823767243772,
+    0.55140341654063940,
+    0.55803828226258556,
+    0.56480919291239828,
+    0.57172304866482382,
+    0.57878735860284303,
+    0.58601031847726592,
+    0.59340090169173121,
+    0.60096896636523001,
+    0.60872538207961979,
+    0.61668218091520532,
+    0.62485273870366353,
+    0.63325199421436362,
+    0.64189671642726354,
+    0.65080583341456844,
+    0.66000084107899704,
+    0.66950631673192196,
+    0.67935057226476248,
+    0.68956649611707499,
+    0.70019265508278505,
+    0.71127476080507268,
+    0.72286765959356858,
+    0.73503809243141993,
+    0.74786862198519133,
+    0.76146338884989218,
+    0.77595685204011122,
+    0.79152763697249096,
+    0.80842165152300327,
+    0.82699329664304466,
+    0.84778550062398317,
+    0.87170433238119605,
+    0.90046992992573693,
+    0.93814368086216138,
+    1.0
+];
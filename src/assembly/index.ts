@@ -19,7 +19,31 @@
 // encapsulate top-level exports in namespaces for AssemblyScript consumers
 // to avoid polluting the global namespace
 export * as PCG from './prng/pcg';
+export * as PCG_SIMD from './prng/pcg-simd';
+export * as PCG64 from './prng/pcg64';
+export * as Philox from './prng/philox';
+export * as Philox_SIMD from './prng/philox-simd';
+export * as ChaCha_SIMD from './prng/chacha-simd';
+export * as SFC64 from './prng/sfc64';
+export * as SFC64_SIMD from './prng/sfc64-simd';
+export * as RomuTrio from './prng/romutrio';
+export * as RomuTrio_SIMD from './prng/romutrio-simd';
+export * as RomuDuoJr from './prng/romuduojr';
+export * as RomuDuoJr_SIMD from './prng/romuduojr-simd';
 export * as Xoroshiro128Plus from './prng/xoroshiro128plus';
 export * as Xoroshiro128Plus_SIMD from './prng/xoroshiro128plus-simd';
+export * as Xoroshiro128Plus_SIMDx4 from './prng/xoroshiro128plus-simd-x4';
+export * as Xoroshiro128PlusPlus from './prng/xoroshiro128plusplus';
+export * as Xoroshiro128PlusPlus_SIMD from './prng/xoroshiro128plusplus-simd';
+export * as Xoroshiro128StarStar from './prng/xoroshiro128starstar';
+export * as Xoroshiro128StarStar_SIMD from './prng/xoroshiro128starstar-simd';
 export * as Xoshiro256Plus from './prng/xoshiro256plus';
 export * as Xoshiro256Plus_SIMD from './prng/xoshiro256plus-simd';
+export * as Xoshiro256Plus_SIMDx4 from './prng/xoshiro256plus-simd-x4';
+export * as Xoshiro256PlusPlus from './prng/xoshiro256plusplus';
+export * as Xoshiro256PlusPlus_SIMD from './prng/xoshiro256plusplus-simd';
+export * as Xoshiro256StarStar from './prng/xoshiro256starstar';
+export * as Xoshiro256StarStar_SIMD from './prng/xoshiro256starstar-simd';
+
+// seed expansion for the generators above
+export * as SplitMix64 from './prng/splitmix64';
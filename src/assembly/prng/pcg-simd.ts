@@ -0,0 +1,2001 @@
+/**
+ * An AssemblyScript implementation of the PCG pseudo random number generator,
+ * a 32-bit generator with 64 bits of state and unique stream selection.
+ * 
+ * This version supports WebAssembly SIMD to run 2 independent PCG streams side by
+ * side, providing 2 random outputs for the price of 1 when using array output functions.
+ * @packageDocumentation
+ */
+
+/*
+* Based on the PCG Minimal C Implementation
+* (c) 2014 M.E. O'Neill / pcg-random.org
+* https://www.pcg-random.org/download.html
+* 
+* Which is licensed under Apache License 2.0
+* https://www.apache.org/licenses/LICENSE-2.0
+*/
+
+import {
+    uint64_to_uint53AsFloat,
+    uint64_to_float53,
+    uint64_to_coord53,
+    uint64_to_coord53Squared
+} from '../common/conversion';
+import {
+    uint64x2_to_uint53AsFloatx2,
+    uint64x2_to_float53x2,
+    uint64x2_to_coord53x2,
+    uint64x2_to_coord53Squaredx2
+} from '../common/conversion-simd';
+import {
+    lemireProduct,
+    lemireFraction,
+    lemireThreshold,
+    rangeToBound,
+    recycleCount,
+    recyclePower,
+    recycleThreshold
+} from '../common/bounded';
+import {
+    lemireProductx2,
+    lemireRejectx2,
+    lemireResultx2,
+    recycleDigitx2,
+    recycleFractionx2,
+    recycleRejectx2
+} from '../common/bounded-simd';
+import {
+    normalLayer,
+    normalMagnitude,
+    normalInside,
+    normalSign,
+    normalFast,
+    normalWedge,
+    normalTail
+} from '../common/normal';
+import { normalFastx2, normalRejectx2 } from '../common/normal-simd';
+import {
+    exponentialLayer,
+    exponentialMagnitude,
+    exponentialInside,
+    exponentialFast,
+    exponentialWedge,
+    exponentialTail
+} from '../common/exponential';
+import { exponentialFastx2, exponentialRejectx2, prefixSumx2 } from '../common/exponential-simd';
+import {
+    gammaD,
+    gammaC,
+    gammaBoostPower,
+    gammaCube,
+    gammaSqueeze,
+    gammaAccept,
+    gammaUniform,
+    gammaBoost,
+    betaBoosted
+} from '../common/gamma';
+import { gammaUniformx2, gammaCubex2, gammaRejectx2, gammaBoostx2 } from '../common/gamma-simd';
+import {
+    poissonSetup,
+    poissonInverts,
+    poissonInversion,
+    poissonTransformedRejection
+} from '../common/poisson';
+import {
+    binomialSetup,
+    binomialInverts,
+    binomialInversion,
+    binomialBtpe,
+    binomialFlip
+} from '../common/binomial';
+import { geometricScale, geometricSkip, pairCount, pairsToEdges } from '../common/geometric';
+import { zipfSetup, zipfRejectionInversion } from '../common/zipf';
+import { aliasPick } from '../common/alias';
+import { empiricalSegments, empiricalValue } from '../common/empirical';
+import { empiricalValuex2 } from '../common/empirical-simd';
+import {
+    inverseUniform,
+    cauchyInverse,
+    laplaceInverse,
+    logisticInverse,
+    gumbelInverse,
+    weibullInverse,
+    paretoInverse
+} from '../common/inverse-transform';
+import {
+    inverseUniformx2,
+    cauchyInversex2,
+    laplaceInversex2,
+    logisticInversex2,
+    gumbelInversex2,
+    weibullInversex2,
+    paretoInversex2
+} from '../common/inverse-transform-simd';
+
+// Expose array memory management functions for this WASM module to JS consumers
+export { allocUint64Array, allocFloat64Array } from '../common/memory';
+
+// Expose alias table building, for categorical() and categoricalArray()
+export { aliasTableBuild } from '../common/alias';
+
+// Expose empirical table building, for empirical() and empiricalArray()
+export { empiricalTableBuild } from '../common/empirical';
+
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const MULTIPLIER: u64 = 6364136223846793005;
+
+// In PCG, the stream increment is used to provide a unique random stream.
+// Each lane has its own increment, so the 2 lanes always provide 2 different streams.
+// Lane 0 defaults to the same increment as pcg.ts, and lane 1 to the reference
+// implementation's PCG32_INITIALIZER increment.
+// Note: These numbers must always be odd! This is enforced below.
+let streamIncrement: v128 = i64x2(1442695040888963407, 0xda3e39cb94b95bdb);
+
+// Internal PCG state, one per lane
+let state: v128 = i64x2.splat(0);
+
+/** Number of seeds required for this generator's {@link setSeeds} function. */
+export const SEED_COUNT: i32 = 2;
+
+/**
+ * Initializes this generator's internal state with the provided random seeds,
+ * one per SIMD lane.
+ *
+ * Follows the PCG reference implementation initialization pattern from
+ * https://github.com/imneme/pcg-c-basic/blob/master/pcg_basic.c
+ * in each lane, so lane 0 matches the non-SIMD PCG generator given seed `a`
+ * (and the same stream increment).
+ *
+ * IMPORTANT: If using custom stream increments, call setStreamIncrement()
+ * BEFORE calling this function, as the increments must be set before the
+ * seeds are mixed in.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function setSeeds(a: u64, b: u64): void {
+    state = i64x2.splat(0);
+    uint32x2();                                 // First advancement
+    state = i64x2.add(state, i64x2(a, b));      // Mix in seeds
+    uint32x2();                                 // Second advancement
+}
+
+/**
+ * Optionally chooses the unique streams to be provided by this generator's 2 SIMD lanes.
+ *
+ * Two generators given the same seed value(s) will still provide a unique stream
+ * of random numbers as long as they use different stream increments.
+ *
+ * IMPORTANT: Must be called BEFORE setSeeds() to take effect properly.
+ * See the non-SIMD PCG generator's `setStreamIncrement` for details.
+ *
+ * @param a Any integer, used for lane 0. It should be unique amongst stream increments
+ * used for other parallel generator instances (and lanes) that have been seeded uniformly.
+ * @param b Any integer, used for lane 1. Should be different from `a`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function setStreamIncrement(a: u64, b: u64): void {
+    // Ensure the increments are odd regardless of values given, in a way
+    // that allows for consecutive integers and still achieves uniqueness.
+    streamIncrement = i64x2((a << 1) | 1, (b << 1) | 1);
+}
+
+/**
+ * Advances this generator's state by `delta` steps in O(log delta) time, as if
+ * {@link uint32x2} had been called `delta` times and its results discarded.
+ *
+ * Each step advances both SIMD lanes and corresponds to one 32-bit output per lane:
+ * functions returning 64-bit or 53-bit values consume 2 steps each.
+ *
+ * Uses the same algorithm as the non-SIMD PCG generator's `advance` (Brown, "Random
+ * Number Generation with Arbitrary Stride", 1994). The multiplier is shared by both
+ * lanes, so only the additive terms need to be tracked per lane.
+ *
+ * @param delta The number of steps to advance.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function advance(delta: u64): void {
+    let curMult: u64 = MULTIPLIER;
+    let curPlus: v128 = streamIncrement;
+    let accMult: u64 = 1;
+    let accPlus: v128 = i64x2.splat(0);
+
+    // Fast exponentiation of the affine step: state -> state * MULTIPLIER + streamIncrement
+    while (delta != 0) {
+        if ((delta & 1) != 0) {
+            accMult *= curMult;
+            accPlus = i64x2.add(i64x2.mul(accPlus, i64x2.splat(curMult)), curPlus);
+        }
+        curPlus = i64x2.mul(i64x2.splat(curMult + 1), curPlus);
+        curMult *= curMult;
+        delta >>>= 1;
+    }
+
+    state = i64x2.add(i64x2.mul(state, i64x2.splat(accMult)), accPlus);
+}
+
+/**
+ * Gets this generator's next 2 unsigned 32-bit integers.
+ * 
+ * @returns 2 unsigned 32-bit integers, each in the low half of a 64-bit lane.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32x2(): v128 {
+    const oldState: v128 = state;
+
+    // PCG
+    state = i64x2.add(i64x2.mul(oldState, i64x2.splat(MULTIPLIER)), streamIncrement);
+
+    // Calculate output function (XSH RR)
+    // Use i64x2.shr_u for unsigned/logical right shift (v128.shr is signed/arithmetic)
+    const xorshifted: v128 = i64x2.shr_u(v128.xor(i64x2.shr_u(oldState, 18), oldState), 27);
+    const rot: v128 = i64x2.shr_u(oldState, 59);
+
+    // WASM SIMD only supports shifting all lanes by the same amount, so the
+    // data-dependent 32-bit rotate right is applied to each lane separately
+    return i64x2(
+        <u64>rotr<u32>(<u32>v128.extract_lane<u64>(xorshifted, 0), <u32>v128.extract_lane<u64>(rot, 0)),
+        <u64>rotr<u32>(<u32>v128.extract_lane<u64>(xorshifted, 1), <u32>v128.extract_lane<u64>(rot, 1))
+    );
+}
+
+/**
+ * Gets this generator's next 2 unsigned 64-bit integers.
+ * 
+ * @returns 2 unsigned 64-bit integers.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint64x2(): v128 {
+    // chain the next two u32s in each lane together to get `u64`s
+    const hi: v128 = uint32x2();
+    return v128.or(v128.shl<u64>(hi, 32), uint32x2());
+}
+
+/**
+ * Gets this generator's next 2 unsigned 53-bit integers.
+ *
+ * @returns 2 unsigned 53-bit integers, returned as `f64`s
+ * so that the JS runtime converts them to `number`s.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint53AsFloatx2(): v128 {
+    return uint64x2_to_uint53AsFloatx2(uint64x2());
+}
+
+/**
+ * Gets this generator's next 2 unsigned 32-bit integers.
+ *
+ * @returns 2 unsigned 32-bit integers, returned as `f64`s
+ * so that the JS runtime converts them to `number`s.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32AsFloatx2(): v128 {
+    const rand: v128 = uint32x2();
+
+    // PCG produces 32-bit outputs natively, so no bit-shift is needed
+    return f64x2(
+        <f64>v128.extract_lane<u64>(rand, 0),
+        <f64>v128.extract_lane<u64>(rand, 1)
+    );
+}
+
+/**
+ * Gets this generator's next 2 53-bit floating point numbers in range [0, 1).
+ * 
+ * @returns 2 53-bit floating point numbers in range [0, 1).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function float53x2(): v128 {
+    return uint64x2_to_float53x2(uint64x2());
+}
+
+/**
+ * Gets this generator's next 2 53-bit floating point numbers in range [-1, 1).
+ * 
+ * Can be considered a "coordinate" in a unit circle with radius 1.
+ * Useful for Monte Carlo simulation.
+ * 
+ * @returns 2 53-bit floating point numbers in range [-1, 1).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53x2(): v128 {
+    return uint64x2_to_coord53x2(uint64x2());
+}
+
+/**
+ * Gets the square of this generator's next 2 53-bit floating point numbers in range [-1, 1).
+ * 
+ * Useful for Monte Carlo simulation.
+ * 
+ * @returns 2 53-bit floating point numbers in range [-1, 1), each multiplied by itself.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53Squaredx2(): v128 {
+    return uint64x2_to_coord53Squaredx2(uint64x2());
+}
+
+
+// Single-number functions are provided for interface compatibility, but
+// do not actually take advantage of parallelization achieved with SIMD.
+// They return lane 0, so they match the non-SIMD PCG generator's output.
+
+
+/**
+ * Gets this generator's next unsigned 64-bit integer.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * @returns An unsigned 64-bit integer.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint64(): u64 {
+    return v128.extract_lane<u64>(uint64x2(), 0);
+}
+
+/**
+ * Gets this generator's next unsigned 53-bit integer.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * @returns An unsigned 53-bit integer.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint53AsFloat(): f64 {
+    return uint64_to_uint53AsFloat(uint64());
+}
+
+/**
+ * Gets this generator's next unsigned 32-bit integer.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * @returns An unsigned 32-bit integer.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32AsFloat(): f64 {
+    return <f64>v128.extract_lane<u64>(uint32x2(), 0);
+}
+
+/**
+ * Gets this generator's next 53-bit floating point number in range [0, 1).
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * @returns A 53-bit floating point number in range [0, 1).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function float53(): f64 {
+    return uint64_to_float53(v128.extract_lane<u64>(uint64x2(), 0));
+}
+
+/**
+ * Gets this generator's next 53-bit floating point number in range [-1, 1).
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Can be considered part of a "coordinate" in a unit circle with radius 1.
+ * Useful for Monte Carlo simulation.
+ * 
+ * @returns A 53-bit floating point number in range [-1, 1).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53(): f64 {
+    return uint64_to_coord53(v128.extract_lane<u64>(uint64x2(), 0));
+}
+
+/**
+ * Gets the square of this generator's next 53-bit floating point number in range [-1, 1).
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Useful for Monte Carlo simulation.
+ * 
+ * @returns A 53-bit floating point number in range [-1, 1), multiplied by itself.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53Squared(): f64 {
+    return uint64_to_coord53Squared(v128.extract_lane<u64>(uint64x2(), 0));
+}
+
+/**
+ * Draws Lemire products for `bound` (up to 2^32) until one is unbiased:
+ * its high 32 bits are then a uniform integer in range [0, `bound`).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function boundedProduct(bound: u64): u64 {
+    let product: u64 = lemireProduct(<u32>v128.extract_lane<u64>(uint32x2(), 0), bound);
+
+    // the threshold is below `bound`, so it's only computed when it could reject
+    if (lemireFraction(product) < bound) {
+        const threshold: u64 = lemireThreshold(bound);
+        while (lemireFraction(product) < threshold) {
+            product = lemireProduct(<u32>v128.extract_lane<u64>(uint32x2(), 0), bound);
+        }
+    }
+
+    return product;
+}
+
+/**
+ * Gets this generator's next unsigned 32-bit integer in range [0, `bound`), without bias.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses Lemire's nearly divisionless method: each 32-bit output is scaled
+ * to the range by multiplication, and the rare outputs that would bias the result
+ * are rejected and redrawn.
+ * 
+ * @param bound The exclusive upper bound, from 1 to 2^32 - 1.
+ * 
+ * @returns An unsigned 32-bit integer in range [0, `bound`).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32Below(bound: u32): u32 {
+    return <u32>(boundedProduct(<u64>bound) >>> 32);
+}
+
+/**
+ * Gets this generator's next 32-bit integer in range [`min`, `max`] (inclusive), without bias.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses the same method as {@link uint32Below}, so any range up to every `i32` is supported.
+ * 
+ * @param min The lowest integer to return.
+ * @param max The highest integer to return, at least `min`.
+ * 
+ * @returns A 32-bit integer in range [`min`, `max`].
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function intRange(min: i32, max: i32): i32 {
+    return min + <i32>(boundedProduct(rangeToBound(min, max)) >>> 32);
+}
+
+/**
+ * Finishes a standard normal number whose random value's point fell outside its
+ * ziggurat layer: in the layer's wedge, or past the base layer in the tail.
+ */
+function normalSlow(next: u64): f64 {
+    let layer: i32 = normalLayer(next);
+    let z: f64 = normalMagnitude(next, layer);
+
+    while (!normalInside(z, layer)) {
+        if (layer == 0) {
+            // the tail keeps the sign of the value that reached it
+            do {
+                z = normalTail(uint64(), uint64());
+            } while (isNaN(z));
+            break;
+        }
+
+        if (normalWedge(z, layer, uint64())) break;
+
+        next = uint64();
+        layer = normalLayer(next);
+        z = normalMagnitude(next, layer);
+    }
+
+    return normalSign(next, z);
+}
+
+/**
+ * Gets this generator's next normally distributed number.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses the 256-layer ziggurat method, which accepts about 98.5% of numbers with a
+ * table lookup, a multiply and a compare, and only needs `exp` or `log` for the rest.
+ * 
+ * @param mean The mean (center) of the distribution.
+ * @param stddev The standard deviation (spread) of the distribution.
+ * 
+ * @returns A normally distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normal53(mean: f64, stddev: f64): f64 {
+    const next: u64 = uint64();
+    let z: f64 = normalFast(next);
+    if (isNaN(z)) z = normalSlow(next);
+
+    return mean + stddev * z;
+}
+
+/**
+ * Finishes an exponential number whose random value's point fell outside its
+ * ziggurat layer: in the layer's wedge, or past the base layer in the tail.
+ */
+function exponentialSlow(next: u64): f64 {
+    let layer: i32 = exponentialLayer(next);
+    let z: f64 = exponentialMagnitude(next, layer);
+
+    while (!exponentialInside(z, layer)) {
+        if (layer == 0) return exponentialTail(uint64());
+        if (exponentialWedge(z, layer, uint64())) break;
+
+        next = uint64();
+        layer = exponentialLayer(next);
+        z = exponentialMagnitude(next, layer);
+    }
+
+    return z;
+}
+
+/**
+ * Gets this generator's next exponentially distributed number with rate 1.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function exponentialStandard(): f64 {
+    const next: u64 = uint64();
+    const z: f64 = exponentialFast(next);
+    return isNaN(z) ? exponentialSlow(next) : z;
+}
+
+/**
+ * Gets this generator's next exponentially distributed number, such as the wait
+ * until the next event of a process with `rate` events per unit of time.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses the 256-layer ziggurat method, which accepts about 97.8% of numbers with a
+ * table lookup, a multiply and a compare, and only needs `exp` or `log` for the rest.
+ * 
+ * @param rate The rate of the distribution, whose mean is 1 / `rate`.
+ * 
+ * @returns An exponentially distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponential53(rate: f64): f64 {
+    return exponentialStandard() * (1.0 / rate);
+}
+
+/**
+ * Gets this generator's next gamma distributed number with scale 1, for the `d` and `c`
+ * that `gammaD` and `gammaC` derive from its shape, using Marsaglia and Tsang's method.
+ * Shapes below 1 must still be boosted with `gammaBoost`.
+ */
+function gammaStandard(d: f64, c: f64): f64 {
+    let x: f64;
+    let v: f64;
+    let u: f64;
+
+    do {
+        do {
+            x = normal53(0.0, 1.0);
+            v = gammaCube(x, c);
+        } while (v <= 0.0);
+        u = gammaUniform(uint64());
+    } while (!gammaSqueeze(x, u) && !gammaAccept(x, v, u, d));
+
+    return d * v;
+}
+
+/**
+ * Gets this generator's next gamma distributed number with scale 1, boosted
+ * if its shape is below 1 (when its `gammaBoostPower` isn't 0).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function gammaNext(d: f64, c: f64, power: f64): f64 {
+    const z: f64 = gammaStandard(d, c);
+    return power == 0.0 ? z : z * gammaBoost(uint64(), power);
+}
+
+/**
+ * Gets this generator's next beta distributed number, given the `d`, `c` and
+ * `gammaBoostPower` of each of its shapes.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function betaNext(dA: f64, cA: f64, powerA: f64, dB: f64, cB: f64, powerB: f64): f64 {
+    const x: f64 = gammaStandard(dA, cA);
+    const y: f64 = gammaStandard(dB, cB);
+    if (powerA == 0.0 && powerB == 0.0) return x / (x + y);
+
+    return betaBoosted(
+        x,
+        y,
+        powerA == 0.0 ? 1.0 : gammaUniform(uint64()),
+        powerB == 0.0 ? 1.0 : gammaUniform(uint64()),
+        powerA,
+        powerB
+    );
+}
+
+/**
+ * Gets this generator's next gamma distributed number.
+ * 
+ * Discards the additional random numbers generated with SIMD.
+ * 
+ * Uses Marsaglia and Tsang's method: a cubed normal number, accepted by a cheap
+ * squeeze about 92% of the time, and otherwise by a test with 2 logarithms.
+ * 
+ * @param shape The shape (`k`) of the distribution, greater than 0.
+ * @param scale The scale (`θ`) of the distribution, greater than 0.
+ * The distribution's mean is `shape` * `scale`.
+ * 
+ * @returns A gamma distributed 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gamma53(shape: f64, scale: f64): f64 {
+    const d: f64 = gammaD(shape);
+    return gammaNext(d, gammaC(d), gammaBoostPower(shape)) * scale;
+}
+
+/**
+ * Gets this generator's next beta distributed number in range [0, 1].
+ * 
+ * Discards the additional random numbers generated with SIMD.
+ * 
+ * Draws gamma numbers `x` and `y` with shapes `a` and `b` as {@link gamma53} does,
+ * and returns `x` / (`x` + `y`).
+ * 
+ * @param a The first shape (`α`) of the distribution, greater than 0.
+ * @param b The second shape (`β`) of the distribution, greater than 0.
+ * The distribution's mean is `a` / (`a` + `b`).
+ * 
+ * @returns A beta distributed 64-bit float in range [0, 1].
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function beta53(a: f64, b: f64): f64 {
+    const dA: f64 = gammaD(a);
+    const dB: f64 = gammaD(b);
+    return betaNext(dA, gammaC(dA), gammaBoostPower(a), dB, gammaC(dB), gammaBoostPower(b));
+}
+
+/**
+ * Gets this generator's next chi-squared distributed number: a gamma number
+ * with shape `k` / 2 and scale 2.
+ * 
+ * Discards the additional random numbers generated with SIMD.
+ * 
+ * @param k The degrees of freedom of the distribution, greater than 0.
+ * The distribution's mean is `k`.
+ * 
+ * @returns A chi-squared distributed 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function chiSquared53(k: f64): f64 {
+    return gamma53(0.5 * k, 2.0);
+}
+
+/**
+ * Gets this generator's next Poisson distributed number, for the λ set up with `poissonSetup`.
+ */
+function poissonNext(): f64 {
+    let uv: v128;
+    let k: f64;
+
+    if (poissonInverts()) {
+        do {
+            k = poissonInversion(float53());
+        } while (isNaN(k));
+    } else {
+        do {
+            uv = uint64x2_to_float53x2(uint64x2());
+            k = poissonTransformedRejection(f64x2.extract_lane(uv, 0), f64x2.extract_lane(uv, 1));
+        } while (isNaN(k));
+    }
+
+    return k;
+}
+
+/**
+ * Gets this generator's next binomially distributed number, for the `n` and `p` set up
+ * with `binomialSetup`.
+ */
+function binomialNext(): f64 {
+    let uv: v128;
+    let k: f64;
+
+    if (binomialInverts()) {
+        do {
+            k = binomialInversion(float53());
+        } while (isNaN(k));
+    } else {
+        do {
+            uv = uint64x2_to_float53x2(uint64x2());
+            k = binomialBtpe(f64x2.extract_lane(uv, 0), f64x2.extract_lane(uv, 1));
+        } while (isNaN(k));
+    }
+
+    return binomialFlip(k);
+}
+
+/**
+ * Gets this generator's next Poisson distributed number: a count of events in an
+ * interval where they occur independently at mean rate `lambda`.
+ * 
+ * Discards the additional random numbers generated with SIMD.
+ * 
+ * Uses inversion for a `lambda` below 10, and Hörmann's transformed rejection (PTRS)
+ * from 10 up, so the cost stays flat as `lambda` grows.
+ * 
+ * @param lambda The mean (`λ`) of the distribution, at least 0.
+ * 
+ * @returns A Poisson distributed integer, as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function poisson(lambda: f64): f64 {
+    poissonSetup(lambda);
+    return poissonNext();
+}
+
+/**
+ * Gets this generator's next binomially distributed number: a count of successes
+ * in `n` independent trials that each succeed with probability `p`.
+ * 
+ * Discards the additional random numbers generated with SIMD.
+ * 
+ * Uses inversion while `n` times the smaller of `p` and 1 - `p` is below 30, and
+ * Kachitvichyanukul and Schmeiser's BTPE from 30 up, so the cost stays flat as `n` grows.
+ * 
+ * @param n The number of trials, at least 0.
+ * @param p The success probability of each trial, in range [0, 1].
+ * 
+ * @returns A binomially distributed integer in range [0, `n`], as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function binomial(n: i32, p: f64): f64 {
+    binomialSetup(<f64>n, p);
+    return binomialNext();
+}
+
+/**
+ * Gets this generator's next geometric distributed number: the number of failed trials
+ * before the first success, when each succeeds with probability `p`.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * @param p The success probability of each trial, in range (0, 1].
+ * 
+ * @returns A geometric distributed integer, as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function geometric(p: f64): f64 {
+    return geometricSkip(v128.extract_lane<u64>(uint64x2(), 0), geometricScale(p));
+}
+
+/**
+ * Gets this generator's next Zipf distributed number, for the n and s set up with `zipfSetup`.
+ */
+function zipfNext(): f64 {
+    let k: f64;
+
+    do {
+        k = zipfRejectionInversion(float53());
+    } while (isNaN(k));
+
+    return k;
+}
+
+/**
+ * Gets this generator's next Zipf distributed number: a rank from 1 to `n`, drawn with
+ * probability proportional to 1 / rank^`s`.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses Hörmann and Derflinger's rejection-inversion, which needs no table, so memory use
+ * is constant however large `n` is.
+ * 
+ * @param n The number of ranks, at least 1.
+ * @param s The exponent of the distribution, at least 0.
+ * 
+ * @returns A Zipf distributed integer in range [1, `n`], as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function zipf(n: f64, s: f64): f64 {
+    zipfSetup(n, s);
+    return zipfNext();
+}
+
+/**
+ * Gets this generator's next categorical number: a category drawn from an alias table
+ * built with `aliasTableBuild`, with probability proportional to its weight.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses a single random number and one table lookup, however many categories there are.
+ * 
+ * @param table The alias table. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * 
+ * @returns A category, from 0 to the number of categories - 1, as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function categorical(table: Uint64Array): f64 {
+    return aliasPick(v128.extract_lane<u64>(uint64x2(), 0), table.dataStart, <u64>table.length);
+}
+
+/**
+ * Gets this generator's next empirical number: a value drawn by inversion from a tabulated,
+ * piecewise-linear CDF, built into a table with `empiricalTableBuild`.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses a single random number, a guide table lookup and a short search, however many
+ * points the CDF has.
+ * 
+ * @param table The empirical table. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * 
+ * @returns A value from the CDF's range, as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function empirical(table: Float64Array): f64 {
+    return empiricalValue(float53(), table.dataStart, empiricalSegments(table.length));
+}
+
+/**
+ * Gets this generator's next Cauchy distributed number, such as the ratio of 2 normal
+ * numbers, or a resonance line shape. It has no mean or variance, and its tails are very
+ * heavy.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param location The location of the distribution: its median.
+ * @param scale The scale of the distribution, greater than 0. It's the half width at half
+ * maximum.
+ * 
+ * @returns A Cauchy distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function cauchy53(location: f64, scale: f64): f64 {
+    return location + scale * cauchyInverse(inverseUniform(uint64()));
+}
+
+/**
+ * Gets this generator's next Laplace distributed number, a double exponential: the
+ * difference between 2 exponential numbers, such as noise for differential privacy.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param location The location of the distribution: its mean.
+ * @param scale The scale of the distribution, greater than 0. The variance is 2 * `scale`^2.
+ * 
+ * @returns A Laplace distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function laplace53(location: f64, scale: f64): f64 {
+    return location + scale * laplaceInverse(inverseUniform(uint64()));
+}
+
+/**
+ * Gets this generator's next logistic distributed number, such as the noise in a logit
+ * model, or an Elo rating difference. Its shape is close to a normal distribution's, with
+ * heavier tails.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param location The location of the distribution: its mean.
+ * @param scale The scale of the distribution, greater than 0. The variance is (π * `scale`)^2
+ * / 3.
+ * 
+ * @returns A logistic distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function logistic53(location: f64, scale: f64): f64 {
+    return location + scale * logisticInverse(inverseUniform(uint64()));
+}
+
+/**
+ * Gets this generator's next Gumbel distributed number, such as the largest of many
+ * samples, or the noise of the Gumbel-max trick for sampling categories.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param location The location of the distribution: its mode.
+ * @param scale The scale of the distribution, greater than 0.
+ * 
+ * @returns A Gumbel distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gumbel53(location: f64, scale: f64): f64 {
+    return location + scale * gumbelInverse(inverseUniform(uint64()));
+}
+
+/**
+ * Gets this generator's next Weibull distributed number, such as a time to failure, or a
+ * wind speed.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param shape The shape (`k`) of the distribution, greater than 0. Below 1, the failure rate
+ * falls over time; above 1, it rises.
+ * @param scale The scale (`λ`) of the distribution, greater than 0.
+ * 
+ * @returns A Weibull distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function weibull53(shape: f64, scale: f64): f64 {
+    return scale * weibullInverse(inverseUniform(uint64()), 1.0 / shape);
+}
+
+/**
+ * Gets this generator's next Pareto distributed number, such as a file size, a wealth or a
+ * city population, from a power law above a minimum.
+ * 
+ * Discards the additional random number generated with SIMD.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param shape The shape (`α`) of the distribution, greater than 0. Its mean is only finite
+ * for shapes above 1, and its variance for shapes above 2.
+ * @param scale The scale of the distribution, greater than 0: its minimum.
+ * 
+ * @returns A Pareto distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function pareto53(shape: f64, scale: f64): f64 {
+    return scale * paretoInverse(inverseUniform(uint64()), 1.0 / shape);
+}
+
+
+/* 
+* Perf:
+* If we extract the following mostly-repeated functions to common logic, 
+* define a type for the function, and pass the generator function as a 
+* parameter, it runs somewhat slower. I believe this is because of runtime
+* function call overhead, and so it can't be avoided using @inline.
+* 
+* In the interest of speed over DRY cleanliness, we repeat this logic in each
+* generator type.
+* 
+* The same speed caveat applies when wrapping the generator logic in a class:
+* Everything slows down somewhat. So we opt instead for global functions and speed.
+* 
+* TODO: Add performance tradeoff examples to demos.
+*/
+
+
+/**
+ * Monte Carlo test: Generates random (x,y) coordinates in range [-1, 1), and
+ * counts how many of them fall inside the unit circle with radius 1.
+ * 
+ * Can be used to estimate pi (π).
+ * 
+ * @param count The number of random (x,y) coordinate points in (-1, 1) to generate and check.
+ * 
+ * @returns The number of random points which fell *inside* of the unit circle with radius 1.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function batchTestUnitCirclePoints(count: i32): i32 {
+    let pointsInCircle: i32 = 0;
+    let pSquared: v128;
+    let xSquared: f64;
+    let ySquared: f64;
+
+    for (let i: i32 = 0; i < count; i++) {
+        pSquared = coord53Squaredx2();
+        xSquared = v128.extract_lane<f64>(pSquared, 0);
+        ySquared = v128.extract_lane<f64>(pSquared, 1);
+        
+        if (xSquared + ySquared <= 1.0) {
+            pointsInCircle++;
+        }
+    }
+
+    return pointsInCircle;
+}
+
+/**
+ * Fills the provided array with this generator's next set of unsigned 64-bit integers.
+ * 
+ * Utilizes SIMD.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint64Array(arr: Uint64Array): void {
+    let rand: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        rand = uint64x2();
+        unchecked(arr[i] = v128.extract_lane<u64>(rand, 0));
+        unchecked(arr[i + 1] = v128.extract_lane<u64>(rand, 1));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of unsigned 53-bit integers.
+ * 
+ * Utilizes SIMD.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint53AsFloatArray(arr: Float64Array): void {
+    let rand: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        rand = uint53AsFloatx2();
+        unchecked(arr[i] = v128.extract_lane<f64>(rand, 0));
+        unchecked(arr[i + 1] = v128.extract_lane<f64>(rand, 1));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of unsigned 32-bit integers.
+ * 
+ * Utilizes SIMD.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32AsFloatArray(arr: Float64Array): void {
+    let rand: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        rand = uint32AsFloatx2();
+        unchecked(arr[i] = v128.extract_lane<f64>(rand, 0));
+        unchecked(arr[i + 1] = v128.extract_lane<f64>(rand, 1));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of 53-bit floating point numbers
+ * in range [0, 1).
+ * 
+ * Utilizes SIMD.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function float53Array(arr: Float64Array): void {
+    let rand: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        rand = float53x2();
+        unchecked(arr[i] = v128.extract_lane<f64>(rand, 0));
+        unchecked(arr[i + 1] = v128.extract_lane<f64>(rand, 1));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of 53-bit floating point numbers
+ * in range [-1, 1).
+ * 
+ * Utilizes SIMD.
+ * 
+ * Useful for Monte Carlo simulation.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53Array(arr: Float64Array): void {
+    let rand: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        rand = coord53x2();
+        unchecked(arr[i] = v128.extract_lane<f64>(rand, 0));
+        unchecked(arr[i + 1] = v128.extract_lane<f64>(rand, 1));
+    }
+}
+
+/**
+ * Fills the provided array with the squares of this generator's next set of 53-bit floating 
+ * point numbers in range [-1, 1).
+ * 
+ * Utilizes SIMD.
+ * 
+ * Useful for Monte Carlo simulation.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53SquaredArray(arr: Float64Array): void {
+    let rand: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        rand = coord53Squaredx2();
+        unchecked(arr[i] = v128.extract_lane<f64>(rand, 0));
+        unchecked(arr[i + 1] = v128.extract_lane<f64>(rand, 1));
+    }
+}
+
+/**
+ * Fills the provided array with unbiased integers in range [0, `bound`), plus `offset`,
+ * scaling and testing the products of every lane at once.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function boundedArray(bound: u64, offset: f64, arr: Float64Array): void {
+    const boundx2: v128 = i64x2.splat(bound);
+    const thresholdx2: v128 = i64x2.splat(lemireThreshold(bound));
+    const offsetx2: v128 = f64x2.splat(offset);
+    let ptr: usize = arr.dataStart;
+    let product: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        product = lemireProductx2(uint32x2(), boundx2);
+
+        // redraw both lanes while either would be biased (each lane stays independent and uniform)
+        while (lemireRejectx2(product, thresholdx2)) {
+            product = lemireProductx2(uint32x2(), boundx2);
+        }
+
+        v128.store(ptr, f64x2.add(lemireResultx2(product), offsetx2));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of unsigned 32-bit integers
+ * in range [0, `bound`), without bias.
+ * 
+ * Utilizes SIMD.
+ * 
+ * @param bound The exclusive upper bound, from 1 to 2^32 - 1.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32BelowArray(bound: u32, arr: Float64Array): void {
+    boundedArray(<u64>bound, 0.0, arr);
+}
+
+/**
+ * Fills the provided array with this generator's next set of 32-bit integers
+ * in range [`min`, `max`] (inclusive), without bias.
+ * 
+ * Utilizes SIMD.
+ * 
+ * @param min The lowest integer to return.
+ * @param max The highest integer to return, at least `min`.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function intRangeArray(min: i32, max: i32, arr: Float64Array): void {
+    boundedArray(rangeToBound(min, max), <f64>min, arr);
+}
+
+/**
+ * Fills the provided array with this generator's next set of 32-bit integers
+ * in the small range [`min`, `max`] (inclusive), without bias.
+ * 
+ * Recycles the bits of each 64-bit output to extract as many integers as fit, e.g.
+ * over 20 dice rolls from every output, so far fewer outputs are generated than with
+ * {@link intRangeArray}. Best suited to ranges of up to 2^16 integers.
+ * 
+ * Utilizes SIMD.
+ * 
+ * @param min The lowest integer to return.
+ * @param max The highest integer to return, at least `min`. The range can't span every `i32`.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function smallIntRangeArray(min: i32, max: i32, arr: Float64Array): void {
+    const bound: u64 = rangeToBound(min, max);
+    const count: i32 = recycleCount(bound);
+    const threshold: u64 = recycleThreshold(recyclePower(bound, count));
+    const boundx2: v128 = i64x2.splat(bound);
+    const thresholdx2: v128 = i64x2.splat(threshold);
+    const minx2: v128 = f64x2.splat(<f64>min);
+    let ptr: usize = arr.dataStart;
+    let remaining: i32 = arr.length;
+    let x: v128;
+
+    while (remaining > 1) {
+        // each lane yields up to `count` integers, stored as interleaved pairs
+        const stored: i32 = (remaining >> 1) < count ? remaining >> 1 : count;
+
+        // redraw both lanes' batches if either final fraction shows it would be biased
+        do {
+            x = uint64x2();
+            for (let j: i32 = 0; j < stored; j++) {
+                v128.store(ptr + (<usize>j << 4), f64x2.add(recycleDigitx2(x, boundx2), minx2));
+                x = recycleFractionx2(x, boundx2);
+            }
+            for (let j: i32 = stored; j < count; j++) {
+                x = recycleFractionx2(x, boundx2);
+            }
+        } while (recycleRejectx2(x, thresholdx2));
+
+        ptr += <usize>stored << 4;
+        remaining -= stored << 1;
+    }
+}
+
+/**
+ * Finishes any lanes of a {@link normalFastx2} result whose points fell outside their
+ * layers, one lane at a time, with the same loop as {@link normal53}.
+ */
+function normalFinishx2(next: v128, z: v128): v128 {
+    let z0: f64 = f64x2.extract_lane(z, 0);
+    let z1: f64 = f64x2.extract_lane(z, 1);
+    if (isNaN(z0)) z0 = normalSlow(v128.extract_lane<u64>(next, 0));
+    if (isNaN(z1)) z1 = normalSlow(v128.extract_lane<u64>(next, 1));
+
+    return f64x2(z0, z1);
+}
+
+/**
+ * Fills the provided array with this generator's next set of normally distributed numbers.
+ * 
+ * Utilizes SIMD: both lanes take the ziggurat fast path together, and the rare
+ * lanes that fall outside their layers are finished one at a time.
+ * 
+ * @param mean The mean (center) of the distribution.
+ * @param stddev The standard deviation (spread) of the distribution.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normal53Array(mean: f64, stddev: f64, arr: Float64Array): void {
+    const meanx2: v128 = f64x2.splat(mean);
+    const stddevx2: v128 = f64x2.splat(stddev);
+    let ptr: usize = arr.dataStart;
+    let next: v128;
+    let z: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        next = uint64x2();
+        z = normalFastx2(next);
+        if (normalRejectx2(z)) z = normalFinishx2(next, z);
+
+        v128.store(ptr, f64x2.add(f64x2.mul(z, stddevx2), meanx2));
+        ptr += 16;
+    }
+}
+
+/**
+ * Finishes any lanes of an {@link exponentialFastx2} result whose points fell outside
+ * their layers, one lane at a time, with the same loop as {@link exponential53}.
+ */
+function exponentialFinishx2(next: v128, z: v128): v128 {
+    let z0: f64 = f64x2.extract_lane(z, 0);
+    let z1: f64 = f64x2.extract_lane(z, 1);
+    if (isNaN(z0)) z0 = exponentialSlow(v128.extract_lane<u64>(next, 0));
+    if (isNaN(z1)) z1 = exponentialSlow(v128.extract_lane<u64>(next, 1));
+
+    return f64x2(z0, z1);
+}
+
+/**
+ * Fills the provided array with this generator's next set of exponentially distributed numbers.
+ * 
+ * Utilizes SIMD: both lanes take the ziggurat fast path together, and the rare
+ * lanes that fall outside their layers are finished one at a time.
+ * 
+ * @param rate The rate of the distribution, whose mean is 1 / `rate`.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponential53Array(rate: f64, arr: Float64Array): void {
+    const scalex2: v128 = f64x2.splat(1.0 / rate);
+    let ptr: usize = arr.dataStart;
+    let next: v128;
+    let z: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        next = uint64x2();
+        z = exponentialFastx2(next);
+        if (exponentialRejectx2(z)) z = exponentialFinishx2(next, z);
+
+        v128.store(ptr, f64x2.mul(z, scalex2));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with the arrival times of this generator's next set of events
+ * in a Poisson process: each time is the previous one plus an exponentially distributed gap.
+ * 
+ * Utilizes SIMD for the gaps and their running totals within each pair, so only
+ * one add per pair is carried from one pair to the next.
+ * 
+ * Pass the array's last time as the next call's `t0` to continue the same timeline.
+ * 
+ * @param rate The rate of the process, in events per unit of time.
+ * @param t0 The time the process starts from, before the first event.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function arrivalTimesArray(rate: f64, t0: f64, arr: Float64Array): void {
+    const scalex2: v128 = f64x2.splat(1.0 / rate);
+    let time: f64 = t0;
+    let ptr: usize = arr.dataStart;
+    let next: v128;
+    let z: v128;
+    let times: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        next = uint64x2();
+        z = exponentialFastx2(next);
+        if (exponentialRejectx2(z)) z = exponentialFinishx2(next, z);
+
+        times = f64x2.add(prefixSumx2(f64x2.mul(z, scalex2)), f64x2.splat(time));
+        time = f64x2.extract_lane(times, 1);
+
+        v128.store(ptr, times);
+        ptr += 16;
+    }
+}
+
+/**
+ * Finishes a gamma candidate that failed the SIMD squeeze: accepted by the full test,
+ * or replaced by a new gamma number from {@link gammaStandard}.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function gammaFinish(x: f64, v: f64, u: f64, d: f64, c: f64): f64 {
+    return v > 0.0 && (gammaSqueeze(x, u) || gammaAccept(x, v, u, d)) ? d * v : gammaStandard(d, c);
+}
+
+/**
+ * Gets this generator's next 2 gamma distributed numbers with scale 1, like {@link gammaStandard}.
+ * Both candidates are built and squeezed together, and the rare candidates that fail
+ * the squeeze are finished one at a time.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function gammaStandardx2(d: f64, c: f64): v128 {
+    const next: v128 = uint64x2();
+    const u: v128 = gammaUniformx2(uint64x2());
+    let x: v128 = normalFastx2(next);
+    if (normalRejectx2(x)) x = normalFinishx2(next, x);
+
+    const v: v128 = gammaCubex2(x, f64x2.splat(c));
+    if (!gammaRejectx2(x, v, u)) return f64x2.mul(v, f64x2.splat(d));
+
+    return f64x2(
+        gammaFinish(f64x2.extract_lane(x, 0), f64x2.extract_lane(v, 0), f64x2.extract_lane(u, 0), d, c),
+        gammaFinish(f64x2.extract_lane(x, 1), f64x2.extract_lane(v, 1), f64x2.extract_lane(u, 1), d, c)
+    );
+}
+
+/**
+ * Fills the provided array with this generator's next set of gamma distributed numbers.
+ * 
+ * Utilizes SIMD: candidates for 2 numbers are built and squeezed together, and the
+ * rare candidates that fail the squeeze are finished one at a time.
+ * 
+ * @param shape The shape (`k`) of the distribution, greater than 0.
+ * @param scale The scale (`θ`) of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gamma53Array(shape: f64, scale: f64, arr: Float64Array): void {
+    const d: f64 = gammaD(shape);
+    const c: f64 = gammaC(d);
+    const power: f64 = gammaBoostPower(shape);
+    const scalex2: v128 = f64x2.splat(scale);
+    let ptr: usize = arr.dataStart;
+    let z: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        z = gammaStandardx2(d, c);
+        if (power != 0.0) z = f64x2.mul(z, gammaBoostx2(uint64x2(), power));
+
+        v128.store(ptr, f64x2.mul(z, scalex2));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of beta distributed numbers
+ * in range [0, 1].
+ * 
+ * Utilizes SIMD: candidates for 2 numbers are built and squeezed together, and the
+ * rare candidates that fail the squeeze are finished one at a time.
+ * 
+ * @param a The first shape (`α`) of the distribution, greater than 0.
+ * @param b The second shape (`β`) of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function beta53Array(a: f64, b: f64, arr: Float64Array): void {
+    const dA: f64 = gammaD(a);
+    const cA: f64 = gammaC(dA);
+    const powerA: f64 = gammaBoostPower(a);
+    const dB: f64 = gammaD(b);
+    const cB: f64 = gammaC(dB);
+    const powerB: f64 = gammaBoostPower(b);
+    let ptr: usize = arr.dataStart;
+    let x: v128;
+    let y: v128;
+    let ux: v128;
+    let uy: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        x = gammaStandardx2(dA, cA);
+        y = gammaStandardx2(dB, cB);
+
+        if (powerA == 0.0 && powerB == 0.0) {
+            v128.store(ptr, f64x2.div(x, f64x2.add(x, y)));
+        } else {
+            // boosts are applied as logarithms, one lane at a time
+            ux = gammaUniformx2(uint64x2());
+            uy = gammaUniformx2(uint64x2());
+            v128.store(ptr, f64x2(
+                betaBoosted(
+                    f64x2.extract_lane(x, 0), f64x2.extract_lane(y, 0),
+                    f64x2.extract_lane(ux, 0), f64x2.extract_lane(uy, 0), powerA, powerB
+                ),
+                betaBoosted(
+                    f64x2.extract_lane(x, 1), f64x2.extract_lane(y, 1),
+                    f64x2.extract_lane(ux, 1), f64x2.extract_lane(uy, 1), powerA, powerB
+                )
+            ));
+        }
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of chi-squared distributed
+ * numbers: gamma numbers with shape `k` / 2 and scale 2.
+ * 
+ * Utilizes SIMD, like {@link gamma53Array}.
+ * 
+ * @param k The degrees of freedom of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function chiSquared53Array(k: f64, arr: Float64Array): void {
+    gamma53Array(0.5 * k, 2.0, arr);
+}
+
+/**
+ * Finishes a Poisson number from `poissonInversion` or `poissonTransformedRejection`:
+ * kept, or replaced by a new number from {@link poissonNext} if it failed.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function poissonFinish(k: f64): f64 {
+    return isNaN(k) ? poissonNext() : k;
+}
+
+/**
+ * Finishes a binomial number from `binomialInversion` or `binomialBtpe`: flipped,
+ * or replaced by a new number from {@link binomialNext} if it failed.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function binomialFinish(k: f64): f64 {
+    return isNaN(k) ? binomialNext() : binomialFlip(k);
+}
+
+/**
+ * Fills the provided array with this generator's next set of Poisson distributed numbers.
+ * 
+ * Utilizes SIMD: uniform numbers are drawn for every lane at once, and the rare lanes
+ * that fail are redrawn one at a time.
+ * 
+ * @param lambda The mean (`λ`) of the distribution, at least 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function poissonArray(lambda: f64, arr: Float64Array): void {
+    poissonSetup(lambda);
+    let ptr: usize = arr.dataStart;
+    let u: v128;
+    let v: v128;
+
+    if (poissonInverts()) {
+        // each uniform number is inverted to its own count
+        for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+            u = uint64x2_to_float53x2(uint64x2());
+            v128.store(ptr, f64x2(
+                poissonFinish(poissonInversion(f64x2.extract_lane(u, 0))),
+                poissonFinish(poissonInversion(f64x2.extract_lane(u, 1)))
+            ));
+            ptr += 16;
+        }
+    } else {
+        // each candidate takes its 2 uniform numbers from matching lanes of 2 vectors
+        for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+            u = uint64x2_to_float53x2(uint64x2());
+            v = uint64x2_to_float53x2(uint64x2());
+            v128.store(ptr, f64x2(
+                poissonFinish(poissonTransformedRejection(f64x2.extract_lane(u, 0), f64x2.extract_lane(v, 0))),
+                poissonFinish(poissonTransformedRejection(f64x2.extract_lane(u, 1), f64x2.extract_lane(v, 1)))
+            ));
+            ptr += 16;
+        }
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of binomially distributed numbers.
+ * 
+ * Utilizes SIMD: uniform numbers are drawn for every lane at once, and the rare lanes
+ * that fail are redrawn one at a time.
+ * 
+ * @param n The number of trials, at least 0.
+ * @param p The success probability of each trial, in range [0, 1].
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function binomialArray(n: i32, p: f64, arr: Float64Array): void {
+    binomialSetup(<f64>n, p);
+    let ptr: usize = arr.dataStart;
+    let u: v128;
+    let v: v128;
+
+    if (binomialInverts()) {
+        // each uniform number is inverted to its own count
+        for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+            u = uint64x2_to_float53x2(uint64x2());
+            v128.store(ptr, f64x2(
+                binomialFinish(binomialInversion(f64x2.extract_lane(u, 0))),
+                binomialFinish(binomialInversion(f64x2.extract_lane(u, 1)))
+            ));
+            ptr += 16;
+        }
+    } else {
+        // each candidate takes its 2 uniform numbers from matching lanes of 2 vectors
+        for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+            u = uint64x2_to_float53x2(uint64x2());
+            v = uint64x2_to_float53x2(uint64x2());
+            v128.store(ptr, f64x2(
+                binomialFinish(binomialBtpe(f64x2.extract_lane(u, 0), f64x2.extract_lane(v, 0))),
+                binomialFinish(binomialBtpe(f64x2.extract_lane(u, 1), f64x2.extract_lane(v, 1)))
+            ));
+            ptr += 16;
+        }
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of geometric distributed numbers.
+ * 
+ * Utilizes SIMD: draws the random numbers for 2 results at once.
+ * 
+ * @param p The success probability of each trial, in range (0, 1].
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function geometricArray(p: f64, arr: Float64Array): void {
+    const scale: f64 = geometricScale(p);
+    let ptr: usize = arr.dataStart;
+    let next: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        next = uint64x2();
+        v128.store(ptr, f64x2(
+            geometricSkip(v128.extract_lane<u64>(next, 0), scale),
+            geometricSkip(v128.extract_lane<u64>(next, 1), scale)
+        ));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the start of the provided array with the indices of up to `max` successes among
+ * `n` Bernoulli trials with probability `p`, numbered from `start`, and returns their count.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function sparseIndices(n: f64, p: f64, start: f64, arr: Float64Array, max: i32): i32 {
+    const scale: f64 = geometricScale(p);
+    let index: f64 = start - 1.0;
+    let count: i32 = 0;
+    let next: v128;
+
+    while (count < max) {
+        // each lane skips to the next success in turn
+        next = uint64x2();
+        index += 1.0 + geometricSkip(v128.extract_lane<u64>(next, 0), scale);
+        if (index >= n) break;
+        unchecked(arr[count] = index);
+        if (++count == max) break;
+        index += 1.0 + geometricSkip(v128.extract_lane<u64>(next, 1), scale);
+        if (index >= n) break;
+        unchecked(arr[count] = index);
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * Fills the start of the provided array with the indices of the successes among `n`
+ * Bernoulli trials that each succeed with probability `p`, numbered from `start`, until
+ * either the trials or the array run out.
+ * 
+ * Skips over failed trials with geometric numbers, so only the successes cost a random number.
+ * 
+ * Utilizes SIMD: draws the random numbers for 2 skips at once.
+ * 
+ * @param n The number of trials, numbered from 0.
+ * @param p The success probability of each trial, in range [0, 1].
+ * @param start The number of the first trial to run, to continue from the trial
+ * after the last success of a previous call that filled its array.
+ * @param arr The array to fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * 
+ * @returns The number of successes written to the start of the array.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function sparseBernoulliIndices(n: f64, p: f64, start: f64, arr: Float64Array): i32 {
+    return sparseIndices(n, p, start, arr, arr.length);
+}
+
+/**
+ * Fills the start of the provided array with the edges of a G(`nodes`, `p`) random graph,
+ * in which each of the `nodes`(`nodes` - 1) / 2 possible edges is included with probability
+ * `p`, until either the possible edges or the array run out.
+ * 
+ * Each edge is written as its lower node and then its higher node, and edges are ordered by
+ * their higher node and then their lower node. Possible edges are numbered in that order,
+ * from 0, so that edge (`v`, `w`) is number `w`(`w` - 1) / 2 + `v`.
+ * 
+ * Skips over missing edges with geometric numbers, so only the included edges cost
+ * a random number.
+ * 
+ * Utilizes SIMD: draws the random numbers for 2 skips at once.
+ * 
+ * @param nodes The number of nodes, numbered from 0.
+ * @param p The probability of each edge, in range [0, 1].
+ * @param start The number of the first possible edge to consider, to continue from the
+ * edge after the last one of a previous call that filled its array.
+ * @param arr The array to fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * 
+ * @returns The number of edges written to the start of the array, 2 elements each.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function randomGraphEdges(nodes: f64, p: f64, start: f64, arr: Float64Array): i32 {
+    const count: i32 = sparseIndices(pairCount(nodes), p, start, arr, arr.length >> 1);
+    pairsToEdges(arr, count);
+    return count;
+}
+
+/**
+ * Finishes a Zipf number from `zipfRejectionInversion`: kept, or replaced by a new number
+ * from {@link zipfNext} if it was rejected.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function zipfFinish(k: f64): f64 {
+    return isNaN(k) ? zipfNext() : k;
+}
+
+/**
+ * Fills the provided array with this generator's next set of Zipf distributed numbers.
+ * 
+ * Utilizes SIMD: uniform numbers are drawn for every lane at once, and the rare lanes
+ * that are rejected are redrawn one at a time.
+ * 
+ * @param n The number of ranks, at least 1.
+ * @param s The exponent of the distribution, at least 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function zipfArray(n: f64, s: f64, arr: Float64Array): void {
+    zipfSetup(n, s);
+    let ptr: usize = arr.dataStart;
+    let u: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        u = uint64x2_to_float53x2(uint64x2());
+        v128.store(ptr, f64x2(
+            zipfFinish(zipfRejectionInversion(f64x2.extract_lane(u, 0))),
+            zipfFinish(zipfRejectionInversion(f64x2.extract_lane(u, 1)))
+        ));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of categorical numbers, drawn
+ * from an alias table built with `aliasTableBuild`.
+ * 
+ * Uses a single random number and one table lookup for each category drawn, and the table
+ * can be reused for any number of fills.
+ * 
+ * Utilizes SIMD: draws the random numbers for 2 categories at once.
+ * 
+ * @param table The alias table. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function categoricalArray(table: Uint64Array, arr: Float64Array): void {
+    const entries: usize = table.dataStart;
+    const size: u64 = <u64>table.length;
+    let ptr: usize = arr.dataStart;
+    let next: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        next = uint64x2();
+        v128.store(ptr, f64x2(
+            aliasPick(v128.extract_lane<u64>(next, 0), entries, size),
+            aliasPick(v128.extract_lane<u64>(next, 1), entries, size)
+        ));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of empirical numbers, drawn by
+ * inversion from a tabulated, piecewise-linear CDF, built into a table with
+ * `empiricalTableBuild`.
+ * 
+ * Uses a single random number, a guide table lookup and a short search for each value drawn,
+ * and the table can be reused for any number of fills.
+ * 
+ * Utilizes SIMD: draws the uniform numbers and interpolates within the segments for 2 values
+ * at once.
+ * 
+ * @param table The empirical table. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function empiricalArray(table: Float64Array, arr: Float64Array): void {
+    const entries: usize = table.dataStart;
+    const segments: i32 = empiricalSegments(table.length);
+    let ptr: usize = arr.dataStart;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        v128.store(ptr, empiricalValuex2(uint64x2_to_float53x2(uint64x2()), entries, segments));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Cauchy distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * Utilizes SIMD: draws the uniform numbers, and scales and shifts the results, for 2 numbers
+ * at once.
+ * 
+ * @param location The location of the distribution: its median.
+ * @param scale The scale of the distribution, greater than 0. It's the half width at half
+ * maximum.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function cauchy53Array(location: f64, scale: f64, arr: Float64Array): void {
+    const locationx2: v128 = f64x2.splat(location);
+    const scalex2: v128 = f64x2.splat(scale);
+    let ptr: usize = arr.dataStart;
+    let z: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        z = cauchyInversex2(inverseUniformx2(uint64x2()));
+        v128.store(ptr, f64x2.add(locationx2, f64x2.mul(scalex2, z)));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Laplace distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * Utilizes SIMD: draws the uniform numbers, and scales and shifts the results, for 2 numbers
+ * at once.
+ * 
+ * @param location The location of the distribution: its mean.
+ * @param scale The scale of the distribution, greater than 0. The variance is 2 * `scale`^2.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function laplace53Array(location: f64, scale: f64, arr: Float64Array): void {
+    const locationx2: v128 = f64x2.splat(location);
+    const scalex2: v128 = f64x2.splat(scale);
+    let ptr: usize = arr.dataStart;
+    let z: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        z = laplaceInversex2(inverseUniformx2(uint64x2()));
+        v128.store(ptr, f64x2.add(locationx2, f64x2.mul(scalex2, z)));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of logistic distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * Utilizes SIMD: draws the uniform numbers, and scales and shifts the results, for 2 numbers
+ * at once.
+ * 
+ * @param location The location of the distribution: its mean.
+ * @param scale The scale of the distribution, greater than 0. The variance is (π * `scale`)^2
+ * / 3.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function logistic53Array(location: f64, scale: f64, arr: Float64Array): void {
+    const locationx2: v128 = f64x2.splat(location);
+    const scalex2: v128 = f64x2.splat(scale);
+    let ptr: usize = arr.dataStart;
+    let z: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        z = logisticInversex2(inverseUniformx2(uint64x2()));
+        v128.store(ptr, f64x2.add(locationx2, f64x2.mul(scalex2, z)));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Gumbel distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * Utilizes SIMD: draws the uniform numbers, and scales and shifts the results, for 2 numbers
+ * at once.
+ * 
+ * @param location The location of the distribution: its mode.
+ * @param scale The scale of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gumbel53Array(location: f64, scale: f64, arr: Float64Array): void {
+    const locationx2: v128 = f64x2.splat(location);
+    const scalex2: v128 = f64x2.splat(scale);
+    let ptr: usize = arr.dataStart;
+    let z: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        z = gumbelInversex2(inverseUniformx2(uint64x2()));
+        v128.store(ptr, f64x2.add(locationx2, f64x2.mul(scalex2, z)));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Weibull distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * Utilizes SIMD: draws the uniform numbers, and scales the results, for 2 numbers at once.
+ * 
+ * @param shape The shape (`k`) of the distribution, greater than 0. Below 1, the failure rate
+ * falls over time; above 1, it rises.
+ * @param scale The scale (`λ`) of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function weibull53Array(shape: f64, scale: f64, arr: Float64Array): void {
+    const invShape: f64 = 1.0 / shape;
+    const scalex2: v128 = f64x2.splat(scale);
+    let ptr: usize = arr.dataStart;
+    let z: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        z = weibullInversex2(inverseUniformx2(uint64x2()), invShape);
+        v128.store(ptr, f64x2.mul(scalex2, z));
+        ptr += 16;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Pareto distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * Utilizes SIMD: draws the uniform numbers, and scales the results, for 2 numbers at once.
+ * 
+ * @param shape The shape (`α`) of the distribution, greater than 0. Its mean is only finite
+ * for shapes above 1, and its variance for shapes above 2.
+ * @param scale The scale of the distribution, greater than 0: its minimum.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function pareto53Array(shape: f64, scale: f64, arr: Float64Array): void {
+    const invShape: f64 = 1.0 / shape;
+    const scalex2: v128 = f64x2.splat(scale);
+    let ptr: usize = arr.dataStart;
+    let z: v128;
+
+    for (let i: i32 = 0; i < arr.length - 1; i += 2) {
+        z = paretoInversex2(inverseUniformx2(uint64x2()), invShape);
+        v128.store(ptr, f64x2.mul(scalex2, z));
+        ptr += 16;
+    }
+}
@@ -0,0 +1,1499 @@
+/**
+ * An AssemblyScript implementation of the PCG64 DXSM pseudo random number generator,
+ * a 64-bit generator with 128 bits of state and unique stream selection.
+ *
+ * Unlike {@link PCG}, which chains two 32-bit outputs for every 64-bit or 53-bit value,
+ * this generator produces a full 64-bit output from a single state step.
+ * @packageDocumentation
+ */
+
+/*
+* Based on the PCG C++ Implementation (pcg_engines::cm_setseq_dxsm_128_64)
+* (c) 2014-2019 M.E. O'Neill / pcg-random.org
+* https://github.com/imneme/pcg-cpp
+*
+* Which is licensed under Apache License 2.0
+* https://www.apache.org/licenses/LICENSE-2.0
+*/
+
+import {
+    uint64_to_uint53AsFloat,
+    uint64_to_uint32AsFloat,
+    uint64_to_float53,
+    uint64_to_coord53,
+    uint64_to_coord53Squared
+} from '../common/conversion';
+import { mulHigh64 } from '../common/uint128';
+import {
+    lemireProduct,
+    lemireFraction,
+    lemireThreshold,
+    rangeToBound,
+    recycleCount,
+    recyclePower,
+    recycleThreshold,
+    recycleDigit,
+    recycleFraction
+} from '../common/bounded';
+import {
+    normalLayer,
+    normalMagnitude,
+    normalInside,
+    normalSign,
+    normalFast,
+    normalWedge,
+    normalTail
+} from '../common/normal';
+import {
+    exponentialLayer,
+    exponentialMagnitude,
+    exponentialInside,
+    exponentialFast,
+    exponentialWedge,
+    exponentialTail
+} from '../common/exponential';
+import {
+    gammaD,
+    gammaC,
+    gammaBoostPower,
+    gammaCube,
+    gammaSqueeze,
+    gammaAccept,
+    gammaUniform,
+    gammaBoost,
+    betaBoosted
+} from '../common/gamma';
+import {
+    poissonSetup,
+    poissonInverts,
+    poissonInversion,
+    poissonTransformedRejection
+} from '../common/poisson';
+import {
+    binomialSetup,
+    binomialInverts,
+    binomialInversion,
+    binomialBtpe,
+    binomialFlip
+} from '../common/binomial';
+import { geometricScale, geometricSkip, pairCount, pairsToEdges } from '../common/geometric';
+import { zipfSetup, zipfRejectionInversion } from '../common/zipf';
+import { aliasPick } from '../common/alias';
+import { empiricalSegments, empiricalValue } from '../common/empirical';
+import {
+    inverseUniform,
+    cauchyInverse,
+    laplaceInverse,
+    logisticInverse,
+    gumbelInverse,
+    weibullInverse,
+    paretoInverse
+} from '../common/inverse-transform';
+
+// Expose array memory management functions for this WASM module to JS consumers
+export { allocUint64Array, allocFloat64Array } from '../common/memory';
+
+// Expose alias table building, for categorical() and categoricalArray()
+export { aliasTableBuild } from '../common/alias';
+
+// Expose empirical table building, for empirical() and empiricalArray()
+export { empiricalTableBuild } from '../common/empirical';
+
+// The "cheap multiplier": a 64-bit LCG multiplier for the 128-bit state, which needs
+// one widening multiply per step rather than a full 128 x 128-bit multiply.
+// DXSM also uses it to mix the output.
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const CHEAP_MULTIPLIER: u64 = 0xda942042e4dd58b5;
+
+// In PCG, the stream increment is used to provide a unique random stream.
+// Note: This number must always be odd! This is enforced below.
+// The default is the reference implementation's default 128-bit increment.
+let streamIncrementHi: u64 = 6364136223846793005;
+let streamIncrementLo: u64 = 1442695040888963407;
+
+// Internal PCG state (128 bits)
+let stateHi: u64 = 0;
+let stateLo: u64 = 0;
+
+/** Number of seeds required for this generator's {@link setSeeds} function. */
+export const SEED_COUNT: i32 = 2;
+
+/**
+ * Advances the 128-bit LCG state once: state = state * CHEAP_MULTIPLIER + streamIncrement
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function step(): void {
+    const productLo: u64 = stateLo * CHEAP_MULTIPLIER;
+    const productHi: u64 = stateHi * CHEAP_MULTIPLIER + mulHigh64(stateLo, CHEAP_MULTIPLIER);
+
+    stateLo = productLo + streamIncrementLo;
+    stateHi = productHi + streamIncrementHi + <u64>(stateLo < productLo);
+}
+
+/**
+ * Initializes this generator's internal state with the provided random seeds,
+ * which form the high and low halves of a 128-bit seed.
+ *
+ * Follows the PCG reference implementation initialization pattern, which:
+ * 1. Sets state to 0
+ * 2. Advances state once (with current stream increment)
+ * 3. Adds the seed value to state
+ * 4. Advances state again
+ *
+ * This "stirs" the seed using the current stream increment to ensure
+ * proper initialization.
+ *
+ * IMPORTANT: If using a custom stream increment, call setStreamIncrement()
+ * BEFORE calling this function, as the increment must be set before the
+ * seed is mixed in.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function setSeeds(seedHi: u64, seedLo: u64): void {
+    stateHi = 0;
+    stateLo = 0;
+    step();                     // First advancement
+
+    stateLo += seedLo;          // Mix in seed
+    stateHi += seedHi + <u64>(stateLo < seedLo);
+
+    step();                     // Second advancement
+}
+
+/**
+ * Optionally chooses the unique stream to be provided by this generator.
+ *
+ * Two generators given the same seed value(s) will still provide a unique stream
+ * of random numbers as long as they use different stream increments.
+ *
+ * IMPORTANT: Must be called BEFORE setSeeds() to take effect properly.
+ * The seed initialization process "stirs" the seed using the current stream
+ * increment. If you change the increment after seeding, the initialization
+ * will not match the PCG reference implementation behavior.
+ *
+ * @param inc Any integer. It should be unique amongst stream increments used
+ * for other parallel generator instances that have been seeded uniformly.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function setStreamIncrement(inc: u64): void {
+    // Ensure the 128-bit increment is odd regardless of value given, in a way
+    // that allows for consecutive integers and still achieves uniqueness.
+    streamIncrementHi = inc >>> 63;
+    streamIncrementLo = (inc << 1) | 1;
+}
+
+// High word of the last mul128() product
+let mulResultHi: u64 = 0;
+
+/**
+ * Multiplies two 128-bit values (mod 2^128), returning the low word of the
+ * product and storing its high word in `mulResultHi`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function mul128(aHi: u64, aLo: u64, bHi: u64, bLo: u64): u64 {
+    mulResultHi = mulHigh64(aLo, bLo) + aHi * bLo + aLo * bHi;
+    return aLo * bLo;
+}
+
+/**
+ * Advances this generator's state by `delta` steps in O(log delta) time, as if
+ * {@link uint64} had been called `delta` times and its results discarded.
+ *
+ * Each step corresponds to one 64-bit output, so every single value function
+ * consumes 1 step.
+ *
+ * Based on the reference implementation's `pcg_advance_lcg_128`, which uses Brown's
+ * "Random Number Generation with Arbitrary Stride" (1994), with 128-bit arithmetic.
+ *
+ * @param delta The number of steps to advance.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function advance(delta: u64): void {
+    let curMultHi: u64 = 0;
+    let curMultLo: u64 = CHEAP_MULTIPLIER;
+    let curPlusHi: u64 = streamIncrementHi;
+    let curPlusLo: u64 = streamIncrementLo;
+    let accMultHi: u64 = 0;
+    let accMultLo: u64 = 1;
+    let accPlusHi: u64 = 0;
+    let accPlusLo: u64 = 0;
+    let lo: u64;
+
+    // Fast exponentiation of the affine step: state -> state * CHEAP_MULTIPLIER + streamIncrement
+    while (delta != 0) {
+        if ((delta & 1) != 0) {
+            // accMult *= curMult
+            accMultLo = mul128(accMultHi, accMultLo, curMultHi, curMultLo);
+            accMultHi = mulResultHi;
+
+            // accPlus = accPlus * curMult + curPlus
+            lo = mul128(accPlusHi, accPlusLo, curMultHi, curMultLo);
+            accPlusLo = lo + curPlusLo;
+            accPlusHi = mulResultHi + curPlusHi + <u64>(accPlusLo < lo);
+        }
+
+        // curPlus = (curMult + 1) * curPlus
+        const curMultPlusOneLo: u64 = curMultLo + 1;
+        const curMultPlusOneHi: u64 = curMultHi + <u64>(curMultPlusOneLo == 0);
+        curPlusLo = mul128(curMultPlusOneHi, curMultPlusOneLo, curPlusHi, curPlusLo);
+        curPlusHi = mulResultHi;
+
+        // curMult *= curMult
+        curMultLo = mul128(curMultHi, curMultLo, curMultHi, curMultLo);
+        curMultHi = mulResultHi;
+
+        delta >>>= 1;
+    }
+
+    // state = accMult * state + accPlus
+    lo = mul128(accMultHi, accMultLo, stateHi, stateLo);
+    stateLo = lo + accPlusLo;
+    stateHi = mulResultHi + accPlusHi + <u64>(stateLo < lo);
+}
+
+/**
+ * Gets this generator's next unsigned 64-bit integer.
+ * 
+ * @returns This generator's next unsigned 64-bit integer.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint64(): u64 {
+    // DXSM ("double xorshift multiply") output function, applied to the state before stepping
+    let hi: u64 = stateHi;
+    const lo: u64 = stateLo | 1;
+
+    step();
+
+    hi ^= hi >>> 32;
+    hi *= CHEAP_MULTIPLIER;
+    hi ^= hi >>> 48;
+    return hi * lo;
+}
+
+/**
+ * Gets this generator's next unsigned 53-bit integer.
+ * 
+ * @returns This generator's next unsigned 53-bit integer, returned
+ * as an `f64` so that the JS runtime converts it to a `number`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint53AsFloat(): f64 {
+    return uint64_to_uint53AsFloat(uint64());
+}
+
+/**
+ * Gets this generator's next unsigned 32-bit integer.
+ * 
+ * @returns An unsigned 32-bit integer, returned as an `f64` so that
+ * the JS runtime converts it to a `number`.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32AsFloat(): f64 {
+    return uint64_to_uint32AsFloat(uint64());
+}
+
+/**
+ * Gets this generator's next 53-bit floating point number in range [0, 1).
+ * 
+ * @returns A 53-bit floating point number in range [0, 1).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function float53(): f64 {
+    return uint64_to_float53(uint64());
+}
+
+/**
+ * Gets this generator's next 53-bit floating point number in range [-1, 1).
+ * 
+ * Can be considered part of a "coordinate" in a unit circle with radius 1.
+ * Useful for Monte Carlo simulation.
+ * 
+ * @returns A 53-bit floating point number in range [-1, 1).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53(): f64 {
+    return uint64_to_coord53(uint64());
+}
+
+/**
+ * Gets the square of this generator's next 53-bit floating point number in range [-1, 1).
+ * 
+ * Useful for Monte Carlo simulation.
+ * 
+ * @returns A 53-bit floating point number in range [-1, 1), multiplied by itself.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53Squared(): f64 {
+    return uint64_to_coord53Squared(uint64());
+}
+
+/**
+ * Draws Lemire products for `bound` (up to 2^32) until one is unbiased:
+ * its high 32 bits are then a uniform integer in range [0, `bound`).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function boundedProduct(bound: u64): u64 {
+    let product: u64 = lemireProduct(<u32>(uint64() >>> 32), bound);
+
+    // the threshold is below `bound`, so it's only computed when it could reject
+    if (lemireFraction(product) < bound) {
+        const threshold: u64 = lemireThreshold(bound);
+        while (lemireFraction(product) < threshold) {
+            product = lemireProduct(<u32>(uint64() >>> 32), bound);
+        }
+    }
+
+    return product;
+}
+
+/**
+ * Gets this generator's next unsigned 32-bit integer in range [0, `bound`), without bias.
+ * 
+ * Uses Lemire's nearly divisionless method: an output's upper 32 bits are scaled
+ * to the range by multiplication, and the rare outputs that would bias the result
+ * are rejected and redrawn.
+ * 
+ * @param bound The exclusive upper bound, from 1 to 2^32 - 1.
+ * 
+ * @returns An unsigned 32-bit integer in range [0, `bound`).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32Below(bound: u32): u32 {
+    return <u32>(boundedProduct(<u64>bound) >>> 32);
+}
+
+/**
+ * Gets this generator's next 32-bit integer in range [`min`, `max`] (inclusive), without bias.
+ * 
+ * Uses the same method as {@link uint32Below}, so any range up to every `i32` is supported.
+ * 
+ * @param min The lowest integer to return.
+ * @param max The highest integer to return, at least `min`.
+ * 
+ * @returns A 32-bit integer in range [`min`, `max`].
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function intRange(min: i32, max: i32): i32 {
+    return min + <i32>(boundedProduct(rangeToBound(min, max)) >>> 32);
+}
+
+/**
+ * Finishes a standard normal number whose random value's point fell outside its
+ * ziggurat layer: in the layer's wedge, or past the base layer in the tail.
+ */
+function normalSlow(next: u64): f64 {
+    let layer: i32 = normalLayer(next);
+    let z: f64 = normalMagnitude(next, layer);
+
+    while (!normalInside(z, layer)) {
+        if (layer == 0) {
+            // the tail keeps the sign of the value that reached it
+            do {
+                z = normalTail(uint64(), uint64());
+            } while (isNaN(z));
+            break;
+        }
+
+        if (normalWedge(z, layer, uint64())) break;
+
+        next = uint64();
+        layer = normalLayer(next);
+        z = normalMagnitude(next, layer);
+    }
+
+    return normalSign(next, z);
+}
+
+/**
+ * Gets this generator's next normally distributed number.
+ * 
+ * Uses the 256-layer ziggurat method, which accepts about 98.5% of numbers with a
+ * table lookup, a multiply and a compare, and only needs `exp` or `log` for the rest.
+ * 
+ * @param mean The mean (center) of the distribution.
+ * @param stddev The standard deviation (spread) of the distribution.
+ * 
+ * @returns A normally distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normal53(mean: f64, stddev: f64): f64 {
+    const next: u64 = uint64();
+    let z: f64 = normalFast(next);
+    if (isNaN(z)) z = normalSlow(next);
+
+    return mean + stddev * z;
+}
+
+/**
+ * Finishes an exponential number whose random value's point fell outside its
+ * ziggurat layer: in the layer's wedge, or past the base layer in the tail.
+ */
+function exponentialSlow(next: u64): f64 {
+    let layer: i32 = exponentialLayer(next);
+    let z: f64 = exponentialMagnitude(next, layer);
+
+    while (!exponentialInside(z, layer)) {
+        if (layer == 0) return exponentialTail(uint64());
+        if (exponentialWedge(z, layer, uint64())) break;
+
+        next = uint64();
+        layer = exponentialLayer(next);
+        z = exponentialMagnitude(next, layer);
+    }
+
+    return z;
+}
+
+/**
+ * Gets this generator's next exponentially distributed number with rate 1.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function exponentialStandard(): f64 {
+    const next: u64 = uint64();
+    const z: f64 = exponentialFast(next);
+    return isNaN(z) ? exponentialSlow(next) : z;
+}
+
+/**
+ * Gets this generator's next exponentially distributed number, such as the wait
+ * until the next event of a process with `rate` events per unit of time.
+ * 
+ * Uses the 256-layer ziggurat method, which accepts about 97.8% of numbers with a
+ * table lookup, a multiply and a compare, and only needs `exp` or `log` for the rest.
+ * 
+ * @param rate The rate of the distribution, whose mean is 1 / `rate`.
+ * 
+ * @returns An exponentially distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponential53(rate: f64): f64 {
+    return exponentialStandard() * (1.0 / rate);
+}
+
+/**
+ * Gets this generator's next gamma distributed number with scale 1, for the `d` and `c`
+ * that `gammaD` and `gammaC` derive from its shape, using Marsaglia and Tsang's method.
+ * Shapes below 1 must still be boosted with `gammaBoost`.
+ */
+function gammaStandard(d: f64, c: f64): f64 {
+    let x: f64;
+    let v: f64;
+    let u: f64;
+
+    do {
+        do {
+            x = normal53(0.0, 1.0);
+            v = gammaCube(x, c);
+        } while (v <= 0.0);
+        u = gammaUniform(uint64());
+    } while (!gammaSqueeze(x, u) && !gammaAccept(x, v, u, d));
+
+    return d * v;
+}
+
+/**
+ * Gets this generator's next gamma distributed number with scale 1, boosted
+ * if its shape is below 1 (when its `gammaBoostPower` isn't 0).
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function gammaNext(d: f64, c: f64, power: f64): f64 {
+    const z: f64 = gammaStandard(d, c);
+    return power == 0.0 ? z : z * gammaBoost(uint64(), power);
+}
+
+/**
+ * Gets this generator's next beta distributed number, given the `d`, `c` and
+ * `gammaBoostPower` of each of its shapes.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function betaNext(dA: f64, cA: f64, powerA: f64, dB: f64, cB: f64, powerB: f64): f64 {
+    const x: f64 = gammaStandard(dA, cA);
+    const y: f64 = gammaStandard(dB, cB);
+    if (powerA == 0.0 && powerB == 0.0) return x / (x + y);
+
+    return betaBoosted(
+        x,
+        y,
+        powerA == 0.0 ? 1.0 : gammaUniform(uint64()),
+        powerB == 0.0 ? 1.0 : gammaUniform(uint64()),
+        powerA,
+        powerB
+    );
+}
+
+/**
+ * Gets this generator's next gamma distributed number.
+ * 
+ * Uses Marsaglia and Tsang's method: a cubed normal number, accepted by a cheap
+ * squeeze about 92% of the time, and otherwise by a test with 2 logarithms.
+ * 
+ * @param shape The shape (`k`) of the distribution, greater than 0.
+ * @param scale The scale (`θ`) of the distribution, greater than 0.
+ * The distribution's mean is `shape` * `scale`.
+ * 
+ * @returns A gamma distributed 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gamma53(shape: f64, scale: f64): f64 {
+    const d: f64 = gammaD(shape);
+    return gammaNext(d, gammaC(d), gammaBoostPower(shape)) * scale;
+}
+
+/**
+ * Gets this generator's next beta distributed number in range [0, 1].
+ * 
+ * Draws gamma numbers `x` and `y` with shapes `a` and `b` as {@link gamma53} does,
+ * and returns `x` / (`x` + `y`).
+ * 
+ * @param a The first shape (`α`) of the distribution, greater than 0.
+ * @param b The second shape (`β`) of the distribution, greater than 0.
+ * The distribution's mean is `a` / (`a` + `b`).
+ * 
+ * @returns A beta distributed 64-bit float in range [0, 1].
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function beta53(a: f64, b: f64): f64 {
+    const dA: f64 = gammaD(a);
+    const dB: f64 = gammaD(b);
+    return betaNext(dA, gammaC(dA), gammaBoostPower(a), dB, gammaC(dB), gammaBoostPower(b));
+}
+
+/**
+ * Gets this generator's next chi-squared distributed number: a gamma number
+ * with shape `k` / 2 and scale 2.
+ * 
+ * @param k The degrees of freedom of the distribution, greater than 0.
+ * The distribution's mean is `k`.
+ * 
+ * @returns A chi-squared distributed 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function chiSquared53(k: f64): f64 {
+    return gamma53(0.5 * k, 2.0);
+}
+
+/**
+ * Gets this generator's next Poisson distributed number, for the λ set up with `poissonSetup`.
+ */
+function poissonNext(): f64 {
+    let k: f64;
+
+    if (poissonInverts()) {
+        do {
+            k = poissonInversion(float53());
+        } while (isNaN(k));
+    } else {
+        do {
+            k = poissonTransformedRejection(float53(), float53());
+        } while (isNaN(k));
+    }
+
+    return k;
+}
+
+/**
+ * Gets this generator's next binomially distributed number, for the `n` and `p` set up
+ * with `binomialSetup`.
+ */
+function binomialNext(): f64 {
+    let k: f64;
+
+    if (binomialInverts()) {
+        do {
+            k = binomialInversion(float53());
+        } while (isNaN(k));
+    } else {
+        do {
+            k = binomialBtpe(float53(), float53());
+        } while (isNaN(k));
+    }
+
+    return binomialFlip(k);
+}
+
+/**
+ * Gets this generator's next Poisson distributed number: a count of events in an
+ * interval where they occur independently at mean rate `lambda`.
+ * 
+ * Uses inversion for a `lambda` below 10, and Hörmann's transformed rejection (PTRS)
+ * from 10 up, so the cost stays flat as `lambda` grows.
+ * 
+ * @param lambda The mean (`λ`) of the distribution, at least 0.
+ * 
+ * @returns A Poisson distributed integer, as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function poisson(lambda: f64): f64 {
+    poissonSetup(lambda);
+    return poissonNext();
+}
+
+/**
+ * Gets this generator's next binomially distributed number: a count of successes
+ * in `n` independent trials that each succeed with probability `p`.
+ * 
+ * Uses inversion while `n` times the smaller of `p` and 1 - `p` is below 30, and
+ * Kachitvichyanukul and Schmeiser's BTPE from 30 up, so the cost stays flat as `n` grows.
+ * 
+ * @param n The number of trials, at least 0.
+ * @param p The success probability of each trial, in range [0, 1].
+ * 
+ * @returns A binomially distributed integer in range [0, `n`], as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function binomial(n: i32, p: f64): f64 {
+    binomialSetup(<f64>n, p);
+    return binomialNext();
+}
+
+/**
+ * Gets this generator's next geometric distributed number: the number of failed trials
+ * before the first success, when each succeeds with probability `p`.
+ * 
+ * @param p The success probability of each trial, in range (0, 1].
+ * 
+ * @returns A geometric distributed integer, as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function geometric(p: f64): f64 {
+    return geometricSkip(uint64(), geometricScale(p));
+}
+
+/**
+ * Gets this generator's next Zipf distributed number, for the n and s set up with `zipfSetup`.
+ */
+function zipfNext(): f64 {
+    let k: f64;
+
+    do {
+        k = zipfRejectionInversion(float53());
+    } while (isNaN(k));
+
+    return k;
+}
+
+/**
+ * Gets this generator's next Zipf distributed number: a rank from 1 to `n`, drawn with
+ * probability proportional to 1 / rank^`s`.
+ * 
+ * Uses Hörmann and Derflinger's rejection-inversion, which needs no table, so memory use
+ * is constant however large `n` is.
+ * 
+ * @param n The number of ranks, at least 1.
+ * @param s The exponent of the distribution, at least 0.
+ * 
+ * @returns A Zipf distributed integer in range [1, `n`], as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function zipf(n: f64, s: f64): f64 {
+    zipfSetup(n, s);
+    return zipfNext();
+}
+
+/**
+ * Gets this generator's next categorical number: a category drawn from an alias table
+ * built with `aliasTableBuild`, with probability proportional to its weight.
+ * 
+ * Uses a single random number and one table lookup, however many categories there are.
+ * 
+ * @param table The alias table. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * 
+ * @returns A category, from 0 to the number of categories - 1, as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function categorical(table: Uint64Array): f64 {
+    return aliasPick(uint64(), table.dataStart, <u64>table.length);
+}
+
+/**
+ * Gets this generator's next empirical number: a value drawn by inversion from a tabulated,
+ * piecewise-linear CDF, built into a table with `empiricalTableBuild`.
+ * 
+ * Uses a single random number, a guide table lookup and a short search, however many
+ * points the CDF has.
+ * 
+ * @param table The empirical table. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * 
+ * @returns A value from the CDF's range, as a 64-bit float.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function empirical(table: Float64Array): f64 {
+    return empiricalValue(float53(), table.dataStart, empiricalSegments(table.length));
+}
+
+/**
+ * Gets this generator's next Cauchy distributed number, such as the ratio of 2 normal
+ * numbers, or a resonance line shape. It has no mean or variance, and its tails are very
+ * heavy.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param location The location of the distribution: its median.
+ * @param scale The scale of the distribution, greater than 0. It's the half width at half
+ * maximum.
+ * 
+ * @returns A Cauchy distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function cauchy53(location: f64, scale: f64): f64 {
+    return location + scale * cauchyInverse(inverseUniform(uint64()));
+}
+
+/**
+ * Gets this generator's next Laplace distributed number, a double exponential: the
+ * difference between 2 exponential numbers, such as noise for differential privacy.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param location The location of the distribution: its mean.
+ * @param scale The scale of the distribution, greater than 0. The variance is 2 * `scale`^2.
+ * 
+ * @returns A Laplace distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function laplace53(location: f64, scale: f64): f64 {
+    return location + scale * laplaceInverse(inverseUniform(uint64()));
+}
+
+/**
+ * Gets this generator's next logistic distributed number, such as the noise in a logit
+ * model, or an Elo rating difference. Its shape is close to a normal distribution's, with
+ * heavier tails.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param location The location of the distribution: its mean.
+ * @param scale The scale of the distribution, greater than 0. The variance is (π * `scale`)^2
+ * / 3.
+ * 
+ * @returns A logistic distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function logistic53(location: f64, scale: f64): f64 {
+    return location + scale * logisticInverse(inverseUniform(uint64()));
+}
+
+/**
+ * Gets this generator's next Gumbel distributed number, such as the largest of many
+ * samples, or the noise of the Gumbel-max trick for sampling categories.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param location The location of the distribution: its mode.
+ * @param scale The scale of the distribution, greater than 0.
+ * 
+ * @returns A Gumbel distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gumbel53(location: f64, scale: f64): f64 {
+    return location + scale * gumbelInverse(inverseUniform(uint64()));
+}
+
+/**
+ * Gets this generator's next Weibull distributed number, such as a time to failure, or a
+ * wind speed.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param shape The shape (`k`) of the distribution, greater than 0. Below 1, the failure rate
+ * falls over time; above 1, it rises.
+ * @param scale The scale (`λ`) of the distribution, greater than 0.
+ * 
+ * @returns A Weibull distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function weibull53(shape: f64, scale: f64): f64 {
+    return scale * weibullInverse(inverseUniform(uint64()), 1.0 / shape);
+}
+
+/**
+ * Gets this generator's next Pareto distributed number, such as a file size, a wealth or a
+ * city population, from a power law above a minimum.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF.
+ * 
+ * @param shape The shape (`α`) of the distribution, greater than 0. Its mean is only finite
+ * for shapes above 1, and its variance for shapes above 2.
+ * @param scale The scale of the distribution, greater than 0: its minimum.
+ * 
+ * @returns A Pareto distributed 64-bit float with 52 bits of randomness.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function pareto53(shape: f64, scale: f64): f64 {
+    return scale * paretoInverse(inverseUniform(uint64()), 1.0 / shape);
+}
+
+
+/* 
+* Perf:
+* If we extract the following mostly-repeated functions to common logic, 
+* define a type for the function, and pass the generator function as a 
+* parameter, it runs somewhat slower. I believe this is because of runtime
+* function call overhead, and so it can't be avoided using @inline.
+* 
+* In the interest of speed over DRY cleanliness, we repeat this logic in each
+* generator type.
+* 
+* The same speed caveat applies when wrapping the generator logic in a class:
+* Everything slows down somewhat. So we opt instead for global functions and speed.
+* 
+* TODO: Add performance tradeoff examples to demos.
+*/
+
+
+/**
+ * Monte Carlo test: Generates random (x,y) coordinates in range [-1, 1), and
+ * counts how many of them fall inside the unit circle with radius 1.
+ * 
+ * Can be used to estimate pi (π).
+ * 
+ * @param count The number of random (x,y) coordinate points in (-1, 1) to generate and check.
+ * 
+ * @returns The number of random points which fell *inside* of the unit circle with radius 1.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function batchTestUnitCirclePoints(count: i32): i32 {
+    let inCircle: i32 = 0;
+    let xSquared: f64;
+    let ySquared: f64;
+
+    for (let i: i32 = 0; i < count; i++) {
+        xSquared = coord53Squared();
+        ySquared = coord53Squared();
+
+        if (xSquared + ySquared <= 1.0) {
+            inCircle++;
+        }
+    }
+
+    return inCircle;
+}
+
+/**
+ * Fills the provided array with this generator's next set of unsigned 64-bit integers.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint64Array(arr: Uint64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = uint64());
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of unsigned 53-bit integers.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint53AsFloatArray(arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = uint53AsFloat());
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of unsigned 32-bit integers.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32AsFloatArray(arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = uint32AsFloat());
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of 53-bit floating point numbers
+ * in range [0, 1).
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function float53Array(arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = float53());
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of 53-bit floating point numbers
+ * in range [-1, 1).
+ * 
+ * Useful for Monte Carlo simulation.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53Array(arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = coord53());
+    }
+}
+
+/**
+ * Fills the provided array with the squares of this generator's next set of floating 
+ * point numbers in range [-1, 1).
+ * 
+ * Useful for Monte Carlo simulation.
+ * 
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function coord53SquaredArray(arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = coord53Squared());
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of unsigned 32-bit integers
+ * in range [0, `bound`), without bias.
+ * 
+ * @param bound The exclusive upper bound, from 1 to 2^32 - 1.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint32BelowArray(bound: u32, arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = <f64>uint32Below(bound));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of 32-bit integers
+ * in range [`min`, `max`] (inclusive), without bias.
+ * 
+ * @param min The lowest integer to return.
+ * @param max The highest integer to return, at least `min`.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function intRangeArray(min: i32, max: i32, arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = <f64>intRange(min, max));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of 32-bit integers
+ * in the small range [`min`, `max`] (inclusive), without bias.
+ * 
+ * Recycles the bits of each 64-bit output to extract as many integers as fit, e.g.
+ * over 20 dice rolls from every output, so far fewer outputs are generated than with
+ * {@link intRangeArray}. Best suited to ranges of up to 2^16 integers.
+ * 
+ * @param min The lowest integer to return.
+ * @param max The highest integer to return, at least `min`. The range can't span every `i32`.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function smallIntRangeArray(min: i32, max: i32, arr: Float64Array): void {
+    const bound: u64 = rangeToBound(min, max);
+    const count: i32 = recycleCount(bound);
+    const threshold: u64 = recycleThreshold(recyclePower(bound, count));
+    let ptr: usize = arr.dataStart;
+    let remaining: i32 = arr.length;
+    let x: u64;
+
+    while (remaining > 0) {
+        const stored: i32 = remaining < count ? remaining : count;
+
+        // redraw the whole batch if its final fraction shows it would be biased
+        do {
+            x = uint64();
+            for (let j: i32 = 0; j < stored; j++) {
+                store<f64>(ptr + (<usize>j << 3), <f64>recycleDigit(x, bound) + <f64>min);
+                x = recycleFraction(x, bound);
+            }
+            for (let j: i32 = stored; j < count; j++) {
+                x = recycleFraction(x, bound);
+            }
+        } while (x < threshold);
+
+        ptr += <usize>stored << 3;
+        remaining -= stored;
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of normally distributed numbers.
+ * 
+ * @param mean The mean (center) of the distribution.
+ * @param stddev The standard deviation (spread) of the distribution.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function normal53Array(mean: f64, stddev: f64, arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = normal53(mean, stddev));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of exponentially distributed numbers.
+ * 
+ * @param rate The rate of the distribution, whose mean is 1 / `rate`.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function exponential53Array(rate: f64, arr: Float64Array): void {
+    const scale: f64 = 1.0 / rate;
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = exponentialStandard() * scale);
+    }
+}
+
+/**
+ * Fills the provided array with the arrival times of this generator's next set of events
+ * in a Poisson process: each time is the previous one plus an exponentially distributed gap.
+ * 
+ * Pass the array's last time as the next call's `t0` to continue the same timeline.
+ * 
+ * @param rate The rate of the process, in events per unit of time.
+ * @param t0 The time the process starts from, before the first event.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function arrivalTimesArray(rate: f64, t0: f64, arr: Float64Array): void {
+    const scale: f64 = 1.0 / rate;
+    let time: f64 = t0;
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        time += exponentialStandard() * scale;
+        unchecked(arr[i] = time);
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of gamma distributed numbers.
+ * 
+ * @param shape The shape (`k`) of the distribution, greater than 0.
+ * @param scale The scale (`θ`) of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gamma53Array(shape: f64, scale: f64, arr: Float64Array): void {
+    const d: f64 = gammaD(shape);
+    const c: f64 = gammaC(d);
+    const power: f64 = gammaBoostPower(shape);
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = gammaNext(d, c, power) * scale);
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of beta distributed numbers
+ * in range [0, 1].
+ * 
+ * @param a The first shape (`α`) of the distribution, greater than 0.
+ * @param b The second shape (`β`) of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function beta53Array(a: f64, b: f64, arr: Float64Array): void {
+    const dA: f64 = gammaD(a);
+    const cA: f64 = gammaC(dA);
+    const powerA: f64 = gammaBoostPower(a);
+    const dB: f64 = gammaD(b);
+    const cB: f64 = gammaC(dB);
+    const powerB: f64 = gammaBoostPower(b);
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = betaNext(dA, cA, powerA, dB, cB, powerB));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of chi-squared distributed
+ * numbers: gamma numbers with shape `k` / 2 and scale 2.
+ * 
+ * @param k The degrees of freedom of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function chiSquared53Array(k: f64, arr: Float64Array): void {
+    gamma53Array(0.5 * k, 2.0, arr);
+}
+
+/**
+ * Fills the provided array with this generator's next set of Poisson distributed numbers.
+ * 
+ * @param lambda The mean (`λ`) of the distribution, at least 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function poissonArray(lambda: f64, arr: Float64Array): void {
+    poissonSetup(lambda);
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = poissonNext());
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of binomially distributed numbers.
+ * 
+ * @param n The number of trials, at least 0.
+ * @param p The success probability of each trial, in range [0, 1].
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function binomialArray(n: i32, p: f64, arr: Float64Array): void {
+    binomialSetup(<f64>n, p);
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = binomialNext());
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of geometric distributed numbers.
+ * 
+ * @param p The success probability of each trial, in range (0, 1].
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function geometricArray(p: f64, arr: Float64Array): void {
+    const scale: f64 = geometricScale(p);
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = geometricSkip(uint64(), scale));
+    }
+}
+
+/**
+ * Fills the start of the provided array with the indices of up to `max` successes among
+ * `n` Bernoulli trials with probability `p`, numbered from `start`, and returns their count.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+function sparseIndices(n: f64, p: f64, start: f64, arr: Float64Array, max: i32): i32 {
+    const scale: f64 = geometricScale(p);
+    let index: f64 = start - 1.0;
+    let count: i32 = 0;
+
+    while (count < max) {
+        index += 1.0 + geometricSkip(uint64(), scale);
+        if (index >= n) break;
+        unchecked(arr[count] = index);
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * Fills the start of the provided array with the indices of the successes among `n`
+ * Bernoulli trials that each succeed with probability `p`, numbered from `start`, until
+ * either the trials or the array run out.
+ * 
+ * Skips over failed trials with geometric numbers, so only the successes cost a random number.
+ * 
+ * @param n The number of trials, numbered from 0.
+ * @param p The success probability of each trial, in range [0, 1].
+ * @param start The number of the first trial to run, to continue from the trial
+ * after the last success of a previous call that filled its array.
+ * @param arr The array to fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * 
+ * @returns The number of successes written to the start of the array.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function sparseBernoulliIndices(n: f64, p: f64, start: f64, arr: Float64Array): i32 {
+    return sparseIndices(n, p, start, arr, arr.length);
+}
+
+/**
+ * Fills the start of the provided array with the edges of a G(`nodes`, `p`) random graph,
+ * in which each of the `nodes`(`nodes` - 1) / 2 possible edges is included with probability
+ * `p`, until either the possible edges or the array run out.
+ * 
+ * Each edge is written as its lower node and then its higher node, and edges are ordered by
+ * their higher node and then their lower node. Possible edges are numbered in that order,
+ * from 0, so that edge (`v`, `w`) is number `w`(`w` - 1) / 2 + `v`.
+ * 
+ * Skips over missing edges with geometric numbers, so only the included edges cost
+ * a random number.
+ * 
+ * @param nodes The number of nodes, numbered from 0.
+ * @param p The probability of each edge, in range [0, 1].
+ * @param start The number of the first possible edge to consider, to continue from the
+ * edge after the last one of a previous call that filled its array.
+ * @param arr The array to fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * 
+ * @returns The number of edges written to the start of the array, 2 elements each.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function randomGraphEdges(nodes: f64, p: f64, start: f64, arr: Float64Array): i32 {
+    const count: i32 = sparseIndices(pairCount(nodes), p, start, arr, arr.length >> 1);
+    pairsToEdges(arr, count);
+    return count;
+}
+
+/**
+ * Fills the provided array with this generator's next set of Zipf distributed numbers.
+ * 
+ * @param n The number of ranks, at least 1.
+ * @param s The exponent of the distribution, at least 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function zipfArray(n: f64, s: f64, arr: Float64Array): void {
+    zipfSetup(n, s);
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = zipfNext());
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of categorical numbers, drawn
+ * from an alias table built with `aliasTableBuild`.
+ * 
+ * Uses a single random number and one table lookup for each category drawn, and the table
+ * can be reused for any number of fills.
+ * 
+ * @param table The alias table. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function categoricalArray(table: Uint64Array, arr: Float64Array): void {
+    const entries: usize = table.dataStart;
+    const size: u64 = <u64>table.length;
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = aliasPick(uint64(), entries, size));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of empirical numbers, drawn by
+ * inversion from a tabulated, piecewise-linear CDF, built into a table with
+ * `empiricalTableBuild`.
+ * 
+ * Uses a single random number, a guide table lookup and a short search for each value drawn,
+ * and the table can be reused for any number of fills.
+ * 
+ * @param table The empirical table. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function empiricalArray(table: Float64Array, arr: Float64Array): void {
+    const entries: usize = table.dataStart;
+    const segments: i32 = empiricalSegments(table.length);
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = empiricalValue(float53(), entries, segments));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Cauchy distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * @param location The location of the distribution: its median.
+ * @param scale The scale of the distribution, greater than 0. It's the half width at half
+ * maximum.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function cauchy53Array(location: f64, scale: f64, arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = location + scale * cauchyInverse(inverseUniform(uint64())));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Laplace distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * @param location The location of the distribution: its mean.
+ * @param scale The scale of the distribution, greater than 0. The variance is 2 * `scale`^2.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function laplace53Array(location: f64, scale: f64, arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = location + scale * laplaceInverse(inverseUniform(uint64())));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of logistic distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * @param location The location of the distribution: its mean.
+ * @param scale The scale of the distribution, greater than 0. The variance is (π * `scale`)^2
+ * / 3.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function logistic53Array(location: f64, scale: f64, arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = location + scale * logisticInverse(inverseUniform(uint64())));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Gumbel distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * @param location The location of the distribution: its mode.
+ * @param scale The scale of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function gumbel53Array(location: f64, scale: f64, arr: Float64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = location + scale * gumbelInverse(inverseUniform(uint64())));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Weibull distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * @param shape The shape (`k`) of the distribution, greater than 0. Below 1, the failure rate
+ * falls over time; above 1, it rises.
+ * @param scale The scale (`λ`) of the distribution, greater than 0.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function weibull53Array(shape: f64, scale: f64, arr: Float64Array): void {
+    const invShape: f64 = 1.0 / shape;
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = scale * weibullInverse(inverseUniform(uint64()), invShape));
+    }
+}
+
+/**
+ * Fills the provided array with this generator's next set of Pareto distributed numbers.
+ * 
+ * Uses a single random number and the inverse of the distribution's CDF for each number,
+ * in the same loop that draws them.
+ * 
+ * @param shape The shape (`α`) of the distribution, greater than 0. Its mean is only finite
+ * for shapes above 1, and its variance for shapes above 2.
+ * @param scale The scale of the distribution, greater than 0: its minimum.
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function pareto53Array(shape: f64, scale: f64, arr: Float64Array): void {
+    const invShape: f64 = 1.0 / shape;
+
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = scale * paretoInverse(inverseUniform(uint64()), invShape));
+    }
+}
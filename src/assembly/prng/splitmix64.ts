@@ -0,0 +1,72 @@
+/**
+ * An AssemblyScript implementation of the SplitMix64 pseudo random number generator,
+ * used to expand a single 64-bit seed into seeds for the other generators.
+ *
+ * Produces exactly the same sequence as the JS `SplitMix64` class, but with native
+ * 64-bit arithmetic instead of BigInt multiplies and masks, so large seed collections
+ * can be filled in one call without allocating intermediate BigInts.
+ * @packageDocumentation
+*/
+
+/*
+* Adapted from: https://xoshiro.di.unimi.it/splitmix64.c
+* by Sebastiano Vigna (vigna@acm.org)
+*
+* This is a fixed-increment version of Java 8's SplittableRandom generator
+* See http://dx.doi.org/10.1145/2714064.2660195 and
+* http://docs.oracle.com/javase/8/docs/api/java/util/SplittableRandom.html
+*/
+
+// Expose array memory management functions for this WASM module to JS consumers
+export { allocUint64Array } from '../common/memory';
+
+// Weyl sequence increment (2^64 / golden ratio), added to the state every step
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+const GAMMA: u64 = 0x9E3779B97F4A7C15;
+
+// Internal state
+let state: u64 = 0;
+
+/** Number of seeds required for this generator's {@link setSeeds} function. */
+export const SEED_COUNT: i32 = 1;
+
+/**
+ * Initializes this generator's internal state with the provided seed.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function setSeeds(seed: u64): void {
+    state = seed;
+}
+
+/**
+ * Gets this generator's next unsigned 64-bit integer.
+ *
+ * @returns An unsigned 64-bit integer.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint64(): u64 {
+    state += GAMMA;
+
+    let z: u64 = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+
+    return z ^ (z >> 31);
+}
+
+/**
+ * Fills the provided array with this generator's next set of unsigned 64-bit integers.
+ *
+ * @param arr The array to fully fill. If called from a JS runtime, this value should
+ * be a pointer to an array that exists in WASM memory.
+ */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export function uint64Array(arr: Uint64Array): void {
+    for (let i: i32 = 0; i < arr.length; i++) {
+        unchecked(arr[i] = uint64());
+    }
+}
@@ -0,0 +1,103 @@
+/**
+ * Alias Table Helper Tests
+ *
+ * Tests for the alias table builder and the pick used by every generator's categorical()
+ * and categoricalArray() functions.
+ *
+ * Test Strategy:
+ * - Verify picks over an even grid of random 64-bit values give each category its exact
+ *   probability, for even, uneven and single-category weights
+ * - Verify categories with a weight of 0 are never picked
+ * - Verify only the table's length of weights is used, and that a table can be rebuilt in place
+ *
+ * Contrast: These test the arithmetic in isolation, while each generator's suite
+ * tests the categories its own loops produce.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import { aliasTableBuild, aliasPick } from '../common/alias';
+
+// picks are made for GRID_SIZE evenly spaced random 64-bit values
+const GRID_SIZE: i32 = 1 << 20;
+const GRID_SHIFT: u64 = 44;
+
+/**
+ * Counts the picks from `table` for each category, over the grid.
+ */
+function gridCounts(table: Uint64Array): Float64Array {
+  const counts = new Float64Array(table.length);
+  for (let i: i32 = 0; i < GRID_SIZE; i++) {
+    const k = <i32>aliasPick(<u64>i << GRID_SHIFT, table.dataStart, <u64>table.length);
+    counts[k] += 1.0;
+  }
+  return counts;
+}
+
+/**
+ * Builds a table for `weights`, and gets the largest difference between the share of grid
+ * picks for each category and its exact probability.
+ */
+function gridError(weights: StaticArray<f64>): f64 {
+  const scratch = new Float64Array(weights.length);
+  let sum: f64 = 0.0;
+  for (let k: i32 = 0; k < weights.length; k++) {
+    scratch[k] = weights[k];
+    sum += weights[k];
+  }
+
+  const table = new Uint64Array(weights.length);
+  aliasTableBuild(scratch, table);
+  const counts = gridCounts(table);
+
+  let maxError: f64 = 0.0;
+  for (let k: i32 = 0; k < weights.length; k++) {
+    const error = Math.abs(counts[k] / <f64>GRID_SIZE - weights[k] / sum);
+    if (error > maxError) maxError = error;
+  }
+  return maxError;
+}
+
+describe('Alias tables', () => {
+  test('picks give each category its exact probability', () => {
+    expect(gridError([1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0])).toBeLessThan(1e-5);
+    expect(gridError([0.25, 0.25, 0.25, 0.25])).toBeLessThan(1e-5);
+    expect(gridError([1000.0, 1.0, 1.0, 0.001, 50.0])).toBeLessThan(1e-5);
+    expect(gridError([3.0])).toBe(0.0);
+  });
+
+  test('categories with a weight of 0 are never picked', () => {
+    const scratch = new Float64Array(7);
+    scratch[1] = 5.0;
+    scratch[3] = 1.0;
+    scratch[4] = 0.001;
+    scratch[5] = 20.0;
+    scratch[6] = 0.5;
+
+    const table = new Uint64Array(7);
+    aliasTableBuild(scratch, table);
+    const counts = gridCounts(table);
+
+    expect(counts[0]).toBe(0.0);
+    expect(counts[2]).toBe(0.0);
+    expect(counts[4]).toBeGreaterThan(0.0);
+  });
+
+  test("only the table's length of weights is used, and tables can be rebuilt in place", () => {
+    const scratch = new Float64Array(4);
+    scratch[0] = 1.0;
+    scratch[1] = 0.0;
+    scratch[2] = 100.0;
+    scratch[3] = 100.0;
+
+    const table = new Uint64Array(2);
+    aliasTableBuild(scratch, table);
+    let counts = gridCounts(table);
+    expect(counts[0]).toBe(<f64>GRID_SIZE);
+
+    scratch[0] = 0.0;
+    scratch[1] = 1.0;
+    aliasTableBuild(scratch, table);
+    counts = gridCounts(table);
+    expect(counts[1]).toBe(<f64>GRID_SIZE);
+  });
+});
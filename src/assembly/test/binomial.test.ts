@@ -0,0 +1,106 @@
+/**
+ * Binomial Helper Tests
+ *
+ * Tests for the inversion and BTPE helpers used by every generator's binomial()
+ * and binomialArray() functions.
+ *
+ * Test Strategy:
+ * - Verify inversion walks the cumulative probabilities exactly
+ * - Verify probabilities above 0.5 are drawn for 1 - p and flipped
+ * - Verify p of 0 or 1 and n of 0 always give 0 or n
+ * - Verify accepted BTPE candidates over an even grid of uniform numbers have mean np and variance npq
+ * - Verify parameters switch algorithm with the mean, and are set up again when n or p changes
+ *
+ * Contrast: These test the arithmetic in isolation, while each generator's suite
+ * tests the counts its own loops produce.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  binomialSetup,
+  binomialInverts,
+  binomialInversion,
+  binomialBtpe,
+  binomialFlip
+} from '../common/binomial';
+
+// accepted candidates are averaged over GRID_SIZE^2 evenly spaced pairs of uniform numbers
+const GRID_SIZE: i32 = 400;
+
+describe('Inversion', () => {
+  test('uniform numbers just below each cumulative probability give its count', () => {
+    binomialSetup(10.0, 0.3);
+    expect(binomialInverts()).toBe(true);
+    let p: f64 = Math.pow(0.7, 10.0);
+    let cumulative: f64 = 0.0;
+
+    for (let k: i32 = 0; k < 9; k++) {
+      cumulative += p;
+      expect(binomialInversion(cumulative - 1e-9)).toBe(<f64>k);
+      expect(binomialInversion(cumulative + 1e-9)).toBe(<f64>(k + 1));
+      p *= <f64>(10 - k) / <f64>(k + 1) * 0.3 / 0.7;
+    }
+  });
+
+  test('probabilities above 0.5 are flipped', () => {
+    binomialSetup(10.0, 0.7);
+    expect(binomialInversion(0.0)).toBe(0.0);
+    expect(binomialFlip(0.0)).toBe(10.0);
+    expect(binomialFlip(3.0)).toBe(7.0);
+
+    binomialSetup(10.0, 0.3);
+    expect(binomialFlip(3.0)).toBe(3.0);
+  });
+
+  test('p of 0 or 1 and n of 0 always give 0 or n', () => {
+    binomialSetup(50.0, 0.0);
+    expect(binomialFlip(binomialInversion(0.9999999999))).toBe(0.0);
+    binomialSetup(50.0, 1.0);
+    expect(binomialFlip(binomialInversion(0.9999999999))).toBe(50.0);
+    binomialSetup(0.0, 0.5);
+    expect(binomialFlip(binomialInversion(0.9999999999))).toBe(0.0);
+  });
+});
+
+describe('BTPE', () => {
+  test('large means are drawn by BTPE, and set up again when n or p changes', () => {
+    binomialSetup(1000.0, 0.5);
+    expect(binomialInverts()).toBe(false);
+    binomialSetup(1000.0, 0.02);
+    expect(binomialInverts()).toBe(true);
+    binomialSetup(100.0, 0.5);
+    expect(binomialInverts()).toBe(false);
+  });
+
+  test('accepted candidates have mean np and variance npq', () => {
+    const ns: StaticArray<f64> = [200.0, 1000.0];
+    const ps: StaticArray<f64> = [0.2, 0.5];
+
+    for (let c: i32 = 0; c < ns.length; c++) {
+      const n: f64 = unchecked(ns[c]);
+      const p: f64 = unchecked(ps[c]);
+      binomialSetup(n, p);
+      let count: f64 = 0.0;
+      let sum: f64 = 0.0;
+      let sumSquares: f64 = 0.0;
+
+      for (let i: i32 = 0; i < GRID_SIZE; i++) {
+        for (let j: i32 = 0; j < GRID_SIZE; j++) {
+          const k = binomialBtpe((<f64>i + 0.5) / <f64>GRID_SIZE, (<f64>j + 0.5) / <f64>GRID_SIZE);
+          if (!isNaN(k)) {
+            expect(k).toBeGreaterThanOrEqual(0.0);
+            expect(k).toBeLessThanOrEqual(n);
+            count += 1.0;
+            sum += k;
+            sumSquares += k * k;
+          }
+        }
+      }
+
+      const mean: f64 = sum / count;
+      const variance: f64 = n * p * (1.0 - p);
+      expect(Math.abs(mean - n * p)).toBeLessThan(0.02 * Math.sqrt(variance));
+      expect(Math.abs(sumSquares / count - mean * mean - variance)).toBeLessThan(0.02 * variance);
+    }
+  });
+});
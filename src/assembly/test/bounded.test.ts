@@ -0,0 +1,180 @@
+/**
+ * Bounded Integer Helper Tests
+ *
+ * Tests for the Lemire multiply-shift helpers used by every generator's
+ * uint32Below() and intRange() functions, in scalar and SIMD form.
+ *
+ * Test Strategy:
+ * - Verify products scale 32-bit values into [0, bound) by their high 32 bits
+ * - Verify the rejection threshold is exactly 2^32 mod bound, including a full 2^32 range
+ * - Exhaustively check a tiny case: accepted products map the same number of inputs to every result
+ * - Verify bit recycling extracts the base-`bound` digits of Lemire's product for `bound`^`count`
+ * - Verify SIMD helpers match the scalar helpers in both lanes
+ *
+ * Contrast: These test the arithmetic in isolation, while each generator's suite
+ * tests the rejection loops that draw from its own output.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  lemireProduct,
+  lemireFraction,
+  lemireThreshold,
+  rangeToBound,
+  recycleCount,
+  recyclePower,
+  recycleThreshold,
+  recycleDigit,
+  recycleFraction
+} from '../common/bounded';
+import {
+  lemireProductx2,
+  lemireRejectx2,
+  lemireResultx2,
+  recycleDigitx2,
+  recycleFractionx2,
+  recycleRejectx2
+} from '../common/bounded-simd';
+import {
+  SIMD_LANE_0,
+  SIMD_LANE_1
+} from './helpers/test-utils';
+
+describe('lemireProduct', () => {
+  test('high 32 bits scale the input into [0, bound)', () => {
+    expect(lemireProduct(0, 6) >>> 32).toBe(0);
+    expect(lemireProduct(0xFFFFFFFF, 6) >>> 32).toBe(5);
+    expect(lemireProduct(0x80000000, 6) >>> 32).toBe(3);
+  });
+
+  test('a full 2^32 bound returns the input unchanged', () => {
+    const bound: u64 = <u64>1 << 32;
+
+    expect(lemireProduct(0xDEADBEEF, bound) >>> 32).toBe(0xDEADBEEF);
+    expect(lemireFraction(lemireProduct(0xDEADBEEF, bound))).toBe(0);
+  });
+});
+
+describe('lemireThreshold', () => {
+  test('is 2^32 mod bound', () => {
+    expect(lemireThreshold(1)).toBe(0);
+    expect(lemireThreshold(6)).toBe(4); // 2^32 = 715827882 * 6 + 4
+    expect(lemireThreshold(<u64>0x80000001)).toBe(0x7FFFFFFF);
+  });
+
+  test('is 0 for powers of 2, whose products are never biased', () => {
+    expect(lemireThreshold(2)).toBe(0);
+    expect(lemireThreshold(<u64>1 << 20)).toBe(0);
+    expect(lemireThreshold(<u64>1 << 32)).toBe(0);
+  });
+});
+
+describe('rangeToBound', () => {
+  test('counts the integers in an inclusive range', () => {
+    expect(rangeToBound(0, 0)).toBe(1);
+    expect(rangeToBound(1, 6)).toBe(6);
+    expect(rangeToBound(-10, 10)).toBe(21);
+  });
+
+  test('handles the full i32 range without overflow', () => {
+    expect(rangeToBound(i32.MIN_VALUE, i32.MAX_VALUE)).toBe(<u64>1 << 32);
+  });
+});
+
+describe('Lemire rejection', () => {
+  test('accepted products are unbiased (exhaustive over the top 16 input bits)', () => {
+    // Every 16-bit prefix stands for 2^16 inputs, so with bound 6 and the
+    // threshold scaled down to 16 bits, each result must be hit equally often
+    const bound: u64 = 6;
+    const threshold: u64 = ((<u64>1 << 16) - bound) % bound;
+    const counts = new StaticArray<i32>(6);
+
+    for (let x: u64 = 0; x < (<u64>1 << 16); x++) {
+      const product = x * bound;
+      if ((product & 0xFFFF) >= threshold) {
+        counts[<i32>(product >>> 16)]++;
+      }
+    }
+
+    for (let i = 1; i < 6; i++) {
+      expect(counts[i]).toBe(counts[0]); // Same number of accepted inputs per result
+    }
+  });
+});
+
+describe('Bit recycling', () => {
+  test('recycleCount keeps the most integers per 64-bit value', () => {
+    expect(recycleCount(2)).toBe(63); // Powers of 2 never reject
+    expect(recycleCount(6)).toBe(23); // 6^24 fits, but would reject 23% of batches
+    expect(recycleCount(52)).toBe(10);
+    expect(recycleCount(65536)).toBe(3);
+  });
+
+  test('recyclePower and recycleThreshold describe the batch', () => {
+    expect(recyclePower(6, 3)).toBe(216);
+    expect(recycleThreshold(216)).toBe(160); // 2^64 mod 216
+    expect(recycleThreshold(<u64>1 << 63)).toBe(0);
+  });
+
+  test('extracted digits match the high bits of a single Lemire product', () => {
+    // reference values computed with arbitrary precision integers: x * 6^23
+    // has high 64 bits 686937872049773816 and low 64 bits 7000511862412410880
+    let x: u64 = 0xDEADBEEFCAFEBABE;
+    let value: u64 = 0;
+    for (let i = 0; i < 23; i++) {
+      const digit = recycleDigit(x, 6);
+      expect(digit).toBeLessThan(6);
+      if (i == 0) expect(digit).toBe(5);
+      if (i == 7) expect(digit).toBe(0);
+      value = value * 6 + digit;
+      x = recycleFraction(x, 6);
+    }
+
+    expect(value).toBe(686937872049773816);
+    expect(x).toBe(7000511862412410880);
+  });
+});
+
+describe('SIMD helpers', () => {
+  test('lemireProductx2 matches scalar products in both lanes', () => {
+    const product = lemireProductx2(i64x2(0xFFFFFFFF, 0x12345678), i64x2.splat(1000));
+
+    expect(v128.extract_lane<u64>(product, <u8>SIMD_LANE_0)).toBe(lemireProduct(0xFFFFFFFF, 1000));
+    expect(v128.extract_lane<u64>(product, <u8>SIMD_LANE_1)).toBe(lemireProduct(0x12345678, 1000));
+  });
+
+  test('lemireRejectx2 rejects when either lane is below the threshold', () => {
+    const threshold = i64x2.splat(4);
+
+    expect(lemireRejectx2(i64x2(0x500000004, 0x300000009), threshold)).toBe(false);
+    expect(lemireRejectx2(i64x2(0x500000003, 0x300000009), threshold)).toBe(true);
+    expect(lemireRejectx2(i64x2(0x500000004, 0x300000000), threshold)).toBe(true);
+  });
+
+  test('lemireResultx2 extracts the high 32 bits as f64s', () => {
+    const result = lemireResultx2(i64x2(0xFFFFFFFF00000001, 0x0000000500000000));
+
+    expect(v128.extract_lane<f64>(result, <u8>SIMD_LANE_0)).toBe(4294967295.0);
+    expect(v128.extract_lane<f64>(result, <u8>SIMD_LANE_1)).toBe(5.0);
+  });
+
+  test('recycleDigitx2 and recycleFractionx2 match scalar recycling in both lanes', () => {
+    const x = i64x2(0xDEADBEEFCAFEBABE, 0x0123456789ABCDEF);
+    const bound = i64x2.splat(52);
+    const digits = recycleDigitx2(x, bound);
+    const fractions = recycleFractionx2(x, bound);
+
+    expect(v128.extract_lane<f64>(digits, <u8>SIMD_LANE_0)).toBe(<f64>recycleDigit(0xDEADBEEFCAFEBABE, 52));
+    expect(v128.extract_lane<f64>(digits, <u8>SIMD_LANE_1)).toBe(<f64>recycleDigit(0x0123456789ABCDEF, 52));
+    expect(v128.extract_lane<u64>(fractions, <u8>SIMD_LANE_0)).toBe(recycleFraction(0xDEADBEEFCAFEBABE, 52));
+    expect(v128.extract_lane<u64>(fractions, <u8>SIMD_LANE_1)).toBe(recycleFraction(0x0123456789ABCDEF, 52));
+  });
+
+  test('recycleRejectx2 compares final fractions as unsigned 64-bit values', () => {
+    const threshold = i64x2.splat(0x9000000000000000);
+
+    expect(recycleRejectx2(i64x2(0xA000000000000000, 0xF000000000000000), threshold)).toBe(false);
+    expect(recycleRejectx2(i64x2(0xA000000000000000, 1), threshold)).toBe(true);
+    expect(recycleRejectx2(i64x2(0x8FFFFFFFFFFFFFFF, 0xF000000000000000), threshold)).toBe(true);
+  });
+});
@@ -24,21 +24,25 @@ else
 fi
 
 echo "Using compiler: $CC"
-echo "Compiling validate-jump.c..."
 
-# Compile
-$CC validate-jump.c -o "validate-jump${EXE_EXT}" -O2 -Wall -Wextra
+EXIT_CODE=0
 
-echo "Compilation successful!"
-echo ""
-echo "Running validation..."
-echo "===================="
+for PROGRAM in validate-jump validate-advance validate-pcg64 validate-philox validate-chacha validate-scramblers validate-sfc-romu; do
+    echo ""
+    echo "Compiling ${PROGRAM}.c..."
 
-# Run
-"./validate-jump${EXE_EXT}"
+    # Compile
+    $CC "${PROGRAM}.c" -o "${PROGRAM}${EXE_EXT}" -O2 -Wall -Wextra
 
-EXIT_CODE=$?
-echo "===================="
+    echo "Compilation successful!"
+    echo ""
+    echo "Running ${PROGRAM}..."
+    echo "===================="
+
+    # Run (record failure, but keep going so every program reports)
+    "./${PROGRAM}${EXE_EXT}" || EXIT_CODE=$?
+    echo "===================="
+done
 
 if [ $EXIT_CODE -eq 0 ]; then
     echo "✓ All validations passed!"
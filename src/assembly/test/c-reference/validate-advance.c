@@ -0,0 +1,141 @@
+/**
+ * Validates the PCG advance() implementation against official C reference code.
+ * See README.md for details on usage and reference sources.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+// ============================================================================
+// PCG32 (XSH RR) Implementation
+// Based on: https://github.com/imneme/pcg-c-basic/blob/master/pcg_basic.c
+// (c) 2014 M.E. O'Neill / pcg-random.org, Apache License 2.0
+// ============================================================================
+
+typedef struct {
+    uint64_t state;
+    uint64_t inc;
+} pcg32_random_t;
+
+uint32_t pcg32_random_r(pcg32_random_t* rng) {
+    uint64_t oldstate = rng->state;
+    rng->state = oldstate * 6364136223846793005ULL + rng->inc;
+    uint32_t xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
+    uint32_t rot = oldstate >> 59u;
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+// Multi-step advance functions (jump-ahead, jump-back)
+//
+// The method used here is based on Brown, "Random Number Generation
+// with Arbitrary Stride,", Transactions of the American Nuclear
+// Society (Nov. 1994).  The algorithm is very similar to fast
+// exponentiation.
+uint64_t pcg_advance_lcg_64(uint64_t state, uint64_t delta, uint64_t cur_mult,
+                            uint64_t cur_plus) {
+    uint64_t acc_mult = 1u;
+    uint64_t acc_plus = 0u;
+    while (delta > 0) {
+        if (delta & 1) {
+            acc_mult *= cur_mult;
+            acc_plus = acc_plus * cur_mult + cur_plus;
+        }
+        cur_plus = (cur_mult + 1) * cur_plus;
+        cur_mult *= cur_mult;
+        delta /= 2;
+    }
+    return acc_mult * state + acc_plus;
+}
+
+void pcg32_advance_r(pcg32_random_t* rng, uint64_t delta) {
+    rng->state = pcg_advance_lcg_64(rng->state, delta, 6364136223846793005ULL, rng->inc);
+}
+
+// Matches setSeeds() in pcg.ts (pcg32_srandom_r, with the increment set separately
+// so that the default stream increment can be used as-is)
+void pcg32_seed(pcg32_random_t* rng, uint64_t initstate, uint64_t inc) {
+    rng->state = 0U;
+    rng->inc = inc;
+    pcg32_random_r(rng);
+    rng->state += initstate;
+    pcg32_random_r(rng);
+}
+
+// Default stream increment in pcg.ts
+static const uint64_t DEFAULT_INCREMENT = 1442695040888963407ULL;
+
+// Default lane 1 stream increment in pcg-simd.ts (pcg_basic's PCG32_INITIALIZER increment)
+static const uint64_t SIMD_LANE1_INCREMENT = 0xda3e39cb94b95bdbULL;
+
+// TEST_SEEDS.SINGLE (and TEST_SEEDS.DOUBLE_0)
+static const uint64_t TEST_SEED = 0x9E3779B97F4A7C15ULL;
+
+// TEST_SEEDS.DOUBLE_1
+static const uint64_t TEST_SEED_LANE1 = 0x6C078965D5B2A5D3ULL;
+
+// ============================================================================
+// Test Program
+// ============================================================================
+
+int main() {
+    printf("PCG advance() Reference Value Validation\n");
+    printf("========================================\n\n");
+
+    pcg32_random_t rng;
+    int failures = 0;
+
+    // Validate advance(delta) against delta individual steps
+    static const uint64_t DELTAS[] = { 0, 1, 2, 3, 1000, 65537, 1000000 };
+
+    for (size_t d = 0; d < sizeof DELTAS / sizeof *DELTAS; d++) {
+        const uint64_t delta = DELTAS[d];
+
+        pcg32_seed(&rng, TEST_SEED, DEFAULT_INCREMENT);
+        for (uint64_t i = 0; i < delta; i++) pcg32_random_r(&rng);
+        const uint32_t expected = pcg32_random_r(&rng);
+
+        pcg32_seed(&rng, TEST_SEED, DEFAULT_INCREMENT);
+        pcg32_advance_r(&rng, delta);
+        const uint32_t actual = pcg32_random_r(&rng);
+
+        const int ok = expected == actual;
+        if (!ok) failures++;
+
+        printf("  delta = %-8llu next(): %-10u  %s\n",
+               (unsigned long long)delta, actual, ok ? "OK" : "MISMATCH");
+    }
+
+    // Advancing by 2^64 - 1 steps is one step backwards (the LCG has period 2^64)
+    pcg32_seed(&rng, TEST_SEED, DEFAULT_INCREMENT);
+    const uint32_t first = pcg32_random_r(&rng);
+    pcg32_advance_r(&rng, UINT64_MAX);
+    const uint32_t rewound = pcg32_random_r(&rng);
+    const int rewind_ok = first == rewound;
+    if (!rewind_ok) failures++;
+    printf("  delta = 2^64 - 1 (step back) next(): %-10u  %s\n\n", rewound, rewind_ok ? "OK" : "MISMATCH");
+
+    // Reference value for a large stride, which is impractical to step through
+    pcg32_seed(&rng, TEST_SEED, DEFAULT_INCREMENT);
+    pcg32_advance_r(&rng, 1ULL << 40);
+    const uint32_t advanced = pcg32_random_r(&rng);
+
+    // PCG SIMD lane 1 runs its own stream, with the second seed and lane 1's default increment
+    // (lane 0 is the same as the non-SIMD generator above)
+    pcg32_seed(&rng, TEST_SEED_LANE1, SIMD_LANE1_INCREMENT);
+    pcg32_advance_r(&rng, 1ULL << 40);
+    const uint32_t advancedLane1 = pcg32_random_r(&rng);
+
+    printf("For test-utils.ts ADVANCE_REFERENCE namespace:\n");
+    printf("==============================================\n");
+    printf("PCG (seed: SINGLE, default stream) after advance(2^40) then next():\n");
+    printf("  uint32: %u\n", advanced);
+    printf("PCG SIMD lane 1 (seed: DOUBLE_1, default lane 1 stream) after advance(2^40) then next():\n");
+    printf("  uint32: %u\n", advancedLane1);
+
+    if (failures) {
+        printf("\n%d advance() mismatch(es) against individual reference steps\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+/**
+ * Validates the ChaCha block function against published keystream test vectors,
+ * and provides reference values for the fast-key-erasure ChaCha generator.
+ * See README.md for details on usage and reference sources.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================================
+// ChaCha Block Function (original 64-bit counter / 64-bit nonce layout)
+// Based on: https://cr.yp.to/chacha.html (chacha-ref.c, public domain)
+// ============================================================================
+
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d)               \
+    x[a] += x[b]; x[d] = ROTL32(x[d] ^ x[a], 16); \
+    x[c] += x[d]; x[b] = ROTL32(x[b] ^ x[c], 12); \
+    x[a] += x[b]; x[d] = ROTL32(x[d] ^ x[a], 8);  \
+    x[c] += x[d]; x[b] = ROTL32(x[b] ^ x[c], 7);
+
+// "expand 32-byte k"
+static const uint32_t SIGMA[4] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+
+void chacha_block(const uint32_t key[8], uint64_t counter, uint64_t nonce, int rounds, uint32_t out[16]) {
+    uint32_t input[16] = {
+        SIGMA[0], SIGMA[1], SIGMA[2], SIGMA[3],
+        key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+        (uint32_t)counter, (uint32_t)(counter >> 32), (uint32_t)nonce, (uint32_t)(nonce >> 32)
+    };
+    uint32_t x[16];
+    memcpy(x, input, sizeof x);
+
+    for (int i = 0; i < rounds; i += 2) {
+        QUARTERROUND(0, 4, 8, 12)
+        QUARTERROUND(1, 5, 9, 13)
+        QUARTERROUND(2, 6, 10, 14)
+        QUARTERROUND(3, 7, 11, 15)
+        QUARTERROUND(0, 5, 10, 15)
+        QUARTERROUND(1, 6, 11, 12)
+        QUARTERROUND(2, 7, 8, 13)
+        QUARTERROUND(3, 4, 9, 14)
+    }
+
+    for (int i = 0; i < 16; i++) {
+        out[i] = x[i] + input[i];
+    }
+}
+
+// ============================================================================
+// Fast-key-erasure generator matching chacha-simd.ts
+// ============================================================================
+
+// 16 blocks (1 KiB) per refill: the first 32 bytes replace the key, and
+// the remaining 992 bytes (124 uint64 outputs) are returned in order
+#define BLOCKS_PER_REFILL 16
+#define BUFFER_WORDS (BLOCKS_PER_REFILL * 16)
+#define BUFFER_BYTES (BUFFER_WORDS * 4)
+#define KEY_BYTES 32
+
+typedef struct {
+    uint32_t key[8];
+    uint64_t nonce;
+    int rounds;
+    uint32_t buffer[BUFFER_WORDS];
+    int position; // byte offset of the next unused output
+} chacha_rng;
+
+void chacha_seed(chacha_rng* rng, const uint64_t seeds[4], int rounds) {
+    for (int i = 0; i < 4; i++) {
+        rng->key[2 * i] = (uint32_t)seeds[i];
+        rng->key[2 * i + 1] = (uint32_t)(seeds[i] >> 32);
+    }
+    rng->nonce = 0;
+    rng->rounds = rounds;
+    rng->position = BUFFER_BYTES;
+}
+
+// Selects the stream at nonce + streamIndex, starting from the next refill
+void chacha_jump_to(chacha_rng* rng, uint64_t streamIndex) {
+    rng->nonce += streamIndex;
+    rng->position = BUFFER_BYTES;
+}
+
+void chacha_refill(chacha_rng* rng) {
+    for (int block = 0; block < BLOCKS_PER_REFILL; block++) {
+        chacha_block(rng->key, (uint64_t)block, rng->nonce, rng->rounds, rng->buffer + 16 * block);
+    }
+    memcpy(rng->key, rng->buffer, KEY_BYTES);
+    memset(rng->buffer, 0, KEY_BYTES);
+    rng->position = KEY_BYTES;
+}
+
+uint64_t chacha_next(chacha_rng* rng) {
+    if (rng->position > BUFFER_BYTES - 8) {
+        chacha_refill(rng);
+    }
+    uint8_t* bytes = (uint8_t*)rng->buffer + rng->position;
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; i--) {
+        value = value << 8 | bytes[i];
+    }
+    memset(bytes, 0, 8);
+    rng->position += 8;
+    return value;
+}
+
+// TEST_SEEDS.QUAD
+static const uint64_t TEST_SEEDS[4] = {
+    0x9E3779B97F4A7C15ULL, 0x6C078965D5B2A5D3ULL, 0xBF58476D1CE4E5B9ULL, 0x94D049BB133111EBULL
+};
+
+// ============================================================================
+// Test Program
+// ============================================================================
+
+int main() {
+    printf("ChaCha Reference Value Validation\n");
+    printf("=================================\n\n");
+
+    int failures = 0;
+
+    // Keystream test vectors for an all-zero key and nonce, block 0
+    // (draft-strombergson-chacha-test-vectors, TC1)
+    static const struct { int rounds; uint8_t expected[16]; } KAT[] = {
+        { 8,  { 0x3e, 0x00, 0xef, 0x2f, 0x89, 0x5f, 0x40, 0xd6, 0x7f, 0x5b, 0xb8, 0xe8, 0x1f, 0x09, 0xa5, 0xa1 } },
+        { 12, { 0x9b, 0xf4, 0x9a, 0x6a, 0x07, 0x55, 0xf9, 0x53, 0x81, 0x1f, 0xce, 0x12, 0x5f, 0x26, 0x83, 0xd5 } },
+        { 20, { 0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90, 0x40, 0x5d, 0x6a, 0xe5, 0x53, 0x86, 0xbd, 0x28 } }
+    };
+
+    const uint32_t zeroKey[8] = { 0 };
+    for (size_t t = 0; t < sizeof KAT / sizeof *KAT; t++) {
+        uint32_t out[16];
+        chacha_block(zeroKey, 0, 0, KAT[t].rounds, out);
+
+        const int ok = memcmp(out, KAT[t].expected, sizeof KAT[t].expected) == 0;
+        if (!ok) failures++;
+
+        printf("  ChaCha%-2d zero key/nonce: %08x %08x %08x %08x  %s\n",
+               KAT[t].rounds, out[0], out[1], out[2], out[3], ok ? "OK" : "MISMATCH");
+    }
+
+    // Reference values
+    chacha_rng rng;
+    uint64_t values[126];
+
+    chacha_seed(&rng, TEST_SEEDS, 20);
+    for (int i = 0; i < 126; i++) {
+        values[i] = chacha_next(&rng);
+    }
+
+    chacha_seed(&rng, TEST_SEEDS, 8);
+    const uint64_t chacha8 = chacha_next(&rng);
+
+    chacha_seed(&rng, TEST_SEEDS, 12);
+    const uint64_t chacha12 = chacha_next(&rng);
+
+    chacha_seed(&rng, TEST_SEEDS, 20);
+    chacha_jump_to(&rng, 5);
+    const uint64_t stream5 = chacha_next(&rng);
+
+    chacha_seed(&rng, TEST_SEEDS, 20);
+    chacha_jump_to(&rng, 3ULL << 32);
+    chacha_jump_to(&rng, 5);
+    const uint64_t nodeWorker = chacha_next(&rng);
+
+    printf("\nFor test-utils.ts CHACHA_REFERENCE namespace:\n");
+    printf("=============================================\n");
+    printf("ChaCha20 (seeds: QUAD) first 2 uint64() values:\n");
+    printf("  uint64: %llu, %llu\n", (unsigned long long)values[0], (unsigned long long)values[1]);
+    printf("ChaCha20 (seeds: QUAD) last value of the first refill, first value of the second:\n");
+    printf("  uint64 [123], [124]: %llu, %llu\n",
+           (unsigned long long)values[123], (unsigned long long)values[124]);
+    printf("ChaCha8 / ChaCha12 (seeds: QUAD) first uint64() value:\n");
+    printf("  uint64: %llu, %llu\n", (unsigned long long)chacha8, (unsigned long long)chacha12);
+    printf("ChaCha20 (seeds: QUAD) after jumpTo(5) then uint64():\n");
+    printf("  uint64: %llu\n", (unsigned long long)stream5);
+    printf("ChaCha20 (seeds: QUAD) after longJumpTo(3), jumpTo(5) then uint64():\n");
+    printf("  uint64: %llu\n", (unsigned long long)nodeWorker);
+
+    if (failures) {
+        printf("\n%d keystream test vector mismatch(es)\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
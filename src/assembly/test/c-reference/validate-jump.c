@@ -1,5 +1,6 @@
 /**
- * Validates jump() implementations against official C reference code.
+ * Validates jump(), jumpTo(), longJump(), longJumpTo() and advance() implementations
+ * against official C reference code.
  * See README.md for details on usage and reference sources.
  */
 
@@ -45,6 +46,23 @@ void xoroshiro128_jump(void) {
     xoroshiro128_s[1] = s1;
 }
 
+void xoroshiro128_long_jump(void) {
+    static const uint64_t LONG_JUMP[] = { 0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1 };
+
+    uint64_t s0 = 0;
+    uint64_t s1 = 0;
+    for(size_t i = 0; i < sizeof LONG_JUMP / sizeof *LONG_JUMP; i++)
+        for(int b = 0; b < 64; b++) {
+            if (LONG_JUMP[i] & UINT64_C(1) << b) {
+                s0 ^= xoroshiro128_s[0];
+                s1 ^= xoroshiro128_s[1];
+            }
+            xoroshiro128_next();
+        }
+    xoroshiro128_s[0] = s0;
+    xoroshiro128_s[1] = s1;
+}
+
 // ============================================================================
 // Xoshiro256+ Implementation
 // Based on: https://prng.di.unimi.it/xoshiro256plus.c
@@ -93,6 +111,167 @@ void xoshiro256_jump(void) {
     xoshiro256_s[3] = s3;
 }
 
+void xoshiro256_long_jump(void) {
+    static const uint64_t LONG_JUMP[] = { 0x76e15d3efefdcbbf, 0xc5004e441c522fb3,
+                                           0x77710069854ee241, 0x39109bb02acbe635 };
+
+    uint64_t s0 = 0;
+    uint64_t s1 = 0;
+    uint64_t s2 = 0;
+    uint64_t s3 = 0;
+    for(size_t i = 0; i < sizeof LONG_JUMP / sizeof *LONG_JUMP; i++)
+        for(int b = 0; b < 64; b++) {
+            if (LONG_JUMP[i] & UINT64_C(1) << b) {
+                s0 ^= xoshiro256_s[0];
+                s1 ^= xoshiro256_s[1];
+                s2 ^= xoshiro256_s[2];
+                s3 ^= xoshiro256_s[3];
+            }
+            xoshiro256_next();
+        }
+    xoshiro256_s[0] = s0;
+    xoshiro256_s[1] = s1;
+    xoshiro256_s[2] = s2;
+    xoshiro256_s[3] = s3;
+}
+
+// ============================================================================
+// jumpTo(): k jumps in O(log k) via jump polynomial exponentiation over GF(2)
+// Mirrors polyPowMod() in common/polynomial.ts and jumpTo() in each generator
+// ============================================================================
+
+// Characteristic polynomials, leading x^128 / x^256 term omitted
+// Matches: CHAR_POLY_128 / CHAR_POLY_256 in conversion.ts
+static const uint64_t CHAR_POLY_128[] = { 0x095b8f76579aa001, 0x0008828e513b43d5 };
+static const uint64_t CHAR_POLY_256[] = { 0x9d116f2bb0f0f001, 0x0280002bcefd1a5e,
+                                          0x04b4edcf26259f85, 0x0003c03c3f3ecb19 };
+
+// out = (a * b) mod char_poly, where all polynomials are `words` 64-bit words
+static void poly_mul_mod(const uint64_t *a, const uint64_t *b, const uint64_t *char_poly,
+                         int words, uint64_t *out) {
+    uint64_t product[4] = { 0 };
+
+    for (int i = words * 64 - 1; i >= 0; i--) {
+        const uint64_t reduce = 0 - (product[words - 1] >> 63);
+        for (int w = words - 1; w > 0; w--)
+            product[w] = (product[w] << 1) | (product[w - 1] >> 63);
+        product[0] <<= 1;
+
+        const uint64_t add = 0 - ((b[i / 64] >> (i % 64)) & 1);
+        for (int w = 0; w < words; w++)
+            product[w] ^= (char_poly[w] & reduce) ^ (a[w] & add);
+    }
+
+    for (int w = 0; w < words; w++)
+        out[w] = product[w];
+}
+
+// out = base^exponent mod char_poly
+static void poly_pow_mod(const uint64_t *base, uint64_t exponent, const uint64_t *char_poly,
+                         int words, uint64_t *out) {
+    uint64_t square[4];
+
+    for (int w = 0; w < words; w++) {
+        out[w] = 0;
+        square[w] = base[w];
+    }
+    out[0] = 1;
+
+    while (exponent) {
+        if (exponent & 1)
+            poly_mul_mod(out, square, char_poly, words, out);
+        exponent >>= 1;
+        if (exponent)
+            poly_mul_mod(square, square, char_poly, words, square);
+    }
+}
+
+// Applies a jump polynomial to the state, exactly as the reference jump() does
+static void xoroshiro128_apply_poly(const uint64_t *poly) {
+    uint64_t s0 = 0;
+    uint64_t s1 = 0;
+    for (int i = 0; i < 2; i++)
+        for (int b = 0; b < 64; b++) {
+            if (poly[i] & UINT64_C(1) << b) {
+                s0 ^= xoroshiro128_s[0];
+                s1 ^= xoroshiro128_s[1];
+            }
+            xoroshiro128_next();
+        }
+    xoroshiro128_s[0] = s0;
+    xoroshiro128_s[1] = s1;
+}
+
+static void xoshiro256_apply_poly(const uint64_t *poly) {
+    uint64_t s0 = 0;
+    uint64_t s1 = 0;
+    uint64_t s2 = 0;
+    uint64_t s3 = 0;
+    for (int i = 0; i < 4; i++)
+        for (int b = 0; b < 64; b++) {
+            if (poly[i] & UINT64_C(1) << b) {
+                s0 ^= xoshiro256_s[0];
+                s1 ^= xoshiro256_s[1];
+                s2 ^= xoshiro256_s[2];
+                s3 ^= xoshiro256_s[3];
+            }
+            xoshiro256_next();
+        }
+    xoshiro256_s[0] = s0;
+    xoshiro256_s[1] = s1;
+    xoshiro256_s[2] = s2;
+    xoshiro256_s[3] = s3;
+}
+
+void xoroshiro128_jump_to(uint64_t stream_index) {
+    static const uint64_t JUMP[] = { 0xdf900294d8f554a5, 0x170865df4b3201fc };
+    uint64_t poly[2];
+    poly_pow_mod(JUMP, stream_index, CHAR_POLY_128, 2, poly);
+    xoroshiro128_apply_poly(poly);
+}
+
+void xoshiro256_jump_to(uint64_t stream_index) {
+    static const uint64_t JUMP[] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+                                      0xa9582618e03fc9aa, 0x39abdc4529b1661c };
+    uint64_t poly[4];
+    poly_pow_mod(JUMP, stream_index, CHAR_POLY_256, 4, poly);
+    xoshiro256_apply_poly(poly);
+}
+
+void xoroshiro128_long_jump_to(uint64_t node_index) {
+    static const uint64_t LONG_JUMP[] = { 0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1 };
+    uint64_t poly[2];
+    poly_pow_mod(LONG_JUMP, node_index, CHAR_POLY_128, 2, poly);
+    xoroshiro128_apply_poly(poly);
+}
+
+void xoshiro256_long_jump_to(uint64_t node_index) {
+    static const uint64_t LONG_JUMP[] = { 0x76e15d3efefdcbbf, 0xc5004e441c522fb3,
+                                           0x77710069854ee241, 0x39109bb02acbe635 };
+    uint64_t poly[4];
+    poly_pow_mod(LONG_JUMP, node_index, CHAR_POLY_256, 4, poly);
+    xoshiro256_apply_poly(poly);
+}
+
+// ============================================================================
+// advance(): n single steps in O(log n) via x^n mod P(x)
+// Mirrors advance() in each generator (POLY_X in conversion.ts)
+// ============================================================================
+
+static const uint64_t POLY_X[] = { 2, 0, 0, 0 };
+
+void xoroshiro128_advance(uint64_t delta) {
+    uint64_t poly[2];
+    poly_pow_mod(POLY_X, delta, CHAR_POLY_128, 2, poly);
+    xoroshiro128_apply_poly(poly);
+}
+
+void xoshiro256_advance(uint64_t delta) {
+    uint64_t poly[4];
+    poly_pow_mod(POLY_X, delta, CHAR_POLY_256, 4, poly);
+    xoshiro256_apply_poly(poly);
+}
+
 // ============================================================================
 // Conversion Functions (matching our WASM uint64_to_float53 logic)
 // ============================================================================
@@ -176,7 +355,214 @@ int main() {
     printf("  float:  %.17g\n\n", xoshiro_float);
     printf("Xoshiro256Plus_SIMD_Lane1:\n");
     printf("  uint64: %llu\n", (unsigned long long)xoshiro_simd_lane1_result);
-    printf("  float:  %.17g\n", xoshiro_simd_lane1_float);
+    printf("  float:  %.17g\n\n", xoshiro_simd_lane1_float);
+
+    // Validate jumpTo(k) against k repeated reference jump() calls
+    printf("jumpTo() vs Repeated jump() Validation\n");
+    printf("======================================\n");
+    static const uint64_t STREAM_INDICES[] = { 0, 1, 2, 3, 7, 64, 1000, 12345 };
+    int failures = 0;
+
+    for (size_t k = 0; k < sizeof STREAM_INDICES / sizeof *STREAM_INDICES; k++) {
+        const uint64_t stream_index = STREAM_INDICES[k];
+
+        xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;  // TEST_SEEDS.DOUBLE_0
+        xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;  // TEST_SEEDS.DOUBLE_1
+        for (uint64_t i = 0; i < stream_index; i++) xoroshiro128_jump();
+        const uint64_t xoroshiro_expected = xoroshiro128_next();
+
+        xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;
+        xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;
+        xoroshiro128_jump_to(stream_index);
+        const uint64_t xoroshiro_actual = xoroshiro128_next();
+
+        xoshiro256_s[0] = 0x9E3779B97F4A7C15ULL;  // TEST_SEEDS.QUAD_0
+        xoshiro256_s[1] = 0x6C078965D5B2A5D3ULL;  // TEST_SEEDS.QUAD_1
+        xoshiro256_s[2] = 0xBF58476D1CE4E5B9ULL;  // TEST_SEEDS.QUAD_2
+        xoshiro256_s[3] = 0x94D049BB133111EBULL;  // TEST_SEEDS.QUAD_3
+        for (uint64_t i = 0; i < stream_index; i++) xoshiro256_jump();
+        const uint64_t xoshiro_expected = xoshiro256_next();
+
+        xoshiro256_s[0] = 0x9E3779B97F4A7C15ULL;
+        xoshiro256_s[1] = 0x6C078965D5B2A5D3ULL;
+        xoshiro256_s[2] = 0xBF58476D1CE4E5B9ULL;
+        xoshiro256_s[3] = 0x94D049BB133111EBULL;
+        xoshiro256_jump_to(stream_index);
+        const uint64_t xoshiro_actual = xoshiro256_next();
+
+        const int ok = xoroshiro_expected == xoroshiro_actual && xoshiro_expected == xoshiro_actual;
+        if (!ok) failures++;
+
+        printf("  k = %-6llu xoroshiro128+: 0x%016llx  xoshiro256+: 0x%016llx  %s\n",
+               (unsigned long long)stream_index,
+               (unsigned long long)xoroshiro_actual,
+               (unsigned long long)xoshiro_actual,
+               ok ? "OK" : "MISMATCH");
+    }
+
+    // Validate longJumpTo(k) against k repeated reference long_jump() calls
+    printf("\nlongJumpTo() vs Repeated long_jump() Validation\n");
+    printf("===============================================\n");
+    static const uint64_t NODE_INDICES[] = { 0, 1, 2, 3, 7, 100 };
+
+    for (size_t k = 0; k < sizeof NODE_INDICES / sizeof *NODE_INDICES; k++) {
+        const uint64_t node_index = NODE_INDICES[k];
+
+        xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;  // TEST_SEEDS.DOUBLE_0
+        xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;  // TEST_SEEDS.DOUBLE_1
+        for (uint64_t i = 0; i < node_index; i++) xoroshiro128_long_jump();
+        const uint64_t xoroshiro_expected = xoroshiro128_next();
+
+        xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;
+        xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;
+        xoroshiro128_long_jump_to(node_index);
+        const uint64_t xoroshiro_actual = xoroshiro128_next();
+
+        xoshiro256_s[0] = 0x9E3779B97F4A7C15ULL;  // TEST_SEEDS.QUAD_0
+        xoshiro256_s[1] = 0x6C078965D5B2A5D3ULL;  // TEST_SEEDS.QUAD_1
+        xoshiro256_s[2] = 0xBF58476D1CE4E5B9ULL;  // TEST_SEEDS.QUAD_2
+        xoshiro256_s[3] = 0x94D049BB133111EBULL;  // TEST_SEEDS.QUAD_3
+        for (uint64_t i = 0; i < node_index; i++) xoshiro256_long_jump();
+        const uint64_t xoshiro_expected = xoshiro256_next();
+
+        xoshiro256_s[0] = 0x9E3779B97F4A7C15ULL;
+        xoshiro256_s[1] = 0x6C078965D5B2A5D3ULL;
+        xoshiro256_s[2] = 0xBF58476D1CE4E5B9ULL;
+        xoshiro256_s[3] = 0x94D049BB133111EBULL;
+        xoshiro256_long_jump_to(node_index);
+        const uint64_t xoshiro_actual = xoshiro256_next();
+
+        const int ok = xoroshiro_expected == xoroshiro_actual && xoshiro_expected == xoshiro_actual;
+        if (!ok) failures++;
+
+        printf("  k = %-6llu xoroshiro128+: 0x%016llx  xoshiro256+: 0x%016llx  %s\n",
+               (unsigned long long)node_index,
+               (unsigned long long)xoroshiro_actual,
+               (unsigned long long)xoshiro_actual,
+               ok ? "OK" : "MISMATCH");
+    }
+
+    // One long jump of 2^96 steps must equal 2^32 jumps of 2^64 steps (xoroshiro128+)
+    xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;
+    xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;
+    xoroshiro128_long_jump();
+    const uint64_t xoroshiro_long_result = xoroshiro128_next();
+
+    xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;
+    xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;
+    xoroshiro128_jump_to(UINT64_C(1) << 32);
+    const int long_jump_ok = xoroshiro128_next() == xoroshiro_long_result;
+    if (!long_jump_ok) failures++;
+    printf("  long_jump() == jumpTo(2^32) (xoroshiro128+): %s\n", long_jump_ok ? "OK" : "MISMATCH");
+
+    // Node 3, worker 5: the stream selected by the (nodeId, workerId) mode
+    xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;
+    xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;
+    xoroshiro128_long_jump_to(3);
+    xoroshiro128_jump_to(5);
+    const uint64_t xoroshiro_node_result = xoroshiro128_next();
+
+    xoshiro256_s[0] = 0x9E3779B97F4A7C15ULL;
+    xoshiro256_s[1] = 0x6C078965D5B2A5D3ULL;
+    xoshiro256_s[2] = 0xBF58476D1CE4E5B9ULL;
+    xoshiro256_s[3] = 0x94D049BB133111EBULL;
+    xoshiro256_long_jump();
+    const uint64_t xoshiro_long_result = xoshiro256_next();
+
+    xoshiro256_s[0] = 0x9E3779B97F4A7C15ULL;
+    xoshiro256_s[1] = 0x6C078965D5B2A5D3ULL;
+    xoshiro256_s[2] = 0xBF58476D1CE4E5B9ULL;
+    xoshiro256_s[3] = 0x94D049BB133111EBULL;
+    xoshiro256_long_jump_to(3);
+    xoshiro256_jump_to(5);
+    const uint64_t xoshiro_node_result = xoshiro256_next();
+
+    printf("\nFor test-utils.ts LONG_JUMP_REFERENCE namespace:\n");
+    printf("================================================\n");
+    printf("Xoroshiro128Plus (seeds: DOUBLE_0, DOUBLE_1):\n");
+    printf("  After long_jump() then next(): %llu\n", (unsigned long long)xoroshiro_long_result);
+    printf("  After long_jump() x3, jump() x5 then next(): %llu\n", (unsigned long long)xoroshiro_node_result);
+    printf("Xoshiro256Plus (seeds: QUAD_0, QUAD_1, QUAD_2, QUAD_3):\n");
+    printf("  After long_jump() then next(): %llu\n", (unsigned long long)xoshiro_long_result);
+    printf("  After long_jump() x3, jump() x5 then next(): %llu\n", (unsigned long long)xoshiro_node_result);
+
+    // Validate advance(n) against n individual reference next() calls
+    printf("\nadvance() vs Individual next() Validation\n");
+    printf("=========================================\n");
+    static const uint64_t DELTAS[] = { 0, 1, 2, 127, 128, 255, 256, 1000, 65537, 1000000 };
+
+    for (size_t d = 0; d < sizeof DELTAS / sizeof *DELTAS; d++) {
+        const uint64_t delta = DELTAS[d];
+
+        xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;  // TEST_SEEDS.DOUBLE_0
+        xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;  // TEST_SEEDS.DOUBLE_1
+        for (uint64_t i = 0; i < delta; i++) xoroshiro128_next();
+        const uint64_t xoroshiro_expected = xoroshiro128_next();
+
+        xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;
+        xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;
+        xoroshiro128_advance(delta);
+        const uint64_t xoroshiro_actual = xoroshiro128_next();
+
+        xoshiro256_s[0] = 0x9E3779B97F4A7C15ULL;  // TEST_SEEDS.QUAD_0
+        xoshiro256_s[1] = 0x6C078965D5B2A5D3ULL;  // TEST_SEEDS.QUAD_1
+        xoshiro256_s[2] = 0xBF58476D1CE4E5B9ULL;  // TEST_SEEDS.QUAD_2
+        xoshiro256_s[3] = 0x94D049BB133111EBULL;  // TEST_SEEDS.QUAD_3
+        for (uint64_t i = 0; i < delta; i++) xoshiro256_next();
+        const uint64_t xoshiro_expected = xoshiro256_next();
+
+        xoshiro256_s[0] = 0x9E3779B97F4A7C15ULL;
+        xoshiro256_s[1] = 0x6C078965D5B2A5D3ULL;
+        xoshiro256_s[2] = 0xBF58476D1CE4E5B9ULL;
+        xoshiro256_s[3] = 0x94D049BB133111EBULL;
+        xoshiro256_advance(delta);
+        const uint64_t xoshiro_actual = xoshiro256_next();
+
+        const int ok = xoroshiro_expected == xoroshiro_actual && xoshiro_expected == xoshiro_actual;
+        if (!ok) failures++;
+
+        printf("  n = %-8llu xoroshiro128+: 0x%016llx  xoshiro256+: 0x%016llx  %s\n",
+               (unsigned long long)delta,
+               (unsigned long long)xoroshiro_actual,
+               (unsigned long long)xoshiro_actual,
+               ok ? "OK" : "MISMATCH");
+    }
+
+    // Two advances of 2^63 steps must equal one reference jump() of 2^64 steps (xoroshiro128+)
+    xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;
+    xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;
+    xoroshiro128_advance(UINT64_C(1) << 63);
+    xoroshiro128_advance(UINT64_C(1) << 63);
+    const uint64_t xoroshiro_advanced = xoroshiro128_next();
+    const int xoroshiro_jump_ok = xoroshiro_advanced == xoroshiro_result;
+    if (!xoroshiro_jump_ok) failures++;
+    printf("  2 x advance(2^63) == jump() (xoroshiro128+): %s\n", xoroshiro_jump_ok ? "OK" : "MISMATCH");
+
+    // Reference values for a large stride, which is impractical to step through
+    xoroshiro128_s[0] = 0x9E3779B97F4A7C15ULL;
+    xoroshiro128_s[1] = 0x6C078965D5B2A5D3ULL;
+    xoroshiro128_advance(UINT64_C(1) << 40);
+    const uint64_t xoroshiro_advance_result = xoroshiro128_next();
+
+    xoshiro256_s[0] = 0x9E3779B97F4A7C15ULL;
+    xoshiro256_s[1] = 0x6C078965D5B2A5D3ULL;
+    xoshiro256_s[2] = 0xBF58476D1CE4E5B9ULL;
+    xoshiro256_s[3] = 0x94D049BB133111EBULL;
+    xoshiro256_advance(UINT64_C(1) << 40);
+    const uint64_t xoshiro_advance_result = xoshiro256_next();
+
+    printf("\nFor test-utils.ts ADVANCE_REFERENCE namespace:\n");
+    printf("==============================================\n");
+    printf("After advance(2^40) then next():\n");
+    printf("Xoroshiro128Plus (seeds: DOUBLE_0, DOUBLE_1):\n");
+    printf("  uint64: %llu\n", (unsigned long long)xoroshiro_advance_result);
+    printf("Xoshiro256Plus (seeds: QUAD_0, QUAD_1, QUAD_2, QUAD_3):\n");
+    printf("  uint64: %llu\n", (unsigned long long)xoshiro_advance_result);
+
+    if (failures) {
+        printf("\n%d jumpTo() / longJumpTo() / advance() mismatch(es) against the reference implementations\n", failures);
+        return 1;
+    }
 
     return 0;
 }
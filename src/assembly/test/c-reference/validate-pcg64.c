@@ -0,0 +1,147 @@
+/**
+ * Validates the PCG64 DXSM implementation against official C++ reference code.
+ * See README.md for details on usage and reference sources.
+ *
+ * Requires a compiler with 128-bit integer support (gcc or clang).
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef __uint128_t pcg128_t;
+
+#define PCG_128BIT_CONSTANT(high, low) (((pcg128_t)(high) << 64) + (low))
+
+// ============================================================================
+// PCG64 DXSM Implementation (pcg_engines::cm_setseq_dxsm_128_64)
+// Based on: https://github.com/imneme/pcg-cpp/blob/master/include/pcg_random.hpp
+// (c) 2014-2019 M.E. O'Neill / pcg-random.org, Apache License 2.0
+// ============================================================================
+
+static const uint64_t CHEAP_MULTIPLIER = 0xda942042e4dd58b5ULL;
+
+// pcg-cpp's default 128-bit stream increment
+static const pcg128_t DEFAULT_INCREMENT = PCG_128BIT_CONSTANT(6364136223846793005ULL, 1442695040888963407ULL);
+
+typedef struct {
+    pcg128_t state;
+    pcg128_t inc;
+} pcg64_random_t;
+
+static inline void pcg64_step_r(pcg64_random_t* rng) {
+    rng->state = rng->state * CHEAP_MULTIPLIER + rng->inc;
+}
+
+// dxsm_mixin::output(), applied to the state before stepping (output_previous)
+uint64_t pcg64_random_r(pcg64_random_t* rng) {
+    uint64_t hi = (uint64_t)(rng->state >> 64);
+    uint64_t lo = (uint64_t)rng->state;
+    pcg64_step_r(rng);
+
+    lo |= 1;
+    hi ^= hi >> 32;
+    hi *= CHEAP_MULTIPLIER;
+    hi ^= hi >> 48;
+    hi *= lo;
+    return hi;
+}
+
+// Brown's arbitrary-stride algorithm (pcg_advance_lcg_128 in pcg-c)
+pcg128_t pcg_advance_lcg_128(pcg128_t state, pcg128_t delta, pcg128_t cur_mult,
+                             pcg128_t cur_plus) {
+    pcg128_t acc_mult = 1u;
+    pcg128_t acc_plus = 0u;
+    while (delta > 0) {
+        if (delta & 1) {
+            acc_mult *= cur_mult;
+            acc_plus = acc_plus * cur_mult + cur_plus;
+        }
+        cur_plus = (cur_mult + 1) * cur_plus;
+        cur_mult *= cur_mult;
+        delta /= 2;
+    }
+    return acc_mult * state + acc_plus;
+}
+
+void pcg64_advance_r(pcg64_random_t* rng, pcg128_t delta) {
+    rng->state = pcg_advance_lcg_128(rng->state, delta, CHEAP_MULTIPLIER, rng->inc);
+}
+
+// Matches setSeeds() in pcg64.ts (the engine's (state, stream) constructor computes
+// bump(seed + inc), which is the same as pcg32_srandom_r's step, add seed, step)
+void pcg64_seed(pcg64_random_t* rng, pcg128_t initstate, pcg128_t inc) {
+    rng->state = 0U;
+    rng->inc = inc;
+    pcg64_step_r(rng);
+    rng->state += initstate;
+    pcg64_step_r(rng);
+}
+
+// Matches setStreamIncrement() in pcg64.ts (the engine's set_stream())
+pcg128_t pcg64_stream_increment(uint64_t stream) {
+    return ((pcg128_t)stream << 1) | 1;
+}
+
+// TEST_SEEDS.DOUBLE_0 (high) and TEST_SEEDS.DOUBLE_1 (low)
+static const pcg128_t TEST_SEED = PCG_128BIT_CONSTANT(0x9E3779B97F4A7C15ULL, 0x6C078965D5B2A5D3ULL);
+
+// ============================================================================
+// Test Program
+// ============================================================================
+
+int main() {
+    printf("PCG64 DXSM Reference Value Validation\n");
+    printf("=====================================\n\n");
+
+    pcg64_random_t rng;
+    int failures = 0;
+
+    // Validate advance(delta) against delta individual steps
+    static const uint64_t DELTAS[] = { 0, 1, 2, 3, 1000, 65537, 1000000 };
+
+    for (size_t d = 0; d < sizeof DELTAS / sizeof *DELTAS; d++) {
+        const uint64_t delta = DELTAS[d];
+
+        pcg64_seed(&rng, TEST_SEED, DEFAULT_INCREMENT);
+        for (uint64_t i = 0; i < delta; i++) pcg64_random_r(&rng);
+        const uint64_t expected = pcg64_random_r(&rng);
+
+        pcg64_seed(&rng, TEST_SEED, DEFAULT_INCREMENT);
+        pcg64_advance_r(&rng, delta);
+        const uint64_t actual = pcg64_random_r(&rng);
+
+        const int ok = expected == actual;
+        if (!ok) failures++;
+
+        printf("  delta = %-8llu next(): %-20llu  %s\n",
+               (unsigned long long)delta, (unsigned long long)actual, ok ? "OK" : "MISMATCH");
+    }
+
+    // Reference values
+    pcg64_seed(&rng, TEST_SEED, DEFAULT_INCREMENT);
+    const uint64_t first = pcg64_random_r(&rng);
+    const uint64_t second = pcg64_random_r(&rng);
+
+    pcg64_seed(&rng, TEST_SEED, DEFAULT_INCREMENT);
+    pcg64_advance_r(&rng, (pcg128_t)1 << 40);
+    const uint64_t advanced = pcg64_random_r(&rng);
+
+    pcg64_seed(&rng, TEST_SEED, pcg64_stream_increment(5));
+    const uint64_t stream5 = pcg64_random_r(&rng);
+
+    printf("\nFor test-utils.ts PCG64_REFERENCE namespace:\n");
+    printf("============================================\n");
+    printf("PCG64 (seeds: DOUBLE_0, DOUBLE_1, default stream) first 2 next() values:\n");
+    printf("  uint64: %llu, %llu\n", (unsigned long long)first, (unsigned long long)second);
+    printf("PCG64 (seeds: DOUBLE_0, DOUBLE_1, default stream) after advance(2^40) then next():\n");
+    printf("  uint64: %llu\n", (unsigned long long)advanced);
+    printf("PCG64 (seeds: DOUBLE_0, DOUBLE_1, setStreamIncrement(5)) first next():\n");
+    printf("  uint64: %llu\n", (unsigned long long)stream5);
+
+    if (failures) {
+        printf("\n%d advance() mismatch(es) against individual reference steps\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
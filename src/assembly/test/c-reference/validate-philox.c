@@ -0,0 +1,141 @@
+/**
+ * Validates the Philox4x32-10 implementation against the Random123 reference
+ * algorithm and its published known-answer test vectors.
+ * See README.md for details on usage and reference sources.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+// ============================================================================
+// Philox4x32-10 Implementation (philox4x32_R with R = 10)
+// Based on: https://github.com/DEShawResearch/random123/blob/main/include/Random123/philox.h
+// Copyright 2010-2011, D. E. Shaw Research, BSD 3-Clause License
+// ============================================================================
+
+#define PHILOX_M4x32_0 0xD2511F53U
+#define PHILOX_M4x32_1 0xCD9E8D57U
+#define PHILOX_W32_0   0x9E3779B9U
+#define PHILOX_W32_1   0xBB67AE85U
+
+typedef struct { uint32_t v[4]; } philox4x32_ctr_t;
+typedef struct { uint32_t v[2]; } philox4x32_key_t;
+
+static inline uint32_t mulhilo32(uint32_t a, uint32_t b, uint32_t* hip) {
+    const uint64_t product = (uint64_t)a * b;
+    *hip = (uint32_t)(product >> 32);
+    return (uint32_t)product;
+}
+
+static inline philox4x32_ctr_t philox4x32round(philox4x32_ctr_t ctr, philox4x32_key_t key) {
+    uint32_t hi0, hi1;
+    const uint32_t lo0 = mulhilo32(PHILOX_M4x32_0, ctr.v[0], &hi0);
+    const uint32_t lo1 = mulhilo32(PHILOX_M4x32_1, ctr.v[2], &hi1);
+    philox4x32_ctr_t out = {{ hi1 ^ ctr.v[1] ^ key.v[0], lo1, hi0 ^ ctr.v[3] ^ key.v[1], lo0 }};
+    return out;
+}
+
+static inline philox4x32_key_t philox4x32bumpkey(philox4x32_key_t key) {
+    key.v[0] += PHILOX_W32_0;
+    key.v[1] += PHILOX_W32_1;
+    return key;
+}
+
+philox4x32_ctr_t philox4x32_10(philox4x32_ctr_t ctr, philox4x32_key_t key) {
+    ctr = philox4x32round(ctr, key);
+    for (int round = 1; round < 10; round++) {
+        key = philox4x32bumpkey(key);
+        ctr = philox4x32round(ctr, key);
+    }
+    return ctr;
+}
+
+// ============================================================================
+// Generator interface matching philox.ts
+// ============================================================================
+
+// The 64-bit seed is the key (low word first), the low 64 bits of the counter are the
+// block index, and the high 64 bits are the stream (workerId low, nodeId high)
+void philox_block(uint64_t seed, uint64_t stream, uint64_t block, uint64_t out[2]) {
+    philox4x32_key_t key = {{ (uint32_t)seed, (uint32_t)(seed >> 32) }};
+    philox4x32_ctr_t ctr = {{ (uint32_t)block, (uint32_t)(block >> 32),
+                              (uint32_t)stream, (uint32_t)(stream >> 32) }};
+    ctr = philox4x32_10(ctr, key);
+
+    out[0] = (uint64_t)ctr.v[1] << 32 | ctr.v[0];
+    out[1] = (uint64_t)ctr.v[3] << 32 | ctr.v[2];
+}
+
+// uint64() output at position `index` (2 outputs per block)
+uint64_t philox_at(uint64_t seed, uint64_t stream, uint64_t index) {
+    uint64_t out[2];
+    philox_block(seed, stream, index >> 1, out);
+    return out[index & 1];
+}
+
+// TEST_SEEDS.SINGLE
+static const uint64_t TEST_SEED = 0x9E3779B97F4A7C15ULL;
+
+// ============================================================================
+// Test Program
+// ============================================================================
+
+int main() {
+    printf("Philox4x32-10 Reference Value Validation\n");
+    printf("========================================\n\n");
+
+    int failures = 0;
+
+    // Known-answer tests from Random123's kat_vectors: counter, key, expected output
+    static const uint32_t KAT[][10] = {
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 },
+        { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+          0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd },
+        { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344, 0xa4093822, 0x299f31d0,
+          0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 }
+    };
+
+    for (size_t t = 0; t < sizeof KAT / sizeof *KAT; t++) {
+        philox4x32_ctr_t ctr = {{ KAT[t][0], KAT[t][1], KAT[t][2], KAT[t][3] }};
+        philox4x32_key_t key = {{ KAT[t][4], KAT[t][5] }};
+        ctr = philox4x32_10(ctr, key);
+
+        int ok = 1;
+        for (int i = 0; i < 4; i++) {
+            if (ctr.v[i] != KAT[t][6 + i]) ok = 0;
+        }
+        if (!ok) failures++;
+
+        printf("  KAT %zu: %08x %08x %08x %08x  %s\n",
+               t, ctr.v[0], ctr.v[1], ctr.v[2], ctr.v[3], ok ? "OK" : "MISMATCH");
+    }
+
+    // Reference values
+    const uint64_t first = philox_at(TEST_SEED, 0, 0);
+    const uint64_t second = philox_at(TEST_SEED, 0, 1);
+    const uint64_t third = philox_at(TEST_SEED, 0, 2);
+    const uint64_t advanced = philox_at(TEST_SEED, 0, 1ULL << 40);
+    const uint64_t advancedOdd = philox_at(TEST_SEED, 0, (1ULL << 40) + 1);
+    const uint64_t stream5 = philox_at(TEST_SEED, 5, 0);
+    const uint64_t nodeWorker = philox_at(TEST_SEED, 3ULL << 32 | 5, 0);
+
+    printf("\nFor test-utils.ts PHILOX_REFERENCE namespace:\n");
+    printf("=============================================\n");
+    printf("Philox (seed: SINGLE) first 3 uint64() values:\n");
+    printf("  uint64: %llu, %llu, %llu\n",
+           (unsigned long long)first, (unsigned long long)second, (unsigned long long)third);
+    printf("Philox (seed: SINGLE) after advance(2^40) then uint64() x2:\n");
+    printf("  uint64: %llu, %llu\n", (unsigned long long)advanced, (unsigned long long)advancedOdd);
+    printf("Philox (seed: SINGLE) after jumpTo(5) then uint64():\n");
+    printf("  uint64: %llu\n", (unsigned long long)stream5);
+    printf("Philox (seed: SINGLE) after longJumpTo(3), jumpTo(5) then uint64():\n");
+    printf("  uint64: %llu\n", (unsigned long long)nodeWorker);
+
+    if (failures) {
+        printf("\n%d known-answer test mismatch(es)\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,272 @@
+/**
+ * Validates the xoshiro256++ / xoshiro256** and xoroshiro128++ / xoroshiro128** generators
+ * against official C reference code, and provides their reference values.
+ * See README.md for details on usage and reference sources.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+static inline uint64_t rotl(const uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// ============================================================================
+// Reference next() Implementations
+// Based on: https://prng.di.unimi.it/xoshiro256plusplus.c
+//           https://prng.di.unimi.it/xoshiro256starstar.c
+//           https://prng.di.unimi.it/xoroshiro128plusplus.c
+//           https://prng.di.unimi.it/xoroshiro128starstar.c
+// Public Domain, 2018-2019 by David Blackman and Sebastiano Vigna
+// ============================================================================
+
+uint64_t xoshiro256plusplus_next(uint64_t *s) {
+    const uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+    const uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+uint64_t xoshiro256starstar_next(uint64_t *s) {
+    const uint64_t result = rotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+uint64_t xoroshiro128plusplus_next(uint64_t *s) {
+    const uint64_t s0 = s[0];
+    uint64_t s1 = s[1];
+    const uint64_t result = rotl(s0 + s1, 17) + s0;
+    s1 ^= s0;
+    s[0] = rotl(s0, 49) ^ s1 ^ (s1 << 21);
+    s[1] = rotl(s1, 28);
+    return result;
+}
+
+uint64_t xoroshiro128starstar_next(uint64_t *s) {
+    const uint64_t s0 = s[0];
+    uint64_t s1 = s[1];
+    const uint64_t result = rotl(s0 * 5, 7) * 9;
+    s1 ^= s0;
+    s[0] = rotl(s0, 24) ^ s1 ^ (s1 << 16);
+    s[1] = rotl(s1, 37);
+    return result;
+}
+
+// ============================================================================
+// Jump Polynomials
+// xoshiro256++ / ** share the xoshiro256+ engine, and xoroshiro128** shares the
+// xoroshiro128+ engine, so they use the same reference jump constants.
+// xoroshiro128++ has its own engine, with its own reference jump constants.
+// ============================================================================
+
+static const uint64_t JUMP_256[] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+                                     0xa9582618e03fc9aa, 0x39abdc4529b1661c };
+static const uint64_t LONG_JUMP_256[] = { 0x76e15d3efefdcbbf, 0xc5004e441c522fb3,
+                                          0x77710069854ee241, 0x39109bb02acbe635 };
+static const uint64_t JUMP_128[] = { 0xdf900294d8f554a5, 0x170865df4b3201fc };
+static const uint64_t LONG_JUMP_128[] = { 0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1 };
+static const uint64_t JUMP_128_PP[] = { 0x2bd7a6a6e99c2ddc, 0x0992ccaf6a6fca05 };
+static const uint64_t LONG_JUMP_128_PP[] = { 0x360fd5f2cf8d5d99, 0x9c6e6877736c46e3 };
+
+// Characteristic polynomials, leading x^128 / x^256 term omitted
+// Matches: CHAR_POLY_256 / CHAR_POLY_128 / CHAR_POLY_128_PP in conversion.ts
+static const uint64_t CHAR_POLY_256[] = { 0x9d116f2bb0f0f001, 0x0280002bcefd1a5e,
+                                          0x04b4edcf26259f85, 0x0003c03c3f3ecb19 };
+static const uint64_t CHAR_POLY_128[] = { 0x095b8f76579aa001, 0x0008828e513b43d5 };
+static const uint64_t CHAR_POLY_128_PP[] = { 0x8dae70779760b081, 0x0031bcf2f855d6e5 };
+
+static const uint64_t POLY_X[] = { 2, 0, 0, 0 };
+
+typedef uint64_t (*next_fn)(uint64_t *s);
+
+typedef struct {
+    const char *name;
+    next_fn next;
+    int words;
+    const uint64_t *jump;
+    const uint64_t *long_jump;
+    const uint64_t *char_poly;
+} generator;
+
+static const generator GENERATORS[] = {
+    { "Xoshiro256PlusPlus", xoshiro256plusplus_next, 4, JUMP_256, LONG_JUMP_256, CHAR_POLY_256 },
+    { "Xoshiro256StarStar", xoshiro256starstar_next, 4, JUMP_256, LONG_JUMP_256, CHAR_POLY_256 },
+    { "Xoroshiro128PlusPlus", xoroshiro128plusplus_next, 2, JUMP_128_PP, LONG_JUMP_128_PP, CHAR_POLY_128_PP },
+    { "Xoroshiro128StarStar", xoroshiro128starstar_next, 2, JUMP_128, LONG_JUMP_128, CHAR_POLY_128 }
+};
+
+// Applies a jump polynomial to the state, exactly as the reference jump() does
+static void apply_poly(const generator *g, uint64_t *s, const uint64_t *poly) {
+    uint64_t jumped[4] = { 0 };
+    for (int i = 0; i < g->words; i++)
+        for (int b = 0; b < 64; b++) {
+            if (poly[i] & UINT64_C(1) << b)
+                for (int w = 0; w < g->words; w++)
+                    jumped[w] ^= s[w];
+            g->next(s);
+        }
+    for (int w = 0; w < g->words; w++)
+        s[w] = jumped[w];
+}
+
+// out = (a * b) mod char_poly, mirrors polyPowMod() in common/polynomial.ts
+static void poly_mul_mod(const uint64_t *a, const uint64_t *b, const uint64_t *char_poly,
+                         int words, uint64_t *out) {
+    uint64_t product[4] = { 0 };
+
+    for (int i = words * 64 - 1; i >= 0; i--) {
+        const uint64_t reduce = 0 - (product[words - 1] >> 63);
+        for (int w = words - 1; w > 0; w--)
+            product[w] = (product[w] << 1) | (product[w - 1] >> 63);
+        product[0] <<= 1;
+
+        const uint64_t add = 0 - ((b[i / 64] >> (i % 64)) & 1);
+        for (int w = 0; w < words; w++)
+            product[w] ^= (char_poly[w] & reduce) ^ (a[w] & add);
+    }
+
+    for (int w = 0; w < words; w++)
+        out[w] = product[w];
+}
+
+// out = base^exponent mod char_poly
+static void poly_pow_mod(const uint64_t *base, uint64_t exponent, const uint64_t *char_poly,
+                         int words, uint64_t *out) {
+    uint64_t square[4];
+
+    for (int w = 0; w < words; w++) {
+        out[w] = 0;
+        square[w] = base[w];
+    }
+    out[0] = 1;
+
+    while (exponent) {
+        if (exponent & 1)
+            poly_mul_mod(out, square, char_poly, words, out);
+        exponent >>= 1;
+        if (exponent)
+            poly_mul_mod(square, square, char_poly, words, square);
+    }
+}
+
+static void poly_apply_power(const generator *g, uint64_t *s, const uint64_t *base, uint64_t exponent) {
+    uint64_t poly[4];
+    poly_pow_mod(base, exponent, g->char_poly, g->words, poly);
+    apply_poly(g, s, poly);
+}
+
+// ============================================================================
+// Test Seeds
+// ============================================================================
+
+// TEST_SEEDS.OCTET_0 - OCTET_7: lane 0 takes the first `words` seeds,
+// and SIMD lane 1 takes the next `words` seeds
+static const uint64_t SEEDS[] = {
+    0x9E3779B97F4A7C15ULL, 0x6C078965D5B2A5D3ULL, 0xBF58476D1CE4E5B9ULL, 0x94D049BB133111EBULL,
+    0x8C6D2D3A5F9A4B1CULL, 0xD3C5E8B2F7A16E4AULL, 0xA7B9C1D3E5F70829ULL, 0xF1E2D3C4B5A69788ULL
+};
+
+static void seed(const generator *g, uint64_t *s, int lane) {
+    for (int w = 0; w < g->words; w++)
+        s[w] = SEEDS[lane * g->words + w];
+}
+
+// ============================================================================
+// Test Program
+// ============================================================================
+
+int main() {
+    printf("Scrambler Variant Validation\n");
+    printf("============================\n");
+
+    int failures = 0;
+    uint64_t s[4];
+
+    for (size_t n = 0; n < sizeof GENERATORS / sizeof *GENERATORS; n++) {
+        const generator *g = &GENERATORS[n];
+        printf("\n%s (lane 0 seeds: OCTET_0 - OCTET_%d)\n", g->name, g->words - 1);
+
+        // Validate jumpTo(k) and longJumpTo(k) against k repeated reference jumps
+        static const uint64_t INDICES[] = { 0, 1, 2, 3, 7, 100 };
+        for (size_t k = 0; k < sizeof INDICES / sizeof *INDICES; k++) {
+            seed(g, s, 0);
+            for (uint64_t i = 0; i < INDICES[k]; i++) apply_poly(g, s, g->jump);
+            const uint64_t jump_expected = g->next(s);
+            seed(g, s, 0);
+            poly_apply_power(g, s, g->jump, INDICES[k]);
+            const uint64_t jump_actual = g->next(s);
+
+            seed(g, s, 0);
+            for (uint64_t i = 0; i < INDICES[k]; i++) apply_poly(g, s, g->long_jump);
+            const uint64_t long_expected = g->next(s);
+            seed(g, s, 0);
+            poly_apply_power(g, s, g->long_jump, INDICES[k]);
+            const uint64_t long_actual = g->next(s);
+
+            const int ok = jump_expected == jump_actual && long_expected == long_actual;
+            if (!ok) failures++;
+            printf("  jumpTo / longJumpTo k = %-4llu %s\n", (unsigned long long)INDICES[k], ok ? "OK" : "MISMATCH");
+        }
+
+        // Validate advance(n) against n individual reference next() calls
+        static const uint64_t DELTAS[] = { 0, 1, 127, 128, 255, 256, 1000, 65537 };
+        for (size_t d = 0; d < sizeof DELTAS / sizeof *DELTAS; d++) {
+            seed(g, s, 0);
+            for (uint64_t i = 0; i < DELTAS[d]; i++) g->next(s);
+            const uint64_t expected = g->next(s);
+            seed(g, s, 0);
+            poly_apply_power(g, s, POLY_X, DELTAS[d]);
+            const uint64_t actual = g->next(s);
+
+            const int ok = expected == actual;
+            if (!ok) failures++;
+            printf("  advance n = %-6llu       %s\n", (unsigned long long)DELTAS[d], ok ? "OK" : "MISMATCH");
+        }
+
+        // Reference values
+        seed(g, s, 0);
+        const uint64_t first = g->next(s);
+
+        seed(g, s, 0);
+        apply_poly(g, s, g->jump);
+        const uint64_t jumped = g->next(s);
+
+        seed(g, s, 1);
+        apply_poly(g, s, g->jump);
+        const uint64_t lane1_jumped = g->next(s);
+
+        seed(g, s, 0);
+        poly_apply_power(g, s, g->long_jump, 3);
+        poly_apply_power(g, s, g->jump, 5);
+        const uint64_t node_worker = g->next(s);
+
+        seed(g, s, 0);
+        poly_apply_power(g, s, POLY_X, UINT64_C(1) << 40);
+        const uint64_t advanced = g->next(s);
+
+        printf("  First next():                            %llu\n", (unsigned long long)first);
+        printf("  After jump() then next():                %llu\n", (unsigned long long)jumped);
+        printf("  SIMD lane 1 after jump() then next():    %llu\n", (unsigned long long)lane1_jumped);
+        printf("  After long_jump() x3, jump() x5, next(): %llu\n", (unsigned long long)node_worker);
+        printf("  After advance(2^40) then next():         %llu\n", (unsigned long long)advanced);
+    }
+
+    if (failures) {
+        printf("\n%d jumpTo() / longJumpTo() / advance() mismatch(es) against the reference implementations\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
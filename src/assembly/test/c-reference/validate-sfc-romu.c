@@ -0,0 +1,106 @@
+/**
+ * Provides reference values for the SFC64, RomuTrio and RomuDuoJr generators,
+ * which have no jump or advance functions to validate.
+ * See README.md for details on usage and reference sources.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define ROTL(d, lrot) ((d << (lrot)) | (d >> (64 - (lrot))))
+
+// ============================================================================
+// SFC64 (Small Fast Chaotic PRNG, 64-bit)
+// Based on: PractRand (sfc64), public domain, Chris Doty-Humphrey
+// ============================================================================
+
+typedef struct {
+    uint64_t a, b, c, counter;
+} sfc64;
+
+uint64_t sfc64_next(sfc64* s) {
+    const uint64_t tmp = s->a + s->b + s->counter++;
+    s->a = s->b ^ (s->b >> 11);
+    s->b = s->c + (s->c << 3);
+    s->c = ROTL(s->c, 24) + tmp;
+    return tmp;
+}
+
+// PractRand's 3-seed initialization: 18 discarded rounds mix the seeds
+void sfc64_seed(sfc64* s, uint64_t s1, uint64_t s2, uint64_t s3) {
+    s->a = s1;
+    s->b = s2;
+    s->c = s3;
+    s->counter = 1;
+    for (int i = 0; i < 18; i++) {
+        sfc64_next(s);
+    }
+}
+
+// ============================================================================
+// RomuTrio and RomuDuoJr
+// Based on: https://www.romu-random.org/code.c, Mark A. Overton (Apache 2.0)
+// ============================================================================
+
+static uint64_t xState, yState, zState;
+
+uint64_t romuTrio_random(void) {
+    uint64_t xp = xState, yp = yState, zp = zState;
+    xState = 15241094284759029579u * zp;
+    yState = yp - xp;  yState = ROTL(yState, 12);
+    zState = zp - yp;  zState = ROTL(zState, 44);
+    return xp;
+}
+
+uint64_t romuDuoJr_random(void) {
+    uint64_t xp = xState;
+    xState = 15241094284759029579u * yState;
+    yState = yState - xp;  yState = ROTL(yState, 27);
+    return xp;
+}
+
+// TEST_SEEDS.QUAD
+static const uint64_t TEST_SEEDS[4] = {
+    0x9E3779B97F4A7C15ULL, 0x6C078965D5B2A5D3ULL, 0xBF58476D1CE4E5B9ULL, 0x94D049BB133111EBULL
+};
+
+// ============================================================================
+// Test Program
+// ============================================================================
+
+int main() {
+    printf("SFC64 / Romu Reference Values\n");
+    printf("=============================\n");
+
+    sfc64 rng;
+    sfc64_seed(&rng, TEST_SEEDS[0], TEST_SEEDS[1], TEST_SEEDS[2]);
+    uint64_t sfc[3];
+    for (int i = 0; i < 3; i++) {
+        sfc[i] = sfc64_next(&rng);
+    }
+
+    xState = TEST_SEEDS[0]; yState = TEST_SEEDS[1]; zState = TEST_SEEDS[2];
+    uint64_t trio[3];
+    for (int i = 0; i < 3; i++) {
+        trio[i] = romuTrio_random();
+    }
+
+    xState = TEST_SEEDS[0]; yState = TEST_SEEDS[1];
+    uint64_t duoJr[3];
+    for (int i = 0; i < 3; i++) {
+        duoJr[i] = romuDuoJr_random();
+    }
+
+    printf("\nFor test-utils.ts SFC_ROMU_REFERENCE namespace:\n");
+    printf("===============================================\n");
+    printf("SFC64 (seeds: QUAD_0 - QUAD_2) first 3 uint64() values:\n");
+    printf("  uint64: %llu, %llu, %llu\n", (unsigned long long)sfc[0], (unsigned long long)sfc[1], (unsigned long long)sfc[2]);
+    printf("RomuTrio (seeds: QUAD_0 - QUAD_2) first 3 uint64() values:\n");
+    printf("  uint64: %llu, %llu, %llu\n", (unsigned long long)trio[0], (unsigned long long)trio[1], (unsigned long long)trio[2]);
+    printf("RomuDuoJr (seeds: QUAD_0 - QUAD_1) first 3 uint64() values:\n");
+    printf("  uint64: %llu, %llu, %llu\n", (unsigned long long)duoJr[0], (unsigned long long)duoJr[1], (unsigned long long)duoJr[2]);
+
+    printf("(Romu's first output is its x seed, so the later values check the state update)\n");
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * Empirical Table Helper Tests
+ *
+ * Tests for the empirical table builder and the inversion used by every generator's
+ * empirical() and empiricalArray() functions.
+ *
+ * Test Strategy:
+ * - Verify values over an even grid of uniform numbers match the exact inverse of the
+ *   tabulated CDF, for even, skewed and many-point CDFs
+ * - Verify the SIMD inversion matches the scalar inversion in each lane
+ * - Verify jumps are drawn as their value, gaps are never drawn, and tables can be rebuilt in place
+ *
+ * Contrast: These test the arithmetic in isolation, while each generator's suite
+ * tests the values its own loops produce.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import { empiricalTableBuild, empiricalSegments, empiricalValue } from '../common/empirical';
+import { empiricalValuex2 } from '../common/empirical-simd';
+
+// values are drawn for GRID_SIZE evenly spaced uniform numbers
+const GRID_SIZE: i32 = 1 << 16;
+
+/**
+ * Builds a table for the CDF tabulated at `values` and `cdf`, which must already run from
+ * 0 to 1.
+ */
+function build(values: StaticArray<f64>, cdf: StaticArray<f64>): Float64Array {
+  const points = new Float64Array(2 * values.length);
+  for (let i: i32 = 0; i < values.length; i++) {
+    points[2 * i] = values[i];
+    points[2 * i + 1] = cdf[i];
+  }
+
+  const table = new Float64Array(4 * (values.length - 1));
+  empiricalTableBuild(points, table);
+  return table;
+}
+
+/**
+ * Draws a value from `table` for a uniform number.
+ */
+function draw(table: Float64Array, u: f64): f64 {
+  return empiricalValue(u, table.dataStart, empiricalSegments(table.length));
+}
+
+/**
+ * Inverts the CDF tabulated at `values` and `cdf` for a uniform number, by a linear scan.
+ */
+function exactInverse(values: StaticArray<f64>, cdf: StaticArray<f64>, u: f64): f64 {
+  let i: i32 = 1;
+  while (cdf[i] <= u) i++;
+  return values[i - 1] + (u - cdf[i - 1]) / (cdf[i] - cdf[i - 1]) * (values[i] - values[i - 1]);
+}
+
+/**
+ * Builds a table for the CDF tabulated at `values` and `cdf`, and gets the largest difference
+ * between the value drawn for each uniform number over the grid and its exact inverse.
+ */
+function gridError(values: StaticArray<f64>, cdf: StaticArray<f64>): f64 {
+  const table = build(values, cdf);
+  let maxError: f64 = 0.0;
+  for (let i: i32 = 0; i < GRID_SIZE; i++) {
+    const u = <f64>i / <f64>GRID_SIZE;
+    const error = Math.abs(draw(table, u) - exactInverse(values, cdf, u));
+    if (error > maxError) maxError = error;
+  }
+  return maxError;
+}
+
+describe('Empirical tables', () => {
+  test('values match the exact inverse of the CDF', () => {
+    expect(gridError([0.0, 1.0, 2.0, 3.0, 4.0], [0.0, 0.25, 0.5, 0.75, 1.0])).toBeLessThan(1e-12);
+    expect(gridError([2.0, 12.0, 40.0, 180.0, 2000.0], [0.0, 0.5, 0.9, 0.99, 1.0])).toBeLessThan(1e-9);
+    expect(gridError([-5.0, -1.0, 0.0, 0.1, 7.0, 8.0], [0.0, 0.001, 0.002, 0.9, 0.95, 1.0])).toBeLessThan(1e-9);
+
+    // a many-point CDF, with its points bunched in probability at each end
+    const values = new StaticArray<f64>(101);
+    const cdf = new StaticArray<f64>(101);
+    for (let i: i32 = 0; i <= 100; i++) {
+      const t = <f64>i / 100.0;
+      values[i] = <f64>i;
+      cdf[i] = t * t * (3.0 - 2.0 * t);
+    }
+    cdf[100] = 1.0;
+    expect(gridError(values, cdf)).toBeLessThan(1e-9);
+  });
+
+  test('SIMD values match scalar values in each lane', () => {
+    const table = build([2.0, 12.0, 40.0, 180.0, 2000.0], [0.0, 0.5, 0.9, 0.99, 1.0]);
+    const segments = empiricalSegments(table.length);
+    for (let i: i32 = 0; i < GRID_SIZE; i += 2) {
+      const u0 = <f64>i / <f64>GRID_SIZE;
+      const u1 = 1.0 - <f64>(i + 1) / <f64>GRID_SIZE;
+      const v = empiricalValuex2(f64x2(u0, u1), table.dataStart, segments);
+      expect(f64x2.extract_lane(v, 0)).toBe(draw(table, u0));
+      expect(f64x2.extract_lane(v, 1)).toBe(draw(table, u1));
+    }
+  });
+
+  test('jumps are drawn as their value, and gaps are never drawn', () => {
+    // a jump of 0.5 at 10, and a gap between 20 and 30
+    const table = build([0.0, 10.0, 10.0, 20.0, 30.0, 40.0], [0.0, 0.2, 0.7, 0.8, 0.8, 1.0]);
+    let jumps: i32 = 0;
+    for (let i: i32 = 0; i < GRID_SIZE; i++) {
+      const x = draw(table, <f64>i / <f64>GRID_SIZE);
+      if (x == 10.0) jumps++;
+      expect(x > 20.001 && x < 29.999).toBe(false);
+    }
+    expect(Math.abs(<f64>jumps / <f64>GRID_SIZE - 0.5)).toBeLessThan(1e-4);
+  });
+
+  test('probabilities are rescaled, and tables can be rebuilt in place', () => {
+    const points = new Float64Array(6);
+    points[0] = 1.0;
+    points[1] = 5.0;
+    points[2] = 2.0;
+    points[3] = 6.0;
+    points[4] = 3.0;
+    points[5] = 7.0;
+
+    const table = new Float64Array(8);
+    empiricalTableBuild(points, table);
+    expect(draw(table, 0.0)).toBe(1.0);
+    expect(draw(table, 0.5)).toBe(2.0);
+    expect(draw(table, 0.75)).toBe(2.5);
+
+    points[0] = 100.0;
+    points[2] = 100.0;
+    points[4] = 100.0;
+    empiricalTableBuild(points, table);
+    expect(draw(table, 0.0)).toBe(100.0);
+    expect(draw(table, 0.999)).toBe(100.0);
+  });
+});
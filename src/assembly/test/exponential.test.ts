@@ -0,0 +1,144 @@
+/**
+ * Ziggurat Exponential Helper Tests
+ *
+ * Tests for the ziggurat tables and helpers used by every generator's exponential53(),
+ * exponential53Array() and arrivalTimesArray() functions, in scalar and SIMD form.
+ *
+ * Test Strategy:
+ * - Verify the generated tables describe 256 layers of equal area under exp(-x)
+ * - Verify the fast path accepts exactly the points inside their layers
+ * - Verify wedge draws accept and reject on the correct side of the curve
+ * - Verify tail draws are always beyond R, without infinities
+ * - Verify SIMD helpers match the scalar helpers in both lanes
+ *
+ * Contrast: These test the ziggurat pieces in isolation, while each generator's suite
+ * tests the distribution of the numbers its own wedge loop produces.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  exponentialLayer,
+  exponentialMagnitude,
+  exponentialInside,
+  exponentialFast,
+  exponentialWedge,
+  exponentialTail
+} from '../common/exponential';
+import {
+  exponentialFastx2,
+  exponentialRejectx2,
+  prefixSumx2
+} from '../common/exponential-simd';
+import {
+  ZIGGURAT_LAYERS,
+  EXPONENTIAL_R,
+  EXPONENTIAL_V,
+  EXPONENTIAL_X,
+  EXPONENTIAL_Y
+} from '../common/ziggurat-tables';
+import {
+  HIGH_PRECISION_TOLERANCE,
+  SIMD_LANE_0,
+  SIMD_LANE_1
+} from './helpers/test-utils';
+
+// layer 255 (bits 4-11 set), point bits 0x80000 (half way across)
+const TOP_LAYER_HALF_WAY: u64 = 0x8000000000000FF0;
+// layer 1, point half way across
+const LAYER_1_HALF_WAY: u64 = 0x8000000000000010;
+
+describe('Ziggurat tables', () => {
+  test('have one edge per layer, from the base layer to the peak', () => {
+    expect(EXPONENTIAL_X.length).toBe(ZIGGURAT_LAYERS + 1);
+    expect(EXPONENTIAL_Y.length).toBe(ZIGGURAT_LAYERS + 1);
+    expect(EXPONENTIAL_X[1]).toBe(EXPONENTIAL_R);
+    expect(EXPONENTIAL_X[ZIGGURAT_LAYERS]).toBe(0.0);
+    expect(EXPONENTIAL_Y[ZIGGURAT_LAYERS]).toBe(1.0);
+  });
+
+  test('edges narrow and densities rise toward the peak', () => {
+    let unordered = 0;
+    for (let i = 0; i < ZIGGURAT_LAYERS; i++) {
+      if (EXPONENTIAL_X[i + 1] >= EXPONENTIAL_X[i] || EXPONENTIAL_Y[i + 1] <= EXPONENTIAL_Y[i]) unordered++;
+      expect(Math.abs(EXPONENTIAL_Y[i] - Math.exp(-EXPONENTIAL_X[i]))).toBeLessThan(HIGH_PRECISION_TOLERANCE);
+    }
+    expect(unordered).toBe(0);
+  });
+
+  test('every layer has area V, and the tail is exactly the base layer\'s spare area', () => {
+    for (let i = 1; i < ZIGGURAT_LAYERS; i++) {
+      const area = EXPONENTIAL_X[i] * (EXPONENTIAL_Y[i + 1] - EXPONENTIAL_Y[i]);
+      expect(Math.abs(area - EXPONENTIAL_V) / EXPONENTIAL_V).toBeLessThan(1e-9);
+    }
+
+    // the area past R is exp(-R), which the base layer's rectangle makes room for
+    const spare = (EXPONENTIAL_X[0] - EXPONENTIAL_R) * EXPONENTIAL_Y[1];
+    expect(Math.abs(spare - Math.exp(-EXPONENTIAL_R)) / EXPONENTIAL_V).toBeLessThan(1e-12);
+  });
+});
+
+describe('Fast path', () => {
+  test('layer bits are separate from the point bits', () => {
+    expect(exponentialLayer(TOP_LAYER_HALF_WAY)).toBe(255);
+    expect(exponentialLayer(LAYER_1_HALF_WAY)).toBe(1);
+    expect(exponentialMagnitude(LAYER_1_HALF_WAY, 1)).toBe(0.5 * EXPONENTIAL_X[1]);
+  });
+
+  test('accepts points inside their layer', () => {
+    // half way across layer 1 is inside layer 2's width
+    expect(exponentialInside(0.5 * EXPONENTIAL_X[1], 1)).toBe(true);
+    expect(exponentialFast(LAYER_1_HALF_WAY)).toBe(0.5 * EXPONENTIAL_X[1]);
+  });
+
+  test('defers points outside their layer with NaN', () => {
+    // nothing in the top layer is inside the peak, which has width 0
+    expect(exponentialInside(0.0, 255)).toBe(false);
+    expect(isNaN(exponentialFast(TOP_LAYER_HALF_WAY))).toBe(true);
+    expect(isNaN(exponentialFast(0xFFFFFFFFFFFFF000))).toBe(true); // base layer, past R
+  });
+});
+
+describe('Wedge and tail', () => {
+  test('wedge accepts points below the curve and rejects points above it', () => {
+    const z = 0.5 * EXPONENTIAL_X[255];
+
+    // height 0 is the layer's lower edge, below the curve everywhere in the layer
+    expect(exponentialWedge(z, 255, 0)).toBe(true);
+    // the top of the layer is the peak, above the curve everywhere but 0
+    expect(exponentialWedge(z, 255, 0xFFFFFFFFFFFFFFFF)).toBe(false);
+  });
+
+  test('tail draws are always beyond R, without infinities', () => {
+    expect(exponentialTail(0xFFFFFFFFFFFFFFFF)).toBe(EXPONENTIAL_R); // uniform 1 adds nothing to R
+    expect(Math.abs(exponentialTail(0) - (EXPONENTIAL_R + 53.0 * Math.LN2))).toBeLessThan(1e-12); // uniform 2^-53
+
+    let next: u64 = 0x9E3779B97F4A7C15;
+    for (let i = 0; i < 1000; i++) {
+      next = next * 6364136223846793005 + 1442695040888963407;
+      expect(exponentialTail(next)).toBeGreaterThanOrEqual(EXPONENTIAL_R);
+    }
+  });
+});
+
+describe('SIMD helpers', () => {
+  test('exponentialFastx2 matches exponentialFast in both lanes', () => {
+    const next = i64x2(LAYER_1_HALF_WAY, 0x123456789ABCDE50);
+    const z = exponentialFastx2(next);
+
+    expect(v128.extract_lane<f64>(z, <u8>SIMD_LANE_0)).toBe(exponentialFast(LAYER_1_HALF_WAY));
+    expect(v128.extract_lane<f64>(z, <u8>SIMD_LANE_1)).toBe(exponentialFast(0x123456789ABCDE50));
+    expect(exponentialRejectx2(z)).toBe(false);
+  });
+
+  test('exponentialRejectx2 flags either lane outside its layer', () => {
+    expect(exponentialRejectx2(exponentialFastx2(i64x2(TOP_LAYER_HALF_WAY, LAYER_1_HALF_WAY)))).toBe(true);
+    expect(exponentialRejectx2(exponentialFastx2(i64x2(LAYER_1_HALF_WAY, TOP_LAYER_HALF_WAY)))).toBe(true);
+  });
+
+  test('prefixSumx2 gets the running totals of both lanes', () => {
+    const sums = prefixSumx2(f64x2(1.5, 2.25));
+
+    expect(v128.extract_lane<f64>(sums, <u8>SIMD_LANE_0)).toBe(1.5);
+    expect(v128.extract_lane<f64>(sums, <u8>SIMD_LANE_1)).toBe(3.75);
+  });
+});
@@ -0,0 +1,146 @@
+/**
+ * Gamma Helper Tests
+ *
+ * Tests for the Marsaglia and Tsang helpers used by every generator's gamma53(), beta53()
+ * and chiSquared53() functions and their array versions, in scalar and SIMD form.
+ *
+ * Test Strategy:
+ * - Verify `d`, `c` and the boost power for shapes above and below 1
+ * - Verify the squeeze only accepts candidates that the full test also accepts
+ * - Verify uniforms exclude 0, so logarithms and boosts stay finite
+ * - Verify beta boosts applied as logarithms match direct boosts, and survive underflow
+ * - Verify SIMD helpers match the scalar helpers in both lanes
+ *
+ * Contrast: These test the arithmetic in isolation, while each generator's suite
+ * tests the distributions its own rejection loop produces.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  gammaD,
+  gammaC,
+  gammaBoostPower,
+  gammaCube,
+  gammaSqueeze,
+  gammaAccept,
+  gammaUniform,
+  gammaBoost,
+  betaBoosted
+} from '../common/gamma';
+import {
+  gammaUniformx2,
+  gammaCubex2,
+  gammaRejectx2,
+  gammaBoostx2
+} from '../common/gamma-simd';
+import {
+  HIGH_PRECISION_TOLERANCE,
+  SIMD_LANE_0,
+  SIMD_LANE_1
+} from './helpers/test-utils';
+
+describe('Parameters', () => {
+  test('d and c follow the shape, boosting shapes below 1 by 1', () => {
+    expect(gammaD(4.0)).toBe(4.0 - 1.0 / 3.0);
+    expect(gammaD(0.5)).toBe(1.5 - 1.0 / 3.0);
+    expect(Math.abs(gammaC(3.0) - 1.0 / 9.0 * Math.sqrt(3.0))).toBeLessThan(HIGH_PRECISION_TOLERANCE);
+  });
+
+  test('only shapes below 1 have a boost power', () => {
+    expect(gammaBoostPower(1.0)).toBe(0.0);
+    expect(gammaBoostPower(7.5)).toBe(0.0);
+    expect(gammaBoostPower(0.25)).toBe(4.0);
+  });
+});
+
+describe('Candidates', () => {
+  test('cube is (1 + c * x)^3, and not positive below x = -1 / c', () => {
+    expect(gammaCube(0.0, 0.2)).toBe(1.0);
+    expect(Math.abs(gammaCube(1.0, 0.2) - 1.728)).toBeLessThan(HIGH_PRECISION_TOLERANCE);
+    expect(gammaCube(-5.0, 0.2)).toBe(0.0);
+    expect(gammaCube(-6.0, 0.2)).toBeLessThan(0.0);
+  });
+
+  test('squeeze only accepts candidates the full test accepts', () => {
+    const d = gammaD(2.0);
+    const c = gammaC(d);
+    let squeezed = 0;
+    let disagreements = 0;
+
+    for (let i = 0; i <= 40; i++) {
+      const x = -2.0 + <f64>i * 0.1;
+      const v = gammaCube(x, c);
+      for (let j = 1; j <= 20; j++) {
+        const u = <f64>j * 0.05;
+        if (gammaSqueeze(x, u)) {
+          squeezed++;
+          if (!gammaAccept(x, v, u, d)) disagreements++;
+        }
+      }
+    }
+
+    expect(squeezed).toBeGreaterThan(400); // most of the grid is squeezed
+    expect(disagreements).toBe(0);
+  });
+});
+
+describe('Uniforms and boosts', () => {
+  test('uniforms are in range (0, 1]', () => {
+    expect(gammaUniform(0)).toBeGreaterThan(0.0);
+    expect(gammaUniform(0xFFFFFFFFFFFFFFFF)).toBe(1.0);
+  });
+
+  test('boost is the uniform to the boost power', () => {
+    expect(gammaBoost(0xFFFFFFFFFFFFFFFF, 4.0)).toBe(1.0);
+    expect(Math.abs(gammaBoost(0x8000000000000000, 2.0) - 0.25)).toBeLessThan(HIGH_PRECISION_TOLERANCE);
+  });
+
+  test('beta boosts as logarithms match boosting directly', () => {
+    // x = 2 boosted by 0.5^2 = 0.5, y = 1.5 unboosted: 0.5 / (0.5 + 1.5)
+    expect(Math.abs(betaBoosted(2.0, 1.5, 0.5, 1.0, 2.0, 0.0) - 0.25)).toBeLessThan(HIGH_PRECISION_TOLERANCE);
+  });
+
+  test('beta stays finite when both boosts underflow to 0', () => {
+    // shapes of 0.0005 boost both numbers by 0.5^2000 and 0.25^2000, far below the smallest f64
+    const result = betaBoosted(1.0, 1.0, 0.5, 0.25, 2000.0, 2000.0);
+
+    expect(Math.pow(0.5, 2000.0) + Math.pow(0.25, 2000.0)).toBe(0.0);
+    expect(isNaN(result)).toBe(false);
+    expect(result).toBe(1.0); // x's boost is larger by a factor of 2^2000
+  });
+});
+
+describe('SIMD helpers', () => {
+  test('gammaUniformx2 is in range (0, 1] in both lanes', () => {
+    const u = gammaUniformx2(i64x2(0, 0xFFFFFFFFFFFFFFFF));
+
+    expect(v128.extract_lane<f64>(u, <u8>SIMD_LANE_0)).toBe(1.0);
+    expect(v128.extract_lane<f64>(u, <u8>SIMD_LANE_1)).toBeGreaterThan(0.0);
+  });
+
+  test('gammaCubex2 matches gammaCube in both lanes', () => {
+    const v = gammaCubex2(f64x2(1.0, -2.5), f64x2.splat(0.2));
+
+    expect(v128.extract_lane<f64>(v, <u8>SIMD_LANE_0)).toBe(gammaCube(1.0, 0.2));
+    expect(v128.extract_lane<f64>(v, <u8>SIMD_LANE_1)).toBe(gammaCube(-2.5, 0.2));
+  });
+
+  test('gammaRejectx2 flags either lane that is not positive or fails the squeeze', () => {
+    const x = f64x2(0.5, -0.5);
+    const c = f64x2.splat(0.2);
+    const v = gammaCubex2(x, c);
+
+    expect(gammaRejectx2(x, v, f64x2(0.5, 0.5))).toBe(false);
+    expect(gammaRejectx2(x, v, f64x2(0.5, 1.0))).toBe(true); // u = 1 is never squeezed
+    expect(gammaRejectx2(x, f64x2(-1.0, 1.0), f64x2(0.5, 0.5))).toBe(true);
+  });
+
+  test('gammaBoostx2 raises both lanes\' uniforms to the boost power', () => {
+    const boost = gammaBoostx2(i64x2(0x8000000000000000, 0xFFFFFFFFFFFFFFFF), 2.0);
+
+    expect(v128.extract_lane<f64>(boost, <u8>SIMD_LANE_0)).toBe(0.25);
+    // smallest uniform, 2^-52, raised as e^(2 ln(u)), so within |2 ln(u)| ULP of 2^-104
+    const smallest = v128.extract_lane<f64>(boost, <u8>SIMD_LANE_1);
+    expect(Math.abs(smallest / Math.pow(2.0, -104.0) - 1.0)).toBeLessThan(1e-13);
+  });
+});
@@ -0,0 +1,81 @@
+/**
+ * Geometric Helper Tests
+ *
+ * Tests for the geometric skip helpers used by every generator's geometric(),
+ * sparseBernoulliIndices() and randomGraphEdges() functions.
+ *
+ * Test Strategy:
+ * - Verify skips over an even grid of random values have geometric tail probabilities
+ * - Verify a p of 1 never skips (without returning -0), and a p of 0 skips past every trial
+ * - Verify pair indices map to edges in order, including near the largest supported node count
+ *
+ * Contrast: These test the arithmetic in isolation, while each generator's suite
+ * tests the indices and edges its own skip loop produces.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  geometricScale,
+  geometricSkip,
+  pairCount,
+  pairsToEdges
+} from '../common/geometric';
+
+describe('Geometric skips', () => {
+  test('an even grid of random values has tail probabilities (1 - p)^k', () => {
+    const scale = geometricScale(0.3);
+    const tail = new StaticArray<i32>(10);
+    const gridSize: i32 = 1 << 20;
+
+    for (let i: i32 = 0; i < gridSize; i++) {
+      const skip = geometricSkip(<u64>i << 44, scale);
+      for (let k: i32 = 0; k < 10; k++) {
+        if (skip >= <f64>k) tail[k]++;
+      }
+    }
+
+    for (let k: i32 = 0; k < 10; k++) {
+      expect(Math.abs(<f64>tail[k] / <f64>gridSize - Math.pow(0.7, <f64>k))).toBeLessThan(1e-5);
+    }
+  });
+
+  test('a p of 1 never skips, and a p of 0 skips past every trial', () => {
+    const never = geometricSkip(0xFFFFFFFFFFFFFFFF, geometricScale(1.0));
+    expect(never).toBe(0.0);
+    expect(1.0 / never).toBe(Infinity); // +0, not -0
+
+    expect(geometricSkip(0, geometricScale(1.0))).toBe(0.0);
+    expect(geometricSkip(0x8000000000000000, geometricScale(0.0))).toBe(Infinity);
+  });
+});
+
+describe('Graph edges', () => {
+  test('pairCount is n(n - 1) / 2', () => {
+    expect(pairCount(0.0)).toBe(0.0);
+    expect(pairCount(5.0)).toBe(10.0);
+  });
+
+  test('pair indices map to edges ordered by their higher node', () => {
+    const arr = new Float64Array(20);
+    for (let i = 0; i < 10; i++) arr[i] = <f64>i;
+    pairsToEdges(arr, 10);
+
+    const expected: StaticArray<f64> = [0, 1, 0, 2, 1, 2, 0, 3, 1, 3, 2, 3, 0, 4, 1, 4, 2, 4, 3, 4];
+    for (let i = 0; i < 20; i++) {
+      expect(arr[i]).toBe(expected[i]);
+    }
+  });
+
+  test('indices near the largest supported node count map exactly', () => {
+    const w: f64 = 67108863.0; // 2^26 - 1
+    const arr = new Float64Array(4);
+    arr[0] = pairCount(w) - 1.0; // the last edge to w - 1
+    arr[1] = pairCount(w) + w - 1.0; // the last edge to w
+    pairsToEdges(arr, 2);
+
+    expect(arr[0]).toBe(w - 2.0);
+    expect(arr[1]).toBe(w - 1.0);
+    expect(arr[2]).toBe(w - 1.0);
+    expect(arr[3]).toBe(w);
+  });
+});
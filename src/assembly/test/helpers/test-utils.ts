@@ -119,6 +119,22 @@ export const PI_ESTIMATE_TOLERANCE: f64 = 0.02;
  */
 export const PI: f64 = 3.14159265358979;
 
+/**
+ * Tolerances for the moments of normal distribution samples (100K samples).
+ * The standard errors of a standard normal sample's mean and variance are ~0.0032
+ * and ~0.0045, so these allow about 6 standard errors.
+ */
+export const NORMAL_MEAN_TOLERANCE: f64 = 0.02;
+export const NORMAL_VARIANCE_TOLERANCE: f64 = 0.03;
+
+/**
+ * Tolerances for the moments of exponential distribution samples with rate 1 (100K samples).
+ * The standard errors of the sample's mean and variance are ~0.0032 and ~0.0089,
+ * so these allow about 6 standard errors.
+ */
+export const EXPONENTIAL_MEAN_TOLERANCE: f64 = 0.02;
+export const EXPONENTIAL_VARIANCE_TOLERANCE: f64 = 0.055;
+
 // ============================================================================
 // Bit Masks and Constants
 // ============================================================================
@@ -194,6 +210,18 @@ export const SIMD_INTERLEAVE_DIVISOR: i32 = 2;
 // Jump Function Reference Values
 // ============================================================================
 
+/**
+ * Stream index used to validate jumpTo() against repeated jump() calls.
+ * 5 = 0b101, so square-and-multiply exercises both its multiply and square paths.
+ */
+export const JUMP_TO_STREAM_INDEX: u64 = 5;
+
+/**
+ * Node index used to validate longJumpTo() against repeated longJump() calls,
+ * and (with JUMP_TO_STREAM_INDEX as the worker index) hierarchical stream selection.
+ */
+export const LONG_JUMP_TO_NODE_INDEX: u64 = 3;
+
 /**
  * Reference jump values from official C implementations.
  * Used to validate jump() correctness against authoritative sources.
@@ -232,3 +260,365 @@ export namespace JUMP_REFERENCE {
    */
   export const XOSHIRO256PLUS: u64 = 1569848409778915303;
 }
+
+/**
+ * Reference long jump values from official C implementations.
+ * Used to validate longJump() and longJumpTo() correctness against authoritative sources.
+ *
+ * Validation methodology matches JUMP_REFERENCE, using the reference long_jump() function.
+ * The NODE_WORKER values are taken after LONG_JUMP_TO_NODE_INDEX long jumps followed by
+ * JUMP_TO_STREAM_INDEX jumps, as selected by a (nodeId, workerId) stream.
+ *
+ * These values are generated and verified by src/assembly/test/c-reference/validate-jump.c
+ *
+ * When updating these values, also update the corresponding JS values in
+ * test/helpers/test-utils.ts (LONG_JUMP_REFERENCE constant).
+ */
+export namespace LONG_JUMP_REFERENCE {
+  /** Xoroshiro128+ (TEST_SEEDS.DOUBLE_0, DOUBLE_1) after longJump() then next() */
+  export const XOROSHIRO128PLUS: u64 = 15076717749790795746;
+
+  /** Xoroshiro128+ (TEST_SEEDS.DOUBLE_0, DOUBLE_1) after longJumpTo(3), jumpTo(5) then next() */
+  export const XOROSHIRO128PLUS_NODE_WORKER: u64 = 11257826811061053454;
+
+  /** Xoshiro256+ (TEST_SEEDS.QUAD_0 - QUAD_3) after longJump() then next() */
+  export const XOSHIRO256PLUS: u64 = 11401229584595561725;
+
+  /** Xoshiro256+ (TEST_SEEDS.QUAD_0 - QUAD_3) after longJumpTo(3), jumpTo(5) then next() */
+  export const XOSHIRO256PLUS_NODE_WORKER: u64 = 11718099546124808324;
+}
+
+// ============================================================================
+// PCG SIMD Lane Streams
+// ============================================================================
+
+/**
+ * Stream increment that selects the PCG generators' default stream
+ * (1442695040888963407 is (PCG_DEFAULT_STREAM << 1) | 1), for restoring it after a test.
+ */
+export const PCG_DEFAULT_STREAM: u64 = 1442695040888963407 >>> 1;
+
+/**
+ * Stream increment that makes the non-SIMD PCG generator's setStreamIncrement() select the
+ * same stream as PCG SIMD lane 1's default (pcg_basic's PCG32_INITIALIZER increment,
+ * 0xda3e39cb94b95bdb, is (PCG_SIMD_LANE1_STREAM << 1) | 1).
+ */
+export const PCG_SIMD_LANE1_STREAM: u64 = 0x6D1F1CE5CA5CADED;
+
+// ============================================================================
+// Advance Function Reference Values
+// ============================================================================
+
+/**
+ * Number of steps used to validate advance() against individual generator steps.
+ * 1000 = 0b1111101000, so the fast exponentiation exercises both its multiply and square paths.
+ */
+export const ADVANCE_STEP_COUNT: u64 = 1000;
+
+/**
+ * Number of steps below the xoshiro family's direct-stepping cutoff (128 / 256 steps),
+ * used to validate advance() for strides too small to benefit from a jump polynomial.
+ */
+export const ADVANCE_SMALL_STEP_COUNT: u64 = 100;
+
+/**
+ * Reference advance values from official C implementations.
+ * Used to validate advance() correctness for strides too large to step through.
+ *
+ * Validation methodology:
+ * - Initialize with TEST_SEEDS (default stream for PCG)
+ * - Call advance(2^40) once
+ * - Call next() once
+ * - Compare result to C reference implementation
+ *
+ * These values are generated and verified by src/assembly/test/c-reference/validate-advance.c
+ * (PCG) and src/assembly/test/c-reference/validate-jump.c (Xoshiro family).
+ *
+ * To regenerate/verify these values:
+ *   npm run test:c-ref
+ */
+export namespace ADVANCE_REFERENCE {
+  /** Stride used for the reference values below: 2^40 */
+  export const DELTA: u64 = <u64>1 << 40;
+
+  /**
+   * PCG reference from https://github.com/imneme/pcg-c-basic/blob/master/pcg_basic.c
+   * Test seed: TEST_SEEDS.SINGLE
+   * Result after advance(2^40) then uint32(): 758214374
+   *
+   * Verified by: src/assembly/test/c-reference/validate-advance.c
+   */
+  export const PCG: u32 = 758214374;
+
+  /**
+   * PCG SIMD lane 1 reference (lane 0 matches PCG above when seeded with TEST_SEEDS.DOUBLE_0)
+   * Test seed: TEST_SEEDS.DOUBLE_1, with lane 1's default stream increment
+   * Result after advance(2^40) then uint32(): 1372530533
+   *
+   * Verified by: src/assembly/test/c-reference/validate-advance.c
+   */
+  export const PCG_SIMD_LANE1: u32 = 1372530533;
+
+  /**
+   * Xoroshiro128+ reference from https://prng.di.unimi.it/xoroshiro128plus.c
+   * Test seeds: TEST_SEEDS.DOUBLE_0, TEST_SEEDS.DOUBLE_1
+   * Result after advance(2^40) then next(): 16695539980219321422
+   *
+   * Verified by: src/assembly/test/c-reference/validate-jump.c
+   */
+  export const XOROSHIRO128PLUS: u64 = 16695539980219321422;
+
+  /**
+   * Xoshiro256+ reference from https://prng.di.unimi.it/xoshiro256plus.c
+   * Test seeds: TEST_SEEDS.QUAD_0, TEST_SEEDS.QUAD_1, TEST_SEEDS.QUAD_2, TEST_SEEDS.QUAD_3
+   * Result after advance(2^40) then next(): 12500896621816312088
+   *
+   * Verified by: src/assembly/test/c-reference/validate-jump.c
+   */
+  export const XOSHIRO256PLUS: u64 = 12500896621816312088;
+}
+
+// ============================================================================
+// PCG64 DXSM Reference Values
+// ============================================================================
+
+/**
+ * Reference values for the PCG64 DXSM generator from the official C++ implementation,
+ * computed with native 128-bit integers to validate the emulated 128-bit arithmetic.
+ *
+ * Test seeds: TEST_SEEDS.DOUBLE_0 (high word), TEST_SEEDS.DOUBLE_1 (low word)
+ *
+ * These values are generated and verified by src/assembly/test/c-reference/validate-pcg64.c
+ *
+ * To regenerate/verify these values:
+ *   npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding JS values in
+ * test/helpers/test-utils.ts (PCG64_REFERENCE constant).
+ */
+export namespace PCG64_REFERENCE {
+  /** First two uint64() values with the default stream */
+  export const FIRST: u64 = 3921929468345756779;
+  export const SECOND: u64 = 1098074140898071293;
+
+  /** uint64() after advance(ADVANCE_REFERENCE.DELTA), with the default stream */
+  export const ADVANCE: u64 = 14730161512686551676;
+
+  /** First uint64() value after setStreamIncrement(STREAM_ID) then setSeeds() */
+  export const STREAM_ID: u64 = 5;
+  export const STREAM: u64 = 14772559007250593283;
+}
+
+// ============================================================================
+// Philox Reference Values
+// ============================================================================
+
+/**
+ * Reference values for the Philox4x32-10 generator from the Random123 reference
+ * algorithm, which validate-philox.c also checks against Random123's known-answer tests.
+ *
+ * Test seed: TEST_SEEDS.SINGLE (the key)
+ *
+ * These values are generated and verified by src/assembly/test/c-reference/validate-philox.c
+ *
+ * To regenerate/verify these values:
+ *   npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding JS values in
+ * test/helpers/test-utils.ts (PHILOX_REFERENCE constant).
+ */
+export namespace PHILOX_REFERENCE {
+  /** First three uint64() values: both values of block 0, then the first of block 1 */
+  export const FIRST: u64 = 5699878716244043604;
+  export const SECOND: u64 = 3431231931551020257;
+  export const THIRD: u64 = 14117391058782646777;
+
+  /** uint64() values at index ADVANCE_REFERENCE.DELTA (block 2^39) and the next index */
+  export const ADVANCE: u64 = 5674917125327261460;
+  export const ADVANCE_NEXT: u64 = 1169777911680275162;
+
+  /** First uint64() value after jumpTo(STREAM_ID) */
+  export const STREAM_ID: u64 = 5;
+  export const STREAM: u64 = 7222165545784475138;
+
+  /** First uint64() value after longJumpTo(NODE_ID) then jumpTo(WORKER_ID) */
+  export const NODE_ID: u64 = 3;
+  export const WORKER_ID: u64 = 5;
+  export const NODE_WORKER: u64 = 3606353301399418341;
+}
+
+// ============================================================================
+// ChaCha Reference Values
+// ============================================================================
+
+/**
+ * Reference values for the fast-key-erasure ChaCha generator, keyed with
+ * TEST_SEEDS.QUAD_0 - QUAD_3. Each refill provides 124 uint64() values before
+ * the generator rekeys itself.
+ *
+ * These values are generated and verified by src/assembly/test/c-reference/validate-chacha.c
+ *
+ * To regenerate/verify these values:
+ *   npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding JS values in
+ * test/helpers/test-utils.ts (CHACHA_REFERENCE constant).
+ */
+export namespace CHACHA_REFERENCE {
+  /** Number of uint64() values between rekeys */
+  export const VALUES_PER_REFILL: i32 = 124;
+
+  /** First two ChaCha20 uint64() values */
+  export const FIRST: u64 = 3792829271538249661;
+  export const SECOND: u64 = 2209437320138217004;
+
+  /** ChaCha20 uint64() values at indexes 123 and 124, either side of the first rekey */
+  export const LAST_OF_FIRST_KEY: u64 = 7095809081073466869;
+  export const FIRST_OF_SECOND_KEY: u64 = 3902580384472760192;
+
+  /** First uint64() values with 8 and 12 rounds */
+  export const CHACHA8_FIRST: u64 = 12913591682024228823;
+  export const CHACHA12_FIRST: u64 = 5530131024697131311;
+
+  /** First ChaCha20 uint64() value after jumpTo(STREAM_ID) */
+  export const STREAM_ID: u64 = 5;
+  export const STREAM: u64 = 6587860388706742925;
+
+  /** First ChaCha20 uint64() value after longJumpTo(NODE_ID) then jumpTo(WORKER_ID) */
+  export const NODE_ID: u64 = 3;
+  export const WORKER_ID: u64 = 5;
+  export const NODE_WORKER: u64 = 8103151218851572907;
+}
+
+// ============================================================================
+// Scrambler Variant Reference Values
+// ============================================================================
+
+/**
+ * Reference values for the xoshiro256++ / xoshiro256** and xoroshiro128++ / xoroshiro128**
+ * generators from official C implementations.
+ *
+ * Lane 0 is seeded with TEST_SEEDS.OCTET_0 onward (2 seeds for Xoroshiro128, 4 for Xoshiro256),
+ * which are the same values as TEST_SEEDS.DOUBLE / QUAD. SIMD lane 1 is seeded with the
+ * following 2 or 4 OCTET seeds, matching each SIMD generator's setSeeds() argument order.
+ *
+ * Each generator has:
+ * - FIRST: first next() after seeding
+ * - JUMP / JUMP_LANE1: after jump() then next(), for lane 0 and SIMD lane 1
+ * - NODE_WORKER: after longJumpTo(LONG_JUMP_TO_NODE_INDEX), jumpTo(JUMP_TO_STREAM_INDEX) then next()
+ * - ADVANCE: after advance(ADVANCE_REFERENCE.DELTA) then next()
+ *
+ * These values are generated and verified by src/assembly/test/c-reference/validate-scramblers.c
+ *
+ * To regenerate/verify these values:
+ *   npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding JS values in
+ * test/helpers/test-utils.ts (SCRAMBLER_REFERENCE constant).
+ */
+export namespace SCRAMBLER_REFERENCE {
+  /** Xoshiro256++ reference from https://prng.di.unimi.it/xoshiro256plusplus.c */
+  export const XOSHIRO256PLUSPLUS_FIRST: u64 = 6377298834877579254;
+  export const XOSHIRO256PLUSPLUS_JUMP: u64 = 2263321408442216625;
+  export const XOSHIRO256PLUSPLUS_JUMP_LANE1: u64 = 13144453194058480280;
+  export const XOSHIRO256PLUSPLUS_NODE_WORKER: u64 = 4366090337512055574;
+  export const XOSHIRO256PLUSPLUS_ADVANCE: u64 = 6707782915941893505;
+
+  /** Xoshiro256** reference from https://prng.di.unimi.it/xoshiro256starstar.c */
+  export const XOSHIRO256STARSTAR_FIRST: u64 = 12219236967926402046;
+  export const XOSHIRO256STARSTAR_JUMP: u64 = 10300857870457424239;
+  export const XOSHIRO256STARSTAR_JUMP_LANE1: u64 = 6796499040794408339;
+  export const XOSHIRO256STARSTAR_NODE_WORKER: u64 = 7731361918242799462;
+  export const XOSHIRO256STARSTAR_ADVANCE: u64 = 6253683939900161798;
+
+  /** Xoroshiro128++ reference from https://prng.di.unimi.it/xoroshiro128plusplus.c */
+  export const XOROSHIRO128PLUSPLUS_FIRST: u64 = 11850698724451455123;
+  export const XOROSHIRO128PLUSPLUS_JUMP: u64 = 8643156494964350155;
+  export const XOROSHIRO128PLUSPLUS_JUMP_LANE1: u64 = 11561545176063776388;
+  export const XOROSHIRO128PLUSPLUS_NODE_WORKER: u64 = 12019560473834826810;
+  export const XOROSHIRO128PLUSPLUS_ADVANCE: u64 = 12226299268682830150;
+
+  /** Xoroshiro128** reference from https://prng.di.unimi.it/xoroshiro128starstar.c */
+  export const XOROSHIRO128STARSTAR_FIRST: u64 = 16155200969329072355;
+  export const XOROSHIRO128STARSTAR_JUMP: u64 = 15208330176777730289;
+  export const XOROSHIRO128STARSTAR_JUMP_LANE1: u64 = 1221083804678859719;
+  export const XOROSHIRO128STARSTAR_NODE_WORKER: u64 = 8398212083353036184;
+  export const XOROSHIRO128STARSTAR_ADVANCE: u64 = 16653617693675954285;
+}
+
+// ============================================================================
+// SFC64 / Romu Reference Values
+// ============================================================================
+
+/**
+ * Reference values for the SFC64, RomuTrio and RomuDuoJr generators from their
+ * C reference implementations. SFC64 and RomuTrio are seeded with TEST_SEEDS.QUAD_0 -
+ * QUAD_2, and RomuDuoJr with TEST_SEEDS.QUAD_0 - QUAD_1, which are the same values as
+ * the first OCTET seeds used for SIMD lane 0.
+ *
+ * A Romu generator's first output is its x seed, so the second and third values are
+ * the first to check its state update.
+ *
+ * These values are generated by src/assembly/test/c-reference/validate-sfc-romu.c
+ *
+ * To regenerate/verify these values:
+ *   npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding JS values in
+ * test/helpers/test-utils.ts (SFC_ROMU_REFERENCE constant).
+ */
+export namespace SFC_ROMU_REFERENCE {
+  /** First 3 SFC64 uint64() values, after the 18 seeding rounds */
+  export const SFC64_FIRST: u64 = 9556196496583309056;
+  export const SFC64_SECOND: u64 = 11805396549560152306;
+  export const SFC64_THIRD: u64 = 7316943179098091769;
+
+  /** First 3 RomuTrio uint64() values */
+  export const ROMUTRIO_FIRST: u64 = 11400714819323198485;
+  export const ROMUTRIO_SECOND: u64 = 15722878982310145075;
+  export const ROMUTRIO_THIRD: u64 = 1629612184478233265;
+
+  /** First 3 RomuDuoJr uint64() values */
+  export const ROMUDUOJR_FIRST: u64 = 11400714819323198485;
+  export const ROMUDUOJR_SECOND: u64 = 5659179934322870737;
+  export const ROMUDUOJR_THIRD: u64 = 665520693657870239;
+}
+
+// ============================================================================
+// Distribution Sample Statistics
+// ============================================================================
+
+/**
+ * Mean of a sample of distribution numbers.
+ */
+export function sampleMean(arr: Float64Array): f64 {
+  let sum = 0.0;
+  for (let i = 0; i < arr.length; i++) {
+    sum += arr[i];
+  }
+  return sum / <f64>arr.length;
+}
+
+/**
+ * Variance of a sample of distribution numbers about its mean.
+ */
+export function sampleVariance(arr: Float64Array, mean: f64): f64 {
+  let sumSquares = 0.0;
+  for (let i = 0; i < arr.length; i++) {
+    sumSquares += (arr[i] - mean) * (arr[i] - mean);
+  }
+  return sumSquares / <f64>arr.length;
+}
+
+/**
+ * Number of values in a sample that fall outside [min, max], or that aren't whole
+ * numbers when `integers` is set. NaN values are always counted.
+ */
+export function countInvalid(arr: Float64Array, min: f64, max: f64, integers: bool): i32 {
+  let invalid = 0;
+  for (let i = 0; i < arr.length; i++) {
+    if (!(arr[i] >= min && arr[i] <= max)) invalid++;
+    else if (integers && arr[i] != Math.floor(arr[i])) invalid++;
+  }
+  return invalid;
+}
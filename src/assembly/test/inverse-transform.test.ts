@@ -0,0 +1,149 @@
+/**
+ * Inverse Transform Helper Tests
+ *
+ * Tests for the uniform numbers and inverse CDFs used by every generator's Cauchy, Laplace,
+ * logistic, Gumbel, Weibull and Pareto functions.
+ *
+ * Test Strategy:
+ * - Verify uniform numbers stay strictly inside (0, 1), symmetric about 0.5, and that the
+ *   SIMD uniform numbers match the scalar ones in each lane
+ * - Verify each inverse CDF round trips through its exact CDF over an even grid of uniform numbers
+ * - Verify each inverse CDF stays finite at the most extreme uniform numbers
+ * - Verify the SIMD inverse CDFs match the scalar inverse CDFs in each lane, to within a few ULP
+ *
+ * Contrast: These test the arithmetic in isolation, while each generator's suite
+ * tests the numbers its own loops produce.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  inverseUniform,
+  cauchyInverse,
+  laplaceInverse,
+  logisticInverse,
+  gumbelInverse,
+  weibullInverse,
+  paretoInverse
+} from '../common/inverse-transform';
+import {
+  inverseUniformx2,
+  cauchyInversex2,
+  laplaceInversex2,
+  logisticInversex2,
+  gumbelInversex2,
+  weibullInversex2,
+  paretoInversex2
+} from '../common/inverse-transform-simd';
+
+// inverse CDFs are checked at GRID_SIZE evenly spaced uniform numbers
+const GRID_SIZE: i32 = 1 << 14;
+
+// the smallest and largest uniform numbers, from random values of all 0s and all 1s
+const U_MIN: f64 = inverseUniform(0);
+const U_MAX: f64 = inverseUniform(0xFFFFFFFFFFFFFFFF);
+
+/**
+ * Gets the exact CDF of distribution `d` (Cauchy, Laplace, logistic, Gumbel, Weibull with
+ * shape 2, or Pareto with shape 3) at `x`. Weibull and Pareto are inverted at 1 - `u`, so
+ * the complements of their CDFs are returned instead, to compare with `u`.
+ */
+function cdf(d: i32, x: f64): f64 {
+  if (d == 0) return 0.5 + Math.atan(x) / Math.PI;
+  if (d == 1) return x < 0.0 ? 0.5 * Math.exp(x) : 1.0 - 0.5 * Math.exp(-x);
+  if (d == 2) return 1.0 / (1.0 + Math.exp(-x));
+  if (d == 3) return Math.exp(-Math.exp(-x));
+  if (d == 4) return Math.exp(-x * x);
+  return Math.pow(x, -3.0);
+}
+
+/**
+ * Inverts the CDF of distribution `d` at `u`, with the shapes used by {@link cdf}.
+ */
+function inverse(d: i32, u: f64): f64 {
+  if (d == 0) return cauchyInverse(u);
+  if (d == 1) return laplaceInverse(u);
+  if (d == 2) return logisticInverse(u);
+  if (d == 3) return gumbelInverse(u);
+  if (d == 4) return weibullInverse(u, 0.5);
+  return paretoInverse(u, 1.0 / 3.0);
+}
+
+/**
+ * Inverts the CDF of distribution `d` at 2 uniform numbers with its SIMD helper.
+ */
+function inversex2(d: i32, u: v128): v128 {
+  if (d == 0) return cauchyInversex2(u);
+  if (d == 1) return laplaceInversex2(u);
+  if (d == 2) return logisticInversex2(u);
+  if (d == 3) return gumbelInversex2(u);
+  if (d == 4) return weibullInversex2(u, 0.5);
+  return paretoInversex2(u, 1.0 / 3.0);
+}
+
+/**
+ * Gets the error of a SIMD lane `x` against the scalar `expected`, relative to it
+ * when it's larger than 1.
+ */
+function laneError(x: f64, expected: f64): f64 {
+  return Math.abs(x - expected) / Math.max(1.0, Math.abs(expected));
+}
+
+describe('Inverse transform', () => {
+  test('uniform numbers are strictly inside (0, 1), and symmetric about 0.5', () => {
+    expect(U_MIN).toBe(1.1102230246251565e-16);
+    expect(U_MAX).toBe(1.0 - U_MIN);
+    expect(inverseUniform(0x8000000000000000) - 0.5).toBe(U_MIN);
+
+    const values: StaticArray<u64> = [0, 1 << 12, 0x123456789ABCDEF0, 0x8000000000000000, 0xFFFFFFFFFFFFFFFF];
+    for (let i = 0; i < values.length; i++) {
+      expect(inverseUniform(values[i]) + inverseUniform(~values[i])).toBe(1.0);
+
+      const u = inverseUniformx2(i64x2(values[i], ~values[i]));
+      expect(f64x2.extract_lane(u, 0)).toBe(inverseUniform(values[i]));
+      expect(f64x2.extract_lane(u, 1)).toBe(inverseUniform(~values[i]));
+    }
+  });
+
+  test('inverse CDFs round trip through their exact CDFs', () => {
+    for (let d = 0; d < 6; d++) {
+      let maxError: f64 = 0.0;
+      for (let i = 0; i < GRID_SIZE; i++) {
+        const u = (<f64>i + 0.5) / <f64>GRID_SIZE;
+        const error = Math.abs(cdf(d, inverse(d, u)) - u);
+        if (error > maxError) maxError = error;
+      }
+      expect(maxError).toBeLessThan(1e-12);
+    }
+  });
+
+  test('inverse CDFs stay finite at the most extreme uniform numbers', () => {
+    for (let d = 0; d < 6; d++) {
+      expect(isFinite(inverse(d, U_MIN))).toBe(true);
+      expect(isFinite(inverse(d, U_MAX))).toBe(true);
+    }
+
+    // symmetric distributions reach just as far in each direction
+    expect(laplaceInverse(U_MIN)).toBe(-laplaceInverse(U_MAX));
+    expect(Math.abs(cauchyInverse(U_MIN) / cauchyInverse(U_MAX) + 1.0)).toBeLessThan(1e-12);
+    expect(Math.abs(logisticInverse(U_MIN) / logisticInverse(U_MAX) + 1.0)).toBeLessThan(1e-12);
+  });
+
+  test('SIMD inverse CDFs match scalar inverse CDFs in each lane', () => {
+    for (let d = 0; d < 6; d++) {
+      let maxError: f64 = 0.0;
+      for (let i = 0; i < GRID_SIZE; i += 2) {
+        const u0 = (<f64>i + 0.5) / <f64>GRID_SIZE;
+        const u1 = 1.0 - u0;
+        const x = inversex2(d, f64x2(u0, u1));
+        maxError = Math.max(maxError, laneError(f64x2.extract_lane(x, 0), inverse(d, u0)));
+        maxError = Math.max(maxError, laneError(f64x2.extract_lane(x, 1), inverse(d, u1)));
+      }
+
+      // and at the most extreme uniform numbers
+      const x = inversex2(d, f64x2(U_MIN, U_MAX));
+      maxError = Math.max(maxError, laneError(f64x2.extract_lane(x, 0), inverse(d, U_MIN)));
+      maxError = Math.max(maxError, laneError(f64x2.extract_lane(x, 1), inverse(d, U_MAX)));
+      expect(maxError).toBeLessThan(1e-14);
+    }
+  });
+});
@@ -0,0 +1,128 @@
+/**
+ * SIMD Math Function Tests
+ *
+ * Tests for the SIMD `log`, `log1p`, `exp`, `sincos`, `tan` and reciprocal square root used
+ * by the SIMD distribution helpers.
+ *
+ * Test Strategy:
+ * - Verify each function is within 2 ULP of `Math` (3 for tan, a division of 2 results, and 4 for
+ *   the reciprocal square root, against a rounded division) in both lanes, over grids spanning
+ *   the inputs each one covers
+ * - Verify exact results where the function is exact: log(1), exp(0), sin(0), cos(0) and tan(0)
+ * - Verify exp overflows to Infinity and underflows to 0, and log1p keeps tiny inputs
+ *
+ * Contrast: These test the arithmetic in isolation, while the distribution helper suites
+ * test the numbers built from it.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import { logx2, log1px2, expx2, sincosx2, tanx2, rsqrtx2 } from '../common/math-simd';
+
+// each function is checked at GRID_SIZE points, 2 at a time
+const GRID_SIZE: i32 = 1 << 16;
+
+// where sincosx2 stores its sines and cosines
+const scratch: usize = memory.data(32, 16);
+
+/**
+ * Gets the error of `x` in units in the last place of `expected`.
+ */
+function ulps(x: f64, expected: f64): f64 {
+  if (x == expected) return 0.0;
+  const magnitude = Math.abs(expected);
+  const ulp = reinterpret<f64>(reinterpret<u64>(magnitude) + 1) - magnitude;
+  return Math.abs(x - expected) / ulp;
+}
+
+/**
+ * Gets the larger error in ULP of the 2 lanes of `x` against `expected0` and `expected1`.
+ */
+function laneUlps(x: v128, expected0: f64, expected1: f64): f64 {
+  return Math.max(ulps(f64x2.extract_lane(x, 0), expected0), ulps(f64x2.extract_lane(x, 1), expected1));
+}
+
+/**
+ * Gets the `i`th of GRID_SIZE points spread evenly in exponent between 2^`low` and 2^`high`.
+ */
+function geometric(i: i32, low: f64, high: f64): f64 {
+  return Math.pow(2.0, low + (high - low) * (<f64>i + 0.5) / <f64>GRID_SIZE);
+}
+
+describe('SIMD math', () => {
+  test('logx2 is within 2 ULP of Math.log', () => {
+    let maxError: f64 = 0.0;
+    for (let i = 0; i < GRID_SIZE; i += 2) {
+      const x0 = geometric(i, -1022.0, 1023.0);
+      const x1 = 0.5 + 1.5 * <f64>i / <f64>GRID_SIZE;
+      maxError = Math.max(maxError, laneUlps(logx2(f64x2(x0, x1)), Math.log(x0), Math.log(x1)));
+    }
+    expect(maxError).toBeLessThan(2.0);
+    expect(f64x2.extract_lane(logx2(f64x2(1.0, 1.0)), 0)).toBe(0.0);
+  });
+
+  test('log1px2 is within 2 ULP of Math.log1p, keeping tiny inputs', () => {
+    let maxError: f64 = 0.0;
+    for (let i = 0; i < GRID_SIZE; i += 2) {
+      const x0 = geometric(i, -1000.0, 1000.0);
+      const x1 = -geometric(i, -1000.0, -0.001);
+      maxError = Math.max(maxError, laneUlps(log1px2(f64x2(x0, x1)), Math.log1p(x0), Math.log1p(x1)));
+    }
+    expect(maxError).toBeLessThan(2.0);
+
+    const tiny = log1px2(f64x2(1e-300, -1e-20));
+    expect(f64x2.extract_lane(tiny, 0)).toBe(1e-300);
+    expect(f64x2.extract_lane(tiny, 1)).toBe(-1e-20);
+  });
+
+  test('expx2 is within 2 ULP of Math.exp, overflowing to Infinity and underflowing to 0', () => {
+    let maxError: f64 = 0.0;
+    for (let i = 0; i < GRID_SIZE; i += 2) {
+      const x0 = -708.0 + 1417.0 * (<f64>i + 0.5) / <f64>GRID_SIZE;
+      const x1 = (<f64>i - <f64>(GRID_SIZE / 2)) / <f64>GRID_SIZE;
+      maxError = Math.max(maxError, laneUlps(expx2(f64x2(x0, x1)), Math.exp(x0), Math.exp(x1)));
+    }
+    expect(maxError).toBeLessThan(2.0);
+
+    const limits = expx2(f64x2(1000.0, -1000.0));
+    expect(f64x2.extract_lane(limits, 0)).toBe(Infinity);
+    expect(f64x2.extract_lane(limits, 1)).toBe(0.0);
+    expect(f64x2.extract_lane(expx2(f64x2(0.0, 0.0)), 0)).toBe(1.0);
+  });
+
+  test('sincosx2 is within 2 ULP of Math.sin and Math.cos', () => {
+    let maxError: f64 = 0.0;
+    for (let i = 0; i < GRID_SIZE; i += 2) {
+      const x0 = 2.0 * Math.PI * (<f64>i + 0.5) / <f64>GRID_SIZE - Math.PI;
+      const x1 = (<f64>(i & 2) - 1.0) * geometric(i, -30.0, 20.0);
+      sincosx2(f64x2(x0, x1), scratch);
+      maxError = Math.max(maxError, laneUlps(v128.load(scratch), Math.sin(x0), Math.sin(x1)));
+      maxError = Math.max(maxError, laneUlps(v128.load(scratch, 16), Math.cos(x0), Math.cos(x1)));
+    }
+    expect(maxError).toBeLessThan(2.0);
+
+    sincosx2(f64x2(0.0, 0.0), scratch);
+    expect(load<f64>(scratch)).toBe(0.0);
+    expect(load<f64>(scratch, 16)).toBe(1.0);
+  });
+
+  test('tanx2 is within 3 ULP of Math.tan', () => {
+    let maxError: f64 = 0.0;
+    for (let i = 0; i < GRID_SIZE; i += 2) {
+      const x0 = Math.PI * (<f64>i + 0.5) / <f64>GRID_SIZE - Math.PI / 2.0;
+      const x1 = (<f64>(i & 2) - 1.0) * geometric(i, -30.0, 20.0);
+      maxError = Math.max(maxError, laneUlps(tanx2(f64x2(x0, x1)), Math.tan(x0), Math.tan(x1)));
+    }
+    expect(maxError).toBeLessThan(3.0);
+    expect(f64x2.extract_lane(tanx2(f64x2(0.0, 0.0)), 0)).toBe(0.0);
+  });
+
+  test('rsqrtx2 is within 4 ULP of 1 / Math.sqrt', () => {
+    let maxError: f64 = 0.0;
+    for (let i = 0; i < GRID_SIZE; i += 2) {
+      const x0 = geometric(i, -1000.0, 1000.0);
+      const x1 = 1.0 + 3.0 * <f64>i / <f64>GRID_SIZE;
+      maxError = Math.max(maxError, laneUlps(rsqrtx2(f64x2(x0, x1)), 1.0 / Math.sqrt(x0), 1.0 / Math.sqrt(x1)));
+    }
+    expect(maxError).toBeLessThan(4.0);
+  });
+});
@@ -0,0 +1,147 @@
+/**
+ * Ziggurat Normal Helper Tests
+ *
+ * Tests for the ziggurat tables and helpers used by every generator's normal53()
+ * and normal53Array() functions, in scalar and SIMD form.
+ *
+ * Test Strategy:
+ * - Verify the generated tables describe 256 layers of equal area under exp(-x^2 / 2)
+ * - Verify the layer, point and sign are taken from separate bits of a random value
+ * - Verify the fast path accepts exactly the points inside their layers
+ * - Verify tail and wedge draws accept and reject on the correct side of the curve
+ * - Verify SIMD helpers match the scalar helpers in both lanes
+ *
+ * Contrast: These test the ziggurat pieces in isolation, while each generator's suite
+ * tests the distribution of the numbers its own wedge and tail loop produces.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  normalLayer,
+  normalMagnitude,
+  normalInside,
+  normalSign,
+  normalFast,
+  normalWedge,
+  normalTail
+} from '../common/normal';
+import {
+  normalFastx2,
+  normalRejectx2
+} from '../common/normal-simd';
+import {
+  ZIGGURAT_LAYERS,
+  NORMAL_R,
+  NORMAL_V,
+  NORMAL_X,
+  NORMAL_Y
+} from '../common/ziggurat-tables';
+import {
+  HIGH_PRECISION_TOLERANCE,
+  SIMD_LANE_0,
+  SIMD_LANE_1
+} from './helpers/test-utils';
+
+// layer 255 (bits 4-11 set), point bits 0x80000 (half way across), positive sign
+const TOP_LAYER_HALF_WAY: u64 = 0x8000000000000FF0;
+// layer 1, point half way across, negative sign
+const LAYER_1_HALF_WAY_NEGATIVE: u64 = 0x8000000000000018;
+
+describe('Ziggurat tables', () => {
+  test('have one edge per layer, from the base layer to the peak', () => {
+    expect(NORMAL_X.length).toBe(ZIGGURAT_LAYERS + 1);
+    expect(NORMAL_Y.length).toBe(ZIGGURAT_LAYERS + 1);
+    expect(NORMAL_X[1]).toBe(NORMAL_R);
+    expect(NORMAL_X[ZIGGURAT_LAYERS]).toBe(0.0);
+    expect(NORMAL_Y[ZIGGURAT_LAYERS]).toBe(1.0);
+  });
+
+  test('edges narrow and densities rise toward the peak', () => {
+    let unordered = 0;
+    for (let i = 0; i < ZIGGURAT_LAYERS; i++) {
+      if (NORMAL_X[i + 1] >= NORMAL_X[i] || NORMAL_Y[i + 1] <= NORMAL_Y[i]) unordered++;
+      expect(Math.abs(NORMAL_Y[i] - Math.exp(-0.5 * NORMAL_X[i] * NORMAL_X[i]))).toBeLessThan(HIGH_PRECISION_TOLERANCE);
+    }
+    expect(unordered).toBe(0);
+  });
+
+  test('every layer above the base has area V', () => {
+    for (let i = 1; i < ZIGGURAT_LAYERS; i++) {
+      const area = NORMAL_X[i] * (NORMAL_Y[i + 1] - NORMAL_Y[i]);
+      expect(Math.abs(area - NORMAL_V) / NORMAL_V).toBeLessThan(1e-9);
+    }
+
+    // the base layer's rectangle, including the area its tail would need
+    expect(Math.abs(NORMAL_X[0] * NORMAL_Y[1] - NORMAL_V) / NORMAL_V).toBeLessThan(1e-12);
+  });
+});
+
+describe('Fast path', () => {
+  test('layer and sign bits are separate from the point bits', () => {
+    expect(normalLayer(TOP_LAYER_HALF_WAY)).toBe(255);
+    expect(normalLayer(LAYER_1_HALF_WAY_NEGATIVE)).toBe(1);
+    expect(normalMagnitude(LAYER_1_HALF_WAY_NEGATIVE, 1)).toBe(0.5 * NORMAL_X[1]);
+    expect(normalSign(LAYER_1_HALF_WAY_NEGATIVE, 2.5)).toBe(-2.5);
+    expect(normalSign(TOP_LAYER_HALF_WAY, 2.5)).toBe(2.5);
+  });
+
+  test('accepts points inside their layer, signed', () => {
+    // half way across layer 1 is inside layer 2's width
+    expect(normalInside(0.5 * NORMAL_X[1], 1)).toBe(true);
+    expect(normalFast(LAYER_1_HALF_WAY_NEGATIVE)).toBe(-0.5 * NORMAL_X[1]);
+  });
+
+  test('defers points outside their layer with NaN', () => {
+    // nothing in the top layer is inside the peak, which has width 0
+    expect(normalInside(0.0, 255)).toBe(false);
+    expect(isNaN(normalFast(TOP_LAYER_HALF_WAY))).toBe(true);
+    expect(isNaN(normalFast(0xFFFFFFFFFFFFF000))).toBe(true); // base layer, past R
+  });
+});
+
+describe('Wedge and tail', () => {
+  test('wedge accepts points below the curve and rejects points above it', () => {
+    const z = 0.5 * NORMAL_X[255];
+
+    // height 0 is the layer's lower edge, below the curve everywhere in the layer
+    expect(normalWedge(z, 255, 0)).toBe(true);
+    // the top of the layer is the peak, above the curve everywhere but 0
+    expect(normalWedge(z, 255, 0xFFFFFFFFFFFFFFFF)).toBe(false);
+  });
+
+  test('tail candidates are beyond R, or rejected with NaN', () => {
+    let accepted = 0;
+    let next: u64 = 0x9E3779B97F4A7C15;
+    for (let i = 0; i < 1000; i++) {
+      next = next * 6364136223846793005 + 1442695040888963407;
+      const candidate = normalTail(next, next ^ (next >>> 29));
+      if (!isNaN(candidate)) {
+        accepted++;
+        expect(candidate).toBeGreaterThan(NORMAL_R);
+      }
+    }
+
+    expect(accepted).toBeGreaterThan(800); // most candidates are accepted
+  });
+
+  test('tail handles the smallest and largest random values without infinities', () => {
+    expect(normalTail(0xFFFFFFFFFFFFFFFF, 0)).toBe(NORMAL_R); // uniform 1 adds nothing to R
+    expect(isNaN(normalTail(0, 0xFFFFFFFFFFFFFFFF))).toBe(true); // far past R, then rejected
+  });
+});
+
+describe('SIMD helpers', () => {
+  test('normalFastx2 matches normalFast in both lanes', () => {
+    const next = i64x2(LAYER_1_HALF_WAY_NEGATIVE, 0x123456789ABCDE50);
+    const z = normalFastx2(next);
+
+    expect(v128.extract_lane<f64>(z, <u8>SIMD_LANE_0)).toBe(normalFast(LAYER_1_HALF_WAY_NEGATIVE));
+    expect(v128.extract_lane<f64>(z, <u8>SIMD_LANE_1)).toBe(normalFast(0x123456789ABCDE50));
+    expect(normalRejectx2(z)).toBe(false);
+  });
+
+  test('normalRejectx2 flags either lane outside its layer', () => {
+    expect(normalRejectx2(normalFastx2(i64x2(TOP_LAYER_HALF_WAY, LAYER_1_HALF_WAY_NEGATIVE)))).toBe(true);
+    expect(normalRejectx2(normalFastx2(i64x2(LAYER_1_HALF_WAY_NEGATIVE, TOP_LAYER_HALF_WAY)))).toBe(true);
+  });
+});
@@ -0,0 +1,110 @@
+/**
+ * Poisson Helper Tests
+ *
+ * Tests for the inversion and transformed rejection (PTRS) helpers used by every
+ * generator's poisson() and poissonArray() functions.
+ *
+ * Test Strategy:
+ * - Verify log-gamma against exact factorials, on both sides of its shift at 7
+ * - Verify inversion walks the cumulative probabilities exactly, and that a λ of 0 always gives 0
+ * - Verify accepted PTRS candidates over an even grid of uniform numbers have mean and variance λ
+ * - Verify parameters switch algorithm with λ, and are set up again when it changes
+ *
+ * Contrast: These test the arithmetic in isolation, while each generator's suite
+ * tests the counts its own loops produce.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  logGamma,
+  poissonSetup,
+  poissonInverts,
+  poissonInversion,
+  poissonTransformedRejection
+} from '../common/poisson';
+
+// accepted candidates are averaged over GRID_SIZE^2 evenly spaced pairs of uniform numbers
+const GRID_SIZE: i32 = 400;
+
+describe('logGamma', () => {
+  test('matches the logarithms of factorials', () => {
+    expect(logGamma(1.0)).toBe(0.0);
+    expect(logGamma(2.0)).toBe(0.0);
+    expect(Math.abs(logGamma(5.0) - Math.log(24.0))).toBeLessThan(1e-13);
+    expect(Math.abs(logGamma(11.0) - Math.log(3628800.0))).toBeLessThan(1e-12);
+    expect(Math.abs(logGamma(101.0) - 363.73937555556347)).toBeLessThan(1e-10);
+  });
+});
+
+describe('Inversion', () => {
+  test('small λs are inverted', () => {
+    poissonSetup(3.0);
+    expect(poissonInverts()).toBe(true);
+    poissonSetup(9.5);
+    expect(poissonInverts()).toBe(true);
+  });
+
+  test('uniform numbers just below each cumulative probability give its count', () => {
+    poissonSetup(3.0);
+    let p: f64 = Math.exp(-3.0);
+    let cumulative: f64 = 0.0;
+
+    for (let k: i32 = 0; k < 15; k++) {
+      cumulative += p;
+      expect(poissonInversion(cumulative - 1e-9)).toBe(<f64>k);
+      expect(poissonInversion(cumulative + 1e-9)).toBe(<f64>(k + 1));
+      p *= 3.0 / <f64>(k + 1);
+    }
+  });
+
+  test('a λ of 0 always gives 0', () => {
+    poissonSetup(0.0);
+    expect(poissonInversion(0.0)).toBe(0.0);
+    expect(poissonInversion(0.9999999999)).toBe(0.0);
+  });
+});
+
+describe('Transformed rejection', () => {
+  test('large λs are drawn by rejection, and set up again when λ changes', () => {
+    poissonSetup(100.0);
+    expect(poissonInverts()).toBe(false);
+    poissonSetup(2.0);
+    expect(poissonInverts()).toBe(true);
+    poissonSetup(10.0);
+    expect(poissonInverts()).toBe(false);
+  });
+
+  test('the center of the hat is accepted by the squeeze, and the edges are rejected', () => {
+    poissonSetup(100.0);
+    expect(poissonTransformedRejection(0.5, 0.5)).toBe(100.0);
+    expect(isNaN(poissonTransformedRejection(0.0, 0.5))).toBe(true);
+  });
+
+  test('accepted candidates have mean and variance λ', () => {
+    const lambdas: StaticArray<f64> = [10.0, 100.0];
+
+    for (let l: i32 = 0; l < lambdas.length; l++) {
+      const lambda: f64 = unchecked(lambdas[l]);
+      poissonSetup(lambda);
+      let count: f64 = 0.0;
+      let sum: f64 = 0.0;
+      let sumSquares: f64 = 0.0;
+
+      for (let i: i32 = 0; i < GRID_SIZE; i++) {
+        for (let j: i32 = 0; j < GRID_SIZE; j++) {
+          const k = poissonTransformedRejection((<f64>i + 0.5) / <f64>GRID_SIZE, (<f64>j + 0.5) / <f64>GRID_SIZE);
+          if (!isNaN(k)) {
+            expect(k).toBe(Math.floor(k));
+            count += 1.0;
+            sum += k;
+            sumSquares += k * k;
+          }
+        }
+      }
+
+      const mean: f64 = sum / count;
+      expect(Math.abs(mean - lambda)).toBeLessThan(0.02 * Math.sqrt(lambda));
+      expect(Math.abs(sumSquares / count - mean * mean - lambda)).toBeLessThan(0.02 * lambda);
+    }
+  });
+});
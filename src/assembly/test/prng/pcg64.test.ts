@@ -0,0 +1,804 @@
+/**
+ * PCG64 PRNG Tests
+ *
+ * Tests for PCG64 DXSM (128-bit state, 64-bit output) PRNG implementation.
+ *
+ * Test Strategy:
+ * - Verify determinism and value ranges
+ * - Validate output against the official C++ reference implementation, which checks
+ *   the emulated 128-bit LCG arithmetic against native 128-bit integers
+ * - Verify array methods match single-value sequences (stream consistency)
+ * - Test stream selection via setStreamIncrement (PCG-specific feature)
+ * - Validate advance() against individual steps and the C reference implementation
+ * - Distribution smoke tests (range and moments of each distribution family)
+ * - Statistical smoke tests (quartile distribution, Monte Carlo π)
+ *
+ * Contrast: Unlike PCG, whose uint64 chains two uint32 calls, PCG64 produces one
+ * uint64 per step, so only its native uint64 output is tested in depth.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  setSeeds,
+  setStreamIncrement,
+  advance,
+  uint64,
+  uint32AsFloat,
+  float53,
+  coord53,
+  uint64Array,
+  uint53AsFloatArray,
+  uint32AsFloatArray,
+  float53Array,
+  coord53Array,
+  coord53SquaredArray,
+  batchTestUnitCirclePoints,
+  intRange,
+  uint32Below,
+  intRangeArray,
+  uint32BelowArray,
+  smallIntRangeArray,
+  normal53,
+  normal53Array,
+  exponential53,
+  exponential53Array,
+  arrivalTimesArray,
+  gamma53,
+  gamma53Array,
+  beta53Array,
+  chiSquared53Array,
+  poisson,
+  binomial,
+  poissonArray,
+  binomialArray,
+  geometric,
+  geometricArray,
+  sparseBernoulliIndices,
+  randomGraphEdges,
+  zipf,
+  zipfArray,
+  aliasTableBuild,
+  categorical,
+  categoricalArray,
+  empiricalTableBuild,
+  empirical,
+  empiricalArray,
+  cauchy53,
+  cauchy53Array,
+  laplace53Array,
+  logistic53,
+  logistic53Array,
+  gumbel53Array,
+  weibull53,
+  weibull53Array,
+  pareto53,
+  pareto53Array
+} from '../../prng/pcg64';
+import {
+  TEST_SEEDS,
+  TEST_SEEDS_ALT,
+  DETERMINISTIC_SAMPLE_SIZE,
+  DISTRIBUTION_SAMPLE_SIZE,
+  QUARTILE_MIN,
+  QUARTILE_MAX,
+  PI_ESTIMATE_TOLERANCE,
+  PI,
+  BIT_63,
+  U64_Q1_MAX,
+  U64_Q2_MAX,
+  U64_Q3_MAX,
+  MAX_SAFE_INTEGER,
+  MAX_UINT32,
+  ADVANCE_STEP_COUNT,
+  ADVANCE_REFERENCE,
+  PCG64_REFERENCE,
+  NORMAL_MEAN_TOLERANCE,
+  NORMAL_VARIANCE_TOLERANCE,
+  EXPONENTIAL_MEAN_TOLERANCE,
+  EXPONENTIAL_VARIANCE_TOLERANCE,
+  sampleMean,
+  sampleVariance,
+  countInvalid
+} from '../helpers/test-utils';
+
+/** Applies this suite's default seeds to establish a known generator state at the start of each test. */
+function setupTest(): void {
+  setSeeds(TEST_SEEDS.DOUBLE_0, TEST_SEEDS.DOUBLE_1);
+}
+
+describe('PCG64', () => {
+  describe('Determinism', () => {
+    test('uint64 produces identical sequence with same seeds', () => {
+      setupTest();
+
+      const seq1: u64[] = [];
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        seq1.push(uint64());
+      }
+
+      setSeeds(TEST_SEEDS.DOUBLE_0, TEST_SEEDS.DOUBLE_1);
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (uint64() != seq1[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // All values should match with same seeds
+    });
+
+    test('uint64 produces different values with different seeds', () => {
+      setupTest();
+
+      const values1: u64[] = [];
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        values1.push(uint64());
+      }
+
+      setSeeds(TEST_SEEDS_ALT.DOUBLE_0, TEST_SEEDS_ALT.DOUBLE_1);
+      let differentCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (uint64() != values1[i]) {
+          differentCount++;
+        }
+      }
+
+      expect(differentCount).toBe(DETERMINISTIC_SAMPLE_SIZE); // All values differ with different seeds
+    });
+
+    test('uint64 matches C reference implementation', () => {
+      setupTest();
+
+      expect(uint64()).toBe(PCG64_REFERENCE.FIRST); // Verified by validate-pcg64.c
+      expect(uint64()).toBe(PCG64_REFERENCE.SECOND);
+    });
+  });
+
+  describe('Quality', () => {
+    test('uint64 should produce unique values', () => {
+      setupTest();
+
+      const values = new Set<u64>();
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        values.add(uint64());
+      }
+
+      expect(values.size).toBe(DETERMINISTIC_SAMPLE_SIZE); // All values are unique
+    });
+
+    test('uint64 should use full range', () => {
+      setupTest();
+
+      let hasHighBit = false;
+      let hasLowBit = false;
+
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const val = uint64();
+        if (val >= BIT_63) {
+          hasHighBit = true;
+        } else {
+          hasLowBit = true;
+        }
+
+        if (hasHighBit && hasLowBit) break;
+      }
+
+      expect(hasHighBit).toBe(true); // Should produce values >= 2^63
+      expect(hasLowBit).toBe(true); // Should produce values < 2^63
+    });
+  });
+
+  describe('Range Validation', () => {
+    test('uint53AsFloatArray should be in [0, 2^53-1]', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint53AsFloatArray(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < 0 || arr[i] > MAX_SAFE_INTEGER) outOfRange++;
+      }
+
+      expect(outOfRange).toBe(0); // All values in [0, 2^53-1]
+    });
+
+    test('uint32AsFloatArray should be in [0, 2^32-1]', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint32AsFloatArray(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < 0 || arr[i] > MAX_UINT32) outOfRange++;
+      }
+
+      expect(outOfRange).toBe(0); // All values in [0, 2^32-1]
+    });
+
+    test('float53Array should be in [0, 1)', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      float53Array(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < 0 || arr[i] >= 1) outOfRange++;
+      }
+
+      expect(outOfRange).toBe(0); // All values in [0, 1)
+    });
+
+    test('coord53SquaredArray should be in [0, 1]', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      coord53SquaredArray(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < 0 || arr[i] > 1) outOfRange++;
+      }
+
+      expect(outOfRange).toBe(0); // All values in [0, 1]
+    });
+  });
+
+  describe('Array Methods', () => {
+    test('uint64Array should match repeated uint64 calls', () => {
+      setupTest();
+
+      const singleValues: u64[] = [];
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        singleValues.push(uint64());
+      }
+
+      setupTest();
+      const arr = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] != singleValues[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // Array method matches repeated single calls
+    });
+
+    test('float53Array should match repeated float53 calls', () => {
+      setupTest();
+
+      const singleValues: f64[] = [];
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        singleValues.push(float53());
+      }
+
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      float53Array(arr);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] != singleValues[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // Array method matches repeated single calls
+    });
+
+    test('coord53Array should match repeated coord53 calls', () => {
+      setupTest();
+
+      const singleValues: f64[] = [];
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        singleValues.push(coord53());
+      }
+
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      coord53Array(arr);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] != singleValues[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // Array method matches repeated single calls
+    });
+
+    test('uint32AsFloat uses one step per value', () => {
+      setupTest();
+      uint32AsFloat();
+
+      expect(uint64()).toBe(PCG64_REFERENCE.SECOND); // Unlike PCG, each 32-bit output consumes a full step
+    });
+  });
+
+  describe('Advance', () => {
+    test('advance(n) matches n uint64 calls', () => {
+      setupTest();
+      for (let i: u64 = 0; i < ADVANCE_STEP_COUNT; i++) {
+        uint64();
+      }
+      const stepped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(stepped);
+
+      setupTest();
+      advance(ADVANCE_STEP_COUNT);
+      const advanced = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(advanced);
+
+      let mismatches = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (stepped[i] != advanced[i]) {
+          mismatches++;
+        }
+      }
+
+      expect(mismatches).toBe(0); // advance() lands on the same state as stepping
+    });
+
+    test('advance(0) leaves state unchanged', () => {
+      setupTest();
+      const expected = uint64();
+
+      setupTest();
+      advance(0);
+
+      expect(uint64()).toBe(expected); // No-op advance
+    });
+
+    test('advance(2^40) matches C reference implementation', () => {
+      setupTest();
+      advance(ADVANCE_REFERENCE.DELTA);
+
+      expect(uint64()).toBe(PCG64_REFERENCE.ADVANCE); // Verified by validate-pcg64.c
+    });
+  });
+
+  describe('Statistical Smoke Tests', () => {
+    test('uint64: basic distribution check (100K samples)', () => {
+      setupTest();
+
+      let q1 = 0, q2 = 0, q3 = 0, q4 = 0;
+
+      for (let i = 0; i < DISTRIBUTION_SAMPLE_SIZE; i++) {
+        const val = uint64();
+        if (val <= U64_Q1_MAX) q1++;
+        else if (val <= U64_Q2_MAX) q2++;
+        else if (val <= U64_Q3_MAX) q3++;
+        else q4++;
+      }
+
+      // Expect roughly 25K in each quartile (allow 24K-26K)
+      expect(q1).toBeGreaterThanOrEqual(QUARTILE_MIN); // Q1 quartile in range [QUARTILE_MIN, QUARTILE_MAX]
+      expect(q1).toBeLessThanOrEqual(QUARTILE_MAX);
+      expect(q2).toBeGreaterThanOrEqual(QUARTILE_MIN); // Q2 quartile in range [QUARTILE_MIN, QUARTILE_MAX]
+      expect(q2).toBeLessThanOrEqual(QUARTILE_MAX);
+      expect(q3).toBeGreaterThanOrEqual(QUARTILE_MIN); // Q3 quartile in range [QUARTILE_MIN, QUARTILE_MAX]
+      expect(q3).toBeLessThanOrEqual(QUARTILE_MAX);
+      expect(q4).toBeGreaterThanOrEqual(QUARTILE_MIN); // Q4 quartile in range [QUARTILE_MIN, QUARTILE_MAX]
+      expect(q4).toBeLessThanOrEqual(QUARTILE_MAX);
+    });
+
+    test('Monte Carlo π estimation (100K samples)', () => {
+      setupTest();
+
+      const inside = batchTestUnitCirclePoints(DISTRIBUTION_SAMPLE_SIZE);
+      const piEstimate = (4.0 * <f64>inside) / <f64>DISTRIBUTION_SAMPLE_SIZE;
+      const diff = piEstimate > PI
+        ? piEstimate - PI
+        : PI - piEstimate;
+
+      expect(diff).toBeLessThan(PI_ESTIMATE_TOLERANCE); // π estimation error
+    });
+  });
+
+  // Runs last: the default 128-bit stream increment can't be restored with setStreamIncrement()
+  describe('Stream Increment', () => {
+    test('setStreamIncrement matches C reference implementation', () => {
+      setStreamIncrement(PCG64_REFERENCE.STREAM_ID);
+      setupTest();
+
+      expect(uint64()).toBe(PCG64_REFERENCE.STREAM); // Verified by validate-pcg64.c
+    });
+
+    test('different stream increments produce completely different sequences', () => {
+      setStreamIncrement(1);
+      setupTest();
+      const seq1 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(seq1);
+
+      setStreamIncrement(2);
+      setupTest();
+      const seq2 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(seq2);
+
+      // All values should differ (100% different per test standard for stream selection)
+      let differentCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (seq1[i] != seq2[i]) {
+          differentCount++;
+        }
+      }
+
+      expect(differentCount).toBe(DETERMINISTIC_SAMPLE_SIZE); // All values differ with different stream increments
+    });
+
+    test('advance(n) matches n uint64 calls on a custom stream', () => {
+      setStreamIncrement(PCG64_REFERENCE.STREAM_ID);
+      setupTest();
+      for (let i: u64 = 0; i < ADVANCE_STEP_COUNT; i++) {
+        uint64();
+      }
+      const expected = uint64();
+
+      setupTest();
+      advance(ADVANCE_STEP_COUNT);
+
+      expect(uint64()).toBe(expected); // advance() uses the selected stream's increment
+    });
+  });
+
+  describe('Distribution Smoke Tests', () => {
+    test('bounded integers stay in range with uniform means', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // standard errors of the means are ~0.0054, ~0.0063 and ~0.91
+      intRangeArray(1, 6, arr);
+      expect(countInvalid(arr, 1.0, 6.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 3.5)).toBeLessThan(0.035);
+
+      smallIntRangeArray(-3, 3, arr);
+      expect(countInvalid(arr, -3.0, 3.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr))).toBeLessThan(0.04);
+
+      uint32BelowArray(1000, arr);
+      expect(countInvalid(arr, 0.0, 999.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 499.5)).toBeLessThan(5.0);
+
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const r = intRange(-5, 5);
+        if (r < -5 || r > 5) invalid++;
+        if (uint32Below(7) >= 7) invalid++;
+      }
+      expect(invalid).toBe(0);
+    });
+
+    test('normal53Array and normal53 have normal moments', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      normal53Array(0.0, 1.0, arr);
+      const mean = sampleMean(arr);
+
+      expect(countInvalid(arr, -Infinity, Infinity, false)).toBe(0);
+      expect(Math.abs(mean)).toBeLessThan(NORMAL_MEAN_TOLERANCE);
+      expect(Math.abs(sampleVariance(arr, mean) - 1.0)).toBeLessThan(NORMAL_VARIANCE_TOLERANCE);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += normal53(5.0, 2.0);
+      }
+
+      // standard error of ~0.02
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.12);
+    });
+
+    test('exponential53Array, exponential53 and arrivalTimesArray have mean 1 / rate', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      exponential53Array(1.0, arr);
+      const mean = sampleMean(arr);
+
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(mean - 1.0)).toBeLessThan(EXPONENTIAL_MEAN_TOLERANCE);
+      expect(Math.abs(sampleVariance(arr, mean) - 1.0)).toBeLessThan(EXPONENTIAL_VARIANCE_TOLERANCE);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += exponential53(4.0);
+      }
+
+      // standard error of ~0.0025
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.25)).toBeLessThan(0.015);
+
+      arrivalTimesArray(2.0, 10.0, arr);
+      let decreasing = arr[0] < 10.0 ? 1 : 0;
+      for (let i = 1; i < arr.length; i++) {
+        if (arr[i] < arr[i - 1]) decreasing++;
+      }
+
+      // mean gap 0.5, with a standard error of ~0.0016
+      expect(decreasing).toBe(0);
+      expect(Math.abs((arr[arr.length - 1] - 10.0) / <f64>arr.length - 0.5)).toBeLessThan(0.01);
+    });
+
+    test('gamma, beta and chi-squared numbers have the expected moments', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // standard errors of ~0.0047 and ~0.012
+      gamma53Array(9.0, 0.5, arr);
+      let mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(mean - 4.5)).toBeLessThan(0.03);
+      expect(Math.abs(sampleVariance(arr, mean) - 2.25)).toBeLessThan(0.07);
+
+      // shape 0.3 is boosted, with a standard error of ~0.0013
+      beta53Array(0.3, 0.3, arr);
+      expect(countInvalid(arr, 0.0, 1.0, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 0.5)).toBeLessThan(0.008);
+
+      // standard error of ~0.0089
+      chiSquared53Array(4.0, arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 4.0)).toBeLessThan(0.05);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += gamma53(0.5, 2.0);
+      }
+
+      // standard error of ~0.014
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.0)).toBeLessThan(0.08);
+    });
+
+    test('Poisson and binomial counts have the expected moments, by each algorithm', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // λ = 3.5 inverts and λ = 60 rejects, with standard errors of the means of ~0.006 and ~0.025
+      poissonArray(3.5, arr);
+      let mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(mean - 3.5)).toBeLessThan(0.03);
+      expect(Math.abs(sampleVariance(arr, mean) - 3.5)).toBeLessThan(0.36);
+
+      poissonArray(60.0, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(mean - 60.0)).toBeLessThan(0.12);
+      expect(Math.abs(sampleVariance(arr, mean) - 60.0)).toBeLessThan(1.44);
+
+      // n = 20 inverts and n = 1000 uses BTPE, with standard errors of the means of ~0.007 and ~0.043
+      binomialArray(20, 0.3, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, 20.0, true)).toBe(0);
+      expect(Math.abs(mean - 6.0)).toBeLessThan(0.035);
+      expect(Math.abs(sampleVariance(arr, mean) - 4.2)).toBeLessThan(0.63);
+
+      binomialArray(1000, 0.75, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, 1000.0, true)).toBe(0);
+      expect(Math.abs(mean - 750.0)).toBeLessThan(0.22);
+      expect(Math.abs(sampleVariance(arr, mean) - 187.5)).toBeLessThan(3.96);
+
+      let poissonSum = 0.0;
+      let binomialSum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        poissonSum += poisson(25.0);
+        binomialSum += binomial(100, 0.4);
+      }
+
+      // standard errors of the means are ~0.05 and ~0.05
+      expect(Math.abs(poissonSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 25.0)).toBeLessThan(0.25);
+      expect(Math.abs(binomialSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 40.0)).toBeLessThan(0.25);
+    });
+
+    test('geometric skips, sparse Bernoulli successes and random graph edges have the expected rates', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // mean 3, with a standard error of ~0.011
+      geometricArray(0.25, arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 3.0)).toBeLessThan(0.06);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += geometric(0.5);
+      }
+
+      // mean 1, with a standard error of ~0.014
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.0)).toBeLessThan(0.07);
+
+      // about 5000 successes among a million trials, with a standard deviation of ~70
+      const successes = sparseBernoulliIndices(1000000.0, 0.005, 0.0, arr);
+      let decreasing = 0;
+      for (let i = 1; i < successes; i++) {
+        if (arr[i] <= arr[i - 1]) decreasing++;
+      }
+      expect(decreasing).toBe(0);
+      expect(Math.abs(<f64>successes - 5000.0)).toBeLessThan(350.0);
+      expect(sparseBernoulliIndices(60.0, 1.0, 10.0, arr)).toBe(50);
+
+      // 4995 edges expected among 499500 possible, with a standard deviation of ~70
+      const edges = randomGraphEdges(1000.0, 0.01, 0.0, arr);
+      let invalid = 0;
+      for (let i = 0; i < edges * 2; i += 2) {
+        if (!(arr[i] >= 0.0 && arr[i] < arr[i + 1] && arr[i + 1] < 1000.0)) invalid++;
+      }
+      expect(invalid).toBe(0);
+      expect(Math.abs(<f64>edges - 4995.0)).toBeLessThan(350.0);
+      expect(randomGraphEdges(5.0, 1.0, 0.0, arr)).toBe(10);
+    });
+
+    test('Zipf ranks stay in range at their expected rates', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      zipfArray(1e9, 1.0, arr);
+
+      let first = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] == 1.0) first++;
+      }
+
+      // rank 1 has probability 1 / H(1e9) ~ 0.0469, with a standard error of ~0.0007
+      expect(countInvalid(arr, 1.0, 1e9, true)).toBe(0);
+      expect(Math.abs(<f64>first / <f64>arr.length - 0.0469)).toBeLessThan(0.0035);
+
+      first = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (zipf(100.0, 2.0) == 1.0) first++;
+      }
+
+      // rank 1 has probability 1 / 1.635 ~ 0.612, with a standard error of ~0.005
+      expect(Math.abs(<f64>first / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.612)).toBeLessThan(0.025);
+    });
+
+    test('categories are drawn from an alias table in proportion to their weights', () => {
+      setupTest();
+      const weights = new Float64Array(4);
+      weights[0] = 1.0;
+      weights[2] = 3.0;
+      weights[3] = 6.0;
+      const table = new Uint64Array(4);
+      aliasTableBuild(weights, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      categoricalArray(table, arr);
+      const counts = new Float64Array(4);
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] >= 0.0 && arr[i] <= 3.0) counts[<i32>arr[i]] += 1.0;
+      }
+
+      // probabilities 0.1, 0, 0.3 and 0.6, with standard errors under 0.0016
+      const total = <f64>arr.length;
+      expect(countInvalid(arr, 0.0, 3.0, true)).toBe(0);
+      expect(counts[1]).toBe(0.0);
+      expect(Math.abs(counts[0] / total - 0.1)).toBeLessThan(0.008);
+      expect(Math.abs(counts[2] / total - 0.3)).toBeLessThan(0.008);
+      expect(Math.abs(counts[3] / total - 0.6)).toBeLessThan(0.008);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += categorical(table);
+      }
+
+      // mean 2.4, with a standard error of ~0.0092
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 2.4)).toBeLessThan(0.055);
+    });
+
+    test('values are drawn from a tabulated CDF, with its jumps and tails', () => {
+      setupTest();
+      // uniform over 0 to 10, a jump to 10, then uniform over 10 to 20 and a long tail to 100
+      const points = new Float64Array(10);
+      points[2] = 10.0;
+      points[3] = 0.2;
+      points[4] = 10.0;
+      points[5] = 0.5;
+      points[6] = 20.0;
+      points[7] = 0.9;
+      points[8] = 100.0;
+      points[9] = 1.0;
+      const table = new Float64Array(16);
+      empiricalTableBuild(points, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      empiricalArray(table, arr);
+      let jumps = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] == 10.0) jumps++;
+      }
+
+      // mean 16 and standard deviation ~16.95, for a standard error of ~0.054,
+      // and a jump with probability 0.3, with a standard error of ~0.0015
+      expect(countInvalid(arr, 0.0, 100.0, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 16.0)).toBeLessThan(0.3);
+      expect(Math.abs(<f64>jumps / <f64>arr.length - 0.3)).toBeLessThan(0.008);
+
+      let sum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const x = empirical(table);
+        if (!(x >= 0.0 && x <= 100.0)) invalid++;
+        sum += x;
+      }
+
+      // standard error of ~0.17
+      expect(invalid).toBe(0);
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 16.0)).toBeLessThan(0.9);
+    });
+
+    test('inverse transform numbers have the moments of their distributions', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      // mean, variance and their tolerances, each ~5 standard errors over 100000 draws
+      const expected: StaticArray<f64> = [
+        // Laplace(2, 0.5)
+        2.0, 0.5, 0.012, 0.02,
+        // logistic(-1, 2)
+        -1.0, 13.159472534785811, 0.06, 0.4,
+        // Gumbel(0, 1): the Euler-Mascheroni constant and π^2 / 6
+        0.5772156649015329, 1.6449340668482264, 0.02, 0.06
+      ];
+
+      for (let d = 0; d < 3; d++) {
+        if (d == 0) laplace53Array(2.0, 0.5, arr);
+        else if (d == 1) logistic53Array(-1.0, 2.0, arr);
+        else gumbel53Array(0.0, 1.0, arr);
+        const mean = sampleMean(arr);
+
+        expect(countInvalid(arr, -Infinity, Infinity, false)).toBe(0);
+        expect(Math.abs(mean - expected[4 * d])).toBeLessThan(expected[4 * d + 2]);
+        expect(Math.abs(sampleVariance(arr, mean) - expected[4 * d + 1])).toBeLessThan(expected[4 * d + 3]);
+      }
+
+      // half of Cauchy(1, 2) is within one scale of its location, with a standard error of ~0.0016
+      cauchy53Array(1.0, 2.0, arr);
+      let inside = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (Math.abs(arr[i] - 1.0) < 2.0) inside++;
+      }
+      expect(Math.abs(<f64>inside / <f64>arr.length - 0.5)).toBeLessThan(0.008);
+
+      // Weibull(2, 3) has mean 3 * Γ(1.5), with a standard error of ~0.0044
+      weibull53Array(2.0, 3.0, arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 2.658680776358274)).toBeLessThan(0.022);
+
+      // Pareto(4, 2) has mean 8 / 3, with a standard error of ~0.003
+      pareto53Array(4.0, 2.0, arr);
+      expect(countInvalid(arr, 2.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 8.0 / 3.0)).toBeLessThan(0.015);
+
+      let logisticSum = 0.0;
+      let weibullSum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        logisticSum += logistic53(5.0, 1.0);
+        weibullSum += weibull53(1.0, 2.0);
+        if (!isFinite(cauchy53(0.0, 1.0)) || !(pareto53(1.5, 3.0) >= 3.0)) invalid++;
+      }
+
+      // standard errors of ~0.018 and ~0.02
+      expect(invalid).toBe(0);
+      expect(Math.abs(logisticSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.09);
+      expect(Math.abs(weibullSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 2.0)).toBeLessThan(0.1);
+    });
+
+    test('normal53Array and intRangeArray match repeated single-value calls', () => {
+      setupTest();
+      const normals = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      normal53Array(0.0, 1.0, normals);
+      const dice = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      intRangeArray(1, 6, dice);
+
+      setupTest();
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (normals[i] != normal53(0.0, 1.0)) mismatchCount++;
+      }
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (dice[i] != <f64>intRange(1, 6)) mismatchCount++;
+      }
+
+      expect(mismatchCount).toBe(0); // Array and single value methods share one stream
+    });
+  });
+});
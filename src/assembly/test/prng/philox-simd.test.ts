@@ -0,0 +1,612 @@
+/**
+ * Philox SIMD PRNG Tests
+ *
+ * Tests for Philox4x32-10 SIMD (one block of 4 32-bit words per v128) PRNG implementation.
+ *
+ * Test Strategy:
+ * - Validate the SIMD round function against the C reference implementation
+ * - Verify array output matches the non-SIMD Philox generator exactly
+ * - Verify single value functions return lane 0 of each block
+ * - Test fillAt() random access against the sequential stream and non-SIMD fillAt()
+ * - Test jumpTo() and longJumpTo() stream selection with C reference validation
+ * - Validate advance() in whole blocks against individual steps and the C reference
+ * - Distribution smoke tests (range and moments of each distribution family)
+ * - Statistical smoke test (Monte Carlo π)
+ *
+ * Contrast: Unlike the other SIMD generators, both lanes hold consecutive values of the
+ * same stream rather than 2 independent streams, so there is no interleaving to test.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  setSeeds,
+  jump,
+  jumpTo,
+  longJumpTo,
+  advance,
+  fillAt,
+  uint64,
+  uint64x2,
+  float53Array,
+  uint64Array,
+  batchTestUnitCirclePoints,
+  intRange,
+  uint32Below,
+  intRangeArray,
+  uint32BelowArray,
+  smallIntRangeArray,
+  normal53,
+  normal53Array,
+  exponential53,
+  exponential53Array,
+  arrivalTimesArray,
+  gamma53,
+  gamma53Array,
+  beta53Array,
+  chiSquared53Array,
+  poisson,
+  binomial,
+  poissonArray,
+  binomialArray,
+  geometric,
+  geometricArray,
+  sparseBernoulliIndices,
+  randomGraphEdges,
+  zipf,
+  zipfArray,
+  aliasTableBuild,
+  categorical,
+  categoricalArray,
+  empiricalTableBuild,
+  empirical,
+  empiricalArray,
+  cauchy53,
+  cauchy53Array,
+  laplace53Array,
+  logistic53,
+  logistic53Array,
+  gumbel53Array,
+  weibull53,
+  weibull53Array,
+  pareto53,
+  pareto53Array
+} from '../../prng/philox-simd';
+
+// Import non-SIMD functions for comparison tests
+import {
+  setSeeds as setSeedsNonSIMD,
+  fillAt as fillAtNonSIMD,
+  uint64Array as uint64ArrayNonSIMD,
+  float53Array as float53ArrayNonSIMD
+} from '../../prng/philox';
+
+import {
+  TEST_SEEDS,
+  DETERMINISTIC_SAMPLE_SIZE,
+  DISTRIBUTION_SAMPLE_SIZE,
+  PI_ESTIMATE_TOLERANCE,
+  PI,
+  ADVANCE_STEP_COUNT,
+  ADVANCE_REFERENCE,
+  PHILOX_REFERENCE,
+  NORMAL_MEAN_TOLERANCE,
+  NORMAL_VARIANCE_TOLERANCE,
+  EXPONENTIAL_MEAN_TOLERANCE,
+  EXPONENTIAL_VARIANCE_TOLERANCE,
+  sampleMean,
+  sampleVariance,
+  countInvalid
+} from '../helpers/test-utils';
+
+/** Applies this suite's default seed to establish a known generator state at the start of each test. */
+function setupTest(): void {
+  setSeeds(TEST_SEEDS.SINGLE);
+}
+
+/** Counts mismatched values between two arrays of equal length. */
+function countMismatches(a: Uint64Array, b: Uint64Array): i32 {
+  let mismatches = 0;
+  for (let i = 0; i < a.length; i++) {
+    if (a[i] != b[i]) mismatches++;
+  }
+  return mismatches;
+}
+
+describe('Philox SIMD', () => {
+  describe('Reference Values', () => {
+    test('uint64x2 matches C reference implementation', () => {
+      setupTest();
+      const block0 = uint64x2();
+      const block1 = uint64x2();
+
+      expect(v128.extract_lane<u64>(block0, 0)).toBe(PHILOX_REFERENCE.FIRST); // Verified by validate-philox.c
+      expect(v128.extract_lane<u64>(block0, 1)).toBe(PHILOX_REFERENCE.SECOND);
+      expect(v128.extract_lane<u64>(block1, 0)).toBe(PHILOX_REFERENCE.THIRD);
+    });
+
+    test('uint64 returns lane 0 of each block', () => {
+      setupTest();
+
+      expect(uint64()).toBe(PHILOX_REFERENCE.FIRST); // Second value of block 0 is discarded
+      expect(uint64()).toBe(PHILOX_REFERENCE.THIRD);
+    });
+  });
+
+  describe('Non-SIMD Consistency', () => {
+    test('uint64Array matches non-SIMD Philox', () => {
+      setupTest();
+      const simd = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(simd);
+
+      setSeedsNonSIMD(TEST_SEEDS.SINGLE);
+      const nonSimd = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64ArrayNonSIMD(nonSimd);
+
+      expect(countMismatches(simd, nonSimd)).toBe(0); // Same blocks, in the same order
+    });
+
+    test('float53Array matches non-SIMD Philox', () => {
+      setupTest();
+      const simd = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      float53Array(simd);
+
+      setSeedsNonSIMD(TEST_SEEDS.SINGLE);
+      const nonSimd = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      float53ArrayNonSIMD(nonSimd);
+
+      let mismatches = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (simd[i] != nonSimd[i]) mismatches++;
+      }
+
+      expect(mismatches).toBe(0); // Same blocks, in the same order
+    });
+  });
+
+  describe('Random Access', () => {
+    test('fillAt matches non-SIMD fillAt, including odd lengths', () => {
+      const counter: u64 = 0xFFFFFFFF0; // crosses into the counter's high 32-bit word
+      const oddLength = DETERMINISTIC_SAMPLE_SIZE + 1;
+
+      setupTest();
+      const simd = new Uint64Array(oddLength);
+      fillAt(counter, simd);
+
+      setSeedsNonSIMD(TEST_SEEDS.SINGLE);
+      const nonSimd = new Uint64Array(oddLength);
+      fillAtNonSIMD(counter, nonSimd);
+
+      expect(countMismatches(simd, nonSimd)).toBe(0); // SIMD and scalar rounds agree
+    });
+
+    test('fillAt(counter) matches the sequential stream after advance(counter)', () => {
+      const counter: u64 = 37;
+
+      setupTest();
+      advance(counter);
+      const sequential = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(sequential);
+
+      setupTest();
+      const random = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      fillAt(counter, random);
+
+      expect(countMismatches(random, sequential)).toBe(0); // Random access matches sequential generation
+    });
+
+    test('fillAt does not change the sequential position', () => {
+      setupTest();
+      const arr = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      fillAt(12345, arr);
+
+      expect(uint64()).toBe(PHILOX_REFERENCE.FIRST); // Still at block 0
+    });
+  });
+
+  describe('Stream Selection', () => {
+    test('jumpTo matches C reference implementation', () => {
+      setupTest();
+      jumpTo(PHILOX_REFERENCE.STREAM_ID);
+
+      expect(uint64()).toBe(PHILOX_REFERENCE.STREAM); // Verified by validate-philox.c
+    });
+
+    test('jumpTo matches repeated jump calls', () => {
+      setupTest();
+      for (let i: u64 = 0; i < PHILOX_REFERENCE.STREAM_ID; i++) {
+        jump();
+      }
+
+      expect(uint64()).toBe(PHILOX_REFERENCE.STREAM);
+    });
+
+    test('longJumpTo then jumpTo matches C reference implementation', () => {
+      setupTest();
+      longJumpTo(PHILOX_REFERENCE.NODE_ID);
+      jumpTo(PHILOX_REFERENCE.WORKER_ID);
+
+      expect(uint64()).toBe(PHILOX_REFERENCE.NODE_WORKER); // Verified by validate-philox.c
+    });
+  });
+
+  describe('Advance', () => {
+    test('advance(n) matches n uint64x2 calls', () => {
+      setupTest();
+      for (let i: u64 = 0; i < ADVANCE_STEP_COUNT; i++) {
+        uint64x2();
+      }
+      const stepped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(stepped);
+
+      setupTest();
+      advance(ADVANCE_STEP_COUNT);
+      const advanced = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(advanced);
+
+      expect(countMismatches(stepped, advanced)).toBe(0); // advance() lands on the same block as stepping
+    });
+
+    test('advance(2^39) matches C reference implementation at index 2^40', () => {
+      setupTest();
+      advance(ADVANCE_REFERENCE.DELTA >>> 1);
+      const block = uint64x2();
+
+      expect(v128.extract_lane<u64>(block, 0)).toBe(PHILOX_REFERENCE.ADVANCE); // Verified by validate-philox.c
+      expect(v128.extract_lane<u64>(block, 1)).toBe(PHILOX_REFERENCE.ADVANCE_NEXT);
+    });
+  });
+
+  describe('Statistical Smoke Tests', () => {
+    test('Monte Carlo π estimation (100K samples)', () => {
+      setupTest();
+
+      const inside = batchTestUnitCirclePoints(DISTRIBUTION_SAMPLE_SIZE);
+      const piEstimate = (4.0 * <f64>inside) / <f64>DISTRIBUTION_SAMPLE_SIZE;
+      const diff = piEstimate > PI
+        ? piEstimate - PI
+        : PI - piEstimate;
+
+      expect(diff).toBeLessThan(PI_ESTIMATE_TOLERANCE); // π estimation error
+    });
+  });
+
+  describe('Distribution Smoke Tests', () => {
+    test('bounded integers stay in range with uniform means', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // standard errors of the means are ~0.0054, ~0.0063 and ~0.91
+      intRangeArray(1, 6, arr);
+      expect(countInvalid(arr, 1.0, 6.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 3.5)).toBeLessThan(0.035);
+
+      smallIntRangeArray(-3, 3, arr);
+      expect(countInvalid(arr, -3.0, 3.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr))).toBeLessThan(0.04);
+
+      uint32BelowArray(1000, arr);
+      expect(countInvalid(arr, 0.0, 999.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 499.5)).toBeLessThan(5.0);
+
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const r = intRange(-5, 5);
+        if (r < -5 || r > 5) invalid++;
+        if (uint32Below(7) >= 7) invalid++;
+      }
+      expect(invalid).toBe(0);
+    });
+
+    test('normal53Array and normal53 have normal moments', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      normal53Array(0.0, 1.0, arr);
+      const mean = sampleMean(arr);
+
+      expect(countInvalid(arr, -Infinity, Infinity, false)).toBe(0);
+      expect(Math.abs(mean)).toBeLessThan(NORMAL_MEAN_TOLERANCE);
+      expect(Math.abs(sampleVariance(arr, mean) - 1.0)).toBeLessThan(NORMAL_VARIANCE_TOLERANCE);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += normal53(5.0, 2.0);
+      }
+
+      // standard error of ~0.02
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.12);
+    });
+
+    test('exponential53Array, exponential53 and arrivalTimesArray have mean 1 / rate', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      exponential53Array(1.0, arr);
+      const mean = sampleMean(arr);
+
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(mean - 1.0)).toBeLessThan(EXPONENTIAL_MEAN_TOLERANCE);
+      expect(Math.abs(sampleVariance(arr, mean) - 1.0)).toBeLessThan(EXPONENTIAL_VARIANCE_TOLERANCE);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += exponential53(4.0);
+      }
+
+      // standard error of ~0.0025
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.25)).toBeLessThan(0.015);
+
+      arrivalTimesArray(2.0, 10.0, arr);
+      let decreasing = arr[0] < 10.0 ? 1 : 0;
+      for (let i = 1; i < arr.length; i++) {
+        if (arr[i] < arr[i - 1]) decreasing++;
+      }
+
+      // mean gap 0.5, with a standard error of ~0.0016
+      expect(decreasing).toBe(0);
+      expect(Math.abs((arr[arr.length - 1] - 10.0) / <f64>arr.length - 0.5)).toBeLessThan(0.01);
+    });
+
+    test('gamma, beta and chi-squared numbers have the expected moments', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // standard errors of ~0.0047 and ~0.012
+      gamma53Array(9.0, 0.5, arr);
+      let mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(mean - 4.5)).toBeLessThan(0.03);
+      expect(Math.abs(sampleVariance(arr, mean) - 2.25)).toBeLessThan(0.07);
+
+      // shape 0.3 is boosted, with a standard error of ~0.0013
+      beta53Array(0.3, 0.3, arr);
+      expect(countInvalid(arr, 0.0, 1.0, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 0.5)).toBeLessThan(0.008);
+
+      // standard error of ~0.0089
+      chiSquared53Array(4.0, arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 4.0)).toBeLessThan(0.05);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += gamma53(0.5, 2.0);
+      }
+
+      // standard error of ~0.014
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.0)).toBeLessThan(0.08);
+    });
+
+    test('Poisson and binomial counts have the expected moments, by each algorithm', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // λ = 3.5 inverts and λ = 60 rejects, with standard errors of the means of ~0.006 and ~0.025
+      poissonArray(3.5, arr);
+      let mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(mean - 3.5)).toBeLessThan(0.03);
+      expect(Math.abs(sampleVariance(arr, mean) - 3.5)).toBeLessThan(0.36);
+
+      poissonArray(60.0, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(mean - 60.0)).toBeLessThan(0.12);
+      expect(Math.abs(sampleVariance(arr, mean) - 60.0)).toBeLessThan(1.44);
+
+      // n = 20 inverts and n = 1000 uses BTPE, with standard errors of the means of ~0.007 and ~0.043
+      binomialArray(20, 0.3, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, 20.0, true)).toBe(0);
+      expect(Math.abs(mean - 6.0)).toBeLessThan(0.035);
+      expect(Math.abs(sampleVariance(arr, mean) - 4.2)).toBeLessThan(0.63);
+
+      binomialArray(1000, 0.75, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, 1000.0, true)).toBe(0);
+      expect(Math.abs(mean - 750.0)).toBeLessThan(0.22);
+      expect(Math.abs(sampleVariance(arr, mean) - 187.5)).toBeLessThan(3.96);
+
+      let poissonSum = 0.0;
+      let binomialSum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        poissonSum += poisson(25.0);
+        binomialSum += binomial(100, 0.4);
+      }
+
+      // standard errors of the means are ~0.05 and ~0.05
+      expect(Math.abs(poissonSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 25.0)).toBeLessThan(0.25);
+      expect(Math.abs(binomialSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 40.0)).toBeLessThan(0.25);
+    });
+
+    test('geometric skips, sparse Bernoulli successes and random graph edges have the expected rates', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // mean 3, with a standard error of ~0.011
+      geometricArray(0.25, arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 3.0)).toBeLessThan(0.06);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += geometric(0.5);
+      }
+
+      // mean 1, with a standard error of ~0.014
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.0)).toBeLessThan(0.07);
+
+      // about 5000 successes among a million trials, with a standard deviation of ~70
+      const successes = sparseBernoulliIndices(1000000.0, 0.005, 0.0, arr);
+      let decreasing = 0;
+      for (let i = 1; i < successes; i++) {
+        if (arr[i] <= arr[i - 1]) decreasing++;
+      }
+      expect(decreasing).toBe(0);
+      expect(Math.abs(<f64>successes - 5000.0)).toBeLessThan(350.0);
+      expect(sparseBernoulliIndices(60.0, 1.0, 10.0, arr)).toBe(50);
+
+      // 4995 edges expected among 499500 possible, with a standard deviation of ~70
+      const edges = randomGraphEdges(1000.0, 0.01, 0.0, arr);
+      let invalid = 0;
+      for (let i = 0; i < edges * 2; i += 2) {
+        if (!(arr[i] >= 0.0 && arr[i] < arr[i + 1] && arr[i + 1] < 1000.0)) invalid++;
+      }
+      expect(invalid).toBe(0);
+      expect(Math.abs(<f64>edges - 4995.0)).toBeLessThan(350.0);
+      expect(randomGraphEdges(5.0, 1.0, 0.0, arr)).toBe(10);
+    });
+
+    test('Zipf ranks stay in range at their expected rates', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      zipfArray(1e9, 1.0, arr);
+
+      let first = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] == 1.0) first++;
+      }
+
+      // rank 1 has probability 1 / H(1e9) ~ 0.0469, with a standard error of ~0.0007
+      expect(countInvalid(arr, 1.0, 1e9, true)).toBe(0);
+      expect(Math.abs(<f64>first / <f64>arr.length - 0.0469)).toBeLessThan(0.0035);
+
+      first = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (zipf(100.0, 2.0) == 1.0) first++;
+      }
+
+      // rank 1 has probability 1 / 1.635 ~ 0.612, with a standard error of ~0.005
+      expect(Math.abs(<f64>first / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.612)).toBeLessThan(0.025);
+    });
+
+    test('categories are drawn from an alias table in proportion to their weights', () => {
+      setupTest();
+      const weights = new Float64Array(4);
+      weights[0] = 1.0;
+      weights[2] = 3.0;
+      weights[3] = 6.0;
+      const table = new Uint64Array(4);
+      aliasTableBuild(weights, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      categoricalArray(table, arr);
+      const counts = new Float64Array(4);
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] >= 0.0 && arr[i] <= 3.0) counts[<i32>arr[i]] += 1.0;
+      }
+
+      // probabilities 0.1, 0, 0.3 and 0.6, with standard errors under 0.0016
+      const total = <f64>arr.length;
+      expect(countInvalid(arr, 0.0, 3.0, true)).toBe(0);
+      expect(counts[1]).toBe(0.0);
+      expect(Math.abs(counts[0] / total - 0.1)).toBeLessThan(0.008);
+      expect(Math.abs(counts[2] / total - 0.3)).toBeLessThan(0.008);
+      expect(Math.abs(counts[3] / total - 0.6)).toBeLessThan(0.008);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += categorical(table);
+      }
+
+      // mean 2.4, with a standard error of ~0.0092
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 2.4)).toBeLessThan(0.055);
+    });
+
+    test('values are drawn from a tabulated CDF, with its jumps and tails', () => {
+      setupTest();
+      // uniform over 0 to 10, a jump to 10, then uniform over 10 to 20 and a long tail to 100
+      const points = new Float64Array(10);
+      points[2] = 10.0;
+      points[3] = 0.2;
+      points[4] = 10.0;
+      points[5] = 0.5;
+      points[6] = 20.0;
+      points[7] = 0.9;
+      points[8] = 100.0;
+      points[9] = 1.0;
+      const table = new Float64Array(16);
+      empiricalTableBuild(points, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      empiricalArray(table, arr);
+      let jumps = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] == 10.0) jumps++;
+      }
+
+      // mean 16 and standard deviation ~16.95, for a standard error of ~0.054,
+      // and a jump with probability 0.3, with a standard error of ~0.0015
+      expect(countInvalid(arr, 0.0, 100.0, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 16.0)).toBeLessThan(0.3);
+      expect(Math.abs(<f64>jumps / <f64>arr.length - 0.3)).toBeLessThan(0.008);
+
+      let sum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const x = empirical(table);
+        if (!(x >= 0.0 && x <= 100.0)) invalid++;
+        sum += x;
+      }
+
+      // standard error of ~0.17
+      expect(invalid).toBe(0);
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 16.0)).toBeLessThan(0.9);
+    });
+
+    test('inverse transform numbers have the moments of their distributions', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      // mean, variance and their tolerances, each ~5 standard errors over 100000 draws
+      const expected: StaticArray<f64> = [
+        // Laplace(2, 0.5)
+        2.0, 0.5, 0.012, 0.02,
+        // logistic(-1, 2)
+        -1.0, 13.159472534785811, 0.06, 0.4,
+        // Gumbel(0, 1): the Euler-Mascheroni constant and π^2 / 6
+        0.5772156649015329, 1.6449340668482264, 0.02, 0.06
+      ];
+
+      for (let d = 0; d < 3; d++) {
+        if (d == 0) laplace53Array(2.0, 0.5, arr);
+        else if (d == 1) logistic53Array(-1.0, 2.0, arr);
+        else gumbel53Array(0.0, 1.0, arr);
+        const mean = sampleMean(arr);
+
+        expect(countInvalid(arr, -Infinity, Infinity, false)).toBe(0);
+        expect(Math.abs(mean - expected[4 * d])).toBeLessThan(expected[4 * d + 2]);
+        expect(Math.abs(sampleVariance(arr, mean) - expected[4 * d + 1])).toBeLessThan(expected[4 * d + 3]);
+      }
+
+      // half of Cauchy(1, 2) is within one scale of its location, with a standard error of ~0.0016
+      cauchy53Array(1.0, 2.0, arr);
+      let inside = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (Math.abs(arr[i] - 1.0) < 2.0) inside++;
+      }
+      expect(Math.abs(<f64>inside / <f64>arr.length - 0.5)).toBeLessThan(0.008);
+
+      // Weibull(2, 3) has mean 3 * Γ(1.5), with a standard error of ~0.0044
+      weibull53Array(2.0, 3.0, arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 2.658680776358274)).toBeLessThan(0.022);
+
+      // Pareto(4, 2) has mean 8 / 3, with a standard error of ~0.003
+      pareto53Array(4.0, 2.0, arr);
+      expect(countInvalid(arr, 2.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 8.0 / 3.0)).toBeLessThan(0.015);
+
+      let logisticSum = 0.0;
+      let weibullSum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        logisticSum += logistic53(5.0, 1.0);
+        weibullSum += weibull53(1.0, 2.0);
+        if (!isFinite(cauchy53(0.0, 1.0)) || !(pareto53(1.5, 3.0) >= 3.0)) invalid++;
+      }
+
+      // standard errors of ~0.018 and ~0.02
+      expect(invalid).toBe(0);
+      expect(Math.abs(logisticSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.09);
+      expect(Math.abs(weibullSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 2.0)).toBeLessThan(0.1);
+    });
+  });
+});
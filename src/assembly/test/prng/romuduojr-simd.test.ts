@@ -0,0 +1,530 @@
+/**
+ * RomuDuoJr SIMD PRNG Tests
+ *
+ * Tests for RomuDuoJr SIMD (dual-lane parallel 128-bit rotate-multiply state) PRNG implementation.
+ *
+ * Test Strategy:
+ * - Verify determinism and value ranges
+ * - Validate lane 0 against the C reference implementation
+ * - Verify each lane matches the non-SIMD generator seeded with that lane's seeds
+ * - Distribution smoke tests (range and moments of each distribution family)
+ * - Statistical smoke tests (Monte Carlo π)
+ *
+ * Contrast: The non-SIMD RomuDuoJr suite covers stream consistency between single value
+ * and array methods; this suite focuses on the vectorized state update.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  setSeeds,
+  uint64x2,
+  uint64Array,
+  float53Array,
+  batchTestUnitCirclePoints,
+  intRange,
+  uint32Below,
+  intRangeArray,
+  uint32BelowArray,
+  smallIntRangeArray,
+  normal53,
+  normal53Array,
+  exponential53,
+  exponential53Array,
+  arrivalTimesArray,
+  gamma53,
+  gamma53Array,
+  beta53Array,
+  chiSquared53Array,
+  poisson,
+  binomial,
+  poissonArray,
+  binomialArray,
+  geometric,
+  geometricArray,
+  sparseBernoulliIndices,
+  randomGraphEdges,
+  zipf,
+  zipfArray,
+  aliasTableBuild,
+  categorical,
+  categoricalArray,
+  empiricalTableBuild,
+  empirical,
+  empiricalArray,
+  cauchy53,
+  cauchy53Array,
+  laplace53Array,
+  logistic53,
+  logistic53Array,
+  gumbel53Array,
+  weibull53,
+  weibull53Array,
+  pareto53,
+  pareto53Array
+} from '../../prng/romuduojr-simd';
+
+// Import non-SIMD functions for comparison tests
+import {
+  setSeeds as setSeedsNonSIMD,
+  uint64Array as uint64ArrayNonSIMD
+} from '../../prng/romuduojr';
+
+import {
+  TEST_SEEDS,
+  TEST_SEEDS_ALT,
+  DETERMINISTIC_SAMPLE_SIZE,
+  DISTRIBUTION_SAMPLE_SIZE,
+  PI_ESTIMATE_TOLERANCE,
+  PI,
+  SFC_ROMU_REFERENCE,
+  NORMAL_MEAN_TOLERANCE,
+  NORMAL_VARIANCE_TOLERANCE,
+  EXPONENTIAL_MEAN_TOLERANCE,
+  EXPONENTIAL_VARIANCE_TOLERANCE,
+  sampleMean,
+  sampleVariance,
+  countInvalid
+} from '../helpers/test-utils';
+
+/** Applies this suite's default seeds to establish a known generator state at the start of each test. */
+function setupTest(): void {
+  setSeeds(TEST_SEEDS.OCTET_0, TEST_SEEDS.OCTET_1, TEST_SEEDS.OCTET_2, TEST_SEEDS.OCTET_3);
+}
+
+/** Counts the values that differ between two arrays of the same length. */
+function countMismatches(a: Uint64Array, b: Uint64Array): i32 {
+  let mismatchCount = 0;
+  for (let i = 0; i < a.length; i++) {
+    if (a[i] != b[i]) mismatchCount++;
+  }
+  return mismatchCount;
+}
+
+describe('RomuDuoJrSIMD', () => {
+  describe('Determinism', () => {
+    test('uint64Array produces identical sequence with same seeds', () => {
+      setupTest();
+      const arr1 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr1);
+
+      setupTest();
+      const arr2 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr2);
+
+      expect(countMismatches(arr1, arr2)).toBe(0); // All values should match with same seeds
+    });
+
+    test('uint64Array produces different values with different seeds', () => {
+      setupTest();
+      const arr1 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr1);
+
+      setSeeds(TEST_SEEDS_ALT.OCTET_0, TEST_SEEDS_ALT.OCTET_1, TEST_SEEDS_ALT.OCTET_2, TEST_SEEDS_ALT.OCTET_3);
+      const arr2 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr2);
+
+      expect(countMismatches(arr1, arr2)).toBe(DETERMINISTIC_SAMPLE_SIZE); // All values differ with different seeds
+    });
+
+    test('uint64x2 lane 0 matches C reference implementation', () => {
+      setupTest();
+
+      expect(v128.extract_lane<u64>(uint64x2(), 0)).toBe(SFC_ROMU_REFERENCE.ROMUDUOJR_FIRST); // Verified by validate-sfc-romu.c
+      expect(v128.extract_lane<u64>(uint64x2(), 0)).toBe(SFC_ROMU_REFERENCE.ROMUDUOJR_SECOND);
+      expect(v128.extract_lane<u64>(uint64x2(), 0)).toBe(SFC_ROMU_REFERENCE.ROMUDUOJR_THIRD);
+    });
+  });
+
+  describe('SIMD Lanes', () => {
+    test('each lane matches the non-SIMD generator seeded with its seeds', () => {
+      setupTest();
+      const interleaved = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE * 2);
+      uint64Array(interleaved);
+
+      setSeedsNonSIMD(TEST_SEEDS.OCTET_0, TEST_SEEDS.OCTET_1);
+      const lane0 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64ArrayNonSIMD(lane0);
+
+      setSeedsNonSIMD(TEST_SEEDS.OCTET_2, TEST_SEEDS.OCTET_3);
+      const lane1 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64ArrayNonSIMD(lane1);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (interleaved[i * 2] != lane0[i]) mismatchCount++;
+        if (interleaved[i * 2 + 1] != lane1[i]) mismatchCount++;
+      }
+
+      expect(mismatchCount).toBe(0); // Array output interleaves lane 0 and lane 1
+    });
+  });
+
+  describe('Range Validation', () => {
+    test('float53Array values are in [0, 1)', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      float53Array(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < 0 || arr[i] >= 1) outOfRange++;
+      }
+
+      expect(outOfRange).toBe(0); // All values in [0, 1)
+    });
+  });
+
+  describe('Statistical Smoke Tests', () => {
+    test('Monte Carlo π estimation (100K samples)', () => {
+      setupTest();
+
+      const inside = batchTestUnitCirclePoints(DISTRIBUTION_SAMPLE_SIZE);
+      const piEstimate = (4.0 * <f64>inside) / <f64>DISTRIBUTION_SAMPLE_SIZE;
+      const diff = piEstimate > PI
+        ? piEstimate - PI
+        : PI - piEstimate;
+
+      expect(diff).toBeLessThan(PI_ESTIMATE_TOLERANCE); // π estimation error
+    });
+  });
+
+  describe('Distribution Smoke Tests', () => {
+    test('bounded integers stay in range with uniform means', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // standard errors of the means are ~0.0054, ~0.0063 and ~0.91
+      intRangeArray(1, 6, arr);
+      expect(countInvalid(arr, 1.0, 6.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 3.5)).toBeLessThan(0.035);
+
+      smallIntRangeArray(-3, 3, arr);
+      expect(countInvalid(arr, -3.0, 3.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr))).toBeLessThan(0.04);
+
+      uint32BelowArray(1000, arr);
+      expect(countInvalid(arr, 0.0, 999.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 499.5)).toBeLessThan(5.0);
+
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const r = intRange(-5, 5);
+        if (r < -5 || r > 5) invalid++;
+        if (uint32Below(7) >= 7) invalid++;
+      }
+      expect(invalid).toBe(0);
+    });
+
+    test('normal53Array and normal53 have normal moments', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      normal53Array(0.0, 1.0, arr);
+      const mean = sampleMean(arr);
+
+      expect(countInvalid(arr, -Infinity, Infinity, false)).toBe(0);
+      expect(Math.abs(mean)).toBeLessThan(NORMAL_MEAN_TOLERANCE);
+      expect(Math.abs(sampleVariance(arr, mean) - 1.0)).toBeLessThan(NORMAL_VARIANCE_TOLERANCE);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += normal53(5.0, 2.0);
+      }
+
+      // standard error of ~0.02
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.12);
+    });
+
+    test('exponential53Array, exponential53 and arrivalTimesArray have mean 1 / rate', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      exponential53Array(1.0, arr);
+      const mean = sampleMean(arr);
+
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(mean - 1.0)).toBeLessThan(EXPONENTIAL_MEAN_TOLERANCE);
+      expect(Math.abs(sampleVariance(arr, mean) - 1.0)).toBeLessThan(EXPONENTIAL_VARIANCE_TOLERANCE);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += exponential53(4.0);
+      }
+
+      // standard error of ~0.0025
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.25)).toBeLessThan(0.015);
+
+      arrivalTimesArray(2.0, 10.0, arr);
+      let decreasing = arr[0] < 10.0 ? 1 : 0;
+      for (let i = 1; i < arr.length; i++) {
+        if (arr[i] < arr[i - 1]) decreasing++;
+      }
+
+      // mean gap 0.5, with a standard error of ~0.0016
+      expect(decreasing).toBe(0);
+      expect(Math.abs((arr[arr.length - 1] - 10.0) / <f64>arr.length - 0.5)).toBeLessThan(0.01);
+    });
+
+    test('gamma, beta and chi-squared numbers have the expected moments', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // standard errors of ~0.0047 and ~0.012
+      gamma53Array(9.0, 0.5, arr);
+      let mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(mean - 4.5)).toBeLessThan(0.03);
+      expect(Math.abs(sampleVariance(arr, mean) - 2.25)).toBeLessThan(0.07);
+
+      // shape 0.3 is boosted, with a standard error of ~0.0013
+      beta53Array(0.3, 0.3, arr);
+      expect(countInvalid(arr, 0.0, 1.0, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 0.5)).toBeLessThan(0.008);
+
+      // standard error of ~0.0089
+      chiSquared53Array(4.0, arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 4.0)).toBeLessThan(0.05);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += gamma53(0.5, 2.0);
+      }
+
+      // standard error of ~0.014
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.0)).toBeLessThan(0.08);
+    });
+
+    test('Poisson and binomial counts have the expected moments, by each algorithm', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // λ = 3.5 inverts and λ = 60 rejects, with standard errors of the means of ~0.006 and ~0.025
+      poissonArray(3.5, arr);
+      let mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(mean - 3.5)).toBeLessThan(0.03);
+      expect(Math.abs(sampleVariance(arr, mean) - 3.5)).toBeLessThan(0.36);
+
+      poissonArray(60.0, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(mean - 60.0)).toBeLessThan(0.12);
+      expect(Math.abs(sampleVariance(arr, mean) - 60.0)).toBeLessThan(1.44);
+
+      // n = 20 inverts and n = 1000 uses BTPE, with standard errors of the means of ~0.007 and ~0.043
+      binomialArray(20, 0.3, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, 20.0, true)).toBe(0);
+      expect(Math.abs(mean - 6.0)).toBeLessThan(0.035);
+      expect(Math.abs(sampleVariance(arr, mean) - 4.2)).toBeLessThan(0.63);
+
+      binomialArray(1000, 0.75, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, 1000.0, true)).toBe(0);
+      expect(Math.abs(mean - 750.0)).toBeLessThan(0.22);
+      expect(Math.abs(sampleVariance(arr, mean) - 187.5)).toBeLessThan(3.96);
+
+      let poissonSum = 0.0;
+      let binomialSum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        poissonSum += poisson(25.0);
+        binomialSum += binomial(100, 0.4);
+      }
+
+      // standard errors of the means are ~0.05 and ~0.05
+      expect(Math.abs(poissonSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 25.0)).toBeLessThan(0.25);
+      expect(Math.abs(binomialSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 40.0)).toBeLessThan(0.25);
+    });
+
+    test('geometric skips, sparse Bernoulli successes and random graph edges have the expected rates', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // mean 3, with a standard error of ~0.011
+      geometricArray(0.25, arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 3.0)).toBeLessThan(0.06);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += geometric(0.5);
+      }
+
+      // mean 1, with a standard error of ~0.014
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.0)).toBeLessThan(0.07);
+
+      // about 5000 successes among a million trials, with a standard deviation of ~70
+      const successes = sparseBernoulliIndices(1000000.0, 0.005, 0.0, arr);
+      let decreasing = 0;
+      for (let i = 1; i < successes; i++) {
+        if (arr[i] <= arr[i - 1]) decreasing++;
+      }
+      expect(decreasing).toBe(0);
+      expect(Math.abs(<f64>successes - 5000.0)).toBeLessThan(350.0);
+      expect(sparseBernoulliIndices(60.0, 1.0, 10.0, arr)).toBe(50);
+
+      // 4995 edges expected among 499500 possible, with a standard deviation of ~70
+      const edges = randomGraphEdges(1000.0, 0.01, 0.0, arr);
+      let invalid = 0;
+      for (let i = 0; i < edges * 2; i += 2) {
+        if (!(arr[i] >= 0.0 && arr[i] < arr[i + 1] && arr[i + 1] < 1000.0)) invalid++;
+      }
+      expect(invalid).toBe(0);
+      expect(Math.abs(<f64>edges - 4995.0)).toBeLessThan(350.0);
+      expect(randomGraphEdges(5.0, 1.0, 0.0, arr)).toBe(10);
+    });
+
+    test('Zipf ranks stay in range at their expected rates', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      zipfArray(1e9, 1.0, arr);
+
+      let first = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] == 1.0) first++;
+      }
+
+      // rank 1 has probability 1 / H(1e9) ~ 0.0469, with a standard error of ~0.0007
+      expect(countInvalid(arr, 1.0, 1e9, true)).toBe(0);
+      expect(Math.abs(<f64>first / <f64>arr.length - 0.0469)).toBeLessThan(0.0035);
+
+      first = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (zipf(100.0, 2.0) == 1.0) first++;
+      }
+
+      // rank 1 has probability 1 / 1.635 ~ 0.612, with a standard error of ~0.005
+      expect(Math.abs(<f64>first / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.612)).toBeLessThan(0.025);
+    });
+
+    test('categories are drawn from an alias table in proportion to their weights', () => {
+      setupTest();
+      const weights = new Float64Array(4);
+      weights[0] = 1.0;
+      weights[2] = 3.0;
+      weights[3] = 6.0;
+      const table = new Uint64Array(4);
+      aliasTableBuild(weights, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      categoricalArray(table, arr);
+      const counts = new Float64Array(4);
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] >= 0.0 && arr[i] <= 3.0) counts[<i32>arr[i]] += 1.0;
+      }
+
+      // probabilities 0.1, 0, 0.3 and 0.6, with standard errors under 0.0016
+      const total = <f64>arr.length;
+      expect(countInvalid(arr, 0.0, 3.0, true)).toBe(0);
+      expect(counts[1]).toBe(0.0);
+      expect(Math.abs(counts[0] / total - 0.1)).toBeLessThan(0.008);
+      expect(Math.abs(counts[2] / total - 0.3)).toBeLessThan(0.008);
+      expect(Math.abs(counts[3] / total - 0.6)).toBeLessThan(0.008);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += categorical(table);
+      }
+
+      // mean 2.4, with a standard error of ~0.0092
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 2.4)).toBeLessThan(0.055);
+    });
+
+    test('values are drawn from a tabulated CDF, with its jumps and tails', () => {
+      setupTest();
+      // uniform over 0 to 10, a jump to 10, then uniform over 10 to 20 and a long tail to 100
+      const points = new Float64Array(10);
+      points[2] = 10.0;
+      points[3] = 0.2;
+      points[4] = 10.0;
+      points[5] = 0.5;
+      points[6] = 20.0;
+      points[7] = 0.9;
+      points[8] = 100.0;
+      points[9] = 1.0;
+      const table = new Float64Array(16);
+      empiricalTableBuild(points, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      empiricalArray(table, arr);
+      let jumps = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] == 10.0) jumps++;
+      }
+
+      // mean 16 and standard deviation ~16.95, for a standard error of ~0.054,
+      // and a jump with probability 0.3, with a standard error of ~0.0015
+      expect(countInvalid(arr, 0.0, 100.0, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 16.0)).toBeLessThan(0.3);
+      expect(Math.abs(<f64>jumps / <f64>arr.length - 0.3)).toBeLessThan(0.008);
+
+      let sum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const x = empirical(table);
+        if (!(x >= 0.0 && x <= 100.0)) invalid++;
+        sum += x;
+      }
+
+      // standard error of ~0.17
+      expect(invalid).toBe(0);
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 16.0)).toBeLessThan(0.9);
+    });
+
+    test('inverse transform numbers have the moments of their distributions', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      // mean, variance and their tolerances, each ~5 standard errors over 100000 draws
+      const expected: StaticArray<f64> = [
+        // Laplace(2, 0.5)
+        2.0, 0.5, 0.012, 0.02,
+        // logistic(-1, 2)
+        -1.0, 13.159472534785811, 0.06, 0.4,
+        // Gumbel(0, 1): the Euler-Mascheroni constant and π^2 / 6
+        0.5772156649015329, 1.6449340668482264, 0.02, 0.06
+      ];
+
+      for (let d = 0; d < 3; d++) {
+        if (d == 0) laplace53Array(2.0, 0.5, arr);
+        else if (d == 1) logistic53Array(-1.0, 2.0, arr);
+        else gumbel53Array(0.0, 1.0, arr);
+        const mean = sampleMean(arr);
+
+        expect(countInvalid(arr, -Infinity, Infinity, false)).toBe(0);
+        expect(Math.abs(mean - expected[4 * d])).toBeLessThan(expected[4 * d + 2]);
+        expect(Math.abs(sampleVariance(arr, mean) - expected[4 * d + 1])).toBeLessThan(expected[4 * d + 3]);
+      }
+
+      // half of Cauchy(1, 2) is within one scale of its location, with a standard error of ~0.0016
+      cauchy53Array(1.0, 2.0, arr);
+      let inside = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (Math.abs(arr[i] - 1.0) < 2.0) inside++;
+      }
+      expect(Math.abs(<f64>inside / <f64>arr.length - 0.5)).toBeLessThan(0.008);
+
+      // Weibull(2, 3) has mean 3 * Γ(1.5), with a standard error of ~0.0044
+      weibull53Array(2.0, 3.0, arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 2.658680776358274)).toBeLessThan(0.022);
+
+      // Pareto(4, 2) has mean 8 / 3, with a standard error of ~0.003
+      pareto53Array(4.0, 2.0, arr);
+      expect(countInvalid(arr, 2.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 8.0 / 3.0)).toBeLessThan(0.015);
+
+      let logisticSum = 0.0;
+      let weibullSum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        logisticSum += logistic53(5.0, 1.0);
+        weibullSum += weibull53(1.0, 2.0);
+        if (!isFinite(cauchy53(0.0, 1.0)) || !(pareto53(1.5, 3.0) >= 3.0)) invalid++;
+      }
+
+      // standard errors of ~0.018 and ~0.02
+      expect(invalid).toBe(0);
+      expect(Math.abs(logisticSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.09);
+      expect(Math.abs(weibullSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 2.0)).toBeLessThan(0.1);
+    });
+  });
+});
@@ -0,0 +1,78 @@
+/**
+ * SplitMix64 Seeder Tests
+ *
+ * Tests for the SplitMix64 implementation used to expand a single seed into seed collections.
+ *
+ * Test Strategy:
+ * - Validate output against the reference implementation (the same values as the JS SplitMix64 tests)
+ * - Verify array fills match single-value sequences, and continue the same sequence
+ * - Verify 64-bit wrapping of the state
+ *
+ * Contrast: This module only generates seeds for the other generators, so unlike the
+ * PRNG suites there are no float conversions or statistical smoke tests.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  setSeeds,
+  uint64,
+  uint64Array
+} from '../../prng/splitmix64';
+import {
+  DETERMINISTIC_SAMPLE_SIZE
+} from '../helpers/test-utils';
+
+describe('SplitMix64', () => {
+  describe('Reference Values', () => {
+    test('uint64 matches reference implementation', () => {
+      setSeeds(12345);
+
+      // Same values as the JS SplitMix64 'known output' test (reference splitmix64.c)
+      expect(uint64()).toBe(2454886589211414944);
+      expect(uint64()).toBe(3778200017661327597);
+      expect(uint64()).toBe(2205171434679333405);
+      expect(uint64()).toBe(3248800117070709450);
+      expect(uint64()).toBe(9350289611492784363);
+    });
+
+    test('state wraps at 64 bits', () => {
+      // 2^64 - GAMMA steps to a state of exactly 0, which mixes to 0
+      setSeeds(0 - <u64>0x9E3779B97F4A7C15);
+
+      expect(uint64()).toBe(0);
+      expect(uint64()).not.toBe(0);
+    });
+  });
+
+  describe('Array Fill Consistency', () => {
+    test('uint64Array should match repeated uint64 calls', () => {
+      setSeeds(12345);
+      const singleValues = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        singleValues[i] = uint64();
+      }
+
+      setSeeds(12345);
+      const arr = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr);
+
+      let mismatches = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] != singleValues[i]) mismatches++;
+      }
+      expect(mismatches).toBe(0); // Array fill must produce the same sequence
+    });
+
+    test('consecutive uint64Array calls continue the same sequence', () => {
+      setSeeds(12345);
+      const first = new Uint64Array(2);
+      const second = new Uint64Array(3);
+      uint64Array(first);
+      uint64Array(second);
+
+      expect(first[0]).toBe(2454886589211414944);
+      expect(second[0]).toBe(2205171434679333405); // 3rd value overall
+      expect(second[2]).toBe(9350289611492784363); // 5th value overall
+    });
+  });
+});
@@ -0,0 +1,850 @@
+/**
+ * Xoroshiro128Plus 4-lane SIMD PRNG Tests
+ *
+ * Tests for Xoroshiro128+ SIMDx4 (two interleaved dual-lane 128-bit state sets) PRNG implementation.
+ *
+ * Test Strategy:
+ * - Verify determinism and value ranges of single value and array methods
+ * - Verify each pair of lanes matches the 2-lane SIMD generator seeded with its half of the seeds
+ * - Test jump(), jumpTo(), longJump() and longJumpTo() against the 2-lane SIMD generator, with C reference validation
+ * - Test advance() against individual steps, with C reference validation
+ * - Distribution smoke tests (range and moments of each distribution family)
+ * - Statistical smoke tests (Monte Carlo π)
+ *
+ * Contrast: The 2-lane SIMD suite covers the algorithm in depth; this suite focuses on the
+ * 4-lane interleaving, which must not change any lane's sequence.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import {
+  setSeeds,
+  uint64,
+  float53,
+  uint64Array,
+  uint53AsFloatArray,
+  uint32AsFloatArray,
+  float53Array,
+  coord53Array,
+  coord53SquaredArray,
+  batchTestUnitCirclePoints,
+  jump,
+  jumpTo,
+  longJump,
+  longJumpTo,
+  advance,
+  intRange,
+  uint32Below,
+  intRangeArray,
+  uint32BelowArray,
+  smallIntRangeArray,
+  normal53,
+  normal53Array,
+  exponential53,
+  exponential53Array,
+  arrivalTimesArray,
+  gamma53,
+  gamma53Array,
+  beta53Array,
+  chiSquared53Array,
+  poisson,
+  binomial,
+  poissonArray,
+  binomialArray,
+  geometric,
+  geometricArray,
+  sparseBernoulliIndices,
+  randomGraphEdges,
+  zipf,
+  zipfArray,
+  aliasTableBuild,
+  categorical,
+  categoricalArray,
+  empiricalTableBuild,
+  empirical,
+  empiricalArray,
+  cauchy53,
+  cauchy53Array,
+  laplace53Array,
+  logistic53,
+  logistic53Array,
+  gumbel53Array,
+  weibull53,
+  weibull53Array,
+  pareto53,
+  pareto53Array
+} from '../../prng/xoroshiro128plus-simd-x4';
+
+// Import 2-lane SIMD functions for comparison tests
+import {
+  setSeeds as setSeedsSIMD,
+  uint64Array as uint64ArraySIMD,
+  float53Array as float53ArraySIMD,
+  jumpTo as jumpToSIMD,
+  longJumpTo as longJumpToSIMD
+} from '../../prng/xoroshiro128plus-simd';
+
+import {
+  TEST_SEEDS,
+  TEST_SEEDS_ALT,
+  DETERMINISTIC_SAMPLE_SIZE,
+  DISTRIBUTION_SAMPLE_SIZE,
+  PI_ESTIMATE_TOLERANCE,
+  PI,
+  BIT_63,
+  MAX_SAFE_INTEGER,
+  MAX_UINT32,
+  JUMP_REFERENCE,
+  JUMP_TO_STREAM_INDEX,
+  LONG_JUMP_TO_NODE_INDEX,
+  LONG_JUMP_REFERENCE,
+  ADVANCE_STEP_COUNT,
+  ADVANCE_SMALL_STEP_COUNT,
+  ADVANCE_REFERENCE,
+  NORMAL_MEAN_TOLERANCE,
+  NORMAL_VARIANCE_TOLERANCE,
+  EXPONENTIAL_MEAN_TOLERANCE,
+  EXPONENTIAL_VARIANCE_TOLERANCE,
+  sampleMean,
+  sampleVariance,
+  countInvalid
+} from '../helpers/test-utils';
+
+/** Applies this suite's default seeds to establish a known generator state at the start of each test. */
+function setupTest(): void {
+  setSeeds(
+    TEST_SEEDS.OCTET_0, TEST_SEEDS.OCTET_1, TEST_SEEDS.OCTET_2, TEST_SEEDS.OCTET_3,
+    TEST_SEEDS.OCTET_4, TEST_SEEDS.OCTET_5, TEST_SEEDS.OCTET_6, TEST_SEEDS.OCTET_7
+  );
+}
+
+/** Seeds the 2-lane SIMD generator with the first (lanes 0-1) half of this suite's default seeds. */
+function setupSIMDLanes01(): void {
+  setSeedsSIMD(TEST_SEEDS.OCTET_0, TEST_SEEDS.OCTET_1, TEST_SEEDS.OCTET_2, TEST_SEEDS.OCTET_3);
+}
+
+/** Seeds the 2-lane SIMD generator with the second (lanes 2-3) half of this suite's default seeds. */
+function setupSIMDLanes23(): void {
+  setSeedsSIMD(TEST_SEEDS.OCTET_4, TEST_SEEDS.OCTET_5, TEST_SEEDS.OCTET_6, TEST_SEEDS.OCTET_7);
+}
+
+/**
+ * Counts the values in a 4-lane array that differ from the 2-lane arrays for lanes 0-1 and 2-3.
+ * Each 4-lane step stores lanes 0 and 1, then lanes 2 and 3.
+ */
+function countLaneMismatches(x4: Uint64Array, lanes01: Uint64Array, lanes23: Uint64Array): i32 {
+  let mismatchCount = 0;
+  for (let i = 0; i < <i32>(x4.length / 4); i++) {
+    if (x4[i * 4] != lanes01[i * 2]) mismatchCount++;
+    if (x4[i * 4 + 1] != lanes01[i * 2 + 1]) mismatchCount++;
+    if (x4[i * 4 + 2] != lanes23[i * 2]) mismatchCount++;
+    if (x4[i * 4 + 3] != lanes23[i * 2 + 1]) mismatchCount++;
+  }
+  return mismatchCount;
+}
+
+describe('Xoroshiro128PlusSIMDx4', () => {
+  describe('Determinism', () => {
+    test('uint64Array produces identical sequence with same seeds', () => {
+      setupTest();
+      const arr1 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr1);
+
+      setupTest();
+      const arr2 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr2);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr1[i] != arr2[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // All values should match with same seeds
+    });
+
+    test('uint64Array produces different values with different seeds', () => {
+      setupTest();
+      const arr1 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr1);
+
+      setSeeds(
+        TEST_SEEDS_ALT.OCTET_0, TEST_SEEDS_ALT.OCTET_1, TEST_SEEDS_ALT.OCTET_2, TEST_SEEDS_ALT.OCTET_3,
+        TEST_SEEDS_ALT.OCTET_4, TEST_SEEDS_ALT.OCTET_5, TEST_SEEDS_ALT.OCTET_6, TEST_SEEDS_ALT.OCTET_7
+      );
+      const arr2 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr2);
+
+      let differentCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr1[i] != arr2[i]) {
+          differentCount++;
+        }
+      }
+
+      expect(differentCount).toBe(DETERMINISTIC_SAMPLE_SIZE); // All values differ with different seeds
+    });
+  });
+
+  describe('Array Methods', () => {
+    test('uint53AsFloatArray values are in correct range', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint53AsFloatArray(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < 0 || arr[i] > MAX_SAFE_INTEGER) {
+          outOfRange++;
+        }
+      }
+
+      expect(outOfRange).toBe(0); // All values in [0, 2^53-1]
+    });
+
+    test('uint32AsFloatArray values are in correct range', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint32AsFloatArray(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < 0 || arr[i] > MAX_UINT32) {
+          outOfRange++;
+        }
+      }
+
+      expect(outOfRange).toBe(0); // All values in [0, 2^32-1]
+    });
+
+    test('float53Array values are in correct range', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      float53Array(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < 0 || arr[i] >= 1) {
+          outOfRange++;
+        }
+      }
+
+      expect(outOfRange).toBe(0); // All values in [0, 1)
+    });
+
+    test('coord53Array values are in correct range', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      coord53Array(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < -1 || arr[i] >= 1) {
+          outOfRange++;
+        }
+      }
+
+      expect(outOfRange).toBe(0); // All values in [-1, 1)
+    });
+
+    test('coord53SquaredArray values are in correct range', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      coord53SquaredArray(arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] < 0 || arr[i] > 1) {
+          outOfRange++;
+        }
+      }
+
+      expect(outOfRange).toBe(0); // All values in [0, 1]
+    });
+
+    test('float53 matches lane 0 of float53Array', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      float53Array(arr);
+
+      setupTest();
+      let mismatchCount = 0;
+      for (let i = 0; i < <i32>(DETERMINISTIC_SAMPLE_SIZE / 4); i++) {
+        if (float53() != arr[i * 4]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // Single value methods step all lanes and return lane 0
+    });
+  });
+
+  describe('Lane Interleaving', () => {
+    test('uint64Array lanes match the 2-lane SIMD generator for each half of the seeds', () => {
+      setupSIMDLanes01();
+      const lanes01 = new Uint64Array(<i32>(DETERMINISTIC_SAMPLE_SIZE / 2));
+      uint64ArraySIMD(lanes01);
+
+      setupSIMDLanes23();
+      const lanes23 = new Uint64Array(<i32>(DETERMINISTIC_SAMPLE_SIZE / 2));
+      uint64ArraySIMD(lanes23);
+
+      setupTest();
+      const x4 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(x4);
+
+      expect(countLaneMismatches(x4, lanes01, lanes23)).toBe(0); // Interleaving does not change any lane's sequence
+    });
+
+    test('float53Array lanes match the 2-lane SIMD generator for each half of the seeds', () => {
+      setupSIMDLanes01();
+      const lanes01 = new Float64Array(<i32>(DETERMINISTIC_SAMPLE_SIZE / 2));
+      float53ArraySIMD(lanes01);
+
+      setupSIMDLanes23();
+      const lanes23 = new Float64Array(<i32>(DETERMINISTIC_SAMPLE_SIZE / 2));
+      float53ArraySIMD(lanes23);
+
+      setupTest();
+      const x4 = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      float53Array(x4);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < <i32>(DETERMINISTIC_SAMPLE_SIZE / 4); i++) {
+        if (x4[i * 4] != lanes01[i * 2]) mismatchCount++;
+        if (x4[i * 4 + 1] != lanes01[i * 2 + 1]) mismatchCount++;
+        if (x4[i * 4 + 2] != lanes23[i * 2]) mismatchCount++;
+        if (x4[i * 4 + 3] != lanes23[i * 2 + 1]) mismatchCount++;
+      }
+
+      expect(mismatchCount).toBe(0); // Interleaving does not change any lane's sequence
+    });
+
+    test('all 4 lanes produce different values', () => {
+      setupTest();
+      const arr = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(arr);
+
+      let duplicateCount = 0;
+      for (let i = 0; i < <i32>(DETERMINISTIC_SAMPLE_SIZE / 4); i++) {
+        for (let a = 0; a < 4; a++) {
+          for (let b = a + 1; b < 4; b++) {
+            if (arr[i * 4 + a] == arr[i * 4 + b]) {
+              duplicateCount++;
+            }
+          }
+        }
+      }
+
+      expect(duplicateCount).toBe(0); // Lanes with different seeds are independent
+    });
+  });
+
+  describe('Jump Function', () => {
+    test('jump matches C reference implementation', () => {
+      // Lane 0 uses the same seeds as the non-SIMD C reference
+      setupTest();
+      jump();
+
+      expect(uint64()).toBe(JUMP_REFERENCE.XOROSHIRO128PLUS); // Verified by validate-jump.c
+    });
+
+    test('jumpTo matches the 2-lane SIMD generator in every lane', () => {
+      setupSIMDLanes01();
+      jumpToSIMD(JUMP_TO_STREAM_INDEX);
+      const lanes01 = new Uint64Array(<i32>(DETERMINISTIC_SAMPLE_SIZE / 2));
+      uint64ArraySIMD(lanes01);
+
+      setupSIMDLanes23();
+      jumpToSIMD(JUMP_TO_STREAM_INDEX);
+      const lanes23 = new Uint64Array(<i32>(DETERMINISTIC_SAMPLE_SIZE / 2));
+      uint64ArraySIMD(lanes23);
+
+      setupTest();
+      jumpTo(JUMP_TO_STREAM_INDEX);
+      const x4 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(x4);
+
+      expect(countLaneMismatches(x4, lanes01, lanes23)).toBe(0); // Jumps apply to both state sets
+    });
+
+    test('jumpTo(0) leaves state unchanged', () => {
+      setupTest();
+      const expected = uint64();
+
+      setupTest();
+      jumpTo(0);
+
+      expect(uint64()).toBe(expected); // Stream 0 is the seeded stream
+    });
+
+    test('longJump matches C reference implementation', () => {
+      setupTest();
+      longJump();
+
+      expect(uint64()).toBe(LONG_JUMP_REFERENCE.XOROSHIRO128PLUS); // Verified by validate-jump.c
+    });
+
+    test('longJumpTo matches the 2-lane SIMD generator in every lane', () => {
+      setupSIMDLanes01();
+      longJumpToSIMD(LONG_JUMP_TO_NODE_INDEX);
+      const lanes01 = new Uint64Array(<i32>(DETERMINISTIC_SAMPLE_SIZE / 2));
+      uint64ArraySIMD(lanes01);
+
+      setupSIMDLanes23();
+      longJumpToSIMD(LONG_JUMP_TO_NODE_INDEX);
+      const lanes23 = new Uint64Array(<i32>(DETERMINISTIC_SAMPLE_SIZE / 2));
+      uint64ArraySIMD(lanes23);
+
+      setupTest();
+      longJumpTo(LONG_JUMP_TO_NODE_INDEX);
+      const x4 = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(x4);
+
+      expect(countLaneMismatches(x4, lanes01, lanes23)).toBe(0); // Long jumps apply to both state sets
+    });
+
+    test('longJumpTo then jumpTo matches C reference implementation', () => {
+      setupTest();
+      longJumpTo(LONG_JUMP_TO_NODE_INDEX);
+      jumpTo(JUMP_TO_STREAM_INDEX);
+
+      expect(uint64()).toBe(LONG_JUMP_REFERENCE.XOROSHIRO128PLUS_NODE_WORKER); // Verified by validate-jump.c
+    });
+  });
+
+  describe('Advance Function', () => {
+    test('advance(n) matches n individual steps (all lanes)', () => {
+      setupTest();
+      for (let i: u64 = 0; i < ADVANCE_STEP_COUNT; i++) {
+        uint64();
+      }
+      const stepped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(stepped);
+
+      setupTest();
+      advance(ADVANCE_STEP_COUNT);
+      const advanced = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(advanced);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (stepped[i] != advanced[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // advance() lands on the same state as stepping
+    });
+
+    test('advance(n) matches n individual steps for small n', () => {
+      setupTest();
+      for (let i: u64 = 0; i < ADVANCE_SMALL_STEP_COUNT; i++) {
+        uint64();
+      }
+      const expected = uint64();
+
+      setupTest();
+      advance(ADVANCE_SMALL_STEP_COUNT);
+
+      expect(uint64()).toBe(expected); // Small strides step directly
+    });
+
+    test('two advance(2^63) calls match jump()', () => {
+      setupTest();
+      jump();
+      const jumped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(jumped);
+
+      setupTest();
+      advance(BIT_63);
+      advance(BIT_63);
+      const advanced = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(advanced);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (jumped[i] != advanced[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // 2 * 2^63 steps is exactly one 2^64 step jump
+    });
+
+    test('advance(2^40) matches C reference implementation', () => {
+      setupTest();
+      advance(ADVANCE_REFERENCE.DELTA);
+
+      expect(uint64()).toBe(ADVANCE_REFERENCE.XOROSHIRO128PLUS); // Verified by validate-jump.c
+    });
+  });
+
+  describe('Statistical Smoke Tests', () => {
+    test('Monte Carlo π estimation (100K samples)', () => {
+      setupTest();
+
+      const inside = batchTestUnitCirclePoints(DISTRIBUTION_SAMPLE_SIZE);
+
+      expect(inside).toBeGreaterThanOrEqual(0); // Points inside circle in valid range [0, DISTRIBUTION_SAMPLE_SIZE]
+      expect(inside).toBeLessThanOrEqual(DISTRIBUTION_SAMPLE_SIZE);
+
+      const piEstimate = (4.0 * <f64>inside) / <f64>DISTRIBUTION_SAMPLE_SIZE;
+      const diff = piEstimate > PI
+        ? piEstimate - PI
+        : PI - piEstimate;
+
+      expect(diff).toBeLessThan(PI_ESTIMATE_TOLERANCE); // π estimation error: estimate within tolerance of actual value
+    });
+
+    test('batchTestUnitCirclePoints: determinism', () => {
+      setupTest();
+      const result1 = batchTestUnitCirclePoints(DETERMINISTIC_SAMPLE_SIZE);
+
+      setupTest();
+      const result2 = batchTestUnitCirclePoints(DETERMINISTIC_SAMPLE_SIZE);
+
+      expect(result1).toBe(result2); // Monte Carlo results are deterministic with same seeds
+    });
+  });
+
+  describe('Distribution Smoke Tests', () => {
+    test('bounded integers stay in range with uniform means', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // standard errors of the means are ~0.0054, ~0.0063 and ~0.91
+      intRangeArray(1, 6, arr);
+      expect(countInvalid(arr, 1.0, 6.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 3.5)).toBeLessThan(0.035);
+
+      smallIntRangeArray(-3, 3, arr);
+      expect(countInvalid(arr, -3.0, 3.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr))).toBeLessThan(0.04);
+
+      uint32BelowArray(1000, arr);
+      expect(countInvalid(arr, 0.0, 999.0, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 499.5)).toBeLessThan(5.0);
+
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const r = intRange(-5, 5);
+        if (r < -5 || r > 5) invalid++;
+        if (uint32Below(7) >= 7) invalid++;
+      }
+      expect(invalid).toBe(0);
+    });
+
+    test('normal53Array and normal53 have normal moments', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      normal53Array(0.0, 1.0, arr);
+      const mean = sampleMean(arr);
+
+      expect(countInvalid(arr, -Infinity, Infinity, false)).toBe(0);
+      expect(Math.abs(mean)).toBeLessThan(NORMAL_MEAN_TOLERANCE);
+      expect(Math.abs(sampleVariance(arr, mean) - 1.0)).toBeLessThan(NORMAL_VARIANCE_TOLERANCE);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += normal53(5.0, 2.0);
+      }
+
+      // standard error of ~0.02
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.12);
+    });
+
+    test('exponential53Array, exponential53 and arrivalTimesArray have mean 1 / rate', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      exponential53Array(1.0, arr);
+      const mean = sampleMean(arr);
+
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(mean - 1.0)).toBeLessThan(EXPONENTIAL_MEAN_TOLERANCE);
+      expect(Math.abs(sampleVariance(arr, mean) - 1.0)).toBeLessThan(EXPONENTIAL_VARIANCE_TOLERANCE);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += exponential53(4.0);
+      }
+
+      // standard error of ~0.0025
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.25)).toBeLessThan(0.015);
+
+      arrivalTimesArray(2.0, 10.0, arr);
+      let decreasing = arr[0] < 10.0 ? 1 : 0;
+      for (let i = 1; i < arr.length; i++) {
+        if (arr[i] < arr[i - 1]) decreasing++;
+      }
+
+      // mean gap 0.5, with a standard error of ~0.0016
+      expect(decreasing).toBe(0);
+      expect(Math.abs((arr[arr.length - 1] - 10.0) / <f64>arr.length - 0.5)).toBeLessThan(0.01);
+    });
+
+    test('gamma, beta and chi-squared numbers have the expected moments', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // standard errors of ~0.0047 and ~0.012
+      gamma53Array(9.0, 0.5, arr);
+      let mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(mean - 4.5)).toBeLessThan(0.03);
+      expect(Math.abs(sampleVariance(arr, mean) - 2.25)).toBeLessThan(0.07);
+
+      // shape 0.3 is boosted, with a standard error of ~0.0013
+      beta53Array(0.3, 0.3, arr);
+      expect(countInvalid(arr, 0.0, 1.0, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 0.5)).toBeLessThan(0.008);
+
+      // standard error of ~0.0089
+      chiSquared53Array(4.0, arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 4.0)).toBeLessThan(0.05);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += gamma53(0.5, 2.0);
+      }
+
+      // standard error of ~0.014
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.0)).toBeLessThan(0.08);
+    });
+
+    test('Poisson and binomial counts have the expected moments, by each algorithm', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // λ = 3.5 inverts and λ = 60 rejects, with standard errors of the means of ~0.006 and ~0.025
+      poissonArray(3.5, arr);
+      let mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(mean - 3.5)).toBeLessThan(0.03);
+      expect(Math.abs(sampleVariance(arr, mean) - 3.5)).toBeLessThan(0.36);
+
+      poissonArray(60.0, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(mean - 60.0)).toBeLessThan(0.12);
+      expect(Math.abs(sampleVariance(arr, mean) - 60.0)).toBeLessThan(1.44);
+
+      // n = 20 inverts and n = 1000 uses BTPE, with standard errors of the means of ~0.007 and ~0.043
+      binomialArray(20, 0.3, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, 20.0, true)).toBe(0);
+      expect(Math.abs(mean - 6.0)).toBeLessThan(0.035);
+      expect(Math.abs(sampleVariance(arr, mean) - 4.2)).toBeLessThan(0.63);
+
+      binomialArray(1000, 0.75, arr);
+      mean = sampleMean(arr);
+      expect(countInvalid(arr, 0.0, 1000.0, true)).toBe(0);
+      expect(Math.abs(mean - 750.0)).toBeLessThan(0.22);
+      expect(Math.abs(sampleVariance(arr, mean) - 187.5)).toBeLessThan(3.96);
+
+      let poissonSum = 0.0;
+      let binomialSum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        poissonSum += poisson(25.0);
+        binomialSum += binomial(100, 0.4);
+      }
+
+      // standard errors of the means are ~0.05 and ~0.05
+      expect(Math.abs(poissonSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 25.0)).toBeLessThan(0.25);
+      expect(Math.abs(binomialSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 40.0)).toBeLessThan(0.25);
+    });
+
+    test('geometric skips, sparse Bernoulli successes and random graph edges have the expected rates', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+
+      // mean 3, with a standard error of ~0.011
+      geometricArray(0.25, arr);
+      expect(countInvalid(arr, 0.0, Infinity, true)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 3.0)).toBeLessThan(0.06);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += geometric(0.5);
+      }
+
+      // mean 1, with a standard error of ~0.014
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.0)).toBeLessThan(0.07);
+
+      // about 5000 successes among a million trials, with a standard deviation of ~70
+      const successes = sparseBernoulliIndices(1000000.0, 0.005, 0.0, arr);
+      let decreasing = 0;
+      for (let i = 1; i < successes; i++) {
+        if (arr[i] <= arr[i - 1]) decreasing++;
+      }
+      expect(decreasing).toBe(0);
+      expect(Math.abs(<f64>successes - 5000.0)).toBeLessThan(350.0);
+      expect(sparseBernoulliIndices(60.0, 1.0, 10.0, arr)).toBe(50);
+
+      // 4995 edges expected among 499500 possible, with a standard deviation of ~70
+      const edges = randomGraphEdges(1000.0, 0.01, 0.0, arr);
+      let invalid = 0;
+      for (let i = 0; i < edges * 2; i += 2) {
+        if (!(arr[i] >= 0.0 && arr[i] < arr[i + 1] && arr[i + 1] < 1000.0)) invalid++;
+      }
+      expect(invalid).toBe(0);
+      expect(Math.abs(<f64>edges - 4995.0)).toBeLessThan(350.0);
+      expect(randomGraphEdges(5.0, 1.0, 0.0, arr)).toBe(10);
+    });
+
+    test('Zipf ranks stay in range at their expected rates', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      zipfArray(1e9, 1.0, arr);
+
+      let first = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] == 1.0) first++;
+      }
+
+      // rank 1 has probability 1 / H(1e9) ~ 0.0469, with a standard error of ~0.0007
+      expect(countInvalid(arr, 1.0, 1e9, true)).toBe(0);
+      expect(Math.abs(<f64>first / <f64>arr.length - 0.0469)).toBeLessThan(0.0035);
+
+      first = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (zipf(100.0, 2.0) == 1.0) first++;
+      }
+
+      // rank 1 has probability 1 / 1.635 ~ 0.612, with a standard error of ~0.005
+      expect(Math.abs(<f64>first / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.612)).toBeLessThan(0.025);
+    });
+
+    test('categories are drawn from an alias table in proportion to their weights', () => {
+      setupTest();
+      const weights = new Float64Array(4);
+      weights[0] = 1.0;
+      weights[2] = 3.0;
+      weights[3] = 6.0;
+      const table = new Uint64Array(4);
+      aliasTableBuild(weights, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      categoricalArray(table, arr);
+      const counts = new Float64Array(4);
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] >= 0.0 && arr[i] <= 3.0) counts[<i32>arr[i]] += 1.0;
+      }
+
+      // probabilities 0.1, 0, 0.3 and 0.6, with standard errors under 0.0016
+      const total = <f64>arr.length;
+      expect(countInvalid(arr, 0.0, 3.0, true)).toBe(0);
+      expect(counts[1]).toBe(0.0);
+      expect(Math.abs(counts[0] / total - 0.1)).toBeLessThan(0.008);
+      expect(Math.abs(counts[2] / total - 0.3)).toBeLessThan(0.008);
+      expect(Math.abs(counts[3] / total - 0.6)).toBeLessThan(0.008);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += categorical(table);
+      }
+
+      // mean 2.4, with a standard error of ~0.0092
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 2.4)).toBeLessThan(0.055);
+    });
+
+    test('values are drawn from a tabulated CDF, with its jumps and tails', () => {
+      setupTest();
+      // uniform over 0 to 10, a jump to 10, then uniform over 10 to 20 and a long tail to 100
+      const points = new Float64Array(10);
+      points[2] = 10.0;
+      points[3] = 0.2;
+      points[4] = 10.0;
+      points[5] = 0.5;
+      points[6] = 20.0;
+      points[7] = 0.9;
+      points[8] = 100.0;
+      points[9] = 1.0;
+      const table = new Float64Array(16);
+      empiricalTableBuild(points, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      empiricalArray(table, arr);
+      let jumps = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] == 10.0) jumps++;
+      }
+
+      // mean 16 and standard deviation ~16.95, for a standard error of ~0.054,
+      // and a jump with probability 0.3, with a standard error of ~0.0015
+      expect(countInvalid(arr, 0.0, 100.0, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 16.0)).toBeLessThan(0.3);
+      expect(Math.abs(<f64>jumps / <f64>arr.length - 0.3)).toBeLessThan(0.008);
+
+      let sum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const x = empirical(table);
+        if (!(x >= 0.0 && x <= 100.0)) invalid++;
+        sum += x;
+      }
+
+      // standard error of ~0.17
+      expect(invalid).toBe(0);
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 16.0)).toBeLessThan(0.9);
+    });
+
+    test('inverse transform numbers have the moments of their distributions', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      // mean, variance and their tolerances, each ~5 standard errors over 100000 draws
+      const expected: StaticArray<f64> = [
+        // Laplace(2, 0.5)
+        2.0, 0.5, 0.012, 0.02,
+        // logistic(-1, 2)
+        -1.0, 13.159472534785811, 0.06, 0.4,
+        // Gumbel(0, 1): the Euler-Mascheroni constant and π^2 / 6
+        0.5772156649015329, 1.6449340668482264, 0.02, 0.06
+      ];
+
+      for (let d = 0; d < 3; d++) {
+        if (d == 0) laplace53Array(2.0, 0.5, arr);
+        else if (d == 1) logistic53Array(-1.0, 2.0, arr);
+        else gumbel53Array(0.0, 1.0, arr);
+        const mean = sampleMean(arr);
+
+        expect(countInvalid(arr, -Infinity, Infinity, false)).toBe(0);
+        expect(Math.abs(mean - expected[4 * d])).toBeLessThan(expected[4 * d + 2]);
+        expect(Math.abs(sampleVariance(arr, mean) - expected[4 * d + 1])).toBeLessThan(expected[4 * d + 3]);
+      }
+
+      // half of Cauchy(1, 2) is within one scale of its location, with a standard error of ~0.0016
+      cauchy53Array(1.0, 2.0, arr);
+      let inside = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (Math.abs(arr[i] - 1.0) < 2.0) inside++;
+      }
+      expect(Math.abs(<f64>inside / <f64>arr.length - 0.5)).toBeLessThan(0.008);
+
+      // Weibull(2, 3) has mean 3 * Γ(1.5), with a standard error of ~0.0044
+      weibull53Array(2.0, 3.0, arr);
+      expect(countInvalid(arr, 0.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 2.658680776358274)).toBeLessThan(0.022);
+
+      // Pareto(4, 2) has mean 8 / 3, with a standard error of ~0.003
+      pareto53Array(4.0, 2.0, arr);
+      expect(countInvalid(arr, 2.0, Infinity, false)).toBe(0);
+      expect(Math.abs(sampleMean(arr) - 8.0 / 3.0)).toBeLessThan(0.015);
+
+      let logisticSum = 0.0;
+      let weibullSum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        logisticSum += logistic53(5.0, 1.0);
+        weibullSum += weibull53(1.0, 2.0);
+        if (!isFinite(cauchy53(0.0, 1.0)) || !(pareto53(1.5, 3.0) >= 3.0)) invalid++;
+      }
+
+      // standard errors of ~0.018 and ~0.02
+      expect(invalid).toBe(0);
+      expect(Math.abs(logisticSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.09);
+      expect(Math.abs(weibullSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 2.0)).toBeLessThan(0.1);
+    });
+  });
+});
@@ -4,11 +4,23 @@
  * Tests for Xoroshiro128+ (128-bit state, scalar) PRNG implementation.
  *
  * Test Strategy:
+ * - Verify bounded integers (uint32Below, intRange) stay in range and are uniform, even under heavy rejection
+ * - Verify smallIntRangeArray recycles each output into many unbiased small-range integers
+ * - Verify normal53 and normal53Array have standard normal moments, including the ziggurat tail
+ * - Verify exponential53 and exponential53Array have mean 1 / rate, and arrivalTimesArray accumulates them
+ * - Verify gamma, beta and chi-squared numbers have the expected moments, including boosted shapes below 1
+ * - Verify Poisson and binomial counts have the expected moments on both sides of each algorithm switch
+ * - Verify geometric skips find sparse Bernoulli successes and random graph edges at the expected rates
+ * - Verify Zipf ranks stay in range and hit their expected rates, over up to a billion ranks
+ * - Verify categories are drawn from alias tables in proportion to their weights
+ * - Verify values are drawn from tabulated CDFs, across their jumps and long tails
+ * - Verify Cauchy, Laplace, logistic, Gumbel, Weibull and Pareto numbers match their distributions
  * - Verify determinism with larger sample sequences (vs integration's smaller samples)
  * - Test quality metrics (uniqueness, full range usage) on larger samples
  * - Validate all output formats (uint64, floats, coords) at WASM level
  * - Verify array methods match single-value sequences (stream consistency)
- * - Test jump() for parallel stream generation with C reference validation
+ * - Test jump(), jumpTo(), longJump() and longJumpTo() for parallel stream generation with C reference validation
+ * - Test advance() against individual steps, with C reference validation
  * - Statistical smoke tests (quartile distribution, Monte Carlo π)
  *
  * Contrast: These are deep WASM-level tests with larger sample sizes testing the raw
@@ -32,13 +44,65 @@ import {
   coord53Array,
   coord53SquaredArray,
   batchTestUnitCirclePoints,
-  jump
+  jump,
+  jumpTo,
+  longJump,
+  longJumpTo,
+  advance,
+  uint32Below,
+  intRange,
+  uint32BelowArray,
+  intRangeArray,
+  smallIntRangeArray,
+  normal53,
+  normal53Array,
+  exponential53,
+  exponential53Array,
+  arrivalTimesArray,
+  gamma53,
+  gamma53Array,
+  beta53,
+  beta53Array,
+  chiSquared53,
+  chiSquared53Array,
+  poisson,
+  binomial,
+  poissonArray,
+  binomialArray,
+  geometric,
+  geometricArray,
+  sparseBernoulliIndices,
+  randomGraphEdges,
+  zipf,
+  zipfArray,
+  aliasTableBuild,
+  categorical,
+  categoricalArray,
+  empiricalTableBuild,
+  empirical,
+  empiricalArray,
+  cauchy53,
+  laplace53,
+  logistic53,
+  gumbel53,
+  weibull53,
+  pareto53,
+  cauchy53Array,
+  laplace53Array,
+  logistic53Array,
+  gumbel53Array,
+  weibull53Array,
+  pareto53Array
 } from '../../prng/xoroshiro128plus';
 import {
   TEST_SEEDS,
   TEST_SEEDS_ALT,
   DETERMINISTIC_SAMPLE_SIZE,
   DISTRIBUTION_SAMPLE_SIZE,
+  NORMAL_MEAN_TOLERANCE,
+  NORMAL_VARIANCE_TOLERANCE,
+  EXPONENTIAL_MEAN_TOLERANCE,
+  EXPONENTIAL_VARIANCE_TOLERANCE,
   QUARTILE_MIN,
   QUARTILE_MAX,
   PI_ESTIMATE_TOLERANCE,
@@ -49,7 +113,13 @@ import {
   U64_Q3_MAX,
   MAX_SAFE_INTEGER,
   MAX_UINT32,
-  JUMP_REFERENCE
+  JUMP_REFERENCE,
+  JUMP_TO_STREAM_INDEX,
+  LONG_JUMP_TO_NODE_INDEX,
+  LONG_JUMP_REFERENCE,
+  ADVANCE_STEP_COUNT,
+  ADVANCE_SMALL_STEP_COUNT,
+  ADVANCE_REFERENCE
 } from '../helpers/test-utils';
 
 /** Applies this suite's default seeds to establish a known generator state at the start of each test. */
@@ -501,6 +571,178 @@ describe('Xoroshiro128Plus', () => {
 
       expect(result).toBe(JUMP_REFERENCE.XOROSHIRO128PLUS); // Must match C reference implementation
     });
+
+    test('jumpTo matches repeated jump calls', () => {
+      setupTest();
+
+      for (let i: u64 = 0; i < JUMP_TO_STREAM_INDEX; i++) {
+        jump();
+      }
+      const jumped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(jumped);
+
+      setSeeds(TEST_SEEDS.DOUBLE_0, TEST_SEEDS.DOUBLE_1);
+      jumpTo(JUMP_TO_STREAM_INDEX);
+      const jumpedTo = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(jumpedTo);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (jumped[i] != jumpedTo[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // jumpTo(k) selects the same stream as k calls to jump()
+    });
+
+    test('jumpTo(0) leaves state unchanged', () => {
+      setupTest();
+
+      const expected = uint64();
+
+      setSeeds(TEST_SEEDS.DOUBLE_0, TEST_SEEDS.DOUBLE_1);
+      jumpTo(0);
+
+      expect(uint64()).toBe(expected); // Stream 0 is the seeded stream
+    });
+
+    test('longJump matches C reference implementation', () => {
+      setupTest();
+      longJump();
+
+      expect(uint64()).toBe(LONG_JUMP_REFERENCE.XOROSHIRO128PLUS); // Verified by validate-jump.c
+    });
+
+    test('longJumpTo matches repeated longJump calls', () => {
+      setupTest();
+      for (let i: u64 = 0; i < LONG_JUMP_TO_NODE_INDEX; i++) {
+        longJump();
+      }
+      const longJumped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(longJumped);
+
+      setupTest();
+      longJumpTo(LONG_JUMP_TO_NODE_INDEX);
+      const longJumpedTo = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(longJumpedTo);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (longJumped[i] != longJumpedTo[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // longJumpTo(k) selects the same starting point as k calls to longJump()
+    });
+
+    test('longJump matches 2^32 jump calls', () => {
+      setupTest();
+      longJump();
+      const longJumped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(longJumped);
+
+      setupTest();
+      jumpTo(<u64>1 << 32);
+      const jumped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(jumped);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (longJumped[i] != jumped[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // 2^96 steps is exactly 2^32 jumps of 2^64 steps
+    });
+
+    test('longJumpTo then jumpTo matches C reference implementation', () => {
+      setupTest();
+      longJumpTo(LONG_JUMP_TO_NODE_INDEX);
+      jumpTo(JUMP_TO_STREAM_INDEX);
+
+      expect(uint64()).toBe(LONG_JUMP_REFERENCE.XOROSHIRO128PLUS_NODE_WORKER); // Verified by validate-jump.c
+    });
+  });
+
+  describe('Advance Function', () => {
+    test('advance(n) matches n individual steps', () => {
+      setupTest();
+      for (let i: u64 = 0; i < ADVANCE_STEP_COUNT; i++) {
+        uint64();
+      }
+      const stepped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(stepped);
+
+      setSeeds(TEST_SEEDS.DOUBLE_0, TEST_SEEDS.DOUBLE_1);
+      advance(ADVANCE_STEP_COUNT);
+      const advanced = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(advanced);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (stepped[i] != advanced[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // advance() lands on the same state as stepping
+    });
+
+    test('advance(n) matches n individual steps for small n', () => {
+      setupTest();
+      for (let i: u64 = 0; i < ADVANCE_SMALL_STEP_COUNT; i++) {
+        uint64();
+      }
+      const expected = uint64();
+
+      setSeeds(TEST_SEEDS.DOUBLE_0, TEST_SEEDS.DOUBLE_1);
+      advance(ADVANCE_SMALL_STEP_COUNT);
+
+      expect(uint64()).toBe(expected); // Small strides step directly
+    });
+
+    test('advance(0) leaves state unchanged', () => {
+      setupTest();
+
+      const expected = uint64();
+
+      setSeeds(TEST_SEEDS.DOUBLE_0, TEST_SEEDS.DOUBLE_1);
+      advance(0);
+
+      expect(uint64()).toBe(expected); // No-op advance
+    });
+
+    test('two advance(2^63) calls match jump()', () => {
+      setupTest();
+      jump();
+      const jumped = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(jumped);
+
+      setSeeds(TEST_SEEDS.DOUBLE_0, TEST_SEEDS.DOUBLE_1);
+      advance(BIT_63);
+      advance(BIT_63);
+      const advanced = new Uint64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint64Array(advanced);
+
+      let mismatchCount = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (jumped[i] != advanced[i]) {
+          mismatchCount++;
+        }
+      }
+
+      expect(mismatchCount).toBe(0); // 2 * 2^63 steps is exactly one 2^64 step jump
+    });
+
+    test('advance(2^40) matches C reference implementation', () => {
+      setupTest();
+      advance(ADVANCE_REFERENCE.DELTA);
+
+      expect(uint64()).toBe(ADVANCE_REFERENCE.XOROSHIRO128PLUS); // Verified by validate-jump.c
+    });
   });
 
   describe('Statistical Smoke Tests', () => {
@@ -555,4 +797,851 @@ describe('Xoroshiro128Plus', () => {
       expect(result1).toBe(result2); // Monte Carlo results are deterministic with same seeds
     });
   });
+
+  describe('Bounded Integers', () => {
+    test('uint32Below values are in [0, bound)', () => {
+      setupTest();
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (uint32Below(6) >= 6) outOfRange++;
+      }
+
+      expect(outOfRange).toBe(0);
+    });
+
+    test('uint32Below(1) always returns 0', () => {
+      setupTest();
+      let nonZero = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (uint32Below(1) != 0) nonZero++;
+      }
+
+      expect(nonZero).toBe(0);
+    });
+
+    test('uint32Below is uniform when half of all products are rejected', () => {
+      // 2^32 mod (2^31 + 1) is 2^31 - 1, so nearly half of all draws are redrawn
+      setupTest();
+      const bound: u32 = 0x80000001;
+      let upperHalf = 0;
+      for (let i = 0; i < DISTRIBUTION_SAMPLE_SIZE; i++) {
+        const value = uint32Below(bound);
+        expect(value).toBeLessThan(bound);
+        if (value >= 0x40000000) upperHalf++;
+      }
+
+      expect(upperHalf).toBeGreaterThan(49000); // ~50% of 100K (±6 standard deviations)
+      expect(upperHalf).toBeLessThan(51000);
+    });
+
+    test('intRange covers every value of a small range evenly', () => {
+      setupTest();
+      const counts = new StaticArray<i32>(6);
+      for (let i = 0; i < DISTRIBUTION_SAMPLE_SIZE; i++) {
+        const roll = intRange(1, 6);
+        expect(roll).toBeGreaterThanOrEqual(1);
+        expect(roll).toBeLessThanOrEqual(6);
+        counts[roll - 1]++;
+      }
+
+      for (let i = 0; i < 6; i++) {
+        expect(counts[i]).toBeGreaterThan(16000); // ~16667 each (±6 standard deviations)
+        expect(counts[i]).toBeLessThan(17400);
+      }
+    });
+
+    test('intRange supports negative and full i32 ranges', () => {
+      setupTest();
+      let negative = 0;
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const value = intRange(-10, 10);
+        if (value < -10 || value > 10) outOfRange++;
+        if (intRange(i32.MIN_VALUE, i32.MAX_VALUE) < 0) negative++;
+      }
+
+      expect(outOfRange).toBe(0);
+      expect(negative).toBeGreaterThan(0); // Full range reaches both signs
+      expect(negative).toBeLessThan(DETERMINISTIC_SAMPLE_SIZE);
+      expect(intRange(7, 7)).toBe(7);
+    });
+
+    test('intRangeArray matches repeated intRange calls', () => {
+      setupTest();
+      const expected = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        expected[i] = <f64>intRange(-3, 100);
+      }
+
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      intRangeArray(-3, 100, arr);
+
+      let mismatches = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] != expected[i]) mismatches++;
+      }
+      expect(mismatches).toBe(0); // Array fill must produce the same sequence
+    });
+
+    test('uint32BelowArray values are in [0, bound)', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      uint32BelowArray(52, arr);
+
+      let outOfRange = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] < 0 || arr[i] >= 52 || arr[i] != Math.floor(arr[i])) outOfRange++;
+      }
+      expect(outOfRange).toBe(0);
+    });
+
+    test('smallIntRangeArray rolls dice evenly', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      smallIntRangeArray(1, 6, arr);
+
+      const counts = new StaticArray<i32>(6);
+      let outOfRange = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (arr[i] < 1 || arr[i] > 6 || arr[i] != Math.floor(arr[i])) {
+          outOfRange++;
+        } else {
+          counts[<i32>arr[i] - 1]++;
+        }
+      }
+
+      expect(outOfRange).toBe(0);
+      for (let i = 0; i < 6; i++) {
+        expect(counts[i]).toBeGreaterThan(16000); // ~16667 each (±6 standard deviations)
+        expect(counts[i]).toBeLessThan(17400);
+      }
+    });
+
+    test('smallIntRangeArray produces deterministic sequences for negative and single-value ranges', () => {
+      setupTest();
+      const arr1 = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      smallIntRangeArray(-26, 25, arr1);
+
+      setupTest();
+      const arr2 = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      smallIntRangeArray(-26, 25, arr2);
+
+      let mismatches = 0;
+      let outOfRange = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr1[i] != arr2[i]) mismatches++;
+        if (arr1[i] < -26 || arr1[i] > 25) outOfRange++;
+      }
+      expect(mismatches).toBe(0); // Same seeds, same sequence
+      expect(outOfRange).toBe(0);
+
+      smallIntRangeArray(7, 7, arr1);
+      let notSeven = 0;
+      for (let i = 0; i < arr1.length; i++) {
+        if (arr1[i] != 7) notSeven++;
+      }
+      expect(notSeven).toBe(0);
+    });
+
+    test('smallIntRangeArray extracts many dice rolls from each output', () => {
+      // 460 rolls need 460 outputs without recycling, but only ~20 with 23 rolls per output
+      setupTest();
+      const arr = new Float64Array(460);
+      smallIntRangeArray(1, 6, arr);
+      const next = uint64();
+
+      setupTest();
+      let outputsUsed = 0;
+      while (outputsUsed < 100 && uint64() != next) outputsUsed++;
+
+      expect(outputsUsed).toBeGreaterThan(0);
+      expect(outputsUsed).toBeLessThan(40);
+    });
+  });
+
+  describe('Normal Distribution', () => {
+    test('normal53Array has standard normal moments', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      normal53Array(0.0, 1.0, arr);
+
+      let sum = 0.0;
+      let sumSquares = 0.0;
+      let withinOne = 0;
+      let pastTail = 0;
+      for (let i = 0; i < arr.length; i++) {
+        sum += arr[i];
+        sumSquares += arr[i] * arr[i];
+        if (Math.abs(arr[i]) < 1.0) withinOne++;
+        if (Math.abs(arr[i]) > 3.6541528853610075) pastTail++;
+      }
+      const mean = sum / <f64>arr.length;
+
+      expect(Math.abs(mean)).toBeLessThan(NORMAL_MEAN_TOLERANCE);
+      expect(Math.abs(sumSquares / <f64>arr.length - mean * mean - 1.0)).toBeLessThan(NORMAL_VARIANCE_TOLERANCE);
+      expect(withinOne).toBeGreaterThan(67370); // ~68.27% (±6 standard deviations)
+      expect(withinOne).toBeLessThan(69170);
+      expect(pastTail).toBeGreaterThan(5); // ~26 expected from the tail
+    });
+
+    test('normal53Array scales by mean and standard deviation', () => {
+      setupTest();
+      const standard = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      normal53Array(0.0, 1.0, standard);
+
+      setupTest();
+      const scaled = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      normal53Array(100.0, 15.0, scaled);
+
+      let mismatches = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (Math.abs(scaled[i] - (100.0 + 15.0 * standard[i])) > 1e-12) mismatches++;
+      }
+      expect(mismatches).toBe(0); // Same draws, scaled
+    });
+
+    test('normal53 has standard normal moments', () => {
+      setupTest();
+      let sum = 0.0;
+      let sumSquares = 0.0;
+      for (let i = 0; i < DISTRIBUTION_SAMPLE_SIZE; i++) {
+        const value = normal53(0.0, 1.0);
+        sum += value;
+        sumSquares += value * value;
+      }
+      const mean = sum / <f64>DISTRIBUTION_SAMPLE_SIZE;
+
+      expect(Math.abs(mean)).toBeLessThan(NORMAL_MEAN_TOLERANCE);
+      expect(Math.abs(sumSquares / <f64>DISTRIBUTION_SAMPLE_SIZE - mean * mean - 1.0)).toBeLessThan(NORMAL_VARIANCE_TOLERANCE);
+    });
+
+    test('normal53Array matches repeated normal53 calls', () => {
+      setupTest();
+      const expected = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        expected[i] = normal53(5.0, 2.0);
+      }
+
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      normal53Array(5.0, 2.0, arr);
+
+      let mismatches = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr[i] != expected[i]) mismatches++;
+      }
+      expect(mismatches).toBe(0); // Array fill must produce the same sequence
+    });
+  });
+
+  describe('Exponential Distribution', () => {
+    test('exponential53Array has rate 1 moments, including the ziggurat tail', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      exponential53Array(1.0, arr);
+
+      let sum = 0.0;
+      let sumSquares = 0.0;
+      let negative = 0;
+      let pastTail = 0;
+      for (let i = 0; i < arr.length; i++) {
+        sum += arr[i];
+        sumSquares += arr[i] * arr[i];
+        if (arr[i] < 0.0) negative++;
+        if (arr[i] > 7.697117470131051) pastTail++;
+      }
+      const mean = sum / <f64>arr.length;
+
+      expect(negative).toBe(0);
+      expect(Math.abs(mean - 1.0)).toBeLessThan(EXPONENTIAL_MEAN_TOLERANCE);
+      expect(Math.abs(sumSquares / <f64>arr.length - mean * mean - 1.0)).toBeLessThan(EXPONENTIAL_VARIANCE_TOLERANCE);
+      expect(pastTail).toBeGreaterThan(15); // ~45 expected from the tail
+    });
+
+    test('exponential53 has mean 1 / rate', () => {
+      setupTest();
+      let sum = 0.0;
+      for (let i = 0; i < DISTRIBUTION_SAMPLE_SIZE; i++) {
+        sum += exponential53(4.0);
+      }
+
+      expect(Math.abs(sum / <f64>DISTRIBUTION_SAMPLE_SIZE - 0.25)).toBeLessThan(EXPONENTIAL_MEAN_TOLERANCE / 4.0);
+    });
+
+    test('arrivalTimesArray is the running total of exponential53Array gaps, from t0', () => {
+      setupTest();
+      const gaps = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      exponential53Array(0.5, gaps);
+
+      setupTest();
+      const times = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      arrivalTimesArray(0.5, 100.0, times);
+
+      let time = 100.0;
+      let mismatches = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        time += gaps[i];
+        // SIMD generators sum each pair's gaps before adding them to the time so far
+        if (Math.abs(times[i] - time) > 1e-9 * time) mismatches++;
+        if (i > 0 && times[i] < times[i - 1]) mismatches++;
+      }
+      expect(mismatches).toBe(0); // Same draws, accumulated in order
+    });
+
+    test('arrivalTimesArray continues a timeline from the previous call', () => {
+      setupTest();
+      const whole = new Float64Array(DETERMINISTIC_SAMPLE_SIZE * 2);
+      arrivalTimesArray(3.0, 0.0, whole);
+
+      setupTest();
+      const first = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      const second = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      arrivalTimesArray(3.0, 0.0, first);
+      arrivalTimesArray(3.0, first[DETERMINISTIC_SAMPLE_SIZE - 1], second);
+
+      expect(first[DETERMINISTIC_SAMPLE_SIZE - 1]).toBe(whole[DETERMINISTIC_SAMPLE_SIZE - 1]);
+      expect(second[DETERMINISTIC_SAMPLE_SIZE - 1]).toBe(whole[DETERMINISTIC_SAMPLE_SIZE * 2 - 1]);
+    });
+  });
+
+  describe('Gamma, Beta and Chi-squared Distributions', () => {
+    test('gamma53Array has the mean and variance of its shape and scale', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      gamma53Array(9.0, 0.5, arr);
+
+      let sum = 0.0;
+      let sumSquares = 0.0;
+      let nonPositive = 0;
+      for (let i = 0; i < arr.length; i++) {
+        sum += arr[i];
+        sumSquares += arr[i] * arr[i];
+        if (!(arr[i] > 0.0)) nonPositive++;
+      }
+      const mean = sum / <f64>arr.length;
+
+      // mean 4.5 and variance 2.25, with standard errors of ~0.005 and ~0.012
+      expect(nonPositive).toBe(0);
+      expect(Math.abs(mean - 4.5)).toBeLessThan(0.03);
+      expect(Math.abs(sumSquares / <f64>arr.length - mean * mean - 2.25)).toBeLessThan(0.07);
+    });
+
+    test('gamma53Array boosts shapes below 1', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      gamma53Array(0.5, 1.0, arr);
+
+      let sum = 0.0;
+      let negative = 0;
+      for (let i = 0; i < arr.length; i++) {
+        sum += arr[i];
+        if (!(arr[i] >= 0.0)) negative++;
+      }
+
+      // mean 0.5, with a standard error of ~0.0022
+      expect(negative).toBe(0);
+      expect(Math.abs(sum / <f64>arr.length - 0.5)).toBeLessThan(0.015);
+    });
+
+    test('beta53Array stays in [0, 1] with mean a / (a + b), including boosted shapes', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      const shapes: StaticArray<f64> = [2.0, 6.0, 0.3, 0.3];
+
+      for (let s = 0; s < shapes.length; s += 2) {
+        beta53Array(shapes[s], shapes[s + 1], arr);
+
+        let sum = 0.0;
+        let outside = 0;
+        for (let i = 0; i < arr.length; i++) {
+          sum += arr[i];
+          if (!(arr[i] >= 0.0 && arr[i] <= 1.0)) outside++;
+        }
+
+        // standard errors of the means are ~0.0005 and ~0.0013
+        expect(outside).toBe(0);
+        expect(Math.abs(sum / <f64>arr.length - shapes[s] / (shapes[s] + shapes[s + 1]))).toBeLessThan(0.008);
+      }
+    });
+
+    test('chiSquared53Array is gamma53Array with shape k / 2 and scale 2', () => {
+      setupTest();
+      const chiSquared = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      chiSquared53Array(5.0, chiSquared);
+
+      setupTest();
+      const gamma = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      gamma53Array(2.5, 2.0, gamma);
+
+      let mismatches = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (chiSquared[i] != gamma[i]) mismatches++;
+      }
+      expect(mismatches).toBe(0); // Same draws
+    });
+
+    test('gamma53, beta53 and chiSquared53 have the expected means', () => {
+      setupTest();
+      let gammaSum = 0.0;
+      let betaSum = 0.0;
+      let chiSquaredSum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        gammaSum += gamma53(3.0, 2.0);
+        betaSum += beta53(2.0, 6.0);
+        chiSquaredSum += chiSquared53(5.0);
+      }
+
+      // standard errors of the means are ~0.035, ~0.0015 and ~0.032
+      expect(Math.abs(gammaSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 6.0)).toBeLessThan(0.2);
+      expect(Math.abs(betaSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.25)).toBeLessThan(0.01);
+      expect(Math.abs(chiSquaredSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.2);
+    });
+
+    test('beta53Array produces deterministic sequences', () => {
+      setupTest();
+      const arr1 = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      beta53Array(0.5, 3.0, arr1);
+
+      setupTest();
+      const arr2 = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      beta53Array(0.5, 3.0, arr2);
+
+      let mismatches = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        if (arr1[i] != arr2[i]) mismatches++;
+      }
+      expect(mismatches).toBe(0); // Same seeds, same sequence
+    });
+  });
+
+  describe('Poisson and Binomial Distributions', () => {
+    test('poissonArray has mean and variance λ, by inversion and by rejection', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      const lambdas: StaticArray<f64> = [3.5, 60.0];
+      const tolerances: StaticArray<f64> = [0.03, 0.12];
+
+      for (let l = 0; l < lambdas.length; l++) {
+        const lambda = lambdas[l];
+        poissonArray(lambda, arr);
+
+        let sum = 0.0;
+        let sumSquares = 0.0;
+        let invalid = 0;
+        for (let i = 0; i < arr.length; i++) {
+          sum += arr[i];
+          sumSquares += arr[i] * arr[i];
+          if (!(arr[i] >= 0.0 && arr[i] == Math.floor(arr[i]))) invalid++;
+        }
+        const mean = sum / <f64>arr.length;
+
+        // standard errors of the means are ~0.006 and ~0.025, and of the variances ~0.02 and ~0.28
+        expect(invalid).toBe(0);
+        expect(Math.abs(mean - lambda)).toBeLessThan(tolerances[l]);
+        expect(Math.abs(sumSquares / <f64>arr.length - mean * mean - lambda)).toBeLessThan(tolerances[l] * 12.0);
+      }
+    });
+
+    test('binomialArray has mean np and variance npq, by inversion and by BTPE', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      const ns: StaticArray<i32> = [20, 1000];
+      const ps: StaticArray<f64> = [0.3, 0.75];
+      const tolerances: StaticArray<f64> = [0.035, 0.22];
+
+      for (let c = 0; c < ns.length; c++) {
+        const n = <f64>ns[c];
+        const p = ps[c];
+        binomialArray(ns[c], p, arr);
+
+        let sum = 0.0;
+        let sumSquares = 0.0;
+        let invalid = 0;
+        for (let i = 0; i < arr.length; i++) {
+          sum += arr[i];
+          sumSquares += arr[i] * arr[i];
+          if (!(arr[i] >= 0.0 && arr[i] <= n && arr[i] == Math.floor(arr[i]))) invalid++;
+        }
+        const mean = sum / <f64>arr.length;
+
+        // standard errors of the means are ~0.007 and ~0.043, and of the variances ~0.02 and ~0.84
+        expect(invalid).toBe(0);
+        expect(Math.abs(mean - n * p)).toBeLessThan(tolerances[c]);
+        expect(Math.abs(sumSquares / <f64>arr.length - mean * mean - n * p * (1.0 - p))).toBeLessThan(tolerances[c] * 18.0);
+      }
+    });
+
+    test('degenerate parameters always give 0 or n', () => {
+      setupTest();
+      const arr = new Float64Array(DETERMINISTIC_SAMPLE_SIZE);
+      let mismatches = 0;
+
+      poissonArray(0.0, arr);
+      for (let i = 0; i < arr.length; i++) if (arr[i] != 0.0) mismatches++;
+      binomialArray(7, 1.0, arr);
+      for (let i = 0; i < arr.length; i++) if (arr[i] != 7.0) mismatches++;
+      binomialArray(7, 0.0, arr);
+      for (let i = 0; i < arr.length; i++) if (arr[i] != 0.0) mismatches++;
+
+      expect(mismatches).toBe(0);
+    });
+
+    test('poisson and binomial have the expected means', () => {
+      setupTest();
+      let poissonSum = 0.0;
+      let binomialSum = 0.0;
+
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        poissonSum += poisson(25.0);
+        binomialSum += binomial(100, 0.4);
+      }
+
+      // standard errors of the means are ~0.05 and ~0.05
+      expect(Math.abs(poissonSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 25.0)).toBeLessThan(0.25);
+      expect(Math.abs(binomialSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 40.0)).toBeLessThan(0.25);
+    });
+  });
+
+  describe('Geometric Skips, Sparse Bernoulli Trials and Random Graphs', () => {
+    test('geometricArray has mean (1 - p) / p', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      geometricArray(0.25, arr);
+
+      let sum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < arr.length; i++) {
+        sum += arr[i];
+        if (!(arr[i] >= 0.0 && arr[i] == Math.floor(arr[i]))) invalid++;
+      }
+
+      // mean 3, with a standard error of ~0.011
+      expect(invalid).toBe(0);
+      expect(Math.abs(sum / <f64>arr.length - 3.0)).toBeLessThan(0.06);
+    });
+
+    test('sparseBernoulliIndices finds increasing successes at rate p, and continues from start', () => {
+      setupTest();
+      const arr = new Float64Array(1000);
+      let last: f64 = -1.0;
+      let total = 0;
+      let decreasing = 0;
+      let count = 0;
+
+      // about 5000 successes among a million trials, 1000 at a time
+      do {
+        count = sparseBernoulliIndices(1000000.0, 0.005, last + 1.0, arr);
+        for (let i = 0; i < count; i++) {
+          if (!(arr[i] > last && arr[i] < 1000000.0)) decreasing++;
+          last = arr[i];
+        }
+        total += count;
+      } while (count == arr.length);
+
+      // standard deviation of ~70
+      expect(decreasing).toBe(0);
+      expect(Math.abs(<f64>total - 5000.0)).toBeLessThan(350.0);
+    });
+
+    test('sparseBernoulliIndices finds every trial for p = 1 and none for p = 0', () => {
+      setupTest();
+      const arr = new Float64Array(100);
+
+      expect(sparseBernoulliIndices(60.0, 1.0, 10.0, arr)).toBe(50);
+      expect(arr[0]).toBe(10.0);
+      expect(arr[49]).toBe(59.0);
+      expect(sparseBernoulliIndices(1000000.0, 0.0, 0.0, arr)).toBe(0);
+    });
+
+    test('randomGraphEdges lists each edge of a complete graph once for p = 1', () => {
+      setupTest();
+      const arr = new Float64Array(100);
+
+      expect(randomGraphEdges(5.0, 1.0, 0.0, arr)).toBe(10);
+      const expected: StaticArray<f64> = [0, 1, 0, 2, 1, 2, 0, 3, 1, 3, 2, 3, 0, 4, 1, 4, 2, 4, 3, 4];
+      let mismatches = 0;
+      for (let i = 0; i < expected.length; i++) {
+        if (arr[i] != expected[i]) mismatches++;
+      }
+      expect(mismatches).toBe(0);
+    });
+
+    test('randomGraphEdges includes edges at rate p', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      const count = randomGraphEdges(1000.0, 0.01, 0.0, arr);
+
+      let invalid = 0;
+      for (let i = 0; i < count * 2; i += 2) {
+        if (!(arr[i] >= 0.0 && arr[i] < arr[i + 1] && arr[i + 1] < 1000.0)) invalid++;
+      }
+
+      // 4995 edges expected among 499500 possible, with a standard deviation of ~70
+      expect(invalid).toBe(0);
+      expect(Math.abs(<f64>count - 4995.0)).toBeLessThan(350.0);
+    });
+
+    test('geometric has mean (1 - p) / p', () => {
+      setupTest();
+      let sum = 0.0;
+
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += geometric(0.5);
+      }
+
+      // mean 1, with a standard error of ~0.014
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.0)).toBeLessThan(0.07);
+    });
+  });
+
+  describe('Zipf Output', () => {
+    test('zipfArray draws integer ranks in range, a billion of them, at their expected rates', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      zipfArray(1e9, 1.0, arr);
+
+      let invalid = 0;
+      let first = 0;
+      let above = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (!(arr[i] >= 1.0 && arr[i] <= 1e9 && arr[i] == Math.floor(arr[i]))) invalid++;
+        if (arr[i] == 1.0) first++;
+        if (arr[i] > 1e6) above++;
+      }
+
+      // rank 1 has probability 1 / H(1e9) ~ 0.0469, and ranks past a million ~ 0.324,
+      // with standard errors of ~0.0007 and ~0.0015
+      expect(invalid).toBe(0);
+      expect(Math.abs(<f64>first / <f64>arr.length - 0.0469)).toBeLessThan(0.0035);
+      expect(Math.abs(<f64>above / <f64>arr.length - 0.324)).toBeLessThan(0.0075);
+    });
+
+    test('zipf concentrates on the first rank for large exponents', () => {
+      setupTest();
+      let first = 0;
+
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const k = zipf(100.0, 2.0);
+        if (k == 1.0) first++;
+      }
+
+      // rank 1 has probability 1 / 1.635 ~ 0.612, with a standard error of ~0.005
+      expect(Math.abs(<f64>first / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.612)).toBeLessThan(0.025);
+      expect(zipf(1.0, 1.0)).toBe(1.0);
+    });
+  });
+
+  describe('Categorical Output', () => {
+    test('categoricalArray draws categories in proportion to their weights, from a reusable table', () => {
+      setupTest();
+      const weights = new Float64Array(4);
+      weights[0] = 1.0;
+      weights[2] = 3.0;
+      weights[3] = 6.0;
+      const table = new Uint64Array(4);
+      aliasTableBuild(weights, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      const counts = new Float64Array(4);
+      let invalid = 0;
+
+      for (let fill = 0; fill < 2; fill++) {
+        categoricalArray(table, arr);
+        for (let i = 0; i < arr.length; i++) {
+          if (!(arr[i] >= 0.0 && arr[i] <= 3.0 && arr[i] == Math.floor(arr[i]))) invalid++;
+          else counts[<i32>arr[i]] += 1.0;
+        }
+      }
+
+      // probabilities 0.1, 0, 0.3 and 0.6 over 200000 draws, with standard errors under 0.0011
+      const total = <f64>(2 * DISTRIBUTION_SAMPLE_SIZE);
+      expect(invalid).toBe(0);
+      expect(counts[1]).toBe(0.0);
+      expect(Math.abs(counts[0] / total - 0.1)).toBeLessThan(0.005);
+      expect(Math.abs(counts[2] / total - 0.3)).toBeLessThan(0.005);
+      expect(Math.abs(counts[3] / total - 0.6)).toBeLessThan(0.005);
+    });
+
+    test('categorical draws categories in proportion to their weights', () => {
+      setupTest();
+      const weights = new Float64Array(2);
+      weights[0] = 1.0;
+      weights[1] = 3.0;
+      const table = new Uint64Array(2);
+      aliasTableBuild(weights, table);
+
+      let sum = 0.0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        sum += categorical(table);
+      }
+
+      // category 1 has probability 0.75, with a standard error of ~0.0043
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 0.75)).toBeLessThan(0.022);
+    });
+  });
+
+  describe('Empirical Output', () => {
+    test('empiricalArray draws from a tabulated CDF, with jumps and tails, from a reusable table', () => {
+      setupTest();
+      // uniform over 0 to 10, a jump to 10, then uniform over 10 to 20 and a long tail to 100
+      const points = new Float64Array(10);
+      points[2] = 10.0;
+      points[3] = 0.2;
+      points[4] = 10.0;
+      points[5] = 0.5;
+      points[6] = 20.0;
+      points[7] = 0.9;
+      points[8] = 100.0;
+      points[9] = 1.0;
+      const table = new Float64Array(16);
+      empiricalTableBuild(points, table);
+
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      let sum = 0.0;
+      let jumps = 0;
+      let invalid = 0;
+
+      for (let fill = 0; fill < 2; fill++) {
+        empiricalArray(table, arr);
+        for (let i = 0; i < arr.length; i++) {
+          if (!(arr[i] >= 0.0 && arr[i] <= 100.0)) invalid++;
+          if (arr[i] == 10.0) jumps++;
+          sum += arr[i];
+        }
+      }
+
+      // mean 16 and standard deviation ~16.95 over 200000 draws, so a standard error of ~0.038,
+      // and a jump with probability 0.3, with a standard error of ~0.001
+      const total = <f64>(2 * DISTRIBUTION_SAMPLE_SIZE);
+      expect(invalid).toBe(0);
+      expect(Math.abs(sum / total - 16.0)).toBeLessThan(0.2);
+      expect(Math.abs(<f64>jumps / total - 0.3)).toBeLessThan(0.005);
+    });
+
+    test('empirical draws from a tabulated CDF', () => {
+      setupTest();
+      // uniform over 0 to 1 and then over 1 to 3, each with probability 0.5
+      const points = new Float64Array(6);
+      points[2] = 1.0;
+      points[3] = 0.5;
+      points[4] = 3.0;
+      points[5] = 1.0;
+      const table = new Float64Array(8);
+      empiricalTableBuild(points, table);
+
+      let sum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        const x = empirical(table);
+        if (!(x >= 0.0 && x <= 3.0)) invalid++;
+        sum += x;
+      }
+
+      // mean 1.25 and standard deviation ~0.878, so a standard error of ~0.0088
+      expect(invalid).toBe(0);
+      expect(Math.abs(sum / <f64>DETERMINISTIC_SAMPLE_SIZE - 1.25)).toBeLessThan(0.045);
+    });
+  });
+
+  describe('Inverse Transform Distributions', () => {
+    test('laplace53Array, logistic53Array and gumbel53Array have the mean and variance of their location and scale', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      // mean, variance and their tolerances, each ~5 standard errors over 100000 draws
+      const expected: StaticArray<f64> = [
+        // Laplace(2, 0.5)
+        2.0, 0.5, 0.012, 0.02,
+        // logistic(-1, 2)
+        -1.0, 13.159472534785811, 0.06, 0.4,
+        // Gumbel(0, 1): the Euler-Mascheroni constant and π^2 / 6
+        0.5772156649015329, 1.6449340668482264, 0.02, 0.05
+      ];
+
+      for (let d = 0; d < 3; d++) {
+        if (d == 0) laplace53Array(2.0, 0.5, arr);
+        else if (d == 1) logistic53Array(-1.0, 2.0, arr);
+        else gumbel53Array(0.0, 1.0, arr);
+
+        let sum = 0.0;
+        let sumSquares = 0.0;
+        let nonFinite = 0;
+        for (let i = 0; i < arr.length; i++) {
+          sum += arr[i];
+          sumSquares += arr[i] * arr[i];
+          if (!isFinite(arr[i])) nonFinite++;
+        }
+        const mean = sum / <f64>arr.length;
+
+        expect(nonFinite).toBe(0);
+        expect(Math.abs(mean - expected[4 * d])).toBeLessThan(expected[4 * d + 2]);
+        expect(Math.abs(sumSquares / <f64>arr.length - mean * mean - expected[4 * d + 1])).toBeLessThan(expected[4 * d + 3]);
+      }
+    });
+
+    test('cauchy53Array has half its numbers within one scale of its location', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      cauchy53Array(1.0, 2.0, arr);
+
+      let inside = 0;
+      let below = 0;
+      for (let i = 0; i < arr.length; i++) {
+        if (Math.abs(arr[i] - 1.0) < 2.0) inside++;
+        if (arr[i] < 1.0) below++;
+      }
+
+      // both have probability 0.5, with a standard error of ~0.0016
+      expect(Math.abs(<f64>inside / <f64>arr.length - 0.5)).toBeLessThan(0.008);
+      expect(Math.abs(<f64>below / <f64>arr.length - 0.5)).toBeLessThan(0.008);
+    });
+
+    test('weibull53Array and pareto53Array have the mean of their shape and scale', () => {
+      setupTest();
+      const arr = new Float64Array(DISTRIBUTION_SAMPLE_SIZE);
+      weibull53Array(2.0, 3.0, arr);
+
+      let sum = 0.0;
+      let negative = 0;
+      for (let i = 0; i < arr.length; i++) {
+        sum += arr[i];
+        if (arr[i] < 0.0) negative++;
+      }
+
+      // mean 3 * Γ(1.5) ~ 2.6587 and standard deviation ~1.39, for a standard error of ~0.0044
+      expect(negative).toBe(0);
+      expect(Math.abs(sum / <f64>arr.length - 2.658680776358274)).toBeLessThan(0.022);
+
+      pareto53Array(4.0, 2.0, arr);
+      sum = 0.0;
+      let belowMinimum = 0;
+      for (let i = 0; i < arr.length; i++) {
+        sum += arr[i];
+        if (arr[i] < 2.0) belowMinimum++;
+      }
+
+      // mean 8 / 3 and standard deviation ~0.94, for a standard error of ~0.003
+      expect(belowMinimum).toBe(0);
+      expect(Math.abs(sum / <f64>arr.length - 8.0 / 3.0)).toBeLessThan(0.015);
+    });
+
+    test('single inverse transform numbers match their distributions', () => {
+      setupTest();
+      let logisticSum = 0.0;
+      let weibullSum = 0.0;
+      let invalid = 0;
+      for (let i = 0; i < DETERMINISTIC_SAMPLE_SIZE; i++) {
+        logisticSum += logistic53(5.0, 1.0);
+        weibullSum += weibull53(1.0, 2.0);
+        if (!isFinite(cauchy53(0.0, 1.0)) || !isFinite(laplace53(0.0, 1.0))) invalid++;
+        if (!isFinite(gumbel53(0.0, 1.0)) || !(pareto53(1.5, 3.0) >= 3.0)) invalid++;
+      }
+
+      // logistic(5, 1) has standard deviation ~1.81, and Weibull(1, 2) is exponential with mean
+      // and standard deviation 2, for standard errors of ~0.018 and ~0.02
+      expect(invalid).toBe(0);
+      expect(Math.abs(logisticSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 5.0)).toBeLessThan(0.09);
+      expect(Math.abs(weibullSum / <f64>DETERMINISTIC_SAMPLE_SIZE - 2.0)).toBeLessThan(0.1);
+    });
+  });
 });
@@ -0,0 +1,90 @@
+/**
+ * Zipf Helper Tests
+ *
+ * Tests for the rejection-inversion helpers used by every generator's zipf() and
+ * zipfArray() functions.
+ *
+ * Test Strategy:
+ * - Verify accepted candidates over an even grid of uniform numbers give each rank its
+ *   exact probability, for exponents below, at and above 1
+ * - Verify nearly every candidate is accepted
+ * - Verify the ends of the uniform range give the first and last ranks, even for a billion ranks
+ * - Verify parameters are set up again when n or s changes
+ *
+ * Contrast: These test the arithmetic in isolation, while each generator's suite
+ * tests the ranks its own loops produce.
+ */
+
+import { describe, test, expect } from 'vitest-pool-assemblyscript/assembly';
+import { zipfSetup, zipfRejectionInversion } from '../common/zipf';
+
+// candidates are drawn from GRID_SIZE evenly spaced uniform numbers
+const GRID_SIZE: i32 = 1 << 20;
+
+/**
+ * Gets the largest difference between the share of accepted grid candidates that give each
+ * rank and its exact probability, and the share of candidates that are accepted.
+ */
+function gridError(n: i32, s: f64): StaticArray<f64> {
+  zipfSetup(<f64>n, s);
+  const counts = new Float64Array(n + 1);
+  let accepted: f64 = 0.0;
+
+  for (let i: i32 = 0; i < GRID_SIZE; i++) {
+    const k: f64 = zipfRejectionInversion((<f64>i + 0.5) / <f64>GRID_SIZE);
+    if (!isNaN(k)) {
+      counts[<i32>k] += 1.0;
+      accepted += 1.0;
+    }
+  }
+
+  let harmonic: f64 = 0.0;
+  for (let k: i32 = 1; k <= n; k++) harmonic += Math.pow(<f64>k, -s);
+
+  let maxError: f64 = 0.0;
+  for (let k: i32 = 1; k <= n; k++) {
+    const error = Math.abs(counts[k] / accepted - Math.pow(<f64>k, -s) / harmonic);
+    if (error > maxError) maxError = error;
+  }
+
+  return [maxError, accepted / <f64>GRID_SIZE];
+}
+
+describe('Rejection-inversion', () => {
+  test('accepted candidates give each rank its exact probability', () => {
+    const ns: StaticArray<i32> = [10, 10, 1000, 100];
+    const exponents: StaticArray<f64> = [1.2, 0.0, 0.5, 3.0];
+
+    for (let c: i32 = 0; c < ns.length; c++) {
+      const result = gridError(unchecked(ns[c]), unchecked(exponents[c]));
+      expect(result[0]).toBeLessThan(1e-5);
+      expect(result[1]).toBeGreaterThan(0.98);
+    }
+  });
+
+  test('every candidate is accepted for an exponent of 0', () => {
+    const result = gridError(50, 0.0);
+    expect(result[1]).toBe(1.0);
+  });
+
+  test('the ends of the uniform range give the last and first ranks', () => {
+    zipfSetup(1e9, 1.0);
+    expect(zipfRejectionInversion(0.0)).toBe(1e9);
+    expect(zipfRejectionInversion(0.9999999999)).toBe(1.0);
+
+    zipfSetup(1.0, 2.0);
+    expect(zipfRejectionInversion(0.3)).toBe(1.0);
+  });
+
+  test('parameters are set up again when n or s changes', () => {
+    zipfSetup(10.0, 1.0);
+    expect(zipfRejectionInversion(0.0)).toBe(10.0);
+    zipfSetup(20.0, 1.0);
+    expect(zipfRejectionInversion(0.0)).toBe(20.0);
+    zipfSetup(20.0, 0.0);
+
+    // evenly spread, so the middle of the uniform range gives a middle rank
+    const k: f64 = zipfRejectionInversion(0.5);
+    expect(k >= 10.0 && k <= 11.0).toBe(true);
+  });
+});
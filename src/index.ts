@@ -8,5 +8,6 @@
  */
 
 export { PRNGType } from './types/prng';
+export type { HierarchicalStreamId, AliasTable, EmpiricalTable } from './types/prng';
 export * from './random-generator';
 export * from './seeds';
@@ -1,15 +1,36 @@
 import { PRNGType } from './types/prng';
-import type { PRNG, JumpablePRNG, IncrementablePRNG } from './types/prng';
-import { seed64Array } from './seeds';
+import type { PRNG, JumpablePRNG, IncrementablePRNG, AdvanceablePRNG, CounterBasedPRNG, NormalPairPRNG, ChaChaPRNG, HierarchicalStreamId, AliasTable, EmpiricalTable } from './types/prng';
+import { seed64Array, secureSeed64Array } from './seeds';
 
 // rolldown-plugin-wasm imports these binaries as base64 strings, and provides a 
 // function on module load to synchronously instantiate each WASM generator.
 // See types/wasm.d.ts and types/prng.ts
 import PCG from '../bin/pcg.wasm?init&sync';
+import PCG_SIMD from '../bin/pcg-simd.wasm?init&sync';
+import PCG64 from '../bin/pcg64.wasm?init&sync';
+import Philox from '../bin/philox.wasm?init&sync';
+import Philox_SIMD from '../bin/philox-simd.wasm?init&sync';
+import ChaCha from '../bin/chacha-simd.wasm?init&sync';
+import SFC64 from '../bin/sfc64.wasm?init&sync';
+import SFC64_SIMD from '../bin/sfc64-simd.wasm?init&sync';
+import RomuTrio from '../bin/romutrio.wasm?init&sync';
+import RomuTrio_SIMD from '../bin/romutrio-simd.wasm?init&sync';
+import RomuDuoJr from '../bin/romuduojr.wasm?init&sync';
+import RomuDuoJr_SIMD from '../bin/romuduojr-simd.wasm?init&sync';
 import Xoroshiro128Plus from '../bin/xoroshiro128plus.wasm?init&sync';
 import Xoroshiro128Plus_SIMD from '../bin/xoroshiro128plus-simd.wasm?init&sync';
+import Xoroshiro128Plus_SIMDx4 from '../bin/xoroshiro128plus-simd-x4.wasm?init&sync';
+import Xoroshiro128PlusPlus from '../bin/xoroshiro128plusplus.wasm?init&sync';
+import Xoroshiro128PlusPlus_SIMD from '../bin/xoroshiro128plusplus-simd.wasm?init&sync';
+import Xoroshiro128StarStar from '../bin/xoroshiro128starstar.wasm?init&sync';
+import Xoroshiro128StarStar_SIMD from '../bin/xoroshiro128starstar-simd.wasm?init&sync';
 import Xoshiro256Plus from '../bin/xoshiro256plus.wasm?init&sync';
 import Xoshiro256Plus_SIMD from '../bin/xoshiro256plus-simd.wasm?init&sync';
+import Xoshiro256Plus_SIMDx4 from '../bin/xoshiro256plus-simd-x4.wasm?init&sync';
+import Xoshiro256PlusPlus from '../bin/xoshiro256plusplus.wasm?init&sync';
+import Xoshiro256PlusPlus_SIMD from '../bin/xoshiro256plusplus-simd.wasm?init&sync';
+import Xoshiro256StarStar from '../bin/xoshiro256starstar.wasm?init&sync';
+import Xoshiro256StarStar_SIMD from '../bin/xoshiro256starstar-simd.wasm?init&sync';
 
 const wasmImports: WebAssembly.Imports = {
     env: {
@@ -22,17 +43,114 @@ const wasmImports: WebAssembly.Imports = {
     }
 };
 
+// ChaCha8, ChaCha12 and ChaCha20 share one binary, which is given its round count on instantiation
+const chacha = (rounds: number) => () => {
+    const instance = ChaCha(wasmImports);
+    (<ChaChaPRNG>instance.exports).setRounds(rounds);
+    return instance;
+};
+
 const GENERATORS = {
     [PRNGType.PCG]: () => PCG(wasmImports),
+    [PRNGType.PCG_SIMD]: () => PCG_SIMD(wasmImports),
+    [PRNGType.PCG64]: () => PCG64(wasmImports),
+    [PRNGType.Philox]: () => Philox(wasmImports),
+    [PRNGType.Philox_SIMD]: () => Philox_SIMD(wasmImports),
+    [PRNGType.ChaCha8]: chacha(8),
+    [PRNGType.ChaCha12]: chacha(12),
+    [PRNGType.ChaCha20]: chacha(20),
+    [PRNGType.SFC64]: () => SFC64(wasmImports),
+    [PRNGType.SFC64_SIMD]: () => SFC64_SIMD(wasmImports),
+    [PRNGType.RomuTrio]: () => RomuTrio(wasmImports),
+    [PRNGType.RomuTrio_SIMD]: () => RomuTrio_SIMD(wasmImports),
+    [PRNGType.RomuDuoJr]: () => RomuDuoJr(wasmImports),
+    [PRNGType.RomuDuoJr_SIMD]: () => RomuDuoJr_SIMD(wasmImports),
     [PRNGType.Xoroshiro128Plus]: () => Xoroshiro128Plus(wasmImports),
     [PRNGType.Xoroshiro128Plus_SIMD]: () => Xoroshiro128Plus_SIMD(wasmImports),
+    [PRNGType.Xoroshiro128Plus_SIMDx4]: () => Xoroshiro128Plus_SIMDx4(wasmImports),
+    [PRNGType.Xoroshiro128PlusPlus]: () => Xoroshiro128PlusPlus(wasmImports),
+    [PRNGType.Xoroshiro128PlusPlus_SIMD]: () => Xoroshiro128PlusPlus_SIMD(wasmImports),
+    [PRNGType.Xoroshiro128StarStar]: () => Xoroshiro128StarStar(wasmImports),
+    [PRNGType.Xoroshiro128StarStar_SIMD]: () => Xoroshiro128StarStar_SIMD(wasmImports),
     [PRNGType.Xoshiro256Plus]: () => Xoshiro256Plus(wasmImports),
-    [PRNGType.Xoshiro256Plus_SIMD]: () => Xoshiro256Plus_SIMD(wasmImports)
+    [PRNGType.Xoshiro256Plus_SIMD]: () => Xoshiro256Plus_SIMD(wasmImports),
+    [PRNGType.Xoshiro256Plus_SIMDx4]: () => Xoshiro256Plus_SIMDx4(wasmImports),
+    [PRNGType.Xoshiro256PlusPlus]: () => Xoshiro256PlusPlus(wasmImports),
+    [PRNGType.Xoshiro256PlusPlus_SIMD]: () => Xoshiro256PlusPlus_SIMD(wasmImports),
+    [PRNGType.Xoshiro256StarStar]: () => Xoshiro256StarStar(wasmImports),
+    [PRNGType.Xoshiro256StarStar_SIMD]: () => Xoshiro256StarStar_SIMD(wasmImports)
+};
+
+// Number of values produced per step by SIMD generators, which fill
+// their output arrays this many values at a time
+const SIMD_LANE_COUNTS: Partial<Record<PRNGType, number>> = {
+    [PRNGType.PCG_SIMD]: 2,
+    [PRNGType.Philox_SIMD]: 2,
+    [PRNGType.SFC64_SIMD]: 2,
+    [PRNGType.RomuTrio_SIMD]: 2,
+    [PRNGType.RomuDuoJr_SIMD]: 2,
+    [PRNGType.Xoroshiro128Plus_SIMD]: 2,
+    [PRNGType.Xoroshiro128Plus_SIMDx4]: 4,
+    [PRNGType.Xoroshiro128PlusPlus_SIMD]: 2,
+    [PRNGType.Xoroshiro128StarStar_SIMD]: 2,
+    [PRNGType.Xoshiro256Plus_SIMD]: 2,
+    [PRNGType.Xoshiro256Plus_SIMDx4]: 4,
+    [PRNGType.Xoshiro256PlusPlus_SIMD]: 2,
+    [PRNGType.Xoshiro256StarStar_SIMD]: 2
 };
 
+// Number of non-overlapping nodes (long jump slots), and of workers within each node's slot
+// (short jumps), for generators that support HierarchicalStreamId stream selection.
+// A 2^96 long jump holds 2^32 jumps of 2^64, and a 2^192 long jump holds 2^64 jumps of 2^128.
+// Philox splits the high 64 bits of its counter, and ChaCha its 64-bit nonce, into 32-bit node and worker ids.
+const HIERARCHICAL_STREAM_LIMITS: Partial<Record<PRNGType, bigint>> = {
+    [PRNGType.Philox]: 1n << 32n,
+    [PRNGType.Philox_SIMD]: 1n << 32n,
+    [PRNGType.ChaCha8]: 1n << 32n,
+    [PRNGType.ChaCha12]: 1n << 32n,
+    [PRNGType.ChaCha20]: 1n << 32n,
+    [PRNGType.Xoroshiro128Plus]: 1n << 32n,
+    [PRNGType.Xoroshiro128Plus_SIMD]: 1n << 32n,
+    [PRNGType.Xoroshiro128Plus_SIMDx4]: 1n << 32n,
+    [PRNGType.Xoroshiro128PlusPlus]: 1n << 32n,
+    [PRNGType.Xoroshiro128PlusPlus_SIMD]: 1n << 32n,
+    [PRNGType.Xoroshiro128StarStar]: 1n << 32n,
+    [PRNGType.Xoroshiro128StarStar_SIMD]: 1n << 32n,
+    [PRNGType.Xoshiro256Plus]: 1n << 64n,
+    [PRNGType.Xoshiro256Plus_SIMD]: 1n << 64n,
+    [PRNGType.Xoshiro256Plus_SIMDx4]: 1n << 64n,
+    [PRNGType.Xoshiro256PlusPlus]: 1n << 64n,
+    [PRNGType.Xoshiro256PlusPlus_SIMD]: 1n << 64n,
+    [PRNGType.Xoshiro256StarStar]: 1n << 64n,
+    [PRNGType.Xoshiro256StarStar_SIMD]: 1n << 64n
+};
+
+// Cryptographically secure generators, whose seeds are their whole secret key, so they are
+// auto-seeded directly from crypto.getRandomValues() rather than by expanding a 64-bit seed
+const SECURE_PRNG_TYPES: ReadonlySet<PRNGType> = new Set([
+    PRNGType.ChaCha8,
+    PRNGType.ChaCha12,
+    PRNGType.ChaCha20
+]);
+
+// Bounds of the 32-bit signed integers accepted by intRange(), intRangeArray() and binomial()
+const INT32_MIN = -0x80000000;
+const INT32_MAX = 0x7FFFFFFF;
+
+// Largest range accepted by smallIntRangeArray(), which still extracts 3 integers from each output
+const SMALL_RANGE_MAX = 0x10000;
+
+// Most nodes accepted by randomGraphEdges(), whose possible edges are numbered exactly by f64s
+const GRAPH_NODES_MAX = 2 ** 26;
+
+// Most bytes the stub runtime's bump allocator adds around a table's data: the headers of its
+// buffer and view objects, each aligned to 16 bytes
+const TABLE_ALLOCATION_OVERHEAD = 80;
+
 interface ArrayConfig {
     bigIntOutputArrayPtr: number;
     bigIntOutputArray: BigUint64Array;
+    byteOutputArray: Uint8Array;
     floatOutputArrayPtr: number;
     floatOutputArray: Float64Array;
 }
@@ -47,6 +165,13 @@ export class RandomGenerator {
     
     private _instance: PRNG;
     private _arrayConfig: ArrayConfig;
+
+    // alias and empirical tables built in this generator's WASM memory, which no other generator can read
+    private _aliasTables = new WeakSet<AliasTable>();
+    private _empiricalTables = new WeakSet<EmpiricalTable>();
+
+    // bytes of WASM memory left after the output arrays for new tables, which are never freed
+    private _tableBytesFree = 0;
     
     private _setupOutputArrays(outputArraySize: number): ArrayConfig {
         const dataView = new DataView(this._instance.memory.buffer);
@@ -58,6 +183,13 @@ export class RandomGenerator {
             dataView.getUint32(bigIntOutputArrayPtr + 8, true) / BigUint64Array.BYTES_PER_ELEMENT  // array length
         );
 
+        // the same memory, viewed as the bytes of its little-endian 64-bit integers
+        const byteOutputArray = new Uint8Array(
+            bigIntOutputArray.buffer,
+            bigIntOutputArray.byteOffset,
+            bigIntOutputArray.byteLength
+        );
+
         const floatOutputArrayPtr = this._instance.allocFloat64Array(outputArraySize);
         const floatOutputArray = new Float64Array(
             this._instance.memory.buffer,
@@ -68,29 +200,82 @@ export class RandomGenerator {
         return {
             bigIntOutputArrayPtr,
             bigIntOutputArray,
+            byteOutputArray,
             floatOutputArrayPtr,
             floatOutputArray
         };
     }
 
-    private _selectStream(uniqueStreamId: bigint | number | null) {
-        if (uniqueStreamId !== null && uniqueStreamId > 0) {
-            // Xoshiro/Xoroshiro PRNG family: calls the jump function a unique number
-            // of times to "space out" the selected stream within the generator's period
-            if (this._instance.jump) {
-                for (let i = 0; i < uniqueStreamId; i++) {
-                    (<JumpablePRNG>this._instance).jump();
-                }
+    private _selectHierarchicalStream(streamId: HierarchicalStreamId) {
+        const limit = HIERARCHICAL_STREAM_LIMITS[this._prngType];
+        if (!limit) {
+            throw new Error(`Generator type ${this._prngType} does not support (nodeId, workerId) stream selection`);
+        }
+
+        const nodeId = BigInt(streamId.nodeId);
+        const workerId = BigInt(streamId.workerId);
+        if (nodeId < 0n || nodeId >= limit) {
+            throw new Error(`nodeId must be between 0 and ${limit - 1n} for ${this._prngType}, got ${streamId.nodeId}`);
+        }
+        if (workerId < 0n || workerId >= limit) {
+            throw new Error(`workerId must be between 0 and ${limit - 1n} for ${this._prngType}, got ${streamId.workerId}`);
+        }
+
+        // Long jump to the node's slot, then jump to the worker's stream within it
+        const instance = <JumpablePRNG>this._instance;
+        instance.longJumpTo(nodeId);
+        instance.jumpTo(workerId);
+    }
+
+    private _selectStream(uniqueStreamId: bigint | number | HierarchicalStreamId | null) {
+        if (uniqueStreamId !== null && typeof uniqueStreamId === 'object') {
+            this._selectHierarchicalStream(uniqueStreamId);
+        } else if (uniqueStreamId !== null && uniqueStreamId > 0) {
+            // Fractional numbers round down to a whole stream, and stream IDs must fit in the
+            // u64 that crosses into WASM, rather than silently wrapping to a lower stream
+            if (typeof uniqueStreamId === 'number' && !Number.isFinite(uniqueStreamId)) {
+                throw new Error(`uniqueStreamId must be a finite number or a bigint, got ${uniqueStreamId}`);
+            }
+            const streamId = BigInt(typeof uniqueStreamId === 'number' ? Math.floor(uniqueStreamId) : uniqueStreamId);
+            if (streamId > 0xFFFFFFFFFFFFFFFFn) {
+                throw new Error(`uniqueStreamId must be at most 2^64 - 1, got ${uniqueStreamId}`);
+            }
+            if (streamId === 0n) {
+                return;
+            }
+
+            // Xoshiro/Xoroshiro PRNG family: jumps a unique number of times to "space out"
+            // the selected stream within the generator's period. jumpTo() computes the
+            // combined jump polynomial in WASM, so this takes O(log uniqueStreamId) time.
+            // Philox's jumpTo() just adds to the stream half of its counter, and ChaCha's
+            // to its nonce, in O(1) time
+            if (this._instance.jumpTo) {
+                (<JumpablePRNG>this._instance).jumpTo(streamId);
             }
             // PCG PRNG family: uses a unique stream increment to select different
             // streams within the generator's period
             //
-            // Note that some PCG implementations provide jump-ahead and jump-back
-            // functionality as well, similar to the Xoshiro Jump function. In this
-            // library's PCG implementation, we only expose the increment as a way
-            // to choose a stream, and have not implemented PCG state jumps.
+            // Note that PCG can also jump ahead within a single stream, but that
+            // is exposed separately via discard(), since positions within the
+            // same stream overlap rather than providing a unique stream.
+            //
+            // The SIMD variant runs 2 streams side by side, so each unique stream id
+            // reserves a pair of consecutive increments, one per lane
             else if (this._instance.setStreamIncrement) {
-                (<IncrementablePRNG>this._instance).setStreamIncrement(BigInt(uniqueStreamId));
+                if (this._prngType === PRNGType.PCG_SIMD) {
+                    // beyond 2^63 - 1, the doubled increments would overflow u64 and collide
+                    if (streamId > 0x7FFFFFFFFFFFFFFFn) {
+                        throw new Error(`uniqueStreamId must be at most 2^63 - 1 for ${this._prngType}, got ${uniqueStreamId}`);
+                    }
+                    (<IncrementablePRNG>this._instance).setStreamIncrement(2n * streamId, 2n * streamId + 1n);
+                } else {
+                    (<IncrementablePRNG>this._instance).setStreamIncrement(streamId);
+                }
+            }
+            // SFC64 and Romu families have non-linear state updates, with no jumps or
+            // increments to select a stream, so parallel instances need their own seeds
+            else {
+                throw new Error(`Generator type ${this._prngType} does not support uniqueStreamId stream selection`);
             }
         }
     }
@@ -102,24 +287,39 @@ export class RandomGenerator {
      * Xoroshiro128Plus_SIMD.
      * 
      * @param seeds Collection of 64-bit integers used to initialize this
-     * generator's internal state. 1-8 seeds are required depending on generator 
+     * generator's internal state. 1-16 seeds are required depending on generator 
      * type (see {@link seedCount} or API docs to determine the required seed count).
      * <br><br>
      * 
-     * Auto-seeds itself if no seeds are provided.
+     * Auto-seeds itself if no seeds are provided. ChaCha generators are auto-seeded
+     * directly from `crypto.getRandomValues()` (see {@link secureSeed64Array}).
      * 
      * @param uniqueStreamId Determines the unique random stream
      * this generator will return within its period, given a particular starting state.
-     * Values <= 0, `null`, or `undefined` will select the default stream.
+     * Values <= 0, `null`, or `undefined` will select the default stream. Fractional
+     * numbers are rounded down, and non-finite numbers or values above 2^64 - 1 throw.
      * <br><br>
      * 
      * This optional unique identifier should be used when sharing the same seeds across
      * parallel generator instances, so that each can provide a unique random stream.
      * <br><br>
      * 
-     * For Xoshiro generators, this value indicates the number of state jumps
-     * to make after seeding. For PCG generators, this value is used as the
-     * internal stream increment for state advances.
+     * For Xoshiro, Philox and ChaCha generators, this value indicates the number of state
+     * jumps to make after seeding (up to 2^64 - 1); for Philox, each jump simply selects the
+     * next stream of 2^64 blocks in its counter, and for ChaCha, the next nonce. For PCG
+     * generators (including PCG64), this value is used as the internal stream increment for
+     * state advances (PCG_SIMD uses the increments `2 * uniqueStreamId` and
+     * `2 * uniqueStreamId + 1`, one for each SIMD lane, so its stream IDs go up to
+     * 2^63 - 1). SFC64 and Romu generators have no
+     * stream selection, and throw for any positive value: give each parallel instance its
+     * own random seeds instead.
+     * <br><br>
+     * 
+     * Xoshiro, Philox and ChaCha generators also accept a {@link HierarchicalStreamId}
+     * (`{ nodeId, workerId }`), which long jumps to the node's slot within the period and
+     * then jumps to the worker's stream within that slot. Xoroshiro128, Philox and ChaCha
+     * generators support 2^32 nodes of 2^32 workers each, and Xoshiro256 generators support
+     * 2^64 nodes of 2^64 workers each.
      * 
      * @param outputArraySize Size of the output arrays used when filling WASM memory 
      * buffer using the `*Array()` methods (default: 1000).
@@ -130,11 +330,10 @@ export class RandomGenerator {
     constructor(
         prngType: PRNGType = PRNGType.Xoroshiro128Plus_SIMD,
         seeds: bigint[] | null = null,
-        uniqueStreamId: bigint | number | null = null,
+        uniqueStreamId: bigint | number | HierarchicalStreamId | null = null,
         outputArraySize: number = 1000
     ) {
         this._prngType = prngType;
-        this._seeds = seeds || seed64Array();
         this._outputArraySize = outputArraySize;
 
         // Validate outputArraySize
@@ -142,17 +341,25 @@ export class RandomGenerator {
             throw new Error(`outputArraySize must be positive, got ${outputArraySize}`);
         }
 
-        // SIMD algorithms require even-sized arrays (process 2 values at a time)
-        const simdTypes = [PRNGType.Xoroshiro128Plus_SIMD, PRNGType.Xoshiro256Plus_SIMD];
-        if (simdTypes.includes(prngType) && outputArraySize % 2 !== 0) {
+        // SIMD algorithms require even-sized arrays (process 2 values at a time),
+        // and 4-lane SIMD algorithms require arrays in multiples of 4
+        const simdLaneCount = SIMD_LANE_COUNTS[prngType] || 1;
+        if (simdLaneCount > 1 && outputArraySize % 2 !== 0) {
             throw new Error(`${prngType} requires even outputArraySize for SIMD processing, got ${outputArraySize}`);
         }
+        if (outputArraySize % simdLaneCount !== 0) {
+            throw new Error(`${prngType} requires outputArraySize to be a multiple of ${simdLaneCount} for SIMD processing, got ${outputArraySize}`);
+        }
 
         // instantiate the WASM instance and get its exported PRNG interface
         this._instance = GENERATORS[this._prngType]().exports;
 
-        // seed count check
+        // auto-seed with at least the default 8 seeds, or more if this generator requires it
         const requiredSeedCount = this._instance.SEED_COUNT.value;
+        const autoSeed64Array = SECURE_PRNG_TYPES.has(prngType) ? secureSeed64Array : seed64Array;
+        this._seeds = seeds || autoSeed64Array(Math.max(8, requiredSeedCount));
+
+        // seed count check
         if (this._seeds.length < requiredSeedCount) {
             throw new Error(`Generator type ${this._prngType} requires ${requiredSeedCount} seeds, got ${this._seeds.length}`);
         }
@@ -160,7 +367,7 @@ export class RandomGenerator {
         // PCG requires stream increment to be set BEFORE seeding, as the
         // reference implementation "stirs" the seed using the current increment.
         // See: https://github.com/imneme/pcg-c-basic/blob/master/pcg_basic.c
-        if (this._prngType === PRNGType.PCG) {
+        if (this._prngType === PRNGType.PCG || this._prngType === PRNGType.PCG_SIMD || this._prngType === PRNGType.PCG64) {
             this._selectStream(uniqueStreamId);
             this._instance.setSeeds(...this._seeds);
         } else {
@@ -171,6 +378,11 @@ export class RandomGenerator {
 
         // allocate WASM memory for bulk array fills
         this._arrayConfig = this._setupOutputArrays(outputArraySize);
+
+        // tables are bump-allocated after the float output array's data and view, whichever is last
+        const { floatOutputArrayPtr, floatOutputArray } = this._arrayConfig;
+        const heapTop = Math.max(floatOutputArray.byteOffset + floatOutputArray.byteLength, floatOutputArrayPtr + 12);
+        this._tableBytesFree = this._instance.memory.buffer.byteLength - heapTop;
     }
 
     /** Gets the PRNG algorithm being used by this generator instance. */
@@ -203,6 +415,45 @@ export class RandomGenerator {
         return this._outputArraySize;
     }
 
+    /**
+     * Advances this generator's state as if `count` outputs had been generated
+     * and discarded, in O(log count) time rather than O(count).
+     *
+     * Useful for partitioning a single stream into reproducible blocks (e.g. giving
+     * worker `i` the block that starts at `i * 2^40`), or for resuming a sequence
+     * from a known position.
+     *
+     * For PCG and PCG_SIMD, each step corresponds to one 32-bit output: {@link int32}
+     * consumes 1 step, while {@link int64}, {@link int53}, {@link float}, {@link coord}
+     * and {@link coordSquared} consume 2 steps per value. For PCG64, Philox and Xoshiro
+     * generators, each step corresponds to one 64-bit output, so {@link int32} and each of
+     * those methods consume 1 step per value. SIMD variants advance all lanes per step, so their
+     * `*Array()` methods consume half (or, for the 4-lane `_SIMDx4` variants, a quarter)
+     * as many steps per value.
+     *
+     * The distribution methods, such as {@link normal}, {@link intRange} and {@link poisson},
+     * consume a variable number of steps per value, since their samplers reject and redraw
+     * some candidates: the position they leave a stream at isn't fixed by the number of values.
+     *
+     * @param count Number of steps to skip, between 0 and 2^64 - 1.
+     *
+     * @throws Error if `count` is out of range, or if this generator type
+     * does not support advancing its state.
+     */
+    discard(count: bigint | number): void {
+        const advanceable = <AdvanceablePRNG>this._instance;
+        if (!advanceable.advance) {
+            throw new Error(`Generator type ${this._prngType} does not support discard()`);
+        }
+
+        const delta = BigInt(count);
+        if (delta < 0n || delta > 0xFFFFFFFFFFFFFFFFn) {
+            throw new Error(`discard count must be between 0 and 2^64 - 1, got ${count}`);
+        }
+
+        advanceable.advance(delta);
+    }
+
     /**
      * Gets this generator's next unsigned 64-bit integer.
      * 
@@ -278,215 +529,1788 @@ export class RandomGenerator {
     }
 
     /**
-     * Helper to copy BigUint64Array buffer values into a new independent array.
+     * Gets this generator's next integer in the inclusive range [`min`, `max`].
+     *
+     * Generated entirely in WASM with Lemire's multiply-shift method, rejecting the
+     * few draws that would bias the result, so every integer in range is equally likely.
+     * Unlike `Math.floor(gen.float() * n)`, the result is unbiased for any range size.
+     *
+     * @param min - Smallest possible result, a 32-bit signed integer.
+     * @param max - Largest possible result, a 32-bit signed integer no less than `min`.
+     *
+     * @returns An integer between `min` and `max`, inclusive.
+     *
+     * @throws Error if `min` or `max` is not a 32-bit signed integer, or if `min` > `max`.
+     *
+     * @example
+     * // Roll a six-sided die
+     * const roll = gen.intRange(1, 6);
      */
-    private copyBigUint64Array(): BigUint64Array {
-        const result = new BigUint64Array(this._arrayConfig.bigIntOutputArray.length);
-        result.set(this._arrayConfig.bigIntOutputArray);
-        return result;
+    intRange(min: number, max: number): number {
+        this.validateIntRange(min, max);
+        return this._instance.intRange(min, max);
     }
 
     /**
-     * Helper to copy Float64Array buffer values into a new independent array.
+     * Gets this generator's next exponentially distributed number, such as the wait
+     * until the next event of a process with `rate` events per unit of time.
+     *
+     * Generated entirely in WASM with the 256-layer ziggurat method, which needs only a
+     * table lookup, a multiply and a compare for about 97.8% of numbers.
+     *
+     * @param rate - The rate of the distribution, greater than 0. Its mean is 1 / `rate`. Default: 1.
+     *
+     * @returns An exponentially distributed float with 52 bits of randomness.
+     *
+     * @throws Error if `rate` is not a finite number greater than 0.
+     *
+     * @example
+     * // Seconds until the next request, at 20 requests per second
+     * const wait = gen.exponential(20);
      */
-    private copyFloat64Array(): Float64Array {
-        const result = new Float64Array(this._arrayConfig.floatOutputArray.length);
-        result.set(this._arrayConfig.floatOutputArray);
-        return result;
+    exponential(rate: number = 1): number {
+        this.validatePositive('rate', rate);
+        return this._instance.exponential53(rate);
     }
 
     /**
-     * Fills WASM memory array with this generator's next set of unsigned 64-bit integers.
-     *
-     * Array size is set when generator is created.
+     * Validates a distribution parameter that must be a finite number greater than 0,
+     * such as a rate, shape or scale, which WASM would otherwise loop on or turn into `NaN`s.
+     */
+    private validatePositive(name: string, value: number): void {
+        if (!Number.isFinite(value) || value <= 0) {
+            throw new Error(`${name} must be a finite number greater than 0, got ${value}`);
+        }
+    }
+
+    /**
+     * Gets this generator's next gamma distributed number.
      *
-     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
-     * reused WASM memory view for performance. Default: false.
+     * Generated entirely in WASM with Marsaglia and Tsang's method, which builds each number
+     * from a ziggurat normal number and accepts about 92% of them with a cheap squeeze,
+     * leaving the logarithms of the full rejection test for the rest.
      *
-     * @returns View of the array in WASM memory for this generator, now refilled.
-     * This output buffer is reused with each call unless `copy` is true.
+     * @param shape - The shape (k) of the distribution, greater than 0.
+     * @param scale - The scale (θ) of the distribution, greater than 0. Default: 1.
+     * The distribution's mean is `shape * scale`.
      *
-     * @remarks
-     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
-     * Use `copy=true` if storing multiple arrays.
+     * @returns A gamma distributed float.
      *
-     * @example
-     * // Immediate consumption (fast, no copy needed)
-     * const sum = gen.int64Array().reduce((a, b) => a + b, 0n);
+     * @throws Error if `shape` or `scale` is not a finite number greater than 0.
      *
      * @example
-     * // Store multiple arrays (use copy parameter)
-     * const arr1 = gen.int64Array(true);
-     * const arr2 = gen.int64Array(true);
-     * console.log(arr1 !== arr2); // true - independent copies
+     * // Total time for 3 independent tasks that each take 2 seconds on average
+     * const seconds = gen.gamma(3, 2);
      */
-    int64Array(copy: boolean = false): BigUint64Array {
-        this._instance.uint64Array(this._arrayConfig.bigIntOutputArrayPtr);
-        return copy ? this.copyBigUint64Array() : this._arrayConfig.bigIntOutputArray;
+    gamma(shape: number, scale: number = 1): number {
+        this.validatePositive('shape', shape);
+        this.validatePositive('scale', scale);
+        return this._instance.gamma53(shape, scale);
     }
-    
+
     /**
-     * Fills WASM memory array with this generator's next set of unsigned 53-bit integers.
+     * Gets this generator's next beta distributed number in the range [0, 1].
      *
-     * Array size is set when generator is created.
-     *
-     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
-     * reused WASM memory view for performance. Default: false.
+     * Generated entirely in WASM from 2 {@link gamma} numbers `x` and `y`, as `x / (x + y)`.
      *
-     * @returns View of the array in WASM memory for this generator, now refilled.
-     * This output buffer is reused with each call unless `copy` is true.
+     * @param a - The first shape (α) of the distribution, greater than 0.
+     * @param b - The second shape (β) of the distribution, greater than 0.
+     * The distribution's mean is `a / (a + b)`.
      *
-     * @remarks
-     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
-     * Use `copy=true` if storing multiple arrays.
+     * @returns A beta distributed float in the range [0, 1].
      *
-     * @example
-     * // Immediate consumption (fast, no copy needed)
-     * const max = Math.max(...gen.int53Array());
+     * @throws Error if `a` or `b` is not a finite number greater than 0.
      *
      * @example
-     * // Store multiple arrays (use copy parameter)
-     * const arr1 = gen.int53Array(true);
-     * const arr2 = gen.int53Array(true);
-     * console.log(arr1 !== arr2); // true - independent copies
+     * // A conversion rate, after 12 conversions in 100 trials (uniform prior)
+     * const rate = gen.beta(1 + 12, 1 + 88);
      */
-    int53Array(copy: boolean = false): Float64Array {
-        this._instance.uint53AsFloatArray(this._arrayConfig.floatOutputArrayPtr);
-        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    beta(a: number, b: number): number {
+        this.validatePositive('a', a);
+        this.validatePositive('b', b);
+        return this._instance.beta53(a, b);
     }
-    
+
     /**
-     * Fills WASM memory array with this generator's next set of unsigned 32-bit integers.
-     *
-     * Array size is set when generator is created.
+     * Gets this generator's next chi-squared distributed number.
      *
-     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
-     * reused WASM memory view for performance. Default: false.
+     * Generated entirely in WASM, as a {@link gamma} number with shape `k / 2` and scale 2.
      *
-     * @returns View of the array in WASM memory for this generator, now refilled.
-     * This output buffer is reused with each call unless `copy` is true.
+     * @param k - The degrees of freedom of the distribution, greater than 0.
+     * The distribution's mean is `k`.
      *
-     * @remarks
-     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
-     * Use `copy=true` if storing multiple arrays.
+     * @returns A chi-squared distributed float.
      *
-     * @example
-     * // Immediate consumption (fast, no copy needed)
-     * const sum = gen.int32Array().reduce((a, b) => a + b, 0);
+     * @throws Error if `k` is not a finite number greater than 0.
      *
      * @example
-     * // Store multiple arrays (use copy parameter)
-     * const arr1 = gen.int32Array(true);
-     * const arr2 = gen.int32Array(true);
-     * console.log(arr1 !== arr2); // true - independent copies
+     * const statistic = gen.chiSquared(4);
      */
-    int32Array(copy: boolean = false): Float64Array {
-        this._instance.uint32AsFloatArray(this._arrayConfig.floatOutputArrayPtr);
-        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    chiSquared(k: number): number {
+        this.validatePositive('k', k);
+        return this._instance.chiSquared53(k);
     }
 
     /**
-     * Fills WASM memory array with this generator's next set of floats in range [0, 1).
+     * Gets this generator's next Poisson distributed number: a count of events in an
+     * interval where they occur independently at an average of `lambda`.
      *
-     * Array size is set when generator is created.
+     * Generated entirely in WASM by inversion for a `lambda` below 10, and by Hörmann's
+     * transformed rejection (PTRS) from 10 up, so the cost stays flat as `lambda` grows.
      *
-     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
-     * reused WASM memory view for performance. Default: false.
+     * @param lambda - The mean (λ) of the distribution, at least 0.
      *
-     * @returns View of the array in WASM memory for this generator, now refilled.
-     * This output buffer is reused with each call unless `copy` is true.
+     * @returns A Poisson distributed integer.
      *
-     * @remarks
-     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
-     * Use `copy=true` if storing multiple arrays.
+     * @throws Error if `lambda` is negative or not finite.
      *
      * @example
-     * // Immediate consumption (fast, no copy needed)
-     * const avg = gen.floatArray().reduce((a, b) => a + b, 0) / gen.outputArraySize;
+     * // New infections caused by one case today
+     * const infections = gen.poisson(0.4);
+     */
+    poisson(lambda: number): number {
+        this.validatePoisson(lambda);
+        return this._instance.poisson(lambda);
+    }
+
+    /**
+     * Validates the mean of a {@link poisson} or {@link poissonArray} call.
+     */
+    private validatePoisson(lambda: number): void {
+        if (!Number.isFinite(lambda) || lambda < 0) {
+            throw new Error(`lambda must be a finite number of at least 0, got ${lambda}`);
+        }
+    }
+
+    /**
+     * Gets this generator's next binomially distributed number: a count of successes
+     * in `n` independent trials that each succeed with probability `p`.
+     *
+     * Generated entirely in WASM by inversion while `n` times the smaller of `p` and `1 - p`
+     * is below 30, and by Kachitvichyanukul and Schmeiser's BTPE from 30 up, so the cost
+     * stays flat as `n` grows.
+     *
+     * @param n - The number of trials, an integer from 0 to 2^31 - 1.
+     * @param p - The success probability of each trial, in the range [0, 1].
+     *
+     * @returns A binomially distributed integer in the range [0, `n`].
+     *
+     * @throws Error if `n` is not an integer in range, or `p` is not a number in the range [0, 1].
      *
      * @example
-     * // Store multiple arrays (use copy parameter)
-     * const arr1 = gen.floatArray(true);
-     * const arr2 = gen.floatArray(true);
-     * console.log(arr1 !== arr2); // true - independent copies
+     * // Household members infected by one case, at a 15% secondary attack rate
+     * const infected = gen.binomial(4, 0.15);
      */
-    floatArray(copy: boolean = false): Float64Array {
-        this._instance.float53Array(this._arrayConfig.floatOutputArrayPtr);
-        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    binomial(n: number, p: number): number {
+        this.validateBinomial(n, p);
+        return this._instance.binomial(n, p);
     }
-    
+
     /**
-     * Fills WASM memory array with this generator's next set of floats in range [-1, 1).
-     *
-     * Array size is set when generator is created.
+     * Validates the parameters of a {@link binomial} or {@link binomialArray} call.
+     */
+    private validateBinomial(n: number, p: number): void {
+        if (!Number.isInteger(n) || n < 0 || n > INT32_MAX) {
+            throw new Error(`n must be an integer between 0 and ${INT32_MAX}, got ${n}`);
+        }
+        this.validateProbability(p);
+    }
+
+    /**
+     * Validates a probability that must be in the range [0, 1].
+     */
+    private validateProbability(p: number): void {
+        if (!(p >= 0 && p <= 1)) {
+            throw new Error(`p must be a number between 0 and 1, got ${p}`);
+        }
+    }
+
+    /**
+     * Gets this generator's next geometric distributed number: the number of failed trials
+     * before the first success, when each trial succeeds with probability `p`.
      *
-     * Can be used as part of a coordinate pair in a unit square with radius 1.
-     * Useful for Monte Carlo simulation.
+     * Generated entirely in WASM from a single random number, as `floor(log(u) / log(1 - p))`.
      *
-     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
-     * reused WASM memory view for performance. Default: false.
+     * @param p - The success probability of each trial, in the range (0, 1].
+     * The distribution's mean is `(1 - p) / p`.
      *
-     * @returns View of the array in WASM memory for this generator, now refilled.
-     * This output buffer is reused with each call unless `copy` is true.
+     * @returns A geometric distributed integer.
      *
-     * @remarks
-     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
-     * Use `copy=true` if storing multiple arrays.
+     * @throws Error if `p` is not a number greater than 0 and at most 1.
      *
      * @example
-     * // Immediate consumption (fast, no copy needed)
-     * const coords = gen.coordArray();
-     * for (let i = 0; i < coords.length; i++) {
-     *   processCoordinate(coords[i]);
-     * }
+     * // Failed login attempts before one gets through, at 5% per attempt
+     * const attempts = gen.geometric(0.05);
+     */
+    geometric(p: number): number {
+        this.validateGeometric(p);
+        return this._instance.geometric(p);
+    }
+
+    /**
+     * Validates the probability of a {@link geometric} or {@link geometricArray} call,
+     * which must be above 0 for a success to ever happen.
+     */
+    private validateGeometric(p: number): void {
+        if (!(p > 0 && p <= 1)) {
+            throw new Error(`p must be a number greater than 0 and at most 1, got ${p}`);
+        }
+    }
+
+    /**
+     * Gets this generator's next Zipf distributed number: a rank from 1 to `n`, drawn with
+     * probability proportional to `1 / rank^s`.
+     *
+     * Generated entirely in WASM by Hörmann and Derflinger's rejection-inversion, which
+     * needs no table, so memory use is constant however large `n` is.
+     *
+     * @param n - The number of ranks, an integer from 1 to 2^53 - 1.
+     * @param s - The exponent of the distribution, at least 0. Higher values concentrate
+     * more of the draws on the first ranks, and 0 draws every rank equally.
+     *
+     * @returns A Zipf distributed integer in the range [1, `n`].
+     *
+     * @throws Error if `n` is not an integer in range, or `s` is negative or not finite.
      *
      * @example
-     * // Store multiple arrays (use copy parameter)
-     * const arr1 = gen.coordArray(true);
-     * const arr2 = gen.coordArray(true);
-     * console.log(arr1 !== arr2); // true - independent copies
+     * // A word's frequency rank in a 50,000 word vocabulary
+     * const rank = gen.zipf(50_000, 1.07);
      */
-    coordArray(copy: boolean = false): Float64Array {
-        this._instance.coord53Array(this._arrayConfig.floatOutputArrayPtr);
-        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    zipf(n: number, s: number): number {
+        this.validateZipf(n, s);
+        return this._instance.zipf(n, s);
     }
 
     /**
-     * Fills WASM memory array with this generator's next set of floats in range [-1, 1)
-     * that have been squared.
+     * Validates the parameters of a {@link zipf} or {@link zipfArray} call.
+     */
+    private validateZipf(n: number, s: number): void {
+        if (!Number.isSafeInteger(n) || n < 1) {
+            throw new Error(`n must be an integer between 1 and ${Number.MAX_SAFE_INTEGER}, got ${n}`);
+        }
+        if (!Number.isFinite(s) || s < 0) {
+            throw new Error(`s must be a finite number of at least 0, got ${s}`);
+        }
+    }
+
+    /**
+     * Builds an alias table in WASM memory for weighted categorical draws with
+     * {@link categorical} and {@link categoricalArray}, such as loot tables, mixture
+     * components or routing weights.
      *
-     * Array size is set when generator is created.
+     * Built by Vose's method in O(n) time, so that each draw then takes a single random
+     * number and one table lookup however many categories there are. Build a table once per
+     * set of weights, and reuse it for any number of draws.
      *
-     * Can be used as part of a coordinate pair in a unit square with radius 1,
-     * already squared to speed up testing for unit circle inclusion.
-     * Useful for Monte Carlo simulation.
+     * The weights are staged in this generator's float output array, so there can be at most
+     * as many categories as the array size set when the generator is created, and its contents
+     * are overwritten.
      *
-     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
-     * reused WASM memory view for performance. Default: false.
+     * A new table takes 8 bytes of WASM memory per category, plus up to 80 bytes of headers,
+     * for the life of the generator. Each generator has a single 64 KiB page of WASM memory,
+     * shared by its 2 output arrays and all of its alias and empirical tables, so with the
+     * default output array size of 1000, at most about 48 KiB is left for tables. To change
+     * a table's weights, pass it to be rebuilt in place rather than building a new one.
      *
-     * @returns View of the array in WASM memory for this generator, now refilled.
-     * This output buffer is reused with each call unless `copy` is true.
+     * @param weights - The weight of each category, numbered from 0: each a finite number of
+     * at least 0, with a positive, finite sum.
+     * @param table - An existing table from this generator with the same number of categories,
+     * to rebuild in place rather than allocating a new one. Default: undefined.
      *
-     * @remarks
-     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
-     * Use `copy=true` if storing multiple arrays.
+     * @returns The table, for use with this generator only.
      *
-     * @example
-     * // Immediate consumption (fast, no copy needed)
-     * const coords = gen.coordSquaredArray();
-     * let inCircle = 0;
-     * for (let i = 0; i < coords.length - 1; i += 2) {
-     *   if (coords[i] + coords[i + 1] <= 1) inCircle++;
-     * }
+     * @throws Error if there are no weights or more than the output array size, any weight
+     * is negative or not finite, their sum isn't positive and finite, `table` isn't from
+     * this generator or has a different number of categories, or a new table wouldn't fit
+     * in the generator's remaining WASM memory.
      *
      * @example
-     * // Store multiple arrays (use copy parameter)
-     * const arr1 = gen.coordSquaredArray(true);
-     * const arr2 = gen.coordSquaredArray(true);
-     * console.log(arr1 !== arr2); // true - independent copies
+     * // Common, rare and legendary drops, at 90%, 9% and 1%
+     * const loot = gen.aliasTable([90, 9, 1]);
+     * const drops = gen.categoricalArray(loot);
      */
-    coordSquaredArray(copy: boolean = false): Float64Array {
-        this._instance.coord53SquaredArray(this._arrayConfig.floatOutputArrayPtr);
+    aliasTable(weights: ArrayLike<number>, table?: AliasTable): AliasTable {
+        const size = weights.length;
+        if (size < 1 || size > this._outputArraySize) {
+            throw new Error(`weights must hold between 1 and ${this._outputArraySize} values, got ${size}`);
+        }
+
+        let sum = 0;
+        for (let i = 0; i < size; i++) {
+            const weight = weights[i];
+            if (!Number.isFinite(weight) || weight < 0) {
+                throw new Error(`weights must be finite numbers of at least 0, got ${weight} at index ${i}`);
+            }
+            sum += weight;
+        }
+        if (!(sum > 0 && Number.isFinite(sum))) {
+            throw new Error(`weights must have a positive, finite sum, got ${sum}`);
+        }
+
+        if (table === undefined) {
+            this.reserveTableMemory(size * BigUint64Array.BYTES_PER_ELEMENT);
+            table = Object.freeze({ size, ptr: this._instance.allocUint64Array(size) });
+            this._aliasTables.add(table);
+        } else {
+            this.validateAliasTable(table);
+            if (table.size !== size) {
+                throw new Error(`table has ${table.size} categories, but there are ${size} weights`);
+            }
+        }
+
+        this._arrayConfig.floatOutputArray.set(weights);
+        this._instance.aliasTableBuild(this._arrayConfig.floatOutputArrayPtr, table.ptr);
+        return table;
+    }
+
+    /**
+     * Reserves this generator's WASM memory for a new table's data of `bytes` bytes,
+     * throwing if it wouldn't fit, rather than letting the allocation abort in WASM.
+     */
+    private reserveTableMemory(bytes: number): void {
+        const needed = bytes + TABLE_ALLOCATION_OVERHEAD;
+        if (needed > this._tableBytesFree) {
+            throw new Error(`table needs up to ${needed} bytes of WASM memory, but this generator has only ${this._tableBytesFree} left; rebuild an existing table in place instead`);
+        }
+        this._tableBytesFree -= needed;
+    }
+
+    /**
+     * Validates that an alias table was built by this generator's {@link aliasTable}.
+     */
+    private validateAliasTable(table: AliasTable): void {
+        if (!this._aliasTables.has(table)) {
+            throw new Error('table must be an alias table built by this generator');
+        }
+    }
+
+    /**
+     * Gets this generator's next categorical number: a category drawn from an alias table,
+     * with probability proportional to its weight.
+     *
+     * Generated entirely in WASM from a single random number and one table lookup.
+     *
+     * @param table - The alias table, built by this generator's {@link aliasTable}.
+     *
+     * @returns A category, an integer from 0 to the number of categories - 1.
+     *
+     * @throws Error if `table` wasn't built by this generator.
+     *
+     * @example
+     * const route = gen.categorical(routes);
+     */
+    categorical(table: AliasTable): number {
+        this.validateAliasTable(table);
+        return this._instance.categorical(table.ptr);
+    }
+
+    /**
+     * Builds an empirical table in WASM memory from a tabulated, piecewise-linear CDF, such
+     * as one captured from production latencies or sizes, for drawing values from it with
+     * {@link empirical} and {@link empiricalArray}.
+     *
+     * Values are drawn by inversion, with a Chen-Asau guide table that finds each uniform
+     * number's segment of the CDF in under 2 steps on average, however many points it has,
+     * rather than a binary search. Build a table once per CDF, and reuse it for any number
+     * of draws.
+     *
+     * The points are staged in this generator's float output array, so there can be at most
+     * half as many points as the array size set when the generator is created, and its contents
+     * are overwritten.
+     *
+     * A new table takes 32 bytes of WASM memory per segment between points, plus up to 80 bytes
+     * of headers, for the life of the generator. It shares the generator's single 64 KiB page
+     * of WASM memory with the output arrays and the other tables, as for {@link aliasTable},
+     * so to change a table's CDF, pass it to be rebuilt in place rather than building a new one.
+     *
+     * @param values - The value at each point of the CDF, non-decreasing. Repeated values make
+     * a jump in the CDF, so that value is drawn with the jump's probability.
+     * @param cdf - The cumulative probability at each point, non-decreasing, and rescaled to run
+     * from 0 at the first point to 1 at the last. Repeated probabilities make a gap in the values
+     * that's never drawn.
+     * @param table - An existing table from this generator with the same number of points,
+     * to rebuild in place rather than allocating a new one. Default: undefined.
+     *
+     * @returns The table, for use with this generator only.
+     *
+     * @throws Error if there are fewer than 2 points or more than half the output array size,
+     * `values` and `cdf` differ in length, either isn't finite and non-decreasing, `cdf` doesn't
+     * rise overall, `table` isn't from this generator or has a different number of points, or
+     * a new table wouldn't fit in the generator's remaining WASM memory.
+     *
+     * @example
+     * // Request latencies in ms at the 0th, 50th, 90th, 99th and 100th percentiles
+     * const latency = gen.empiricalTable([2, 12, 40, 180, 2000], [0, 0.5, 0.9, 0.99, 1]);
+     * const latencies = gen.empiricalArray(latency);
+     */
+    empiricalTable(values: ArrayLike<number>, cdf: ArrayLike<number>, table?: EmpiricalTable): EmpiricalTable {
+        const size = values.length;
+        const maxSize = Math.floor(this._outputArraySize / 2);
+        if (size < 2 || size > maxSize) {
+            throw new Error(`values must hold between 2 and ${maxSize} points, got ${size}`);
+        }
+        if (cdf.length !== size) {
+            throw new Error(`cdf must hold a probability for each of the ${size} values, got ${cdf.length}`);
+        }
+        this.validateNonDecreasing('values', values);
+        this.validateNonDecreasing('cdf', cdf);
+        if (!(cdf[size - 1] > cdf[0])) {
+            throw new Error(`cdf must rise from its first point to its last, got ${cdf[0]} to ${cdf[size - 1]}`);
+        }
+
+        if (table === undefined) {
+            this.reserveTableMemory(4 * (size - 1) * Float64Array.BYTES_PER_ELEMENT);
+            table = Object.freeze({ size, ptr: this._instance.allocFloat64Array(4 * (size - 1)) });
+            this._empiricalTables.add(table);
+        } else {
+            this.validateEmpiricalTable(table);
+            if (table.size !== size) {
+                throw new Error(`table has ${table.size} points, but there are ${size} values`);
+            }
+        }
+
+        // staged as each point's value and then its probability, in turn
+        const points = this._arrayConfig.floatOutputArray;
+        for (let i = 0; i < size; i++) {
+            points[2 * i] = values[i];
+            points[2 * i + 1] = cdf[i];
+        }
+        this._instance.empiricalTableBuild(this._arrayConfig.floatOutputArrayPtr, table.ptr);
+        return table;
+    }
+
+    /**
+     * Validates that the points of an {@link empiricalTable} call are finite and non-decreasing.
+     */
+    private validateNonDecreasing(name: string, points: ArrayLike<number>): void {
+        for (let i = 0; i < points.length; i++) {
+            if (!Number.isFinite(points[i]) || (i > 0 && points[i] < points[i - 1])) {
+                throw new Error(`${name} must be finite and non-decreasing, got ${points[i]} at index ${i}`);
+            }
+        }
+    }
+
+    /**
+     * Validates that an empirical table was built by this generator's {@link empiricalTable}.
+     */
+    private validateEmpiricalTable(table: EmpiricalTable): void {
+        if (!this._empiricalTables.has(table)) {
+            throw new Error('table must be an empirical table built by this generator');
+        }
+    }
+
+    /**
+     * Gets this generator's next empirical number: a value drawn from an empirical table's
+     * CDF, interpolating linearly between its points.
+     *
+     * Generated entirely in WASM from a single random number, a guide table lookup and
+     * a short search.
+     *
+     * @param table - The empirical table, built by this generator's {@link empiricalTable}.
+     *
+     * @returns A value between the CDF's first and last values.
+     *
+     * @throws Error if `table` wasn't built by this generator.
+     *
+     * @example
+     * const size = gen.empirical(payloadSizes);
+     */
+    empirical(table: EmpiricalTable): number {
+        this.validateEmpiricalTable(table);
+        return this._instance.empirical(table.ptr);
+    }
+
+    /**
+     * Gets this generator's next normally distributed (Gaussian) number.
+     *
+     * Generated entirely in WASM with the 256-layer ziggurat method, which needs only a
+     * table lookup, a multiply and a compare for about 98.5% of numbers.
+     *
+     * @param mean - The mean (center) of the distribution. Default: 0.
+     * @param stddev - The standard deviation (spread) of the distribution, at least 0. Default: 1.
+     *
+     * @returns A normally distributed float with 52 bits of randomness.
+     *
+     * @throws Error if `mean` is not finite, or `stddev` is negative or not finite.
+     *
+     * @example
+     * // IQ-style scores
+     * const score = gen.normal(100, 15);
+     */
+    normal(mean: number = 0, stddev: number = 1): number {
+        this.validateNormal(mean, stddev);
+        return this._instance.normal53(mean, stddev);
+    }
+
+    /**
+     * Validates the parameters of a {@link normal} or {@link normalArray} call.
+     */
+    private validateNormal(mean: number, stddev: number): void {
+        if (!Number.isFinite(mean)) {
+            throw new Error(`mean must be a finite number, got ${mean}`);
+        }
+        if (!Number.isFinite(stddev) || stddev < 0) {
+            throw new Error(`stddev must be a finite number of at least 0, got ${stddev}`);
+        }
+    }
+
+    /**
+     * Gets this generator's next Cauchy distributed number, such as the ratio of 2 normal
+     * numbers, or a resonance line shape. It has no mean or variance, and its tails are very heavy.
+     *
+     * Generated entirely in WASM from a single random number and the inverse of the
+     * distribution's CDF.
+     *
+     * @param location - The location of the distribution: its median. Default: 0.
+     * @param scale - The scale of the distribution, greater than 0: its half width at half maximum.
+     * Default: 1.
+     *
+     * @returns A Cauchy distributed float with 52 bits of randomness.
+     *
+     * @throws Error if `location` is not finite, or `scale` is not a finite number greater than 0.
+     *
+     * @example
+     * // Energies in a resonance peak at 91.2, with a half width of 1.25
+     * const energy = gen.cauchy(91.2, 1.25);
+     */
+    cauchy(location: number = 0, scale: number = 1): number {
+        this.validateLocationScale(location, scale);
+        return this._instance.cauchy53(location, scale);
+    }
+
+    /**
+     * Validates the parameters of a location-scale distribution, such as {@link cauchy}
+     * or {@link gumbel}, or their arrays.
+     */
+    private validateLocationScale(location: number, scale: number): void {
+        if (!Number.isFinite(location)) {
+            throw new Error(`location must be a finite number, got ${location}`);
+        }
+        this.validatePositive('scale', scale);
+    }
+
+    /**
+     * Gets this generator's next Laplace distributed number, a double exponential: the
+     * difference between 2 exponential numbers.
+     *
+     * Generated entirely in WASM from a single random number and the inverse of the
+     * distribution's CDF.
+     *
+     * @param location - The location of the distribution: its mean. Default: 0.
+     * @param scale - The scale of the distribution, greater than 0. Its variance is 2 * `scale`^2.
+     * Default: 1.
+     *
+     * @returns A Laplace distributed float with 52 bits of randomness.
+     *
+     * @throws Error if `location` is not finite, or `scale` is not a finite number greater than 0.
+     *
+     * @example
+     * // Differentially private count, with sensitivity 1 and ε = 0.5
+     * const noisyCount = trueCount + gen.laplace(0, 1 / 0.5);
+     */
+    laplace(location: number = 0, scale: number = 1): number {
+        this.validateLocationScale(location, scale);
+        return this._instance.laplace53(location, scale);
+    }
+
+    /**
+     * Gets this generator's next logistic distributed number, such as the noise in a logit
+     * model, or an Elo rating difference. Its shape is close to a normal distribution's, with
+     * heavier tails.
+     *
+     * Generated entirely in WASM from a single random number and the inverse of the
+     * distribution's CDF.
+     *
+     * @param location - The location of the distribution: its mean. Default: 0.
+     * @param scale - The scale of the distribution, greater than 0. Its variance is
+     * (π * `scale`)^2 / 3. Default: 1.
+     *
+     * @returns A logistic distributed float with 52 bits of randomness.
+     *
+     * @throws Error if `location` is not finite, or `scale` is not a finite number greater than 0.
+     *
+     * @example
+     * // Performance gap between 2 chess players, on the Elo scale
+     * const gap = gen.logistic(1850 - 1700, 400 / Math.LN10);
+     */
+    logistic(location: number = 0, scale: number = 1): number {
+        this.validateLocationScale(location, scale);
+        return this._instance.logistic53(location, scale);
+    }
+
+    /**
+     * Gets this generator's next Gumbel distributed number, such as the largest of many
+     * samples, or the noise of the Gumbel-max trick.
+     *
+     * Generated entirely in WASM from a single random number and the inverse of the
+     * distribution's CDF.
+     *
+     * @param location - The location of the distribution: its mode. Default: 0.
+     * @param scale - The scale of the distribution, greater than 0. Default: 1.
+     *
+     * @returns A Gumbel distributed float with 52 bits of randomness.
+     *
+     * @throws Error if `location` is not finite, or `scale` is not a finite number greater than 0.
+     *
+     * @example
+     * // Annual maximum river level, in meters
+     * const peak = gen.gumbel(3.2, 0.6);
+     */
+    gumbel(location: number = 0, scale: number = 1): number {
+        this.validateLocationScale(location, scale);
+        return this._instance.gumbel53(location, scale);
+    }
+
+    /**
+     * Gets this generator's next Weibull distributed number, such as a time to failure,
+     * or a wind speed.
+     *
+     * Generated entirely in WASM from a single random number and the inverse of the
+     * distribution's CDF.
+     *
+     * @param shape - The shape (k) of the distribution, greater than 0. Below 1, the failure rate
+     * falls over time; above 1, it rises.
+     * @param scale - The scale (λ) of the distribution, greater than 0. Default: 1.
+     *
+     * @returns A Weibull distributed float with 52 bits of randomness. Very small shapes can
+     * overflow to `Infinity`.
+     *
+     * @throws Error if `shape` or `scale` is not a finite number greater than 0.
+     *
+     * @example
+     * // Hours until a component fails, with wear-out (k = 1.5) and a 1000 hour scale
+     * const hours = gen.weibull(1.5, 1000);
+     */
+    weibull(shape: number, scale: number = 1): number {
+        this.validatePositive('shape', shape);
+        this.validatePositive('scale', scale);
+        return this._instance.weibull53(shape, scale);
+    }
+
+    /**
+     * Gets this generator's next Pareto distributed number, such as a file size, a wealth
+     * or a city population, from a power law above a minimum.
+     *
+     * Generated entirely in WASM from a single random number and the inverse of the
+     * distribution's CDF.
+     *
+     * @param shape - The shape (α) of the distribution, greater than 0. Its mean is only finite
+     * for shapes above 1, and its variance for shapes above 2.
+     * @param scale - The scale of the distribution, greater than 0: its minimum. Default: 1.
+     *
+     * @returns A Pareto distributed float with 52 bits of randomness. Very small shapes can
+     * overflow to `Infinity`.
+     *
+     * @throws Error if `shape` or `scale` is not a finite number greater than 0.
+     *
+     * @example
+     * // File sizes in KB, of at least 4 KB, with the 80/20 rule's shape
+     * const size = gen.pareto(1.16, 4);
+     */
+    pareto(shape: number, scale: number = 1): number {
+        this.validatePositive('shape', shape);
+        this.validatePositive('scale', scale);
+        return this._instance.pareto53(shape, scale);
+    }
+
+    /**
+     * Validates the bounds of an {@link intRange}, {@link intRangeArray} or {@link smallIntRangeArray} call,
+     * which WASM would otherwise silently wrap to 32 bits.
+     */
+    private validateIntRange(min: number, max: number): void {
+        if (!Number.isInteger(min) || min < INT32_MIN || min > INT32_MAX) {
+            throw new Error(`min must be an integer between ${INT32_MIN} and ${INT32_MAX}, got ${min}`);
+        }
+        if (!Number.isInteger(max) || max < INT32_MIN || max > INT32_MAX) {
+            throw new Error(`max must be an integer between ${INT32_MIN} and ${INT32_MAX}, got ${max}`);
+        }
+        if (min > max) {
+            throw new Error(`min must not be greater than max, got ${min} > ${max}`);
+        }
+    }
+
+    /**
+     * Helper to copy BigUint64Array buffer values into a new independent array.
+     */
+    private copyBigUint64Array(): BigUint64Array {
+        const result = new BigUint64Array(this._arrayConfig.bigIntOutputArray.length);
+        result.set(this._arrayConfig.bigIntOutputArray);
+        return result;
+    }
+
+    /**
+     * Helper to copy Float64Array buffer values into a new independent array.
+     */
+    private copyFloat64Array(): Float64Array {
+        const result = new Float64Array(this._arrayConfig.floatOutputArray.length);
+        result.set(this._arrayConfig.floatOutputArray);
+        return result;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of unsigned 64-bit integers.
+     *
+     * Array size is set when generator is created.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Immediate consumption (fast, no copy needed)
+     * const sum = gen.int64Array().reduce((a, b) => a + b, 0n);
+     *
+     * @example
+     * // Store multiple arrays (use copy parameter)
+     * const arr1 = gen.int64Array(true);
+     * const arr2 = gen.int64Array(true);
+     * console.log(arr1 !== arr2); // true - independent copies
+     */
+    int64Array(copy: boolean = false): BigUint64Array {
+        this._instance.uint64Array(this._arrayConfig.bigIntOutputArrayPtr);
+        return copy ? this.copyBigUint64Array() : this._arrayConfig.bigIntOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with the unsigned 64-bit integers of this generator's stream,
+     * starting at block `counter`, without changing this generator's position.
+     *
+     * Only supported by counter-based generators (Philox), whose outputs are computed
+     * directly from their position: each block holds 2 values, so the first value returned
+     * is the stream's value at index `2 * counter`. Separate workers can each fill their own
+     * slice of one stream this way, with no jumps or coordination.
+     *
+     * @param counter - Index of the first block to generate, between 0 and 2^64 - 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `counter` is out of range, or if this generator type
+     * is not counter-based.
+     *
+     * @example
+     * // Worker i generates its own slice of a shared stream
+     * const gen = new RandomGenerator(PRNGType.Philox, seeds);
+     * const slice = gen.int64ArrayAt(BigInt(i * gen.outputArraySize / 2));
+     */
+    int64ArrayAt(counter: bigint | number, copy: boolean = false): BigUint64Array {
+        const counterBased = <CounterBasedPRNG>this._instance;
+        if (!counterBased.fillAt) {
+            throw new Error(`Generator type ${this._prngType} does not support int64ArrayAt()`);
+        }
+
+        const blockIndex = BigInt(counter);
+        if (blockIndex < 0n || blockIndex > 0xFFFFFFFFFFFFFFFFn) {
+            throw new Error(`counter must be between 0 and 2^64 - 1, got ${counter}`);
+        }
+
+        counterBased.fillAt(blockIndex, this._arrayConfig.bigIntOutputArrayPtr);
+        return copy ? this.copyBigUint64Array() : this._arrayConfig.bigIntOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of random bytes.
+     *
+     * Array size is set when generator is created: each call returns `8 * outputArraySize`
+     * bytes, the little-endian bytes of the values {@link int64Array} would return. For ChaCha
+     * generators, these are the bytes of the keystream, in order, suitable for keys, tokens and nonces.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // A 32-byte session token from a cryptographically secure generator
+     * const gen = new RandomGenerator(PRNGType.ChaCha20, null, null, 4);
+     * const token = gen.byteArray(true);
+     */
+    byteArray(copy: boolean = false): Uint8Array {
+        this._instance.uint64Array(this._arrayConfig.bigIntOutputArrayPtr);
+        return copy ? this._arrayConfig.byteOutputArray.slice() : this._arrayConfig.byteOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of unsigned 53-bit integers.
+     *
+     * Array size is set when generator is created.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Immediate consumption (fast, no copy needed)
+     * const max = Math.max(...gen.int53Array());
+     *
+     * @example
+     * // Store multiple arrays (use copy parameter)
+     * const arr1 = gen.int53Array(true);
+     * const arr2 = gen.int53Array(true);
+     * console.log(arr1 !== arr2); // true - independent copies
+     */
+    int53Array(copy: boolean = false): Float64Array {
+        this._instance.uint53AsFloatArray(this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+    
+    /**
+     * Fills WASM memory array with this generator's next set of unsigned 32-bit integers.
+     *
+     * Array size is set when generator is created.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Immediate consumption (fast, no copy needed)
+     * const sum = gen.int32Array().reduce((a, b) => a + b, 0);
+     *
+     * @example
+     * // Store multiple arrays (use copy parameter)
+     * const arr1 = gen.int32Array(true);
+     * const arr2 = gen.int32Array(true);
+     * console.log(arr1 !== arr2); // true - independent copies
+     */
+    int32Array(copy: boolean = false): Float64Array {
+        this._instance.uint32AsFloatArray(this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of floats in range [0, 1).
+     *
+     * Array size is set when generator is created.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Immediate consumption (fast, no copy needed)
+     * const avg = gen.floatArray().reduce((a, b) => a + b, 0) / gen.outputArraySize;
+     *
+     * @example
+     * // Store multiple arrays (use copy parameter)
+     * const arr1 = gen.floatArray(true);
+     * const arr2 = gen.floatArray(true);
+     * console.log(arr1 !== arr2); // true - independent copies
+     */
+    floatArray(copy: boolean = false): Float64Array {
+        this._instance.float53Array(this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+    
+    /**
+     * Fills WASM memory array with this generator's next set of floats in range [-1, 1).
+     *
+     * Array size is set when generator is created.
+     *
+     * Can be used as part of a coordinate pair in a unit square with radius 1.
+     * Useful for Monte Carlo simulation.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Immediate consumption (fast, no copy needed)
+     * const coords = gen.coordArray();
+     * for (let i = 0; i < coords.length; i++) {
+     *   processCoordinate(coords[i]);
+     * }
+     *
+     * @example
+     * // Store multiple arrays (use copy parameter)
+     * const arr1 = gen.coordArray(true);
+     * const arr2 = gen.coordArray(true);
+     * console.log(arr1 !== arr2); // true - independent copies
+     */
+    coordArray(copy: boolean = false): Float64Array {
+        this._instance.coord53Array(this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of floats in range [-1, 1)
+     * that have been squared.
+     *
+     * Array size is set when generator is created.
+     *
+     * Can be used as part of a coordinate pair in a unit square with radius 1,
+     * already squared to speed up testing for unit circle inclusion.
+     * Useful for Monte Carlo simulation.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Immediate consumption (fast, no copy needed)
+     * const coords = gen.coordSquaredArray();
+     * let inCircle = 0;
+     * for (let i = 0; i < coords.length - 1; i += 2) {
+     *   if (coords[i] + coords[i + 1] <= 1) inCircle++;
+     * }
+     *
+     * @example
+     * // Store multiple arrays (use copy parameter)
+     * const arr1 = gen.coordSquaredArray(true);
+     * const arr2 = gen.coordSquaredArray(true);
+     * console.log(arr1 !== arr2); // true - independent copies
+     */
+    coordSquaredArray(copy: boolean = false): Float64Array {
+        this._instance.coord53SquaredArray(this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of integers in the
+     * inclusive range [`min`, `max`].
+     *
+     * Array size is set when generator is created. Uses the same unbiased method as
+     * {@link intRange}; SIMD generators bound 2 values per instruction.
+     *
+     * @param min - Smallest possible result, a 32-bit signed integer.
+     * @param max - Largest possible result, a 32-bit signed integer no less than `min`.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `min` or `max` is not a 32-bit signed integer, or if `min` > `max`.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Immediate consumption (fast, no copy needed)
+     * const rolls = gen.intRangeArray(1, 6);
+     * const sixes = rolls.filter(roll => roll === 6).length;
+     */
+    intRangeArray(min: number, max: number, copy: boolean = false): Float64Array {
+        this.validateIntRange(min, max);
+        this._instance.intRangeArray(min, max, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of integers in the
+     * small inclusive range [`min`, `max`], such as dice rolls, coin flips or card draws.
+     *
+     * Array size is set when generator is created. Results are unbiased like {@link intRangeArray},
+     * but each 64-bit output is recycled into as many integers as it can hold (e.g. 23 rolls
+     * of a six-sided die), so far fewer outputs are generated per integer.
+     *
+     * @param min - Smallest possible result, a 32-bit signed integer.
+     * @param max - Largest possible result, a 32-bit signed integer no less than `min`,
+     * and at most `min + 65535`.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `min` or `max` is not a 32-bit signed integer, if `min` > `max`,
+     * or if the range holds more than 65536 integers.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Draw cards (with replacement) from a 52-card deck
+     * const cards = gen.smallIntRangeArray(0, 51);
+     */
+    smallIntRangeArray(min: number, max: number, copy: boolean = false): Float64Array {
+        this.validateIntRange(min, max);
+        if (max - min + 1 > SMALL_RANGE_MAX) {
+            throw new Error(`smallIntRangeArray() supports ranges of at most ${SMALL_RANGE_MAX} integers, got ${max - min + 1}`);
+        }
+
+        this._instance.smallIntRangeArray(min, max, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of exponentially distributed
+     * numbers.
+     *
+     * Array size is set when generator is created. Uses the same ziggurat method as
+     * {@link exponential}; SIMD generators take its fast path for 2 or 4 numbers at a time.
+     *
+     * @param rate - The rate of the distribution, greater than 0. Its mean is 1 / `rate`. Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `rate` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Service times for a queue that serves 4 customers per minute
+     * const minutes = gen.exponentialArray(4);
+     */
+    exponentialArray(rate: number = 1, copy: boolean = false): Float64Array {
+        this.validatePositive('rate', rate);
+        this._instance.exponential53Array(rate, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with the arrival times of this generator's next set of events
+     * in a Poisson process with `rate` events per unit of time, starting from `t0`.
+     *
+     * Array size is set when generator is created. Each time is the previous one plus an
+     * {@link exponential} gap, so the times are increasing. Both the gaps and their running
+     * total are computed in WASM, and the timeline is written straight into the output buffer.
+     *
+     * @param rate - The rate of the process, greater than 0.
+     * @param t0 - The time the process starts from, before the first event. Default: 0.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `rate` is not a finite number greater than 0, or `t0` is not finite.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * To continue the same timeline, pass the last time of one call as the next call's `t0`.
+     *
+     * @example
+     * // Request timestamps (ms) for a load test at 50 requests per second
+     * let times = gen.arrivalTimesArray(0.05);
+     * times = gen.arrivalTimesArray(0.05, times[times.length - 1]);
+     */
+    arrivalTimesArray(rate: number, t0: number = 0, copy: boolean = false): Float64Array {
+        this.validatePositive('rate', rate);
+        if (!Number.isFinite(t0)) {
+            throw new Error(`t0 must be a finite number, got ${t0}`);
+        }
+
+        this._instance.arrivalTimesArray(rate, t0, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of gamma distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same method as {@link gamma};
+     * SIMD generators build and squeeze 2 candidates at a time.
+     *
+     * @param shape - The shape (k) of the distribution, greater than 0.
+     * @param scale - The scale (θ) of the distribution, greater than 0. Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `shape` or `scale` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Posterior draws of a Poisson rate, after 42 events in 10 hours (gamma prior)
+     * const rates = gen.gammaArray(2 + 42, 1 / (1 + 10));
+     */
+    gammaArray(shape: number, scale: number = 1, copy: boolean = false): Float64Array {
+        this.validatePositive('shape', shape);
+        this.validatePositive('scale', scale);
+        this._instance.gamma53Array(shape, scale, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of beta distributed numbers
+     * in the range [0, 1].
+     *
+     * Array size is set when generator is created. Uses the same method as {@link beta};
+     * SIMD generators draw the gamma numbers for 2 results at a time.
+     *
+     * @param a - The first shape (α) of the distribution, greater than 0.
+     * @param b - The second shape (β) of the distribution, greater than 0.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `a` or `b` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Thompson sampling: draw each arm's conversion rate from its posterior
+     * const armA = gen.betaArray(1 + 12, 1 + 88, true);
+     * const armB = gen.betaArray(1 + 20, 1 + 130, true);
+     */
+    betaArray(a: number, b: number, copy: boolean = false): Float64Array {
+        this.validatePositive('a', a);
+        this.validatePositive('b', b);
+        this._instance.beta53Array(a, b, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of chi-squared distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same method as {@link gammaArray},
+     * with shape `k / 2` and scale 2.
+     *
+     * @param k - The degrees of freedom of the distribution, greater than 0.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `k` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * const statistics = gen.chiSquaredArray(4);
+     */
+    chiSquaredArray(k: number, copy: boolean = false): Float64Array {
+        this.validatePositive('k', k);
+        this._instance.chiSquared53Array(k, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of Poisson distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same methods as {@link poisson},
+     * setting up for `lambda` once per call; SIMD generators draw the uniform numbers
+     * for 2 or 4 results at a time.
+     *
+     * @param lambda - The mean (λ) of the distribution, at least 0.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `lambda` is negative or not finite.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Daily admissions to a hospital that averages 12.5 a day
+     * const admissions = gen.poissonArray(12.5);
+     */
+    poissonArray(lambda: number, copy: boolean = false): Float64Array {
+        this.validatePoisson(lambda);
+        this._instance.poissonArray(lambda, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of binomially distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same methods as {@link binomial},
+     * setting up for `n` and `p` once per call; SIMD generators draw the uniform numbers
+     * for 2 or 4 results at a time.
+     *
+     * @param n - The number of trials, an integer from 0 to 2^31 - 1.
+     * @param p - The success probability of each trial, in the range [0, 1].
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `n` is not an integer in range, or `p` is not a number in the range [0, 1].
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Susceptible agents infected this tick, in wards of 200 at a 2% daily risk
+     * const newCases = gen.binomialArray(200, 0.02);
+     */
+    binomialArray(n: number, p: number, copy: boolean = false): Float64Array {
+        this.validateBinomial(n, p);
+        this._instance.binomialArray(n, p, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of geometric distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same method as {@link geometric};
+     * SIMD generators draw the random numbers for 2 or 4 results at a time.
+     *
+     * @param p - The success probability of each trial, in the range (0, 1].
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `p` is not a number greater than 0 and at most 1.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * const attempts = gen.geometricArray(0.05);
+     */
+    geometricArray(p: number, copy: boolean = false): Float64Array {
+        this.validateGeometric(p);
+        this._instance.geometricArray(p, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Runs `n` Bernoulli trials that each succeed with probability `p`, and fills WASM memory
+     * array with the indices of the successes, in increasing order.
+     *
+     * Rather than testing every trial, WASM skips straight from one success to the next
+     * with {@link geometric} numbers, so the cost follows the number of successes: a million
+     * trials at `p = 0.001` take about a thousand random numbers instead of a million.
+     *
+     * Fills at most the array size set when the generator is created. If it's filled before
+     * the trials run out, pass the last index plus 1 as the next call's `start` to continue
+     * with the remaining trials.
+     *
+     * @param n - The number of trials, an integer of at least 0, numbered from 0.
+     * @param p - The success probability of each trial, in the range [0, 1].
+     * @param start - The index of the first trial to run. Default: 0.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the start of the array in WASM memory for this generator, holding
+     * just the indices of the successes. This output buffer is reused with each call unless
+     * `copy` is true.
+     *
+     * @throws Error if `n` or `start` is not a non-negative safe integer, or `p` is not
+     * a number in the range [0, 1].
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Agents (out of a million) that mutate this generation, at a rate of 1 in 10,000
+     * const mutants = gen.sparseBernoulliIndices(1_000_000, 1e-4);
+     */
+    sparseBernoulliIndices(n: number, p: number, start: number = 0, copy: boolean = false): Float64Array {
+        this.validateCount('n', n);
+        this.validateProbability(p);
+        this.validateCount('start', start);
+
+        const count = this._instance.sparseBernoulliIndices(n, p, start, this._arrayConfig.floatOutputArrayPtr);
+        const indices = this._arrayConfig.floatOutputArray.subarray(0, count);
+        return copy ? indices.slice() : indices;
+    }
+
+    /**
+     * Fills WASM memory array with the edge list of a G(n, p) (Erdős–Rényi) random graph on
+     * `nodes` nodes, which includes each of the `nodes * (nodes - 1) / 2` possible edges
+     * independently with probability `p`.
+     *
+     * Each edge takes 2 elements, its lower node and then its higher node, and edges are
+     * ordered by their higher node, then their lower node. Built on the same geometric skips
+     * as {@link sparseBernoulliIndices}, so the cost follows the number of edges rather than
+     * the number of possible edges.
+     *
+     * Fills at most half the array size set when the generator is created with edges. If it's
+     * filled before the possible edges run out, pass `w * (w - 1) / 2 + v + 1` for the last
+     * edge `(v, w)` as the next call's `start` to continue with the remaining edges.
+     *
+     * @param nodes - The number of nodes, an integer from 0 to 2^26, numbered from 0.
+     * @param p - The probability of each edge, in the range [0, 1].
+     * @param start - The number of the first possible edge to consider, in the order above. Default: 0.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the start of the array in WASM memory for this generator, holding
+     * just the edges' node pairs. This output buffer is reused with each call unless
+     * `copy` is true.
+     *
+     * @throws Error if `nodes` is not an integer in range, `p` is not a number in the range
+     * [0, 1], or `start` is not a non-negative safe integer.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // A sparse contact network of 10,000 people, with 5 contacts each on average
+     * const edges = gen.randomGraphEdges(10_000, 5 / 9_999);
+     * for (let i = 0; i < edges.length; i += 2) {
+     *     connect(edges[i], edges[i + 1]);
+     * }
+     */
+    randomGraphEdges(nodes: number, p: number, start: number = 0, copy: boolean = false): Float64Array {
+        if (!Number.isInteger(nodes) || nodes < 0 || nodes > GRAPH_NODES_MAX) {
+            throw new Error(`nodes must be an integer between 0 and ${GRAPH_NODES_MAX}, got ${nodes}`);
+        }
+        this.validateProbability(p);
+        this.validateCount('start', start);
+
+        const count = this._instance.randomGraphEdges(nodes, p, start, this._arrayConfig.floatOutputArrayPtr);
+        const edges = this._arrayConfig.floatOutputArray.subarray(0, 2 * count);
+        return copy ? edges.slice() : edges;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of Zipf distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same method as {@link zipf},
+     * setting up for `n` and `s` once per call; SIMD generators draw the uniform numbers
+     * for 2 or 4 results at a time.
+     *
+     * @param n - The number of ranks, an integer from 1 to 2^53 - 1.
+     * @param s - The exponent of the distribution, at least 0.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `n` is not an integer in range, or `s` is negative or not finite.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Cache keys requested by a load test, over a billion keys
+     * const keys = gen.zipfArray(1_000_000_000, 0.99);
+     */
+    zipfArray(n: number, s: number, copy: boolean = false): Float64Array {
+        this.validateZipf(n, s);
+        this._instance.zipfArray(n, s, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of categorical numbers, drawn
+     * from an alias table.
+     *
+     * Array size is set when generator is created. Uses the same method as {@link categorical},
+     * with a single random number and one table lookup per category drawn; SIMD generators
+     * draw the random numbers for 2 or 4 results at a time.
+     *
+     * @param table - The alias table, built by this generator's {@link aliasTable}.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `table` wasn't built by this generator.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Servers for the next batch of requests, weighted by capacity
+     * const routes = gen.aliasTable([4, 4, 2, 1]);
+     * const servers = gen.categoricalArray(routes);
+     */
+    categoricalArray(table: AliasTable, copy: boolean = false): Float64Array {
+        this.validateAliasTable(table);
+        this._instance.categoricalArray(table.ptr, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of empirical numbers, drawn from
+     * an empirical table's CDF.
+     *
+     * Array size is set when generator is created. Uses the same method as {@link empirical},
+     * at close to the speed of {@link floatArray}; SIMD generators draw the uniform numbers
+     * for 2 or 4 results, and interpolate within the CDF for 2, at a time.
+     *
+     * @param table - The empirical table, built by this generator's {@link empiricalTable}.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `table` wasn't built by this generator.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Replay payload sizes in bytes, with 10% of them exactly 512
+     * const payloadSizes = gen.empiricalTable([64, 512, 512, 65536], [0, 0.4, 0.5, 1]);
+     * const sizes = gen.empiricalArray(payloadSizes);
+     */
+    empiricalArray(table: EmpiricalTable, copy: boolean = false): Float64Array {
+        this.validateEmpiricalTable(table);
+        this._instance.empiricalArray(table.ptr, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Validates a count or index that must be a non-negative safe integer,
+     * which WASM handles exactly as an f64.
+     */
+    private validateCount(name: string, value: number): void {
+        if (!Number.isSafeInteger(value) || value < 0) {
+            throw new Error(`${name} must be a non-negative safe integer, got ${value}`);
+        }
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of normally distributed
+     * (Gaussian) numbers.
+     *
+     * Array size is set when generator is created. Uses the same ziggurat method as
+     * {@link normal}; SIMD generators take its fast path for 2 or 4 numbers at a time.
+     *
+     * @param mean - The mean (center) of the distribution. Default: 0.
+     * @param stddev - The standard deviation (spread) of the distribution, at least 0. Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `mean` is not finite, or `stddev` is negative or not finite.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Measurement noise around a signal
+     * const noise = gen.normalArray(0, 0.05);
+     */
+    normalArray(mean: number = 0, stddev: number = 1, copy: boolean = false): Float64Array {
+        this.validateNormal(mean, stddev);
+        this._instance.normal53Array(mean, stddev, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of normally distributed
+     * (Gaussian) numbers, drawn in pairs by the Box-Muller transform.
+     *
+     * Only supported by `Xoroshiro128Plus_SIMD` and `Xoshiro256Plus_SIMD`, which compute both
+     * lanes' logarithms, sines and cosines together, with no rejection loop or table lookups.
+     * The numbers follow the same distribution as {@link normalArray}, but not the same
+     * sequence; which is faster depends on the runtime, and
+     * `debug-tools/normal-pair-perf-test.js` compares them.
+     *
+     * @param mean - The mean (center) of the distribution. Default: 0.
+     * @param stddev - The standard deviation (spread) of the distribution, at least 0. Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `mean` is not finite, `stddev` is negative or not finite, or if
+     * this generator type does not support Box-Muller pairs.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * const gen = new RandomGenerator(PRNGType.Xoshiro256Plus_SIMD);
+     * const noise = gen.normalPairArray(0, 0.05);
+     */
+    normalPairArray(mean: number = 0, stddev: number = 1, copy: boolean = false): Float64Array {
+        const normalPair = <NormalPairPRNG>this._instance;
+        if (!normalPair.normalPairArray) {
+            throw new Error(`Generator type ${this._prngType} does not support normalPairArray()`);
+        }
+
+        this.validateNormal(mean, stddev);
+        normalPair.normalPairArray(mean, stddev, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of Cauchy distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same inverse CDF as {@link cauchy},
+     * applied in the same WASM loop that draws the uniform numbers, so the results are written
+     * straight into the output buffer; SIMD generators draw them for 2 or 4 numbers at a time.
+     *
+     * @param location - The location of the distribution: its median. Default: 0.
+     * @param scale - The scale of the distribution, greater than 0: its half width at half maximum.
+     * Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `location` is not finite, or `scale` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Heavy-tailed noise, to test that a fit is robust to outliers
+     * const noise = gen.cauchyArray(0, 0.1);
+     */
+    cauchyArray(location: number = 0, scale: number = 1, copy: boolean = false): Float64Array {
+        this.validateLocationScale(location, scale);
+        this._instance.cauchy53Array(location, scale, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of Laplace distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same inverse CDF as {@link laplace},
+     * applied in the same WASM loop that draws the uniform numbers, so the results are written
+     * straight into the output buffer; SIMD generators draw them for 2 or 4 numbers at a time.
+     *
+     * @param location - The location of the distribution: its mean. Default: 0.
+     * @param scale - The scale of the distribution, greater than 0. Its variance is 2 * `scale`^2.
+     * Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `location` is not finite, or `scale` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Noise for a batch of differentially private sums
+     * const noise = gen.laplaceArray(0, 2);
+     */
+    laplaceArray(location: number = 0, scale: number = 1, copy: boolean = false): Float64Array {
+        this.validateLocationScale(location, scale);
+        this._instance.laplace53Array(location, scale, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of logistic distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same inverse CDF as {@link logistic},
+     * applied in the same WASM loop that draws the uniform numbers, so the results are written
+     * straight into the output buffer; SIMD generators draw them for 2 or 4 numbers at a time.
+     *
+     * @param location - The location of the distribution: its mean. Default: 0.
+     * @param scale - The scale of the distribution, greater than 0. Its variance is
+     * (π * `scale`)^2 / 3. Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `location` is not finite, or `scale` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Latent utilities for a logit choice model
+     * const utilities = gen.logisticArray(0, 1);
+     */
+    logisticArray(location: number = 0, scale: number = 1, copy: boolean = false): Float64Array {
+        this.validateLocationScale(location, scale);
+        this._instance.logistic53Array(location, scale, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of Gumbel distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same inverse CDF as {@link gumbel},
+     * applied in the same WASM loop that draws the uniform numbers, so the results are written
+     * straight into the output buffer; SIMD generators draw them for 2 or 4 numbers at a time.
+     *
+     * @param location - The location of the distribution: its mode. Default: 0.
+     * @param scale - The scale of the distribution, greater than 0. Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `location` is not finite, or `scale` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Gumbel-max trick: the largest of log(weight) + noise picks a category by weight
+     * const noise = gen.gumbelArray();
+     */
+    gumbelArray(location: number = 0, scale: number = 1, copy: boolean = false): Float64Array {
+        this.validateLocationScale(location, scale);
+        this._instance.gumbel53Array(location, scale, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of Weibull distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same inverse CDF as {@link weibull},
+     * applied in the same WASM loop that draws the uniform numbers, so the results are written
+     * straight into the output buffer; SIMD generators draw them for 2 or 4 numbers at a time.
+     *
+     * @param shape - The shape (k) of the distribution, greater than 0. Below 1, the failure rate
+     * falls over time; above 1, it rises.
+     * @param scale - The scale (λ) of the distribution, greater than 0. Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `shape` or `scale` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Hourly wind speeds in m/s
+     * const speeds = gen.weibullArray(2, 8);
+     */
+    weibullArray(shape: number, scale: number = 1, copy: boolean = false): Float64Array {
+        this.validatePositive('shape', shape);
+        this.validatePositive('scale', scale);
+        this._instance.weibull53Array(shape, scale, this._arrayConfig.floatOutputArrayPtr);
+        return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
+    }
+
+    /**
+     * Fills WASM memory array with this generator's next set of Pareto distributed numbers.
+     *
+     * Array size is set when generator is created. Uses the same inverse CDF as {@link pareto},
+     * applied in the same WASM loop that draws the uniform numbers, so the results are written
+     * straight into the output buffer; SIMD generators draw them for 2 or 4 numbers at a time.
+     *
+     * @param shape - The shape (α) of the distribution, greater than 0. Its mean is only finite
+     * for shapes above 1, and its variance for shapes above 2.
+     * @param scale - The scale of the distribution, greater than 0: its minimum. Default: 1.
+     *
+     * @param copy - If true, returns a copy of the buffer. If false (default), returns the
+     * reused WASM memory view for performance. Default: false.
+     *
+     * @returns View of the array in WASM memory for this generator, now refilled.
+     * This output buffer is reused with each call unless `copy` is true.
+     *
+     * @throws Error if `shape` or `scale` is not a finite number greater than 0.
+     *
+     * @remarks
+     * **⚠️ Warning:** Buffer is reused on each call when `copy=false` (default).
+     * Use `copy=true` if storing multiple arrays.
+     *
+     * @example
+     * // Request payload sizes in bytes, of at least 512 bytes
+     * const sizes = gen.paretoArray(1.5, 512);
+     */
+    paretoArray(shape: number, scale: number = 1, copy: boolean = false): Float64Array {
+        this.validatePositive('shape', shape);
+        this.validatePositive('scale', scale);
+        this._instance.pareto53Array(shape, scale, this._arrayConfig.floatOutputArrayPtr);
         return copy ? this.copyFloat64Array() : this._arrayConfig.floatOutputArray;
     }
 
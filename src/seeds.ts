@@ -1,3 +1,55 @@
+import type { PRNG } from './types/prng';
+
+// rolldown-plugin-wasm imports this binary as a base64 string, and provides a
+// function that synchronously instantiates it
+import SplitMix64Wasm from '../bin/splitmix64.wasm?init&sync';
+
+// Seed counts at and above this are generated in WASM, where native 64-bit arithmetic
+// avoids allocating several intermediate BigInts per seed. Below it, the cost of the
+// BigInt arithmetic is smaller than that of copying out of WASM memory.
+const WASM_SEED_THRESHOLD = 256;
+
+// Seeds generated per WASM call: the module's memory is a single 64 KiB page,
+// so larger counts are filled in chunks through one reused output array
+const WASM_CHUNK_SIZE = 1024;
+
+// SplitMix64's state is a Weyl sequence, advanced by this increment every step
+const GAMMA = 0x9e3779b97f4a7c15n;
+
+/** The SplitMix64 WASM module's exports, and its reused output array. */
+interface WasmSeeder {
+    exports: Pick<PRNG, 'memory' | 'setSeeds' | 'uint64Array' | 'allocUint64Array'>;
+    chunkPtr: number;
+    chunk: BigUint64Array;
+}
+
+// Instantiated on first use, as most seed collections are small enough for BigInt
+let wasmSeeder: WasmSeeder | null = null;
+
+function getWasmSeeder(): WasmSeeder {
+    if (wasmSeeder === null) {
+        const exports: WasmSeeder['exports'] = SplitMix64Wasm({
+            env: {
+                abort(_msg: any, _file: any, line: any, column: any) {
+                    console.error(`WASM abort at:${line}:${column}: `, _msg);
+                }
+            }
+        }).exports;
+
+        const chunkPtr = exports.allocUint64Array(WASM_CHUNK_SIZE);
+        const dataView = new DataView(exports.memory.buffer);
+        const chunk = new BigUint64Array(
+            exports.memory.buffer,
+            dataView.getUint32(chunkPtr + 4, true), // array byte offset
+            WASM_CHUNK_SIZE
+        );
+
+        wasmSeeder = { exports, chunkPtr, chunk };
+    }
+
+    return wasmSeeder;
+}
+
 /**
  * Generate a random 32-bit unsigned integer for seeding.
  *
@@ -90,12 +142,48 @@ export class SplitMix64 {
         z = ((z ^ (z >> 27n)) * 0x94d049bb133111ebn) & 0xFFFFFFFFFFFFFFFFn;
         return z ^ (z >> 31n);
     }
+
+    /**
+     * Generates the next `count` values, exactly as `count` calls to {@link next} would.
+     *
+     * Large counts are generated in WASM with native 64-bit arithmetic, which avoids
+     * the BigInt allocation (and garbage collection) of {@link next}, leaving only
+     * the returned values to allocate.
+     *
+     * @param count Number of values to generate.
+     *
+     * @returns Array of the next `count` values.
+     */
+    nextArray(count: number): bigint[] {
+        if (count < WASM_SEED_THRESHOLD) {
+            return Array.from({ length: count }, () => this.next());
+        }
+
+        const { exports, chunkPtr, chunk } = getWasmSeeder();
+        const result = new BigUint64Array(count);
+
+        // WASM takes the state as a wrapped 64-bit integer
+        exports.setSeeds(this._state);
+
+        for (let offset = 0; offset < count; offset += WASM_CHUNK_SIZE) {
+            exports.uint64Array(chunkPtr);
+            result.set(chunk.subarray(0, Math.min(WASM_CHUNK_SIZE, count - offset)), offset);
+        }
+
+        // The last chunk may generate past `count`, so step the Weyl sequence directly
+        this._state = (this._state + BigInt(count) * GAMMA) & 0xFFFFFFFFFFFFFFFFn;
+
+        return Array.from(result);
+    }
 }
 
 /**
  * Generates an array of random 64-bit integers suitable for seeding
  * the other generators in this library.
  *
+ * Large counts (for seeding a bank of generators at once) are generated in WASM,
+ * producing exactly the same seeds without per-seed BigInt arithmetic.
+ *
  * @param count Number of random seeds to generate.
  *
  * @param seed Seed for SplitMix64 generator initialization. If not provided,
@@ -106,6 +194,29 @@ export class SplitMix64 {
  * @returns Array of unique 64-bit seeds.
  */
 export function seed64Array(count = 8, seed: number | bigint | null = null): bigint[] {
-    const sm64 = new SplitMix64(seed);
-    return new Array(count).fill(0n).map(() => sm64.next());
+    return new SplitMix64(seed).nextArray(count);
+}
+
+/**
+ * Generates an array of random 64-bit integers drawn directly from
+ * crypto.getRandomValues(), suitable for keying the cryptographically
+ * secure (ChaCha) generators in this library.
+ *
+ * Unlike {@link seed64Array}, which expands a single 64-bit seed, every
+ * bit of every value comes from the platform's secure random source.
+ *
+ * @param count Number of random seeds to generate.
+ *
+ * @returns Array of random 64-bit seeds.
+ *
+ * @throws Error if crypto.getRandomValues() is not available.
+ */
+export function secureSeed64Array(count = 8): bigint[] {
+    if (typeof crypto === 'undefined' || !crypto.getRandomValues) {
+        throw new Error('secureSeed64Array() requires crypto.getRandomValues()');
+    }
+
+    const seeds = new BigUint64Array(count);
+    crypto.getRandomValues(seeds);
+    return Array.from(seeds);
 }
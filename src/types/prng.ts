@@ -4,14 +4,98 @@
 export enum PRNGType {
     /** PCG XSH RR */
     PCG = 'PCG',
+    /** PCG XSH RR (SIMD-enabled) */
+    PCG_SIMD = 'PCG_SIMD',
+    /** PCG64 DXSM */
+    PCG64 = 'PCG64',
+    /** Philox4x32-10 */
+    Philox = 'Philox',
+    /** Philox4x32-10 (SIMD-enabled) */
+    Philox_SIMD = 'Philox_SIMD',
+    /** ChaCha8 (SIMD-enabled, cryptographically secure) */
+    ChaCha8 = 'ChaCha8',
+    /** ChaCha12 (SIMD-enabled, cryptographically secure) */
+    ChaCha12 = 'ChaCha12',
+    /** ChaCha20 (SIMD-enabled, cryptographically secure) */
+    ChaCha20 = 'ChaCha20',
+    /** SFC64 */
+    SFC64 = 'SFC64',
+    /** SFC64 (SIMD-enabled) */
+    SFC64_SIMD = 'SFC64_SIMD',
+    /** RomuTrio */
+    RomuTrio = 'RomuTrio',
+    /** RomuTrio (SIMD-enabled) */
+    RomuTrio_SIMD = 'RomuTrio_SIMD',
+    /** RomuDuoJr */
+    RomuDuoJr = 'RomuDuoJr',
+    /** RomuDuoJr (SIMD-enabled) */
+    RomuDuoJr_SIMD = 'RomuDuoJr_SIMD',
     /** Xoroshiro128+ */
     Xoroshiro128Plus = 'Xoroshiro128Plus',
     /** Xoroshiro128+ (SIMD-enabled) */
     Xoroshiro128Plus_SIMD = 'Xoroshiro128Plus_SIMD',
+    /** Xoroshiro128+ (4-lane SIMD) */
+    Xoroshiro128Plus_SIMDx4 = 'Xoroshiro128Plus_SIMDx4',
+    /** Xoroshiro128++ */
+    Xoroshiro128PlusPlus = 'Xoroshiro128PlusPlus',
+    /** Xoroshiro128++ (SIMD-enabled) */
+    Xoroshiro128PlusPlus_SIMD = 'Xoroshiro128PlusPlus_SIMD',
+    /** Xoroshiro128** */
+    Xoroshiro128StarStar = 'Xoroshiro128StarStar',
+    /** Xoroshiro128** (SIMD-enabled) */
+    Xoroshiro128StarStar_SIMD = 'Xoroshiro128StarStar_SIMD',
     /** Xoshiro256+ */
     Xoshiro256Plus = 'Xoshiro256Plus',
     /** Xoshiro256+ (SIMD-enabled) */
-    Xoshiro256Plus_SIMD = 'Xoshiro256Plus_SIMD'
+    Xoshiro256Plus_SIMD = 'Xoshiro256Plus_SIMD',
+    /** Xoshiro256+ (4-lane SIMD) */
+    Xoshiro256Plus_SIMDx4 = 'Xoshiro256Plus_SIMDx4',
+    /** Xoshiro256++ */
+    Xoshiro256PlusPlus = 'Xoshiro256PlusPlus',
+    /** Xoshiro256++ (SIMD-enabled) */
+    Xoshiro256PlusPlus_SIMD = 'Xoshiro256PlusPlus_SIMD',
+    /** Xoshiro256** */
+    Xoshiro256StarStar = 'Xoshiro256StarStar',
+    /** Xoshiro256** (SIMD-enabled) */
+    Xoshiro256StarStar_SIMD = 'Xoshiro256StarStar_SIMD'
+}
+
+/**
+ * Selects a unique stream within a two-level (node → worker) layout, for
+ * distributed computations that share seeds across several nodes, each
+ * running several parallel workers.
+ *
+ * Each node is given its own long jump slot within the generator's period,
+ * and each of that node's workers makes short jumps inside that slot.
+ */
+export interface HierarchicalStreamId {
+  /** Selects this generator's long jump slot. */
+  nodeId: bigint | number;
+  /** Selects this generator's stream within its node's long jump slot. */
+  workerId: bigint | number;
+}
+
+/**
+ * An alias table for weighted categorical draws, built in one generator's WASM memory
+ * by its `aliasTable()` method, and reused by its `categorical()` and `categoricalArray()`.
+ */
+export interface AliasTable {
+  /** The number of categories. */
+  readonly size: number;
+  /** Pointer to the table in its generator's WASM memory. */
+  readonly ptr: number;
+}
+
+/**
+ * An empirical table for drawing values from a tabulated, piecewise-linear CDF, built in
+ * one generator's WASM memory by its `empiricalTable()` method, and reused by its
+ * `empirical()` and `empiricalArray()`.
+ */
+export interface EmpiricalTable {
+  /** The number of points in the CDF. */
+  readonly size: number;
+  /** Pointer to the table in its generator's WASM memory. */
+  readonly ptr: number;
 }
 
 /**
@@ -45,6 +129,25 @@ export interface PRNG extends WebAssembly.Exports {
   float53(): number;
   coord53(): number;
   coord53Squared(): number;
+  uint32Below(bound: number): number;
+  intRange(min: number, max: number): number;
+  normal53(mean: number, stddev: number): number;
+  exponential53(rate: number): number;
+  gamma53(shape: number, scale: number): number;
+  beta53(a: number, b: number): number;
+  chiSquared53(k: number): number;
+  poisson(lambda: number): number;
+  binomial(n: number, p: number): number;
+  geometric(p: number): number;
+  zipf(n: number, s: number): number;
+  categorical(tablePtr: number): number;
+  empirical(tablePtr: number): number;
+  cauchy53(location: number, scale: number): number;
+  laplace53(location: number, scale: number): number;
+  logistic53(location: number, scale: number): number;
+  gumbel53(location: number, scale: number): number;
+  weibull53(shape: number, scale: number): number;
+  pareto53(shape: number, scale: number): number;
   
   // bulk array fill
   uint64Array(int64Array: number): void;
@@ -53,6 +156,29 @@ export interface PRNG extends WebAssembly.Exports {
   float53Array(arrPtr: number): void;
   coord53Array(arrPtr: number): void;
   coord53SquaredArray(arrPtr: number): void;
+  uint32BelowArray(bound: number, arrPtr: number): void;
+  intRangeArray(min: number, max: number, arrPtr: number): void;
+  smallIntRangeArray(min: number, max: number, arrPtr: number): void;
+  normal53Array(mean: number, stddev: number, arrPtr: number): void;
+  exponential53Array(rate: number, arrPtr: number): void;
+  arrivalTimesArray(rate: number, t0: number, arrPtr: number): void;
+  gamma53Array(shape: number, scale: number, arrPtr: number): void;
+  beta53Array(a: number, b: number, arrPtr: number): void;
+  chiSquared53Array(k: number, arrPtr: number): void;
+  poissonArray(lambda: number, arrPtr: number): void;
+  binomialArray(n: number, p: number, arrPtr: number): void;
+  geometricArray(p: number, arrPtr: number): void;
+  sparseBernoulliIndices(n: number, p: number, start: number, arrPtr: number): number;
+  randomGraphEdges(nodes: number, p: number, start: number, arrPtr: number): number;
+  zipfArray(n: number, s: number, arrPtr: number): void;
+  categoricalArray(tablePtr: number, arrPtr: number): void;
+  empiricalArray(tablePtr: number, arrPtr: number): void;
+  cauchy53Array(location: number, scale: number, arrPtr: number): void;
+  laplace53Array(location: number, scale: number, arrPtr: number): void;
+  logistic53Array(location: number, scale: number, arrPtr: number): void;
+  gumbel53Array(location: number, scale: number, arrPtr: number): void;
+  weibull53Array(shape: number, scale: number, arrPtr: number): void;
+  pareto53Array(shape: number, scale: number, arrPtr: number): void;
   
   // embedded monte carlo test
   batchTestUnitCirclePoints(count: number): number;
@@ -60,12 +186,40 @@ export interface PRNG extends WebAssembly.Exports {
   // WASM instance memory management
   allocUint64Array(count: number): number;
   allocFloat64Array(count: number): number;
+
+  // alias tables for categorical draws, and empirical tables for tabulated CDFs,
+  // built from weights or points in WASM memory
+  aliasTableBuild(weightsPtr: number, tablePtr: number): void;
+  empiricalTableBuild(pointsPtr: number, tablePtr: number): void;
 }
 
 export interface JumpablePRNG extends PRNG {
   jump(): void;
+  jumpTo(streamIndex: bigint): void;
+  longJump(): void;
+  longJumpTo(nodeIndex: bigint): void;
 }
 
 export interface IncrementablePRNG extends PRNG {
-  setStreamIncrement(inc: bigint): void;
+  // 1 increment per stream (2 for SIMD variants, one per lane)
+  setStreamIncrement(...inc: bigint[]): void;
+}
+
+export interface AdvanceablePRNG extends PRNG {
+  advance(delta: bigint): void;
+}
+
+export interface CounterBasedPRNG extends PRNG {
+  // fills the array with the current stream's outputs, starting at block `counter`
+  fillAt(counter: bigint, int64Array: number): void;
+}
+
+export interface NormalPairPRNG extends PRNG {
+  // fills the array with normal numbers drawn in pairs by the SIMD Box-Muller transform
+  normalPairArray(mean: number, stddev: number, arrPtr: number): void;
+}
+
+export interface ChaChaPRNG extends JumpablePRNG {
+  // 8, 12 or 20, set once on instantiation (ChaCha8, ChaCha12, ChaCha20)
+  setRounds(rounds: number): void;
 }
@@ -17,9 +17,18 @@ import { RandomGenerator, PRNGType, seed64Array } from 'fast-prng-wasm';
 export const TEST_SEEDS = {
     single: [0x9E3779B97F4A7C15n],
     double: [0x9E3779B97F4A7C15n, 0x6C078965D5B2A5D3n],
+    triple: [0x9E3779B97F4A7C15n, 0x6C078965D5B2A5D3n, 0xBF58476D1CE4E5B9n],
     quad: [0x9E3779B97F4A7C15n, 0x6C078965D5B2A5D3n, 0xBF58476D1CE4E5B9n, 0x94D049BB133111EBn],
     octet: [0x9E3779B97F4A7C15n, 0x6C078965D5B2A5D3n, 0xBF58476D1CE4E5B9n, 0x94D049BB133111EBn,
-            0x8C6D2D3A5F9A4B1Cn, 0xD3C5E8B2F7A16E4An, 0xA7B9C1D3E5F70829n, 0xF1E2D3C4B5A69788n]
+            0x8C6D2D3A5F9A4B1Cn, 0xD3C5E8B2F7A16E4An, 0xA7B9C1D3E5F70829n, 0xF1E2D3C4B5A69788n],
+    // first 6 of the primary octet (3 seeds per SIMD lane)
+    sextuple: [0x9E3779B97F4A7C15n, 0x6C078965D5B2A5D3n, 0xBF58476D1CE4E5B9n,
+               0x94D049BB133111EBn, 0x8C6D2D3A5F9A4B1Cn, 0xD3C5E8B2F7A16E4An],
+    // primary octet followed by alternate octet
+    hexadecuple: [0x9E3779B97F4A7C15n, 0x6C078965D5B2A5D3n, 0xBF58476D1CE4E5B9n, 0x94D049BB133111EBn,
+                  0x8C6D2D3A5F9A4B1Cn, 0xD3C5E8B2F7A16E4An, 0xA7B9C1D3E5F70829n, 0xF1E2D3C4B5A69788n,
+                  0xD2B74407B1CE4E93n, 0x82F63B78EB765817n, 0xC5A2E9BD4F8A7320n, 0x9F4D3E7C2A1B6854n,
+                  0xE8B3C4D5A6F71928n, 0xB7A98C6D5E4F3210n, 0xF4E3D2C1B0A98877n, 0xA1B2C3D4E5F60789n]
 };
 
 /**
@@ -41,14 +50,38 @@ export const TEST_SEEDS_ALT = {
 
 /**
  * Expected seed counts for each PRNG type.
- * Note: SIMD versions require double the seeds (2 parallel streams).
+ * Note: SIMD versions require double the seeds (2 parallel streams),
+ * and 4-lane SIMD versions require quadruple the seeds (4 parallel streams).
  */
 export const SEED_COUNTS: Record<PRNGType, number> = {
     [PRNGType.PCG]: 1,
+    [PRNGType.PCG_SIMD]: 2,
+    [PRNGType.PCG64]: 2,
+    [PRNGType.Philox]: 1,
+    [PRNGType.Philox_SIMD]: 1,
+    [PRNGType.ChaCha8]: 4,
+    [PRNGType.ChaCha12]: 4,
+    [PRNGType.ChaCha20]: 4,
+    [PRNGType.SFC64]: 3,
+    [PRNGType.SFC64_SIMD]: 6,
+    [PRNGType.RomuTrio]: 3,
+    [PRNGType.RomuTrio_SIMD]: 6,
+    [PRNGType.RomuDuoJr]: 2,
+    [PRNGType.RomuDuoJr_SIMD]: 4,
     [PRNGType.Xoroshiro128Plus]: 2,
     [PRNGType.Xoroshiro128Plus_SIMD]: 4,
+    [PRNGType.Xoroshiro128Plus_SIMDx4]: 8,
     [PRNGType.Xoshiro256Plus]: 4,
-    [PRNGType.Xoshiro256Plus_SIMD]: 8
+    [PRNGType.Xoshiro256Plus_SIMD]: 8,
+    [PRNGType.Xoshiro256Plus_SIMDx4]: 16,
+    [PRNGType.Xoroshiro128PlusPlus]: 2,
+    [PRNGType.Xoroshiro128PlusPlus_SIMD]: 4,
+    [PRNGType.Xoroshiro128StarStar]: 2,
+    [PRNGType.Xoroshiro128StarStar_SIMD]: 4,
+    [PRNGType.Xoshiro256PlusPlus]: 4,
+    [PRNGType.Xoshiro256PlusPlus_SIMD]: 8,
+    [PRNGType.Xoshiro256StarStar]: 4,
+    [PRNGType.Xoshiro256StarStar_SIMD]: 8
 };
 
 /**
@@ -56,21 +89,57 @@ export const SEED_COUNTS: Record<PRNGType, number> = {
  */
 export const ALL_PRNG_TYPES = [
     PRNGType.PCG,
+    PRNGType.PCG_SIMD,
+    PRNGType.PCG64,
+    PRNGType.Philox,
+    PRNGType.Philox_SIMD,
+    PRNGType.ChaCha8,
+    PRNGType.ChaCha12,
+    PRNGType.ChaCha20,
+    PRNGType.SFC64,
+    PRNGType.SFC64_SIMD,
+    PRNGType.RomuTrio,
+    PRNGType.RomuTrio_SIMD,
+    PRNGType.RomuDuoJr,
+    PRNGType.RomuDuoJr_SIMD,
     PRNGType.Xoroshiro128Plus,
     PRNGType.Xoroshiro128Plus_SIMD,
+    PRNGType.Xoroshiro128Plus_SIMDx4,
     PRNGType.Xoshiro256Plus,
-    PRNGType.Xoshiro256Plus_SIMD
+    PRNGType.Xoshiro256Plus_SIMD,
+    PRNGType.Xoshiro256Plus_SIMDx4,
+    PRNGType.Xoroshiro128PlusPlus,
+    PRNGType.Xoroshiro128PlusPlus_SIMD,
+    PRNGType.Xoroshiro128StarStar,
+    PRNGType.Xoroshiro128StarStar_SIMD,
+    PRNGType.Xoshiro256PlusPlus,
+    PRNGType.Xoshiro256PlusPlus_SIMD,
+    PRNGType.Xoshiro256StarStar,
+    PRNGType.Xoshiro256StarStar_SIMD
 ] as const;
 
 /**
  * Non-SIMD PRNG types (single-lane generators).
  * SIMD generators interleave dual-lane output in array methods, so they have different
  * stream consistency behavior than non-SIMD generators.
+ * ChaCha is included: its SIMD blocks feed a single buffered stream.
  */
 export const NON_SIMD_PRNG_TYPES = [
     PRNGType.PCG,
+    PRNGType.PCG64,
+    PRNGType.Philox,
+    PRNGType.ChaCha8,
+    PRNGType.ChaCha12,
+    PRNGType.ChaCha20,
+    PRNGType.SFC64,
+    PRNGType.RomuTrio,
+    PRNGType.RomuDuoJr,
     PRNGType.Xoroshiro128Plus,
-    PRNGType.Xoshiro256Plus
+    PRNGType.Xoshiro256Plus,
+    PRNGType.Xoroshiro128PlusPlus,
+    PRNGType.Xoroshiro128StarStar,
+    PRNGType.Xoshiro256PlusPlus,
+    PRNGType.Xoshiro256StarStar
 ] as const;
 
 // ============================================================================
@@ -110,6 +179,20 @@ export const TWO_POW_64 = 2n ** 64n;
  */
 export const SIMD_LANE_COUNT = 2;
 
+/**
+ * Number of parallel lanes in 4-lane SIMD generators.
+ * These process two interleaved sets of SIMD lanes simultaneously.
+ */
+export const SIMD_X4_LANE_COUNT = 4;
+
+/**
+ * 4-lane SIMD PRNG types, which fill their output arrays 4 values at a time.
+ */
+export const SIMD_X4_PRNG_TYPES = [
+    PRNGType.Xoroshiro128Plus_SIMDx4,
+    PRNGType.Xoshiro256Plus_SIMDx4
+] as const;
+
 // ============================================================================
 // Test Sample Sizes
 // ============================================================================
@@ -193,6 +276,213 @@ export const JUMP_REFERENCE = {
     XOSHIRO256PLUS_SIMD_LANE1: 0.55326868388004757
 };
 
+/**
+ * Reference values for longJump() and (nodeId, workerId) stream selection.
+ * These are the expected next uint64 values from TEST_SEEDS after long jumping.
+ *
+ * Generated and verified by: src/assembly/test/c-reference/validate-jump.c
+ * To regenerate: npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding AS values in
+ * src/assembly/test/helpers/test-utils.ts (LONG_JUMP_REFERENCE namespace)
+ */
+export const LONG_JUMP_REFERENCE = {
+    /** Node and worker IDs used for the NODE_WORKER values below */
+    NODE_ID: 3,
+    WORKER_ID: 5,
+
+    /** Xoroshiro128Plus with TEST_SEEDS.double, first value from { nodeId: 3, workerId: 5 } */
+    XOROSHIRO128PLUS_NODE_WORKER: 11257826811061053454n,
+
+    /** Xoshiro256Plus with TEST_SEEDS.quad, first value from { nodeId: 3, workerId: 5 } */
+    XOSHIRO256PLUS_NODE_WORKER: 11718099546124808324n
+};
+
+// ============================================================================
+// Advance Function Reference Values
+// ============================================================================
+
+/**
+ * Reference values for discard() validation.
+ * These are the expected next uint64 values after advancing 2^40 steps from TEST_SEEDS.
+ *
+ * Generated and verified by: src/assembly/test/c-reference/validate-jump.c
+ * To regenerate: npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding AS values in
+ * src/assembly/test/helpers/test-utils.ts (ADVANCE_REFERENCE namespace)
+ */
+export const ADVANCE_REFERENCE = {
+    /** Stride used for the reference values below: 2^40 */
+    DELTA: 1n << 40n,
+
+    /** Xoroshiro128Plus with TEST_SEEDS.double, first value after advance(2^40) */
+    XOROSHIRO128PLUS: 16695539980219321422n,
+
+    /** Xoshiro256Plus with TEST_SEEDS.quad, first value after advance(2^40) */
+    XOSHIRO256PLUS: 12500896621816312088n
+};
+
+// ============================================================================
+// PCG64 Reference Values
+// ============================================================================
+
+/**
+ * Reference values for PCG64 DXSM with TEST_SEEDS.double as its 128-bit seed (high, low).
+ *
+ * Generated and verified by: src/assembly/test/c-reference/validate-pcg64.c
+ * To regenerate: npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding AS values in
+ * src/assembly/test/helpers/test-utils.ts (PCG64_REFERENCE namespace)
+ */
+export const PCG64_REFERENCE = {
+    /** First uint64 value after advance(2^40), with the default stream */
+    ADVANCE: 14730161512686551676n,
+
+    /** Stream id used for STREAM below */
+    STREAM_ID: 5n,
+
+    /** First uint64 value with setStreamIncrement(STREAM_ID) */
+    STREAM: 14772559007250593283n
+};
+
+// ============================================================================
+// Philox Reference Values
+// ============================================================================
+
+/**
+ * Reference values for Philox4x32-10 with TEST_SEEDS.single as its key.
+ * Each 128-bit block provides 2 uint64 values, so value index i is in block i / 2.
+ *
+ * Generated and verified by: src/assembly/test/c-reference/validate-philox.c
+ * To regenerate: npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding AS values in
+ * src/assembly/test/helpers/test-utils.ts (PHILOX_REFERENCE namespace)
+ */
+export const PHILOX_REFERENCE = {
+    /** First 2 uint64 values (block 0), with the default stream */
+    FIRST: 5699878716244043604n,
+    SECOND: 3431231931551020257n,
+
+    /** Value at index 2^40 (the first value after discard(2^40) for Philox) */
+    ADVANCE: 5674917125327261460n,
+
+    /** First uint64 value with stream ID STREAM_ID */
+    STREAM_ID: 5n,
+    STREAM: 7222165545784475138n,
+
+    /** First uint64 value from { nodeId: 3, workerId: 5 }, as in LONG_JUMP_REFERENCE */
+    NODE_WORKER: 3606353301399418341n
+};
+
+// ============================================================================
+// ChaCha Reference Values
+// ============================================================================
+
+/**
+ * Reference values for the fast-key-erasure ChaCha generators with TEST_SEEDS.quad as their key.
+ * Each refill provides 124 uint64 values, so value index 124 is the first under the second key.
+ *
+ * Generated and verified by: src/assembly/test/c-reference/validate-chacha.c
+ * To regenerate: npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding AS values in
+ * src/assembly/test/helpers/test-utils.ts (CHACHA_REFERENCE namespace)
+ */
+export const CHACHA_REFERENCE = {
+    /** First 2 uint64 values from ChaCha20, with the default stream */
+    FIRST: 3792829271538249661n,
+    SECOND: 2209437320138217004n,
+
+    /** ChaCha20 values at indexes 123 and 124, either side of the first rekey */
+    LAST_OF_FIRST_KEY: 7095809081073466869n,
+    FIRST_OF_SECOND_KEY: 3902580384472760192n,
+
+    /** First uint64 values from ChaCha8 and ChaCha12 */
+    CHACHA8_FIRST: 12913591682024228823n,
+    CHACHA12_FIRST: 5530131024697131311n,
+
+    /** First ChaCha20 uint64 value with stream ID STREAM_ID */
+    STREAM_ID: 5n,
+    STREAM: 6587860388706742925n,
+
+    /** First ChaCha20 uint64 value from { nodeId: 3, workerId: 5 }, as in LONG_JUMP_REFERENCE */
+    NODE_WORKER: 8103151218851572907n
+};
+
+// ============================================================================
+// SFC64 / Romu Reference Values
+// ============================================================================
+
+/**
+ * Reference values for the SFC64, RomuTrio and RomuDuoJr generators, from TEST_SEEDS.triple
+ * (RomuDuoJr: TEST_SEEDS.double). SIMD lane 0 uses the same seeds.
+ *
+ * Generated by: src/assembly/test/c-reference/validate-sfc-romu.c
+ * To regenerate: npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding AS values in
+ * src/assembly/test/helpers/test-utils.ts (SFC_ROMU_REFERENCE namespace)
+ */
+export const SFC_ROMU_REFERENCE = {
+    /** First 2 uint64 values from SFC64 */
+    SFC64_FIRST: 9556196496583309056n,
+    SFC64_SECOND: 11805396549560152306n,
+
+    /** Second and third uint64 values from RomuTrio (the first is its x seed) */
+    ROMUTRIO_SECOND: 15722878982310145075n,
+    ROMUTRIO_THIRD: 1629612184478233265n,
+
+    /** Second and third uint64 values from RomuDuoJr (the first is its x seed) */
+    ROMUDUOJR_SECOND: 5659179934322870737n,
+    ROMUDUOJR_THIRD: 665520693657870239n
+};
+
+// ============================================================================
+// Scrambler Variant Reference Values
+// ============================================================================
+
+/**
+ * Reference values for the ++ and ** scrambler variants, from TEST_SEEDS.
+ * For each generator:
+ * - JUMP / JUMP_SIMD_LANE1: first float values after jump(), as in JUMP_REFERENCE
+ * - NODE_WORKER: first uint64 value from { nodeId: 3, workerId: 5 }, as in LONG_JUMP_REFERENCE
+ * - ADVANCE: first uint64 value after advance(2^40), as in ADVANCE_REFERENCE
+ *
+ * Generated and verified by: src/assembly/test/c-reference/validate-scramblers.c
+ * To regenerate: npm run test:c-ref
+ *
+ * When updating these values, also update the corresponding AS values in
+ * src/assembly/test/helpers/test-utils.ts (SCRAMBLER_REFERENCE namespace)
+ */
+export const SCRAMBLER_REFERENCE = {
+    /** Xoroshiro128PlusPlus with TEST_SEEDS.double (SIMD lane 1: TEST_SEEDS.quad[2,3]) */
+    XOROSHIRO128PLUSPLUS_JUMP: 0.46854645244862725,
+    XOROSHIRO128PLUSPLUS_JUMP_SIMD_LANE1: 0.6267526198588824,
+    XOROSHIRO128PLUSPLUS_NODE_WORKER: 12019560473834826810n,
+    XOROSHIRO128PLUSPLUS_ADVANCE: 12226299268682830150n,
+
+    /** Xoroshiro128StarStar with TEST_SEEDS.double (SIMD lane 1: TEST_SEEDS.quad[2,3]) */
+    XOROSHIRO128STARSTAR_JUMP: 0.8244452308769635,
+    XOROSHIRO128STARSTAR_JUMP_SIMD_LANE1: 0.0661950856909842,
+    XOROSHIRO128STARSTAR_NODE_WORKER: 8398212083353036184n,
+    XOROSHIRO128STARSTAR_ADVANCE: 16653617693675954285n,
+
+    /** Xoshiro256PlusPlus with TEST_SEEDS.quad (SIMD lane 1: TEST_SEEDS.octet[4,5,6,7]) */
+    XOSHIRO256PLUSPLUS_JUMP: 0.12269489940330014,
+    XOSHIRO256PLUSPLUS_JUMP_SIMD_LANE1: 0.7125622354566116,
+    XOSHIRO256PLUSPLUS_NODE_WORKER: 4366090337512055574n,
+    XOSHIRO256PLUSPLUS_ADVANCE: 6707782915941893505n,
+
+    /** Xoshiro256StarStar with TEST_SEEDS.quad (SIMD lane 1: TEST_SEEDS.octet[4,5,6,7]) */
+    XOSHIRO256STARSTAR_JUMP: 0.5584106240807173,
+    XOSHIRO256STARSTAR_JUMP_SIMD_LANE1: 0.36843895126624715,
+    XOSHIRO256STARSTAR_NODE_WORKER: 7731361918242799462n,
+    XOSHIRO256STARSTAR_ADVANCE: 6253683939900161798n
+};
+
 // ============================================================================
 // Helper Functions
 // ============================================================================
@@ -206,8 +496,11 @@ export function getSeedsForPRNG(prngType: PRNGType): bigint[] {
     switch (count) {
         case 1: return TEST_SEEDS.single;
         case 2: return TEST_SEEDS.double;
+        case 3: return TEST_SEEDS.triple;
         case 4: return TEST_SEEDS.quad;
+        case 6: return TEST_SEEDS.sextuple;
         case 8: return TEST_SEEDS.octet;
+        case 16: return TEST_SEEDS.hexadecuple;
         default: throw new Error(`Unknown seed count: ${count}`);
     }
 }
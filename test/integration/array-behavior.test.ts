@@ -1,7 +1,7 @@
 import { describe, it, expect } from 'vitest';
 import { RandomGenerator, PRNGType } from 'fast-prng-wasm';
 
-import { TEST_SEEDS, TEST_SEEDS_ALT, createTestGenerator, generateSequence, DEFAULT_OUTPUT_ARRAY_SIZE, CUSTOM_ARRAY_SIZE_SMALL, getSeedsForPRNG, ALL_PRNG_TYPES, NON_SIMD_PRNG_TYPES, UINT32_MAX, UINT64_MAX, SIMD_LANE_COUNT } from '../helpers/test-utils';
+import { TEST_SEEDS, TEST_SEEDS_ALT, createTestGenerator, generateSequence, DEFAULT_OUTPUT_ARRAY_SIZE, CUSTOM_ARRAY_SIZE_SMALL, getSeedsForPRNG, ALL_PRNG_TYPES, NON_SIMD_PRNG_TYPES, UINT32_MAX, UINT64_MAX, SIMD_LANE_COUNT, SIMD_X4_LANE_COUNT, SFC_ROMU_REFERENCE } from '../helpers/test-utils';
 
 /**
  * Array Behavior Tests
@@ -131,6 +131,90 @@ describe('Array Behavior', () => {
     // We validate: (1) determinism with same seeds, (2) divergence with different seeds,
     // (3) lanes match their own non-SIMD sequences when using split seeds.
     describe('Array Fill Stream Consistency - SIMD', () => {
+        describe('PCG_SIMD', () => {
+            it('should produce deterministic interleaved output with identical seeds', () => {
+                const seeds = TEST_SEEDS.double; // one seed per lane
+                const gen1 = new RandomGenerator(PRNGType.PCG_SIMD, seeds);
+                const gen2 = new RandomGenerator(PRNGType.PCG_SIMD, seeds);
+
+                // Same seeds → identical interleaved output
+                expect(Array.from(gen1.floatArray())).toEqual(Array.from(gen2.floatArray()));
+                expect(Array.from(gen1.int32Array())).toEqual(Array.from(gen2.int32Array()));
+            });
+
+            it('should produce different interleaved streams even when lanes share a seed', () => {
+                // Each lane has its own stream increment, so identical seeds still diverge
+                const seeds = [TEST_SEEDS.single[0], TEST_SEEDS.single[0]];
+                const gen = new RandomGenerator(PRNGType.PCG_SIMD, seeds);
+
+                const interleavedArray = Array.from(gen.int32Array());
+
+                let differences = 0;
+                for (let i = 0; i < DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_LANE_COUNT; i++) {
+                    if (interleavedArray[i * SIMD_LANE_COUNT] !== interleavedArray[i * SIMD_LANE_COUNT + 1]) {
+                        differences++;
+                    }
+                }
+                // Allow for the occasional chance collision between 32-bit values
+                expect(differences).toBeGreaterThan(DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_LANE_COUNT - 2);
+            });
+
+            it('should match non-SIMD PCG in lane 0 with the default stream', () => {
+                const seeds = TEST_SEEDS.double;
+                const simdGen = new RandomGenerator(PRNGType.PCG_SIMD, seeds);
+                const lane0Gen = new RandomGenerator(PRNGType.PCG, [seeds[0]]);
+
+                const interleavedArray = Array.from(simdGen.int64Array());
+                const lane0Array = generateSequence<bigint>(lane0Gen, DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_LANE_COUNT, 'int64');
+
+                for (let i = 0; i < DEFAULT_OUTPUT_ARRAY_SIZE; i += SIMD_LANE_COUNT) {
+                    expect(interleavedArray[i]).toBe(lane0Array[i / SIMD_LANE_COUNT]);
+                }
+            });
+
+            it('should interleave matching streams from both lanes', () => {
+                // Stream id k selects non-SIMD PCG streams 2k (lane 0) and 2k + 1 (lane 1)
+                const seeds = TEST_SEEDS.double;
+                const streamId = 3;
+                const simdGen = new RandomGenerator(PRNGType.PCG_SIMD, seeds, streamId);
+                const lane0Gen = new RandomGenerator(PRNGType.PCG, [seeds[0]], 2 * streamId);
+                const lane1Gen = new RandomGenerator(PRNGType.PCG, [seeds[1]], 2 * streamId + 1);
+
+                const interleavedArray = Array.from(simdGen.int32Array());
+                const lane0Array = generateSequence<number>(lane0Gen, DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_LANE_COUNT, 'int32');
+                const lane1Array = generateSequence<number>(lane1Gen, DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_LANE_COUNT, 'int32');
+
+                // Even indices should match lane 0, odd indices should match lane 1
+                for (let i = 0; i < DEFAULT_OUTPUT_ARRAY_SIZE; i++) {
+                    if (i % SIMD_LANE_COUNT === 0) {
+                        expect(interleavedArray[i]).toBe(lane0Array[i / SIMD_LANE_COUNT]);
+                    } else {
+                        expect(interleavedArray[i]).toBe(lane1Array[(i - 1) / SIMD_LANE_COUNT]);
+                    }
+                }
+            });
+        });
+
+        describe('Philox_SIMD', () => {
+            it('should produce the same array output as non-SIMD Philox', () => {
+                // Both lanes hold consecutive values of the same block, so there is no interleaving
+                const simdGen = new RandomGenerator(PRNGType.Philox_SIMD, TEST_SEEDS.single);
+                const gen = new RandomGenerator(PRNGType.Philox, TEST_SEEDS.single);
+
+                expect(Array.from(simdGen.int64Array())).toEqual(Array.from(gen.int64Array()));
+                expect(Array.from(simdGen.floatArray())).toEqual(Array.from(gen.floatArray()));
+            });
+
+            it('should return lane 0 of each block from single value methods', () => {
+                const simdGen = new RandomGenerator(PRNGType.Philox_SIMD, TEST_SEEDS.single);
+                const blocks = Array.from(new RandomGenerator(PRNGType.Philox, TEST_SEEDS.single).int64Array());
+
+                for (let i = 0; i < DEFAULT_OUTPUT_ARRAY_SIZE; i += SIMD_LANE_COUNT) {
+                    expect(simdGen.int64()).toBe(blocks[i]);
+                }
+            });
+        });
+
         describe('Xoroshiro128Plus_SIMD', () => {
             it('should produce deterministic interleaved output with identical seeds', () => {
                 const seeds = TEST_SEEDS.quad; // [s0, s1, s2, s3] for lanes 0 and 1
@@ -237,6 +321,104 @@ describe('Array Behavior', () => {
         });
     });
 
+    // SFC64 and Romu SIMD lanes are independent generators seeded with their own seeds,
+    // so int64Array() interleaves the streams of two non-SIMD generators
+    describe('Array Fill Stream Consistency - SFC64 / Romu SIMD', () => {
+        const SIMD_PAIRS = [
+            { simdType: PRNGType.SFC64_SIMD, type: PRNGType.SFC64 },
+            { simdType: PRNGType.RomuTrio_SIMD, type: PRNGType.RomuTrio },
+            { simdType: PRNGType.RomuDuoJr_SIMD, type: PRNGType.RomuDuoJr }
+        ];
+
+        for (const { simdType, type } of SIMD_PAIRS) {
+            it(`${simdType}: should interleave the streams of two ${type} generators`, () => {
+                const seeds = getSeedsForPRNG(simdType);
+                const laneSeedCount = seeds.length / SIMD_LANE_COUNT;
+                const lane0Gen = new RandomGenerator(type, seeds.slice(0, laneSeedCount));
+                const lane1Gen = new RandomGenerator(type, seeds.slice(laneSeedCount));
+
+                const interleavedArray = Array.from(new RandomGenerator(simdType, seeds).int64Array());
+                const lane0Array = generateSequence<bigint>(lane0Gen, DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_LANE_COUNT, 'int64');
+                const lane1Array = generateSequence<bigint>(lane1Gen, DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_LANE_COUNT, 'int64');
+
+                for (let i = 0; i < DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_LANE_COUNT; i++) {
+                    expect(interleavedArray[i * SIMD_LANE_COUNT]).toBe(lane0Array[i]);
+                    expect(interleavedArray[i * SIMD_LANE_COUNT + 1]).toBe(lane1Array[i]);
+                }
+            });
+        }
+
+        it('lane 0 should match C reference implementation', () => {
+            const sfc = new RandomGenerator(PRNGType.SFC64_SIMD, getSeedsForPRNG(PRNGType.SFC64_SIMD)).int64Array();
+            expect(sfc[0]).toBe(SFC_ROMU_REFERENCE.SFC64_FIRST);
+            expect(sfc[2]).toBe(SFC_ROMU_REFERENCE.SFC64_SECOND);
+
+            // A Romu generator's first output is its x seed
+            const trio = new RandomGenerator(PRNGType.RomuTrio_SIMD, getSeedsForPRNG(PRNGType.RomuTrio_SIMD)).int64Array();
+            expect(trio[2]).toBe(SFC_ROMU_REFERENCE.ROMUTRIO_SECOND);
+            expect(trio[4]).toBe(SFC_ROMU_REFERENCE.ROMUTRIO_THIRD);
+
+            const duoJr = new RandomGenerator(PRNGType.RomuDuoJr_SIMD, getSeedsForPRNG(PRNGType.RomuDuoJr_SIMD)).int64Array();
+            expect(duoJr[2]).toBe(SFC_ROMU_REFERENCE.ROMUDUOJR_SECOND);
+            expect(duoJr[4]).toBe(SFC_ROMU_REFERENCE.ROMUDUOJR_THIRD);
+        });
+    });
+
+    // 4-lane SIMD stream consistency: each step stores lanes 0-1 then lanes 2-3, and each
+    // pair of lanes must match the 2-lane SIMD generator seeded with its half of the seeds.
+    describe('Array Fill Stream Consistency - 4-lane SIMD', () => {
+        const SIMD_X4_PAIRS = [
+            { x4Type: PRNGType.Xoroshiro128Plus_SIMDx4, simdType: PRNGType.Xoroshiro128Plus_SIMD },
+            { x4Type: PRNGType.Xoshiro256Plus_SIMDx4, simdType: PRNGType.Xoshiro256Plus_SIMD }
+        ];
+
+        SIMD_X4_PAIRS.forEach(({ x4Type, simdType }) => {
+            describe(`${PRNGType[x4Type]}`, () => {
+                it('should produce deterministic interleaved output with identical seeds', () => {
+                    const seeds = getSeedsForPRNG(x4Type);
+                    const gen1 = new RandomGenerator(x4Type, seeds);
+                    const gen2 = new RandomGenerator(x4Type, seeds);
+
+                    // Same seeds → identical interleaved output
+                    expect(Array.from(gen1.floatArray())).toEqual(Array.from(gen2.floatArray()));
+                    expect(Array.from(gen1.int64Array())).toEqual(Array.from(gen2.int64Array()));
+                });
+
+                it('should interleave matching streams from both 2-lane halves', () => {
+                    const seeds = getSeedsForPRNG(x4Type);
+                    const half = seeds.length / 2;
+                    const x4Gen = new RandomGenerator(x4Type, seeds);
+                    const lanes01Gen = new RandomGenerator(simdType, seeds.slice(0, half), null, DEFAULT_OUTPUT_ARRAY_SIZE / 2);
+                    const lanes23Gen = new RandomGenerator(simdType, seeds.slice(half), null, DEFAULT_OUTPUT_ARRAY_SIZE / 2);
+
+                    const interleavedArray = Array.from(x4Gen.int64Array());
+                    const lanes01Array = Array.from(lanes01Gen.int64Array());
+                    const lanes23Array = Array.from(lanes23Gen.int64Array());
+
+                    for (let i = 0; i < DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_X4_LANE_COUNT; i++) {
+                        expect(interleavedArray[i * 4]).toBe(lanes01Array[i * 2]);
+                        expect(interleavedArray[i * 4 + 1]).toBe(lanes01Array[i * 2 + 1]);
+                        expect(interleavedArray[i * 4 + 2]).toBe(lanes23Array[i * 2]);
+                        expect(interleavedArray[i * 4 + 3]).toBe(lanes23Array[i * 2 + 1]);
+                    }
+                });
+
+                it('should match lane 0 of the array output in single value methods', () => {
+                    const seeds = getSeedsForPRNG(x4Type);
+                    const arrayGen = new RandomGenerator(x4Type, seeds);
+                    const singleGen = new RandomGenerator(x4Type, seeds);
+
+                    const interleavedArray = Array.from(arrayGen.floatArray());
+                    const lane0Array = generateSequence<number>(singleGen, DEFAULT_OUTPUT_ARRAY_SIZE / SIMD_X4_LANE_COUNT, 'float');
+
+                    for (let i = 0; i < DEFAULT_OUTPUT_ARRAY_SIZE; i += SIMD_X4_LANE_COUNT) {
+                        expect(interleavedArray[i]).toBe(lane0Array[i / SIMD_X4_LANE_COUNT]);
+                    }
+                });
+            });
+        });
+    });
+
     describe('Array Sizes', () => {
         it('should respect default array size', () => {
             const gen = createTestGenerator();
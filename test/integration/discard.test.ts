@@ -0,0 +1,239 @@
+/**
+ * RandomGenerator Discard (Skip-Ahead) Tests
+ *
+ * Tests for discard(), which advances a generator's state within its current
+ * stream in logarithmic time.
+ *
+ * Test Strategy:
+ * - Verify discard(n) lands on the same sequence as generating n values
+ * - Verify discard() splits one stream into contiguous, reproducible blocks
+ * - Verify discard() matches C reference values for large strides
+ * - Test both non-SIMD and SIMD variants (SIMD must verify both lanes)
+ *
+ * Contrast: This file tests positions within a single stream (which overlap by
+ * design). For unique, non-overlapping streams, see parallel-streams.test.ts.
+ */
+
+import { describe, it, expect } from 'vitest';
+import { RandomGenerator, PRNGType } from 'fast-prng-wasm';
+import {
+    TEST_SEEDS,
+    INTEGRATION_SAMPLE_SIZE,
+    ALL_PRNG_TYPES,
+    ADVANCE_REFERENCE,
+    PCG64_REFERENCE,
+    PHILOX_REFERENCE,
+    SCRAMBLER_REFERENCE,
+    SIMD_LANE_COUNT,
+    SIMD_X4_LANE_COUNT,
+    getSeedsForPRNG
+} from '../helpers/test-utils';
+
+const XOSHIRO_PRNG_TYPES = ALL_PRNG_TYPES.filter(type => type.startsWith('Xo'));
+
+describe('RandomGenerator discard()', () => {
+    describe('PCG', () => {
+        it('discard(n) should match n int32() calls', () => {
+            const stepped = new RandomGenerator(PRNGType.PCG, TEST_SEEDS.single);
+            const skipped = new RandomGenerator(PRNGType.PCG, TEST_SEEDS.single);
+
+            for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                stepped.int32();
+            }
+            skipped.discard(INTEGRATION_SAMPLE_SIZE);
+
+            expect(Array.from(skipped.int64Array())).toEqual(Array.from(stepped.int64Array()));
+        });
+
+        it('should consume 2 steps per 64-bit value', () => {
+            const stepped = new RandomGenerator(PRNGType.PCG, TEST_SEEDS.single);
+            const skipped = new RandomGenerator(PRNGType.PCG, TEST_SEEDS.single);
+
+            for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                stepped.int64();
+            }
+            skipped.discard(2n * BigInt(INTEGRATION_SAMPLE_SIZE));
+
+            expect(skipped.int64()).toBe(stepped.int64());
+        });
+
+        it('should split one stream into contiguous blocks', () => {
+            const full = new RandomGenerator(PRNGType.PCG, TEST_SEEDS.single);
+            const sequence = Array.from(full.int64Array(true));
+            const blockSize = sequence.length / 2;
+
+            // Second worker starts where the first worker's block ends
+            const second = new RandomGenerator(PRNGType.PCG, TEST_SEEDS.single);
+            second.discard(2 * blockSize);
+
+            for (let i = 0; i < blockSize; i++) {
+                expect(second.int64()).toBe(sequence[blockSize + i]);
+            }
+        });
+    });
+
+    describe('PCG_SIMD', () => {
+        it('discard(n) should match n int32() calls', () => {
+            const stepped = new RandomGenerator(PRNGType.PCG_SIMD, TEST_SEEDS.double);
+            const skipped = new RandomGenerator(PRNGType.PCG_SIMD, TEST_SEEDS.double);
+
+            for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                stepped.int32();
+            }
+            skipped.discard(INTEGRATION_SAMPLE_SIZE);
+
+            // Array output covers both lanes
+            expect(Array.from(skipped.int32Array())).toEqual(Array.from(stepped.int32Array()));
+        });
+
+        it('should split one stream into contiguous blocks', () => {
+            const full = new RandomGenerator(PRNGType.PCG_SIMD, TEST_SEEDS.double);
+            const first = Array.from(full.int64Array(true));
+            const second = Array.from(full.int64Array(true));
+
+            // 2 steps per 64-bit value, with both lanes advancing on each step
+            const worker = new RandomGenerator(PRNGType.PCG_SIMD, TEST_SEEDS.double);
+            worker.discard(first.length);
+
+            expect(Array.from(worker.int64Array())).toEqual(second);
+        });
+
+        it('lane 0: discard(2^40) should match PCG', () => {
+            const simd = new RandomGenerator(PRNGType.PCG_SIMD, TEST_SEEDS.double);
+            const pcg = new RandomGenerator(PRNGType.PCG, [TEST_SEEDS.double[0]]);
+            simd.discard(ADVANCE_REFERENCE.DELTA);
+            pcg.discard(ADVANCE_REFERENCE.DELTA);
+            expect(simd.int64()).toBe(pcg.int64());
+        });
+    });
+
+    describe('PCG64', () => {
+        it('discard(n) should match n int64() calls', () => {
+            const stepped = new RandomGenerator(PRNGType.PCG64, TEST_SEEDS.double);
+            const skipped = new RandomGenerator(PRNGType.PCG64, TEST_SEEDS.double);
+
+            for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                stepped.int64();
+            }
+            skipped.discard(INTEGRATION_SAMPLE_SIZE);
+
+            expect(Array.from(skipped.int64Array())).toEqual(Array.from(stepped.int64Array()));
+        });
+
+        it('should consume 1 step per 32-bit value', () => {
+            const stepped = new RandomGenerator(PRNGType.PCG64, TEST_SEEDS.double);
+            const skipped = new RandomGenerator(PRNGType.PCG64, TEST_SEEDS.double);
+
+            for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                stepped.int32();
+            }
+            skipped.discard(INTEGRATION_SAMPLE_SIZE);
+
+            expect(skipped.int64()).toBe(stepped.int64());
+        });
+
+        it('discard(2^40) should match C reference', () => {
+            const gen = new RandomGenerator(PRNGType.PCG64, TEST_SEEDS.double);
+            gen.discard(ADVANCE_REFERENCE.DELTA);
+            expect(gen.int64()).toBe(PCG64_REFERENCE.ADVANCE);
+        });
+    });
+
+    describe('Philox', () => {
+        it('discard(n) should match n int64() calls, including odd n', () => {
+            for (const count of [INTEGRATION_SAMPLE_SIZE, INTEGRATION_SAMPLE_SIZE + 1]) {
+                const stepped = new RandomGenerator(PRNGType.Philox, TEST_SEEDS.single);
+                const skipped = new RandomGenerator(PRNGType.Philox, TEST_SEEDS.single);
+
+                for (let i = 0; i < count; i++) {
+                    stepped.int64();
+                }
+                skipped.discard(count);
+
+                expect(Array.from(skipped.int64Array())).toEqual(Array.from(stepped.int64Array()));
+            }
+        });
+
+        it('discard(2^40) should match C reference', () => {
+            const gen = new RandomGenerator(PRNGType.Philox, TEST_SEEDS.single);
+            gen.discard(ADVANCE_REFERENCE.DELTA);
+            expect(gen.int64()).toBe(PHILOX_REFERENCE.ADVANCE);
+        });
+
+        it('Philox_SIMD: discard(n) should skip n blocks of 2 values', () => {
+            const gen = new RandomGenerator(PRNGType.Philox_SIMD, TEST_SEEDS.single);
+            gen.discard(ADVANCE_REFERENCE.DELTA / 2n);
+            expect(gen.int64()).toBe(PHILOX_REFERENCE.ADVANCE);
+        });
+    });
+
+    describe('Xoshiro family', () => {
+        for (const prngType of XOSHIRO_PRNG_TYPES) {
+            describe(`${PRNGType[prngType]}`, () => {
+                it('discard(n) should match n int64() calls', () => {
+                    const stepped = new RandomGenerator(prngType, getSeedsForPRNG(prngType));
+                    const skipped = new RandomGenerator(prngType, getSeedsForPRNG(prngType));
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        stepped.int64();
+                    }
+                    skipped.discard(INTEGRATION_SAMPLE_SIZE);
+
+                    // Array output covers all lanes for SIMD variants
+                    expect(Array.from(skipped.int64Array())).toEqual(Array.from(stepped.int64Array()));
+                });
+
+                it('should split one stream into contiguous blocks', () => {
+                    const full = new RandomGenerator(prngType, getSeedsForPRNG(prngType));
+                    const first = Array.from(full.int64Array(true));
+                    const second = Array.from(full.int64Array(true));
+
+                    // SIMD variants produce 2 values per step, and 4-lane SIMD variants 4
+                    const lanes = prngType.endsWith('_SIMDx4') ? SIMD_X4_LANE_COUNT : prngType.endsWith('_SIMD') ? SIMD_LANE_COUNT : 1;
+                    const stepsPerArray = first.length / lanes;
+
+                    const worker = new RandomGenerator(prngType, getSeedsForPRNG(prngType));
+                    worker.discard(stepsPerArray);
+
+                    expect(Array.from(worker.int64Array())).toEqual(second);
+                });
+            });
+        }
+
+        it('Xoroshiro128Plus: discard(2^40) should match C reference', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, TEST_SEEDS.double);
+            gen.discard(ADVANCE_REFERENCE.DELTA);
+            expect(gen.int64()).toBe(ADVANCE_REFERENCE.XOROSHIRO128PLUS);
+        });
+
+        it('Xoshiro256Plus: discard(2^40) should match C reference', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256Plus, TEST_SEEDS.quad);
+            gen.discard(ADVANCE_REFERENCE.DELTA);
+            expect(gen.int64()).toBe(ADVANCE_REFERENCE.XOSHIRO256PLUS);
+        });
+
+        it('4-lane SIMD lane 0: discard(2^40) should match C reference', () => {
+            const xoroshiro = new RandomGenerator(PRNGType.Xoroshiro128Plus_SIMDx4, TEST_SEEDS.octet);
+            const xoshiro = new RandomGenerator(PRNGType.Xoshiro256Plus_SIMDx4, TEST_SEEDS.hexadecuple);
+            xoroshiro.discard(ADVANCE_REFERENCE.DELTA);
+            xoshiro.discard(ADVANCE_REFERENCE.DELTA);
+            expect(xoroshiro.int64()).toBe(ADVANCE_REFERENCE.XOROSHIRO128PLUS);
+            expect(xoshiro.int64()).toBe(ADVANCE_REFERENCE.XOSHIRO256PLUS);
+        });
+
+        const scramblerConfig = [
+            { algo: PRNGType.Xoroshiro128PlusPlus, seeds: TEST_SEEDS.double, reference: SCRAMBLER_REFERENCE.XOROSHIRO128PLUSPLUS_ADVANCE },
+            { algo: PRNGType.Xoroshiro128StarStar, seeds: TEST_SEEDS.double, reference: SCRAMBLER_REFERENCE.XOROSHIRO128STARSTAR_ADVANCE },
+            { algo: PRNGType.Xoshiro256PlusPlus, seeds: TEST_SEEDS.quad, reference: SCRAMBLER_REFERENCE.XOSHIRO256PLUSPLUS_ADVANCE },
+            { algo: PRNGType.Xoshiro256StarStar, seeds: TEST_SEEDS.quad, reference: SCRAMBLER_REFERENCE.XOSHIRO256STARSTAR_ADVANCE }
+        ];
+
+        scramblerConfig.forEach(({ algo, seeds, reference }) => {
+            it(`${algo}: discard(2^40) should match C reference`, () => {
+                const gen = new RandomGenerator(algo, seeds);
+                gen.discard(ADVANCE_REFERENCE.DELTA);
+                expect(gen.int64()).toBe(reference);
+            });
+        });
+    });
+});
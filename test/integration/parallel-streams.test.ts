@@ -1,7 +1,7 @@
 /**
  * RandomGenerator Parallel Generator Stream Selection Tests
  *
- * Tests for stream selection via jump() function (Xoroshiro/Xoshiro) or
+ * Tests for stream selection via jump() function (Xoroshiro/Xoshiro, Philox, ChaCha) or
  * setStreamIncrement() (PCG), verifying parallel generators produce
  * non-overlapping sequences.
  *
@@ -11,6 +11,7 @@
  * - Point-level check: values at same index differ across all streams (100%)
  * - Sequence-level check: no value from one stream appears in any other stream
  * - Test both non-SIMD and SIMD variants (SIMD must verify both lanes)
+ * - Repeat for (nodeId, workerId) stream selection, across both nodes and workers
  *
  * Contrast: This file tests stream independence via unique stream IDs (designed
  * for parallel use cases where streams must never overlap). For independent state
@@ -20,7 +21,7 @@
 
 import { describe, it, expect } from 'vitest';
 import { RandomGenerator, PRNGType } from 'fast-prng-wasm';
-import { createParallelGenerators, TEST_SEEDS, JUMP_REFERENCE, PARALLEL_GENERATOR_COUNT } from '../helpers/test-utils';
+import { createParallelGenerators, TEST_SEEDS, JUMP_REFERENCE, LONG_JUMP_REFERENCE, PCG64_REFERENCE, PHILOX_REFERENCE, CHACHA_REFERENCE, SCRAMBLER_REFERENCE, PARALLEL_GENERATOR_COUNT } from '../helpers/test-utils';
 
 /**
  * Validates stream independence for parallel generators.
@@ -90,10 +91,27 @@ describe('RandomGenerator Parallel Generator Stream Selection', () => {
     // Configuration for each algorithm's stream selection testing
     const streamSelectionConfig = [
         { algo: PRNGType.PCG, seeds: TEST_SEEDS.single, references: undefined },
+        { algo: PRNGType.PCG_SIMD, seeds: TEST_SEEDS.double, references: undefined },
+        { algo: PRNGType.PCG64, seeds: TEST_SEEDS.double, references: undefined },
+        { algo: PRNGType.Philox, seeds: TEST_SEEDS.single, references: undefined },
+        { algo: PRNGType.Philox_SIMD, seeds: TEST_SEEDS.single, references: undefined },
+        { algo: PRNGType.ChaCha8, seeds: TEST_SEEDS.quad, references: undefined },
+        { algo: PRNGType.ChaCha12, seeds: TEST_SEEDS.quad, references: undefined },
+        { algo: PRNGType.ChaCha20, seeds: TEST_SEEDS.quad, references: undefined },
         { algo: PRNGType.Xoroshiro128Plus, seeds: TEST_SEEDS.double, references: [JUMP_REFERENCE.XOROSHIRO128PLUS] },
         { algo: PRNGType.Xoroshiro128Plus_SIMD, seeds: TEST_SEEDS.quad, references: [JUMP_REFERENCE.XOROSHIRO128PLUS, JUMP_REFERENCE.XOROSHIRO128PLUS_SIMD_LANE1] },
+        { algo: PRNGType.Xoroshiro128Plus_SIMDx4, seeds: TEST_SEEDS.octet, references: [JUMP_REFERENCE.XOROSHIRO128PLUS, JUMP_REFERENCE.XOROSHIRO128PLUS_SIMD_LANE1] },
         { algo: PRNGType.Xoshiro256Plus, seeds: TEST_SEEDS.quad, references: [JUMP_REFERENCE.XOSHIRO256PLUS] },
-        { algo: PRNGType.Xoshiro256Plus_SIMD, seeds: TEST_SEEDS.octet, references: [JUMP_REFERENCE.XOSHIRO256PLUS, JUMP_REFERENCE.XOSHIRO256PLUS_SIMD_LANE1] }
+        { algo: PRNGType.Xoshiro256Plus_SIMD, seeds: TEST_SEEDS.octet, references: [JUMP_REFERENCE.XOSHIRO256PLUS, JUMP_REFERENCE.XOSHIRO256PLUS_SIMD_LANE1] },
+        { algo: PRNGType.Xoshiro256Plus_SIMDx4, seeds: TEST_SEEDS.hexadecuple, references: [JUMP_REFERENCE.XOSHIRO256PLUS, JUMP_REFERENCE.XOSHIRO256PLUS_SIMD_LANE1] },
+        { algo: PRNGType.Xoroshiro128PlusPlus, seeds: TEST_SEEDS.double, references: [SCRAMBLER_REFERENCE.XOROSHIRO128PLUSPLUS_JUMP] },
+        { algo: PRNGType.Xoroshiro128PlusPlus_SIMD, seeds: TEST_SEEDS.quad, references: [SCRAMBLER_REFERENCE.XOROSHIRO128PLUSPLUS_JUMP, SCRAMBLER_REFERENCE.XOROSHIRO128PLUSPLUS_JUMP_SIMD_LANE1] },
+        { algo: PRNGType.Xoroshiro128StarStar, seeds: TEST_SEEDS.double, references: [SCRAMBLER_REFERENCE.XOROSHIRO128STARSTAR_JUMP] },
+        { algo: PRNGType.Xoroshiro128StarStar_SIMD, seeds: TEST_SEEDS.quad, references: [SCRAMBLER_REFERENCE.XOROSHIRO128STARSTAR_JUMP, SCRAMBLER_REFERENCE.XOROSHIRO128STARSTAR_JUMP_SIMD_LANE1] },
+        { algo: PRNGType.Xoshiro256PlusPlus, seeds: TEST_SEEDS.quad, references: [SCRAMBLER_REFERENCE.XOSHIRO256PLUSPLUS_JUMP] },
+        { algo: PRNGType.Xoshiro256PlusPlus_SIMD, seeds: TEST_SEEDS.octet, references: [SCRAMBLER_REFERENCE.XOSHIRO256PLUSPLUS_JUMP, SCRAMBLER_REFERENCE.XOSHIRO256PLUSPLUS_JUMP_SIMD_LANE1] },
+        { algo: PRNGType.Xoshiro256StarStar, seeds: TEST_SEEDS.quad, references: [SCRAMBLER_REFERENCE.XOSHIRO256STARSTAR_JUMP] },
+        { algo: PRNGType.Xoshiro256StarStar_SIMD, seeds: TEST_SEEDS.octet, references: [SCRAMBLER_REFERENCE.XOSHIRO256STARSTAR_JUMP, SCRAMBLER_REFERENCE.XOSHIRO256STARSTAR_JUMP_SIMD_LANE1] }
     ];
 
     streamSelectionConfig.forEach(({ algo, seeds, references }) => {
@@ -104,4 +122,75 @@ describe('RandomGenerator Parallel Generator Stream Selection', () => {
             });
         });
     });
+
+    it('PCG64: stream ID should match C reference', () => {
+        const gen = new RandomGenerator(PRNGType.PCG64, TEST_SEEDS.double, PCG64_REFERENCE.STREAM_ID);
+        expect(gen.int64()).toBe(PCG64_REFERENCE.STREAM);
+    });
+
+    it('Philox: stream ID should match C reference', () => {
+        const gen = new RandomGenerator(PRNGType.Philox, TEST_SEEDS.single, PHILOX_REFERENCE.STREAM_ID);
+        const simdGen = new RandomGenerator(PRNGType.Philox_SIMD, TEST_SEEDS.single, PHILOX_REFERENCE.STREAM_ID);
+        expect(gen.int64()).toBe(PHILOX_REFERENCE.STREAM);
+        expect(simdGen.int64()).toBe(PHILOX_REFERENCE.STREAM);
+    });
+
+    it('ChaCha20: stream ID should match C reference', () => {
+        const gen = new RandomGenerator(PRNGType.ChaCha20, TEST_SEEDS.quad, CHACHA_REFERENCE.STREAM_ID);
+        expect(gen.int64()).toBe(CHACHA_REFERENCE.STREAM);
+    });
+});
+
+describe('RandomGenerator Hierarchical (nodeId, workerId) Stream Selection', () => {
+    const hierarchicalConfig = [
+        { algo: PRNGType.Philox, seeds: TEST_SEEDS.single, reference: PHILOX_REFERENCE.NODE_WORKER },
+        { algo: PRNGType.Philox_SIMD, seeds: TEST_SEEDS.single, reference: PHILOX_REFERENCE.NODE_WORKER },
+        { algo: PRNGType.ChaCha20, seeds: TEST_SEEDS.quad, reference: CHACHA_REFERENCE.NODE_WORKER },
+        { algo: PRNGType.Xoroshiro128Plus, seeds: TEST_SEEDS.double, reference: LONG_JUMP_REFERENCE.XOROSHIRO128PLUS_NODE_WORKER },
+        { algo: PRNGType.Xoroshiro128Plus_SIMD, seeds: TEST_SEEDS.quad, reference: LONG_JUMP_REFERENCE.XOROSHIRO128PLUS_NODE_WORKER },
+        { algo: PRNGType.Xoroshiro128Plus_SIMDx4, seeds: TEST_SEEDS.octet, reference: LONG_JUMP_REFERENCE.XOROSHIRO128PLUS_NODE_WORKER },
+        { algo: PRNGType.Xoshiro256Plus, seeds: TEST_SEEDS.quad, reference: LONG_JUMP_REFERENCE.XOSHIRO256PLUS_NODE_WORKER },
+        { algo: PRNGType.Xoshiro256Plus_SIMD, seeds: TEST_SEEDS.octet, reference: LONG_JUMP_REFERENCE.XOSHIRO256PLUS_NODE_WORKER },
+        { algo: PRNGType.Xoshiro256Plus_SIMDx4, seeds: TEST_SEEDS.hexadecuple, reference: LONG_JUMP_REFERENCE.XOSHIRO256PLUS_NODE_WORKER },
+        { algo: PRNGType.Xoroshiro128PlusPlus, seeds: TEST_SEEDS.double, reference: SCRAMBLER_REFERENCE.XOROSHIRO128PLUSPLUS_NODE_WORKER },
+        { algo: PRNGType.Xoroshiro128PlusPlus_SIMD, seeds: TEST_SEEDS.quad, reference: SCRAMBLER_REFERENCE.XOROSHIRO128PLUSPLUS_NODE_WORKER },
+        { algo: PRNGType.Xoroshiro128StarStar, seeds: TEST_SEEDS.double, reference: SCRAMBLER_REFERENCE.XOROSHIRO128STARSTAR_NODE_WORKER },
+        { algo: PRNGType.Xoroshiro128StarStar_SIMD, seeds: TEST_SEEDS.quad, reference: SCRAMBLER_REFERENCE.XOROSHIRO128STARSTAR_NODE_WORKER },
+        { algo: PRNGType.Xoshiro256PlusPlus, seeds: TEST_SEEDS.quad, reference: SCRAMBLER_REFERENCE.XOSHIRO256PLUSPLUS_NODE_WORKER },
+        { algo: PRNGType.Xoshiro256PlusPlus_SIMD, seeds: TEST_SEEDS.octet, reference: SCRAMBLER_REFERENCE.XOSHIRO256PLUSPLUS_NODE_WORKER },
+        { algo: PRNGType.Xoshiro256StarStar, seeds: TEST_SEEDS.quad, reference: SCRAMBLER_REFERENCE.XOSHIRO256STARSTAR_NODE_WORKER },
+        { algo: PRNGType.Xoshiro256StarStar_SIMD, seeds: TEST_SEEDS.octet, reference: SCRAMBLER_REFERENCE.XOSHIRO256STARSTAR_NODE_WORKER }
+    ];
+
+    hierarchicalConfig.forEach(({ algo, seeds, reference }) => {
+        describe(`${PRNGType[algo]}`, () => {
+            it('should produce non-overlapping sequences across nodes and workers', () => {
+                const generators = [
+                    new RandomGenerator(algo, seeds, { nodeId: 0, workerId: 1 }),
+                    new RandomGenerator(algo, seeds, { nodeId: 1, workerId: 0 }),
+                    new RandomGenerator(algo, seeds, { nodeId: 1, workerId: 1 })
+                ] as [RandomGenerator, RandomGenerator, RandomGenerator];
+                validateStreamIndependence(generators);
+            });
+
+            it('should match C reference implementation', () => {
+                // SIMD lane 0 uses the same seeds as the non-SIMD C reference
+                const gen = new RandomGenerator(algo, seeds, {
+                    nodeId: LONG_JUMP_REFERENCE.NODE_ID,
+                    workerId: LONG_JUMP_REFERENCE.WORKER_ID
+                });
+                expect(gen.int64()).toBe(reference);
+            });
+
+            it('node 0 should select the same streams as a plain stream ID', () => {
+                const hierarchical = new RandomGenerator(algo, seeds, { nodeId: 0, workerId: 7 });
+                const plain = new RandomGenerator(algo, seeds, 7);
+                expect(Array.from(hierarchical.int64Array())).toEqual(Array.from(plain.int64Array()));
+            });
+        });
+    });
+
+    it('should throw for generators without long jump support', () => {
+        expect(() => new RandomGenerator(PRNGType.PCG, TEST_SEEDS.single, { nodeId: 1, workerId: 1 })).toThrow();
+    });
 });
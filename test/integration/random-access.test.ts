@@ -0,0 +1,84 @@
+/**
+ * RandomGenerator Random Access Tests
+ *
+ * Tests for int64ArrayAt() on counter-based (Philox) generators, which compute
+ * any block of their stream directly from its counter.
+ *
+ * Test Strategy:
+ * - Verify the first block matches the C reference implementation
+ * - Verify slices at any counter match the sequential stream
+ * - Verify independent slices tile one stream exactly (parallel workers)
+ * - Verify random access doesn't move the generator's sequential position
+ * - Verify SIMD and non-SIMD variants agree
+ *
+ * Contrast: discard.test.ts moves a generator's position within its stream;
+ * int64ArrayAt() reads any position without moving it.
+ */
+
+import { describe, it, expect } from 'vitest';
+import { RandomGenerator, PRNGType } from 'fast-prng-wasm';
+import { TEST_SEEDS, DEFAULT_OUTPUT_ARRAY_SIZE, PHILOX_REFERENCE } from '../helpers/test-utils';
+
+const COUNTER_BASED_PRNG_TYPES = [PRNGType.Philox, PRNGType.Philox_SIMD] as const;
+
+describe('RandomGenerator int64ArrayAt()', () => {
+    COUNTER_BASED_PRNG_TYPES.forEach(prngType => {
+        describe(`${PRNGType[prngType]}`, () => {
+            it('should match C reference implementation at counter 0', () => {
+                const gen = new RandomGenerator(prngType, TEST_SEEDS.single);
+                const slice = gen.int64ArrayAt(0);
+
+                expect(slice[0]).toBe(PHILOX_REFERENCE.FIRST);
+                expect(slice[1]).toBe(PHILOX_REFERENCE.SECOND);
+            });
+
+            it('should match the sequential stream at any counter', () => {
+                const sequential = new RandomGenerator(prngType, TEST_SEEDS.single);
+                const first = Array.from(sequential.int64Array());
+                const second = Array.from(sequential.int64Array());
+
+                // Each block holds 2 values
+                const gen = new RandomGenerator(prngType, TEST_SEEDS.single);
+                expect(Array.from(gen.int64ArrayAt(0))).toEqual(first);
+                expect(Array.from(gen.int64ArrayAt(DEFAULT_OUTPUT_ARRAY_SIZE / 2))).toEqual(second);
+            });
+
+            it('should let parallel workers tile one stream', () => {
+                const sequential = new RandomGenerator(prngType, TEST_SEEDS.single);
+                const expected = [...sequential.int64Array(true), ...sequential.int64Array(true), ...sequential.int64Array(true)];
+
+                const slices = [2, 0, 1].map(worker => {
+                    const gen = new RandomGenerator(prngType, TEST_SEEDS.single);
+                    return { worker, values: Array.from(gen.int64ArrayAt(worker * DEFAULT_OUTPUT_ARRAY_SIZE / 2)) };
+                });
+                slices.sort((a, b) => a.worker - b.worker);
+
+                expect(slices.flatMap(slice => slice.values)).toEqual(expected);
+            });
+
+            it('should not change the sequential position', () => {
+                const gen = new RandomGenerator(prngType, TEST_SEEDS.single);
+                const reference = new RandomGenerator(prngType, TEST_SEEDS.single);
+
+                gen.int64();
+                reference.int64();
+                gen.int64ArrayAt(12345);
+
+                expect(Array.from(gen.int64Array())).toEqual(Array.from(reference.int64Array()));
+            });
+
+            it('should read the selected stream', () => {
+                const gen = new RandomGenerator(prngType, TEST_SEEDS.single, PHILOX_REFERENCE.STREAM_ID);
+                expect(gen.int64ArrayAt(0)[0]).toBe(PHILOX_REFERENCE.STREAM);
+            });
+        });
+    });
+
+    it('Philox should end an odd-size array on the first value of a block', () => {
+        const oddSize = 7;
+        const gen = new RandomGenerator(PRNGType.Philox, TEST_SEEDS.single, null, oddSize);
+        const full = new RandomGenerator(PRNGType.Philox, TEST_SEEDS.single);
+
+        expect(Array.from(gen.int64ArrayAt(3))).toEqual(Array.from(full.int64ArrayAt(3)).slice(0, oddSize));
+    });
+});
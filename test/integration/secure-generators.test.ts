@@ -0,0 +1,72 @@
+/**
+ * RandomGenerator Cryptographically Secure Generator Tests
+ *
+ * Tests for the ChaCha generators (ChaCha8, ChaCha12, ChaCha20), which share
+ * one fast-key-erasure WASM binary configured with each variant's round count.
+ *
+ * Test Strategy:
+ * - Verify each round count matches the C reference implementation
+ * - Verify output either side of the first rekey matches the C reference
+ * - Verify byteArray() returns the keystream, in order
+ * - Verify auto-seeded generators are keyed from crypto.getRandomValues()
+ * - Verify discard() is rejected, as past keys are erased
+ *
+ * Contrast: Stream selection for these generators is tested with the other
+ * jump-capable generators in parallel-streams.test.ts.
+ */
+
+import { describe, it, expect } from 'vitest';
+import { RandomGenerator, PRNGType } from 'fast-prng-wasm';
+import { TEST_SEEDS, CHACHA_REFERENCE } from '../helpers/test-utils';
+
+describe('RandomGenerator ChaCha', () => {
+    it('should match C reference implementation for each round count', () => {
+        expect(new RandomGenerator(PRNGType.ChaCha8, TEST_SEEDS.quad).int64()).toBe(CHACHA_REFERENCE.CHACHA8_FIRST);
+        expect(new RandomGenerator(PRNGType.ChaCha12, TEST_SEEDS.quad).int64()).toBe(CHACHA_REFERENCE.CHACHA12_FIRST);
+
+        const gen = new RandomGenerator(PRNGType.ChaCha20, TEST_SEEDS.quad);
+        expect(gen.int64()).toBe(CHACHA_REFERENCE.FIRST);
+        expect(gen.int64()).toBe(CHACHA_REFERENCE.SECOND);
+    });
+
+    it('should match C reference implementation either side of the first rekey', () => {
+        const gen = new RandomGenerator(PRNGType.ChaCha20, TEST_SEEDS.quad);
+        const values = gen.int64Array();
+
+        expect(values[123]).toBe(CHACHA_REFERENCE.LAST_OF_FIRST_KEY);
+        expect(values[124]).toBe(CHACHA_REFERENCE.FIRST_OF_SECOND_KEY);
+    });
+
+    it('should return the keystream bytes from byteArray()', () => {
+        const gen = new RandomGenerator(PRNGType.ChaCha20, TEST_SEEDS.quad);
+        const bytes = gen.byteArray(true);
+        const reference = new RandomGenerator(PRNGType.ChaCha20, TEST_SEEDS.quad).int64Array();
+
+        expect(bytes.length).toBe(reference.length * 8);
+        expect(Array.from(new BigUint64Array(bytes.buffer))).toEqual(Array.from(reference));
+        expect(new DataView(bytes.buffer).getBigUint64(0, true)).toBe(CHACHA_REFERENCE.FIRST);
+    });
+
+    it('should continue the same stream across byteArray() and int64() calls', () => {
+        const gen = new RandomGenerator(PRNGType.ChaCha20, TEST_SEEDS.quad, null, 1);
+        const bytes = gen.byteArray(true);
+
+        expect(new DataView(bytes.buffer).getBigUint64(0, true)).toBe(CHACHA_REFERENCE.FIRST);
+        expect(gen.int64()).toBe(CHACHA_REFERENCE.SECOND);
+    });
+
+    it('should auto-seed with distinct 256-bit keys', () => {
+        const gen1 = new RandomGenerator(PRNGType.ChaCha20);
+        const gen2 = new RandomGenerator(PRNGType.ChaCha20);
+
+        expect(gen1.seeds).toHaveLength(8);
+        expect(gen1.seeds).not.toEqual(gen2.seeds);
+        expect(gen1.int64()).not.toBe(gen2.int64());
+    });
+
+    it('should not support discard()', () => {
+        const gen = new RandomGenerator(PRNGType.ChaCha20, TEST_SEEDS.quad);
+
+        expect(() => gen.discard(1)).toThrow('does not support discard()');
+    });
+});
@@ -4,7 +4,7 @@
  * Tests for RandomGenerator single-value generation methods across all PRNG types.
  *
  * Test Strategy:
- * - Validate output ranges for all single-value methods
+ * - Validate output ranges for all single-value methods, and intRange()'s array fills
  * - Verify uniqueness (no duplicate values in reasonable sample sizes)
  * - Test all 5 PRNG types to catch wiring errors or missing exports
  *
@@ -164,6 +164,264 @@ describe('RandomGenerator Single-Value Methods', () => {
                     expect(values.size).toBe(INTEGRATION_SAMPLE_SIZE);
                 });
             });
+
+            describe('normal()', () => {
+                it('should generate finite values centered on the mean', () => {
+                    const gen = new RandomGenerator(prngType);
+                    let sum = 0;
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const value = gen.normal(10, 2);
+
+                        expect(Number.isFinite(value)).toBe(true);
+                        sum += value;
+                    }
+
+                    // the sample mean's standard error is 2 / sqrt(1000) ~ 0.063
+                    expect(Math.abs(sum / INTEGRATION_SAMPLE_SIZE - 10)).toBeLessThan(0.4);
+                });
+
+                it('should generate unique values', () => {
+                    const gen = new RandomGenerator(prngType);
+                    const values = new Set<number>();
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        values.add(gen.normal());
+                    }
+
+                    expect(values.size).toBe(INTEGRATION_SAMPLE_SIZE);
+                });
+            });
+
+            describe('exponential()', () => {
+                it('should generate positive values with mean 1 / rate', () => {
+                    const gen = new RandomGenerator(prngType);
+                    let sum = 0;
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const value = gen.exponential(4);
+
+                        expect(Number.isFinite(value)).toBe(true);
+                        expect(value).toBeGreaterThanOrEqual(0);
+                        sum += value;
+                    }
+
+                    // the sample mean's standard error is 0.25 / sqrt(1000) ~ 0.008
+                    expect(Math.abs(sum / INTEGRATION_SAMPLE_SIZE - 0.25)).toBeLessThan(0.05);
+                });
+            });
+
+            describe('gamma(), beta() and chiSquared()', () => {
+                it('should generate values in range with the expected means', () => {
+                    const gen = new RandomGenerator(prngType);
+                    let gammaSum = 0;
+                    let betaSum = 0;
+                    let chiSquaredSum = 0;
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const g = gen.gamma(3, 2);
+                        const b = gen.beta(2, 6);
+                        const c = gen.chiSquared(5);
+
+                        expect(g).toBeGreaterThan(0);
+                        expect(b).toBeGreaterThanOrEqual(0);
+                        expect(b).toBeLessThanOrEqual(1);
+                        expect(c).toBeGreaterThan(0);
+                        gammaSum += g;
+                        betaSum += b;
+                        chiSquaredSum += c;
+                    }
+
+                    // standard errors of the sample means are ~0.11, ~0.005 and ~0.1
+                    expect(Math.abs(gammaSum / INTEGRATION_SAMPLE_SIZE - 6)).toBeLessThan(0.6);
+                    expect(Math.abs(betaSum / INTEGRATION_SAMPLE_SIZE - 0.25)).toBeLessThan(0.03);
+                    expect(Math.abs(chiSquaredSum / INTEGRATION_SAMPLE_SIZE - 5)).toBeLessThan(0.6);
+                });
+            });
+
+            describe('poisson() and binomial()', () => {
+                it('should generate integers in range with the expected means, by inversion and by rejection', () => {
+                    const gen = new RandomGenerator(prngType);
+                    const sums = [0, 0, 0, 0];
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const values = [gen.poisson(4), gen.poisson(50), gen.binomial(20, 0.3), gen.binomial(500, 0.8)];
+
+                        values.forEach((value, j) => {
+                            expect(Number.isInteger(value)).toBe(true);
+                            expect(value).toBeGreaterThanOrEqual(0);
+                            sums[j] += value;
+                        });
+                        expect(values[2]).toBeLessThanOrEqual(20);
+                        expect(values[3]).toBeLessThanOrEqual(500);
+                    }
+
+                    // standard errors of the sample means are ~0.06, ~0.22, ~0.06 and ~0.28
+                    expect(Math.abs(sums[0] / INTEGRATION_SAMPLE_SIZE - 4)).toBeLessThan(0.35);
+                    expect(Math.abs(sums[1] / INTEGRATION_SAMPLE_SIZE - 50)).toBeLessThan(1.2);
+                    expect(Math.abs(sums[2] / INTEGRATION_SAMPLE_SIZE - 6)).toBeLessThan(0.35);
+                    expect(Math.abs(sums[3] / INTEGRATION_SAMPLE_SIZE - 400)).toBeLessThan(1.5);
+                });
+            });
+
+            describe('geometric()', () => {
+                it('should generate non-negative integers with mean (1 - p) / p', () => {
+                    const gen = new RandomGenerator(prngType);
+                    let sum = 0;
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const value = gen.geometric(0.2);
+
+                        expect(Number.isInteger(value)).toBe(true);
+                        expect(value).toBeGreaterThanOrEqual(0);
+                        sum += value;
+                    }
+
+                    // the sample mean's standard error is sqrt(20 / 1000) ~ 0.14
+                    expect(Math.abs(sum / INTEGRATION_SAMPLE_SIZE - 4)).toBeLessThan(0.7);
+                    expect(gen.geometric(1)).toBe(0);
+                });
+            });
+
+            describe('cauchy(), laplace(), logistic(), gumbel(), weibull() and pareto()', () => {
+                it('should generate finite values in range, centered as expected', () => {
+                    const gen = new RandomGenerator(prngType);
+                    let cauchyBelow = 0;
+                    let laplaceSum = 0;
+                    let gumbelSum = 0;
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const cauchy = gen.cauchy(1, 2);
+                        const laplace = gen.laplace(-3, 1);
+                        const logistic = gen.logistic(0, 5);
+                        const gumbel = gen.gumbel(10, 2);
+                        const weibull = gen.weibull(0.5, 3);
+                        const pareto = gen.pareto(2, 7);
+
+                        for (const value of [cauchy, laplace, logistic, gumbel, weibull, pareto]) {
+                            expect(Number.isFinite(value)).toBe(true);
+                        }
+                        expect(weibull).toBeGreaterThan(0);
+                        expect(pareto).toBeGreaterThanOrEqual(7);
+                        if (cauchy < 1) cauchyBelow++;
+                        laplaceSum += laplace;
+                        gumbelSum += gumbel;
+                    }
+
+                    // Cauchy's median is its location, for 500 of 1000 below it with a standard deviation
+                    // of ~16; Laplace's mean has a standard error of ~0.045, and Gumbel's 10 + 2γ ~ 11.15
+                    // has one of ~0.081
+                    expect(Math.abs(cauchyBelow - 500)).toBeLessThan(80);
+                    expect(Math.abs(laplaceSum / INTEGRATION_SAMPLE_SIZE + 3)).toBeLessThan(0.25);
+                    expect(Math.abs(gumbelSum / INTEGRATION_SAMPLE_SIZE - 11.154)).toBeLessThan(0.4);
+                });
+            });
+
+            describe('zipf()', () => {
+                it('should generate ranks in range, favoring the first', () => {
+                    const gen = new RandomGenerator(prngType);
+                    let firstCount = 0;
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const value = gen.zipf(1e9, 1);
+
+                        expect(Number.isInteger(value)).toBe(true);
+                        expect(value).toBeGreaterThanOrEqual(1);
+                        expect(value).toBeLessThanOrEqual(1e9);
+                        if (value === 1) firstCount++;
+                    }
+
+                    // rank 1 has probability 1 / H(1e9) ~ 0.047, for ~47 ± 7 of 1000
+                    expect(firstCount).toBeGreaterThan(20);
+                    expect(firstCount).toBeLessThan(80);
+                    expect(gen.zipf(1, 2)).toBe(1);
+                });
+            });
+
+            describe('categorical()', () => {
+                it('should draw categories in proportion to their weights, never drawing weight 0', () => {
+                    const gen = new RandomGenerator(prngType);
+                    const table = gen.aliasTable([0, 3, 1]);
+                    const counts = [0, 0, 0];
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const value = gen.categorical(table);
+
+                        expect(Number.isInteger(value)).toBe(true);
+                        expect(value).toBeGreaterThanOrEqual(0);
+                        expect(value).toBeLessThanOrEqual(2);
+                        counts[value]++;
+                    }
+
+                    // category 1 has probability 0.75, for 750 of 1000 with a standard deviation of ~14
+                    expect(counts[0]).toBe(0);
+                    expect(Math.abs(counts[1] - 750)).toBeLessThan(70);
+                });
+            });
+
+            describe('empirical()', () => {
+                it('should draw values from a tabulated CDF, including its jumps but not its gaps', () => {
+                    const gen = new RandomGenerator(prngType);
+                    // uniform over 0 to 10, a jump to 10, a gap, then uniform over 20 to 30
+                    const table = gen.empiricalTable([0, 10, 10, 20, 30], [0, 0.25, 0.75, 0.75, 1]);
+                    let jumpCount = 0;
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const value = gen.empirical(table);
+
+                        expect(value).toBeGreaterThanOrEqual(0);
+                        expect(value).toBeLessThanOrEqual(30);
+                        expect(value > 10 && value < 20).toBe(false);
+                        if (value === 10) jumpCount++;
+                    }
+
+                    // the jump has probability 0.5, for 500 of 1000 with a standard deviation of ~16
+                    expect(Math.abs(jumpCount - 500)).toBeLessThan(80);
+                });
+            });
+
+            describe('intRange()', () => {
+                it('should generate integers in the inclusive range', () => {
+                    const gen = new RandomGenerator(prngType);
+                    const seen = new Set<number>();
+
+                    for (let i = 0; i < INTEGRATION_SAMPLE_SIZE; i++) {
+                        const value = gen.intRange(-3, 3);
+
+                        expect(Number.isInteger(value)).toBe(true);
+                        expect(value).toBeGreaterThanOrEqual(-3);
+                        expect(value).toBeLessThanOrEqual(3);
+                        seen.add(value);
+                    }
+
+                    expect(seen.size).toBe(7); // Both ends are reachable
+                });
+
+                it('should fill arrays with integers in the inclusive range', () => {
+                    const gen = new RandomGenerator(prngType);
+                    const arr = gen.intRangeArray(-0x80000000, 0x7FFFFFFF);
+
+                    for (const value of arr) {
+                        expect(Number.isInteger(value)).toBe(true);
+                        expect(value).toBeGreaterThanOrEqual(-0x80000000);
+                        expect(value).toBeLessThanOrEqual(0x7FFFFFFF);
+                    }
+                });
+
+                it('should fill arrays with every value of a small range', () => {
+                    const gen = new RandomGenerator(prngType);
+                    const counts = new Array<number>(6).fill(0);
+
+                    for (const value of gen.smallIntRangeArray(1, 6)) {
+                        expect(Number.isInteger(value)).toBe(true);
+                        expect(value).toBeGreaterThanOrEqual(1);
+                        expect(value).toBeLessThanOrEqual(6);
+                        counts[value - 1]++;
+                    }
+
+                    expect(counts.every(count => count > 0)).toBe(true);
+                });
+            });
         });
     });
 });
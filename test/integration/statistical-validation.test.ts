@@ -267,6 +267,494 @@ describe('Statistical Validation', () => {
         });
     });
 
+    describe('Normal Distribution Tests - All Algorithms', () => {
+        // Each generator module has its own ziggurat wedge and tail loop, and SIMD modules
+        // their own fast path, so every algorithm is tested.
+        const NORMAL_SAMPLES = 200000;
+
+        // Standard normal deciles: 10 bins with equal probability
+        const NORMAL_DECILES = [-1.2815516, -0.8416212, -0.5244005, -0.2533471, 0, 0.2533471, 0.5244005, 0.8416212, 1.2815516];
+
+        for (const algo of ALL_PRNG_TYPES) {
+            it(`${algo}: normalArray() should fill standard normal deciles evenly`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                const gen = new RandomGenerator(algo);
+                const bins = new Array(NORMAL_DECILES.length + 1).fill(0);
+                let beyondThree = 0;
+
+                for (let batch = 0; batch < NORMAL_SAMPLES / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                    for (const value of gen.normalArray()) {
+                        let bin = 0;
+                        while (bin < NORMAL_DECILES.length && value >= NORMAL_DECILES[bin]) bin++;
+                        bins[bin]++;
+                        if (Math.abs(value) > 3) beyondThree++;
+                    }
+                }
+
+                const chiSquare = chiSquareTest(bins, NORMAL_SAMPLES / bins.length);
+
+                // 95% confidence for 9 degrees of freedom
+                expect(chiSquare).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_10_BINS]);
+
+                // P(|z| > 3) = 0.27%, so ~540 expected (±6 standard deviations)
+                expect(beyondThree).toBeGreaterThan(400);
+                expect(beyondThree).toBeLessThan(680);
+            });
+        }
+
+        // Box-Muller pairs are only offered by these SIMD generators
+        for (const algo of [PRNGType.Xoroshiro128Plus_SIMD, PRNGType.Xoshiro256Plus_SIMD]) {
+            it(`${algo}: normalPairArray() should fill standard normal deciles evenly, with independent pairs`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                const gen = new RandomGenerator(algo);
+                const bins = new Array(NORMAL_DECILES.length + 1).fill(0);
+                const pairSquares = [];
+                let beyondThree = 0;
+
+                for (let batch = 0; batch < NORMAL_SAMPLES / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                    const values = gen.normalPairArray();
+                    for (const value of values) {
+                        let bin = 0;
+                        while (bin < NORMAL_DECILES.length && value >= NORMAL_DECILES[bin]) bin++;
+                        bins[bin]++;
+                        if (Math.abs(value) > 3) beyondThree++;
+                    }
+
+                    // each 4 values hold 2 cosines, then the 2 sines of the same pairs
+                    for (let i = 0; i < values.length; i += 4) {
+                        pairSquares.push(values[i] * values[i], values[i + 2] * values[i + 2]);
+                        pairSquares.push(values[i + 1] * values[i + 1], values[i + 3] * values[i + 3]);
+                    }
+                }
+
+                const chiSquare = chiSquareTest(bins, NORMAL_SAMPLES / bins.length);
+                expect(chiSquare).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_10_BINS]);
+                expect(beyondThree).toBeGreaterThan(400);
+                expect(beyondThree).toBeLessThan(680);
+
+                // the 2 numbers of each pair share a radius, but their squares are still independent
+                expect(Math.abs(serialCorrelationTest(pairSquares))).toBeLessThan(SERIAL_CORRELATION_THRESHOLD);
+            });
+        }
+    });
+
+    describe('Exponential Distribution Tests - All Algorithms', () => {
+        // Like the normal ziggurat, every generator module has its own wedge loop and tail
+        const EXPONENTIAL_SAMPLES = 200000;
+
+        // Exponential deciles for rate 1: -ln(1 - k / 10)
+        const EXPONENTIAL_DECILES = [0.1053605, 0.2231436, 0.3566749, 0.5108256, 0.6931472, 0.9162907, 1.2039728, 1.6094379, 2.3025851];
+
+        for (const algo of ALL_PRNG_TYPES) {
+            it(`${algo}: exponentialArray() should fill exponential deciles evenly`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                const gen = new RandomGenerator(algo);
+                const bins = new Array(EXPONENTIAL_DECILES.length + 1).fill(0);
+                let tail = 0;
+
+                for (let batch = 0; batch < EXPONENTIAL_SAMPLES / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                    for (const value of gen.exponentialArray()) {
+                        let bin = 0;
+                        while (bin < EXPONENTIAL_DECILES.length && value >= EXPONENTIAL_DECILES[bin]) bin++;
+                        bins[bin]++;
+                        if (value > 7.7) tail++;
+                    }
+                }
+
+                const chiSquare = chiSquareTest(bins, EXPONENTIAL_SAMPLES / bins.length);
+
+                // 95% confidence for 9 degrees of freedom
+                expect(chiSquare).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_10_BINS]);
+
+                // past the base layer, in the tail: P(x > 7.7) = 0.045%, so ~90 expected (±6 standard deviations)
+                expect(tail).toBeGreaterThan(33);
+                expect(tail).toBeLessThan(147);
+            });
+
+            it(`${algo}: arrivalTimesArray() should continue an increasing timeline at the given rate`, () => {
+                const gen = new RandomGenerator(algo);
+                const rate = 0.05;
+                let t0 = 1000;
+                let previous = t0;
+                let count = 0;
+
+                for (let batch = 0; batch < 20; batch++) {
+                    const times = gen.arrivalTimesArray(rate, t0);
+                    for (const time of times) {
+                        expect(time).toBeGreaterThanOrEqual(previous);
+                        previous = time;
+                        count++;
+                    }
+                    t0 = times[times.length - 1];
+                }
+
+                // the mean gap is 1 / rate = 20, with a standard error of 20 / sqrt(count) ~ 0.1
+                expect(Math.abs((previous - 1000) / count - 20)).toBeLessThan(1);
+            });
+        }
+    });
+
+    describe('Gamma Family Distribution Tests - All Algorithms', () => {
+        // Each generator module has its own Marsaglia-Tsang loop, and SIMD modules their own
+        // squeeze, so every algorithm is tested against distributions with closed-form deciles
+        const GAMMA_SAMPLES = 100000;
+
+        const CASES: { name: string; fill: (gen: RandomGenerator) => Float64Array; deciles: number[] }[] = [
+            {
+                // chi-squared with 2 degrees of freedom is exponential with mean 2 (shape 1)
+                name: 'chiSquaredArray(2)',
+                fill: gen => gen.chiSquaredArray(2),
+                deciles: [0.210721, 0.4462871, 0.7133499, 1.0216512, 1.3862944, 1.8325815, 2.4079456, 3.2188758, 4.6051702]
+            },
+            {
+                // chi-squared with 1 degree of freedom is a squared standard normal (boosted shape 0.5)
+                name: 'chiSquaredArray(1)',
+                fill: gen => gen.chiSquaredArray(1),
+                deciles: [0.0157908, 0.0641848, 0.1484719, 0.2749959, 0.4549364, 0.7083263, 1.0741942, 1.6423744, 2.7055435]
+            },
+            {
+                // beta(0.5, 0.5) is the arcsine distribution, with both shapes boosted
+                name: 'betaArray(0.5, 0.5)',
+                fill: gen => gen.betaArray(0.5, 0.5),
+                deciles: [0.0244717, 0.0954915, 0.2061074, 0.3454915, 0.5, 0.6545085, 0.7938926, 0.9045085, 0.9755283]
+            }
+        ];
+
+        for (const algo of ALL_PRNG_TYPES) {
+            for (const { name, fill, deciles } of CASES) {
+                it(`${algo}: ${name} should fill its deciles evenly`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                    const gen = new RandomGenerator(algo);
+                    const bins = new Array(deciles.length + 1).fill(0);
+
+                    for (let batch = 0; batch < GAMMA_SAMPLES / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                        for (const value of fill(gen)) {
+                            let bin = 0;
+                            while (bin < deciles.length && value >= deciles[bin]) bin++;
+                            bins[bin]++;
+                        }
+                    }
+
+                    const chiSquare = chiSquareTest(bins, GAMMA_SAMPLES / bins.length);
+
+                    // 95% confidence for 9 degrees of freedom
+                    expect(chiSquare).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_10_BINS]);
+                });
+            }
+
+            it(`${algo}: gammaArray() should have the mean and variance of its shape and scale`, () => {
+                const gen = new RandomGenerator(algo);
+                let sum = 0;
+                let sumSquares = 0;
+
+                for (let batch = 0; batch < GAMMA_SAMPLES / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                    for (const value of gen.gammaArray(9, 0.5)) {
+                        sum += value;
+                        sumSquares += value * value;
+                    }
+                }
+
+                const mean = sum / GAMMA_SAMPLES;
+
+                // mean 4.5 and variance 2.25, with standard errors of ~0.005 and ~0.011
+                expect(Math.abs(mean - 4.5)).toBeLessThan(0.03);
+                expect(Math.abs(sumSquares / GAMMA_SAMPLES - mean * mean - 2.25)).toBeLessThan(0.07);
+            });
+        }
+    });
+
+    describe('Poisson and Binomial Distribution Tests - All Algorithms', () => {
+        // Each generator module has its own inversion and rejection loops, and SIMD modules
+        // their own lane handling, so every algorithm is tested against the exact probabilities
+        // of 10 groups of counts, on both sides of each algorithm switch
+        const COUNT_SAMPLES = 100000;
+
+        const poissonPmf = (lambda: number) => (k: number) => {
+            let p = Math.exp(-lambda);
+            for (let i = 1; i <= k; i++) p *= lambda / i;
+            return p;
+        };
+        const binomialPmf = (n: number, p: number) => (k: number) => {
+            let pk = Math.pow(1 - p, n);
+            for (let i = 1; i <= k; i++) pk *= (n - i + 1) / i * p / (1 - p);
+            return pk;
+        };
+
+        // `edges` are the highest count in each group but the last, which takes the rest
+        const CASES: { name: string; fill: (gen: RandomGenerator) => Float64Array; pmf: (k: number) => number; edges: number[] }[] = [
+            { name: 'poissonArray(3)', fill: gen => gen.poissonArray(3), pmf: poissonPmf(3), edges: [0, 1, 2, 3, 4, 5, 6, 7, 8] },
+            { name: 'poissonArray(40)', fill: gen => gen.poissonArray(40), pmf: poissonPmf(40), edges: [32, 35, 37, 38, 40, 41, 43, 45, 48] },
+            { name: 'binomialArray(30, 0.2)', fill: gen => gen.binomialArray(30, 0.2), pmf: binomialPmf(30, 0.2), edges: [2, 3, 4, 5, 6, 7, 8, 9, 10] },
+            { name: 'binomialArray(400, 0.75)', fill: gen => gen.binomialArray(400, 0.75), pmf: binomialPmf(400, 0.75), edges: [289, 293, 296, 298, 300, 302, 305, 307, 311] }
+        ];
+
+        for (const algo of ALL_PRNG_TYPES) {
+            for (const { name, fill, pmf, edges } of CASES) {
+                it(`${algo}: ${name} should match the exact probabilities`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                    const gen = new RandomGenerator(algo);
+                    const bins = new Array(edges.length + 1).fill(0);
+
+                    for (let batch = 0; batch < COUNT_SAMPLES / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                        for (const value of fill(gen)) {
+                            expect(Number.isInteger(value)).toBe(true);
+                            let bin = 0;
+                            while (bin < edges.length && value > edges[bin]) bin++;
+                            bins[bin]++;
+                        }
+                    }
+
+                    let chiSquare = 0;
+                    let k = 0;
+                    let remaining = 1;
+                    for (let bin = 0; bin < bins.length; bin++) {
+                        let probability = 0;
+                        if (bin < edges.length) {
+                            for (; k <= edges[bin]; k++) probability += pmf(k);
+                            remaining -= probability;
+                        } else {
+                            probability = remaining;
+                        }
+
+                        const expected = COUNT_SAMPLES * probability;
+                        chiSquare += (bins[bin] - expected) ** 2 / expected;
+                    }
+
+                    // 95% confidence for 9 degrees of freedom
+                    expect(chiSquare).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_10_BINS]);
+                });
+            }
+        }
+    });
+
+    describe('Sparse Bernoulli and Random Graph Tests - All Algorithms', () => {
+        // Each generator module has its own skip loop, so every algorithm is checked for
+        // the expected number of successes, spread evenly, across several continued calls
+        const TRIALS = 1000000;
+        const TRIAL_P = 0.002;
+        const NODES = 2000;
+        const EDGE_P = 0.001;
+
+        for (const algo of ALL_PRNG_TYPES) {
+            it(`${algo}: sparseBernoulliIndices() should find Binomial(n, p) successes spread evenly`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                const gen = new RandomGenerator(algo);
+                const bins = new Array(CHI_SQUARE_BIN_COUNT_DEFAULT).fill(0);
+                let count = 0;
+                let last = -1;
+                let indices: Float64Array;
+
+                do {
+                    indices = gen.sparseBernoulliIndices(TRIALS, TRIAL_P, last + 1);
+                    for (const index of indices) {
+                        expect(Number.isInteger(index)).toBe(true);
+                        expect(index).toBeGreaterThan(last);
+                        expect(index).toBeLessThan(TRIALS);
+                        bins[Math.floor(index * CHI_SQUARE_BIN_COUNT_DEFAULT / TRIALS)]++;
+                        last = index;
+                        count++;
+                    }
+                } while (indices.length === DEFAULT_OUTPUT_ARRAY_SIZE);
+
+                // 2000 successes expected, with a standard deviation of ~45
+                expect(Math.abs(count - TRIALS * TRIAL_P)).toBeLessThan(225);
+                expect(chiSquareTest(bins, count / bins.length)).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_10_BINS]);
+            });
+
+            it(`${algo}: randomGraphEdges() should list distinct, ordered edges of G(n, p)`, () => {
+                const gen = new RandomGenerator(algo);
+                let count = 0;
+                let last = -1;
+                let edges: Float64Array;
+
+                do {
+                    edges = gen.randomGraphEdges(NODES, EDGE_P, last + 1);
+                    for (let i = 0; i < edges.length; i += 2) {
+                        const v = edges[i];
+                        const w = edges[i + 1];
+                        const pairIndex = w * (w - 1) / 2 + v;
+
+                        expect(v).toBeGreaterThanOrEqual(0);
+                        expect(v).toBeLessThan(w);
+                        expect(w).toBeLessThan(NODES);
+                        expect(pairIndex).toBeGreaterThan(last);
+                        last = pairIndex;
+                        count++;
+                    }
+                } while (edges.length === DEFAULT_OUTPUT_ARRAY_SIZE);
+
+                // ~1999 edges expected among 1,999,000 possible, with a standard deviation of ~45
+                expect(Math.abs(count - NODES * (NODES - 1) / 2 * EDGE_P)).toBeLessThan(225);
+            });
+        }
+    });
+
+    describe('Zipf Distribution Tests - All Algorithms', () => {
+        // Each generator module has its own rejection loop, and SIMD modules their own lane
+        // handling, so every algorithm is tested against the exact probabilities of 10 groups
+        // of ranks, including a billion rank case that no table could hold
+        const RANK_SAMPLES = 100000;
+
+        // `harmonic` is the sum of 1 / k^s over every rank, which normalizes the probabilities
+        const zipfPmf = (s: number, harmonic: number) => (k: number) => k < 1 ? 0 : k ** -s / harmonic;
+        let harmonic10 = 0;
+        for (let k = 1; k <= 10; k++) harmonic10 += k ** -1.2;
+
+        // `edges` are the highest rank in each group but the last, which takes the rest
+        const CASES: { name: string; fill: (gen: RandomGenerator) => Float64Array; pmf: (k: number) => number; edges: number[] }[] = [
+            { name: 'zipfArray(10, 1.2)', fill: gen => gen.zipfArray(10, 1.2), pmf: zipfPmf(1.2, harmonic10), edges: [1, 2, 3, 4, 5, 6, 7, 8, 9] },
+            // log(n) + Euler's constant + 1 / 2n, exact to well within a double's precision
+            { name: 'zipfArray(1e9, 1)', fill: gen => gen.zipfArray(1e9, 1), pmf: zipfPmf(1, Math.log(1e9) + 0.5772156649015329 + 0.5e-9), edges: [1, 2, 3, 4, 6, 9, 15, 30, 100] },
+            // ζ(2.5), as the ranks past a million hold under 1e-9 of the total
+            { name: 'zipfArray(1e6, 2.5)', fill: gen => gen.zipfArray(1e6, 2.5), pmf: zipfPmf(2.5, 1.341487257250917), edges: [1, 2, 3, 4, 5, 6, 8, 10, 15] }
+        ];
+
+        for (const algo of ALL_PRNG_TYPES) {
+            for (const { name, fill, pmf, edges } of CASES) {
+                it(`${algo}: ${name} should match the exact probabilities`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                    const gen = new RandomGenerator(algo);
+                    const bins = new Array(edges.length + 1).fill(0);
+
+                    for (let batch = 0; batch < RANK_SAMPLES / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                        for (const value of fill(gen)) {
+                            expect(Number.isInteger(value)).toBe(true);
+                            let bin = 0;
+                            while (bin < edges.length && value > edges[bin]) bin++;
+                            bins[bin]++;
+                        }
+                    }
+
+                    let chiSquare = 0;
+                    let k = 0;
+                    let remaining = 1;
+                    for (let bin = 0; bin < bins.length; bin++) {
+                        let probability = 0;
+                        if (bin < edges.length) {
+                            for (; k <= edges[bin]; k++) probability += pmf(k);
+                            remaining -= probability;
+                        } else {
+                            probability = remaining;
+                        }
+
+                        const expected = RANK_SAMPLES * probability;
+                        chiSquare += (bins[bin] - expected) ** 2 / expected;
+                    }
+
+                    // 95% confidence for 9 degrees of freedom
+                    expect(chiSquare).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_10_BINS]);
+                });
+            }
+        }
+    });
+
+    describe('Categorical Distribution Tests - All Algorithms', () => {
+        // Each generator module has its own fill loop over the alias table, so every algorithm is
+        // tested against the exact probabilities of 10 unevenly weighted categories, from a table
+        // that's reused across fills and then rebuilt in place with the weights reversed
+        const CATEGORY_SAMPLES = 100000;
+        const WEIGHTS = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10];
+        const WEIGHT_SUM = 55;
+
+        for (const algo of ALL_PRNG_TYPES) {
+            it(`${algo}: categoricalArray() should match the weights, before and after a rebuild`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                const gen = new RandomGenerator(algo);
+                const table = gen.aliasTable(WEIGHTS);
+
+                for (const weights of [WEIGHTS, [...WEIGHTS].reverse()]) {
+                    gen.aliasTable(weights, table);
+                    const bins = new Array(weights.length).fill(0);
+
+                    for (let batch = 0; batch < CATEGORY_SAMPLES / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                        for (const value of gen.categoricalArray(table)) {
+                            expect(Number.isInteger(value)).toBe(true);
+                            bins[value]++;
+                        }
+                    }
+
+                    let chiSquare = 0;
+                    for (let k = 0; k < bins.length; k++) {
+                        const expected = CATEGORY_SAMPLES * weights[k] / WEIGHT_SUM;
+                        chiSquare += (bins[k] - expected) ** 2 / expected;
+                    }
+
+                    // 95% confidence for 9 degrees of freedom
+                    expect(chiSquare).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_10_BINS]);
+                }
+            });
+        }
+    });
+
+    describe('Empirical Distribution Tests - All Algorithms', () => {
+        // Each generator module has its own fill loop over the empirical table, so every algorithm is
+        // tested against a 10-segment CDF with uneven probabilities and a long tail. Each segment is
+        // split at its midpoint value into 2 bins of equal probability, so the test covers both the
+        // guide table's choice of segment and the interpolation within it
+        const EMPIRICAL_SAMPLES = 100000;
+        const VALUES = [0, 1, 2, 4, 8, 16, 32, 64, 128, 256, 512];
+        const CDF = [0, 0.18, 0.34, 0.48, 0.6, 0.7, 0.78, 0.85, 0.91, 0.96, 1];
+
+        for (const algo of ALL_PRNG_TYPES) {
+            it(`${algo}: empiricalArray() should match the tabulated CDF`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                const gen = new RandomGenerator(algo);
+                const table = gen.empiricalTable(VALUES, CDF);
+                const bins = new Array(2 * (VALUES.length - 1)).fill(0);
+
+                for (let batch = 0; batch < EMPIRICAL_SAMPLES / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                    for (const value of gen.empiricalArray(table)) {
+                        expect(value).toBeGreaterThanOrEqual(0);
+                        expect(value).toBeLessThanOrEqual(512);
+
+                        let k = 0;
+                        while (k < VALUES.length - 2 && value >= VALUES[k + 1]) k++;
+                        bins[2 * k + (value < (VALUES[k] + VALUES[k + 1]) / 2 ? 0 : 1)]++;
+                    }
+                }
+
+                let chiSquare = 0;
+                for (let k = 0; k < VALUES.length - 1; k++) {
+                    const expected = EMPIRICAL_SAMPLES * (CDF[k + 1] - CDF[k]) / 2;
+                    chiSquare += (bins[2 * k] - expected) ** 2 / expected;
+                    chiSquare += (bins[2 * k + 1] - expected) ** 2 / expected;
+                }
+
+                // 95% confidence for 19 degrees of freedom
+                expect(chiSquare).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_20_BINS]);
+            });
+        }
+    });
+
+    describe('Inverse Transform Distribution Tests - All Algorithms', () => {
+        // Each generator module has its own fill loop for each distribution, so every algorithm is
+        // tested on all 6: each number is mapped back through its distribution's exact CDF, which
+        // should leave numbers uniform in [0, 1), pooled across the distributions into 20 bins
+        const SAMPLES_PER_DISTRIBUTION = 20000;
+        const DISTRIBUTIONS: [(gen: RandomGenerator) => Float64Array, (x: number) => number][] = [
+            [gen => gen.cauchyArray(1, 2), x => 0.5 + Math.atan((x - 1) / 2) / Math.PI],
+            [gen => gen.laplaceArray(-3, 0.5), x => x < -3 ? 0.5 * Math.exp(2 * (x + 3)) : 1 - 0.5 * Math.exp(-2 * (x + 3))],
+            [gen => gen.logisticArray(10, 4), x => 1 / (1 + Math.exp(-(x - 10) / 4))],
+            [gen => gen.gumbelArray(0, 1), x => Math.exp(-Math.exp(-x))],
+            [gen => gen.weibullArray(1.5, 1000), x => 1 - Math.exp(-((x / 1000) ** 1.5))],
+            [gen => gen.paretoArray(1.16, 4), x => 1 - (4 / x) ** 1.16]
+        ];
+
+        for (const algo of ALL_PRNG_TYPES) {
+            it(`${algo}: inverse transform arrays should match their distributions' CDFs`, { retry: UNIFORMITY_RETRY_COUNT }, () => {
+                const gen = new RandomGenerator(algo);
+                const binCount = CHI_SQUARE_DF_20_BINS + 1;
+                const bins = new Array(binCount).fill(0);
+
+                for (const [fill, cdf] of DISTRIBUTIONS) {
+                    for (let batch = 0; batch < SAMPLES_PER_DISTRIBUTION / DEFAULT_OUTPUT_ARRAY_SIZE; batch++) {
+                        for (const value of fill(gen)) {
+                            expect(Number.isFinite(value)).toBe(true);
+                            bins[calculateBinIndex(cdf(value), binCount, 0, 1)]++;
+                        }
+                    }
+                }
+
+                const expected = SAMPLES_PER_DISTRIBUTION * DISTRIBUTIONS.length / binCount;
+                const chiSquare = chiSquareTest(bins, expected);
+
+                // 95% confidence for 19 degrees of freedom
+                expect(chiSquare).toBeLessThan(CHI_SQUARE_CRITICAL_VALUES[CHI_SQUARE_DF_20_BINS]);
+            });
+        }
+    });
+
     describe('Independence Tests - All Algorithms', () => {
         // Test independence for all algorithms since correlation issues could be algorithm-specific
         for (const algo of ALL_PRNG_TYPES) {
@@ -9,7 +9,7 @@
  */
 
 import { describe, it, expect, beforeEach, vi } from 'vitest';
-import { PRNGType } from '../../src/types/prng';
+import { PRNGType, AliasTable, EmpiricalTable } from '../../src/types/prng';
 import { getSeedsForPRNG } from '../helpers/test-utils';
 
 /**
@@ -30,7 +30,7 @@ import { getSeedsForPRNG } from '../helpers/test-utils';
  * For testing actual PRNG behavior and statistical properties, see the integration
  * test suite.
  */
-function createMockPRNG(seedCount: number, hasJump: boolean = true) {
+function createMockPRNG(seedCount: number, hasJump: boolean = true, hasFillAt: boolean = false) {
   const mockMemory = new WebAssembly.Memory({ initial: 1 });
   let callCount = 0;
 
@@ -46,6 +46,25 @@ function createMockPRNG(seedCount: number, hasJump: boolean = true) {
     float53: vi.fn(() => 0.5 + (callCount++ * 0.01)),
     coord53: vi.fn(() => -0.123 + (callCount++ * 0.001)),
     coord53Squared: vi.fn(() => 0.456 + (callCount++ * 0.001)),
+    uint32Below: vi.fn(() => 4000 + callCount++),
+    intRange: vi.fn(() => 5000 + callCount++),
+    normal53: vi.fn(() => 6000 + callCount++),
+    exponential53: vi.fn(() => 7000 + callCount++),
+    gamma53: vi.fn(() => 8000 + callCount++),
+    beta53: vi.fn(() => 0.25 + (callCount++ * 0.001)),
+    chiSquared53: vi.fn(() => 9000 + callCount++),
+    poisson: vi.fn(() => 10000 + callCount++),
+    binomial: vi.fn(() => 11000 + callCount++),
+    geometric: vi.fn(() => 12000 + callCount++),
+    zipf: vi.fn(() => 13000 + callCount++),
+    categorical: vi.fn(() => 14000 + callCount++),
+    empirical: vi.fn(() => 15000 + callCount++),
+    cauchy53: vi.fn(() => 16000 + callCount++),
+    laplace53: vi.fn(() => 17000 + callCount++),
+    logistic53: vi.fn(() => 18000 + callCount++),
+    gumbel53: vi.fn(() => 19000 + callCount++),
+    weibull53: vi.fn(() => 20000 + callCount++),
+    pareto53: vi.fn(() => 21000 + callCount++),
 
     // Array methods
     uint64Array: vi.fn(),
@@ -54,6 +73,29 @@ function createMockPRNG(seedCount: number, hasJump: boolean = true) {
     float53Array: vi.fn(),
     coord53Array: vi.fn(),
     coord53SquaredArray: vi.fn(),
+    uint32BelowArray: vi.fn(),
+    intRangeArray: vi.fn(),
+    smallIntRangeArray: vi.fn(),
+    normal53Array: vi.fn(),
+    exponential53Array: vi.fn(),
+    arrivalTimesArray: vi.fn(),
+    gamma53Array: vi.fn(),
+    beta53Array: vi.fn(),
+    chiSquared53Array: vi.fn(),
+    poissonArray: vi.fn(),
+    binomialArray: vi.fn(),
+    geometricArray: vi.fn(),
+    sparseBernoulliIndices: vi.fn(() => 3),
+    randomGraphEdges: vi.fn(() => 2),
+    zipfArray: vi.fn(),
+    categoricalArray: vi.fn(),
+    empiricalArray: vi.fn(),
+    cauchy53Array: vi.fn(),
+    laplace53Array: vi.fn(),
+    logistic53Array: vi.fn(),
+    gumbel53Array: vi.fn(),
+    weibull53Array: vi.fn(),
+    pareto53Array: vi.fn(),
 
     // Array allocation - return mock pointers with proper structure
     allocUint64Array: vi.fn((size: number) => {
@@ -72,14 +114,19 @@ function createMockPRNG(seedCount: number, hasJump: boolean = true) {
       return ptr;
     }),
 
+    aliasTableBuild: vi.fn(),
+    empiricalTableBuild: vi.fn(),
+
     batchTestUnitCirclePoints: vi.fn((count: number) => Math.floor(count * 0.785))
   };
 
-  // Add jump() for Xoshiro/Xoroshiro generators or setStreamIncrement() for PCG
+  // Add jump()/jumpTo()/longJump()/longJumpTo() for Xoshiro/Xoroshiro and Philox generators,
+  // or setStreamIncrement() for PCG, and fillAt() for counter-based (Philox) generators
   if (hasJump) {
-    return { ...baseMock, jump: vi.fn() };
+    const jumpMock = { ...baseMock, advance: vi.fn(), jump: vi.fn(), jumpTo: vi.fn(), longJump: vi.fn(), longJumpTo: vi.fn() };
+    return hasFillAt ? { ...jumpMock, fillAt: vi.fn() } : jumpMock;
   } else {
-    return { ...baseMock, setStreamIncrement: vi.fn() };
+    return { ...baseMock, advance: vi.fn(), setStreamIncrement: vi.fn() };
   }
 }
 
@@ -88,12 +135,61 @@ vi.mock('../../bin/pcg.wasm?init&sync', () => ({
   default: vi.fn(() => ({ exports: createMockPRNG(1, false) })) // PCG uses setStreamIncrement
 }));
 
+vi.mock('../../bin/pcg-simd.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(2, false) }))
+}));
+
+vi.mock('../../bin/pcg64.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(2, false) }))
+}));
+
+vi.mock('../../bin/philox.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(1, true, true) })) // Philox jumps by counter, and fills at any counter
+}));
+
+vi.mock('../../bin/philox-simd.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(1, true, true) }))
+}));
+
+vi.mock('../../bin/chacha-simd.wasm?init&sync', () => ({
+  // ChaCha jumps by nonce, has no advance(), and is given its round count on instantiation
+  default: vi.fn(() => ({ exports: { ...createMockPRNG(4, true), advance: undefined, setRounds: vi.fn() } }))
+}));
+
+vi.mock('../../bin/sfc64.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: { ...createMockPRNG(3, false), advance: undefined, setStreamIncrement: undefined } })) // SFC64 and Romu have no jumps, increments or advance
+}));
+
+vi.mock('../../bin/sfc64-simd.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: { ...createMockPRNG(6, false), advance: undefined, setStreamIncrement: undefined } }))
+}));
+
+vi.mock('../../bin/romutrio.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: { ...createMockPRNG(3, false), advance: undefined, setStreamIncrement: undefined } }))
+}));
+
+vi.mock('../../bin/romutrio-simd.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: { ...createMockPRNG(6, false), advance: undefined, setStreamIncrement: undefined } }))
+}));
+
+vi.mock('../../bin/romuduojr.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: { ...createMockPRNG(2, false), advance: undefined, setStreamIncrement: undefined } }))
+}));
+
+vi.mock('../../bin/romuduojr-simd.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: { ...createMockPRNG(4, false), advance: undefined, setStreamIncrement: undefined } }))
+}));
+
 vi.mock('../../bin/xoroshiro128plus.wasm?init&sync', () => ({
   default: vi.fn(() => ({ exports: createMockPRNG(2, true) })) // Xoroshiro uses jump
 }));
 
 vi.mock('../../bin/xoroshiro128plus-simd.wasm?init&sync', () => ({
-  default: vi.fn(() => ({ exports: createMockPRNG(4, true) }))
+  default: vi.fn(() => ({ exports: { ...createMockPRNG(4, true), normalPairArray: vi.fn() } })) // Box-Muller pairs
+}));
+
+vi.mock('../../bin/xoroshiro128plus-simd-x4.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(8, true) }))
 }));
 
 vi.mock('../../bin/xoshiro256plus.wasm?init&sync', () => ({
@@ -101,12 +197,58 @@ vi.mock('../../bin/xoshiro256plus.wasm?init&sync', () => ({
 }));
 
 vi.mock('../../bin/xoshiro256plus-simd.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: { ...createMockPRNG(8, true), normalPairArray: vi.fn() } }))
+}));
+
+vi.mock('../../bin/xoshiro256plus-simd-x4.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(16, true) }))
+}));
+
+vi.mock('../../bin/xoroshiro128plusplus.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(2, true) }))
+}));
+
+vi.mock('../../bin/xoroshiro128plusplus-simd.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(4, true) }))
+}));
+
+vi.mock('../../bin/xoroshiro128starstar.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(2, true) }))
+}));
+
+vi.mock('../../bin/xoroshiro128starstar-simd.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(4, true) }))
+}));
+
+vi.mock('../../bin/xoshiro256plusplus.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(4, true) }))
+}));
+
+vi.mock('../../bin/xoshiro256plusplus-simd.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(8, true) }))
+}));
+
+vi.mock('../../bin/xoshiro256starstar.wasm?init&sync', () => ({
+  default: vi.fn(() => ({ exports: createMockPRNG(4, true) }))
+}));
+
+vi.mock('../../bin/xoshiro256starstar-simd.wasm?init&sync', () => ({
   default: vi.fn(() => ({ exports: createMockPRNG(8, true) }))
 }));
 
 // Now import RandomGenerator after mocks are set up
 import { RandomGenerator } from '../../src/random-generator';
 
+// Generators with non-linear state updates, which support neither stream selection nor discard()
+const NO_STREAM_TYPES: PRNGType[] = [
+    PRNGType.SFC64,
+    PRNGType.SFC64_SIMD,
+    PRNGType.RomuTrio,
+    PRNGType.RomuTrio_SIMD,
+    PRNGType.RomuDuoJr,
+    PRNGType.RomuDuoJr_SIMD
+];
+
 describe('RandomGenerator Unit Tests', () => {
     beforeEach(() => {
         vi.clearAllMocks();
@@ -157,8 +299,16 @@ describe('RandomGenerator Unit Tests', () => {
 
         it('should throw on odd-size arrays for SIMD algorithms', () => {
             const simdTypes = [
+                PRNGType.PCG_SIMD,
+                PRNGType.Philox_SIMD,
                 PRNGType.Xoroshiro128Plus_SIMD,
-                PRNGType.Xoshiro256Plus_SIMD
+                PRNGType.Xoroshiro128Plus_SIMDx4,
+                PRNGType.Xoshiro256Plus_SIMD,
+                PRNGType.Xoshiro256Plus_SIMDx4,
+                PRNGType.Xoroshiro128PlusPlus_SIMD,
+                PRNGType.Xoroshiro128StarStar_SIMD,
+                PRNGType.Xoshiro256PlusPlus_SIMD,
+                PRNGType.Xoshiro256StarStar_SIMD
             ];
 
             for (const type of simdTypes) {
@@ -175,6 +325,42 @@ describe('RandomGenerator Unit Tests', () => {
             }).not.toThrow();
         });
 
+        it('should throw on arrays that are not a multiple of 4 for 4-lane SIMD algorithms', () => {
+            for (const type of [PRNGType.Xoroshiro128Plus_SIMDx4, PRNGType.Xoshiro256Plus_SIMDx4]) {
+                expect(() => {
+                    new RandomGenerator(type, null, null, 102);  // Even, but not a multiple of 4
+                }).toThrow(/must be a multiple of 4/);
+            }
+        });
+
+        it('should auto-seed ChaCha generators directly from crypto.getRandomValues()', () => {
+            const getRandomValues = vi.spyOn(crypto, 'getRandomValues');
+            const gen = new RandomGenerator(PRNGType.ChaCha20);
+
+            expect(getRandomValues).toHaveBeenCalledWith(expect.any(BigUint64Array));
+            expect(gen.seeds).toHaveLength(8);
+            expect((gen as any)._instance.setSeeds).toHaveBeenCalledWith(...gen.seeds);
+            getRandomValues.mockRestore();
+        });
+
+        it('should configure each ChaCha variant with its round count', () => {
+            for (const [type, rounds] of [[PRNGType.ChaCha8, 8], [PRNGType.ChaCha12, 12], [PRNGType.ChaCha20, 20]] as const) {
+                const gen = new RandomGenerator(type, getSeedsForPRNG(type));
+                const instance = (gen as any)._instance;
+
+                expect(instance.setRounds).toHaveBeenCalledWith(rounds);
+                expect(instance.setRounds.mock.invocationCallOrder[0])
+                    .toBeLessThan(instance.setSeeds.mock.invocationCallOrder[0]);
+            }
+        });
+
+        it('should auto-seed with enough seeds for generators that need more than 8', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256Plus_SIMDx4);
+
+            expect(gen.seeds).toHaveLength(16);
+            expect((gen as any)._instance.setSeeds).toHaveBeenCalledWith(...gen.seeds);
+        });
+
         it('should set custom outputArraySize', () => {
             const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus), null, 500);
             expect(gen.outputArraySize).toBe(500);
@@ -470,6 +656,588 @@ describe('RandomGenerator Unit Tests', () => {
         });
     });
 
+    describe('byteArray()', () => {
+        it('should call uint64Array() and return the bytes of the 64-bit output array', () => {
+            const gen = new RandomGenerator(PRNGType.ChaCha20, getSeedsForPRNG(PRNGType.ChaCha20));
+            const bigIntArray = (gen as any)._arrayConfig.bigIntOutputArray as BigUint64Array;
+            const bytes = gen.byteArray();
+
+            expect((gen as any)._instance.uint64Array).toHaveBeenCalledWith((gen as any)._arrayConfig.bigIntOutputArrayPtr);
+            expect(bytes).toBeInstanceOf(Uint8Array);
+            expect(bytes.length).toBe(gen.outputArraySize * 8);
+            expect(bytes.buffer).toBe(bigIntArray.buffer);
+            expect(bytes.byteOffset).toBe(bigIntArray.byteOffset);
+        });
+
+        it('should return an independent copy when copy is true', () => {
+            const gen = new RandomGenerator(PRNGType.ChaCha20, getSeedsForPRNG(PRNGType.ChaCha20));
+            const bytes = gen.byteArray(true);
+
+            expect(bytes).not.toBe((gen as any)._arrayConfig.byteOutputArray);
+            expect(bytes.length).toBe(gen.outputArraySize * 8);
+        });
+    });
+
+    describe('intRange(), intRangeArray() and smallIntRangeArray()', () => {
+        it('should call intRange() with its bounds and return its value', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const val = gen.intRange(1, 6);
+
+            // Get the value that the mock returned
+            const mockReturnValue = ((gen as any)._instance.intRange as any).mock.results[0].value;
+
+            expect((gen as any)._instance.intRange).toHaveBeenCalledWith(1, 6);
+            expect(val).toBe(mockReturnValue);
+        });
+
+        it('should call intRangeArray() with its bounds and the float output array', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const arr = gen.intRangeArray(-5, 5);
+
+            expect((gen as any)._instance.intRangeArray).toHaveBeenCalledWith(-5, 5, (gen as any)._arrayConfig.floatOutputArrayPtr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+            expect(gen.intRangeArray(-5, 5, true)).not.toBe(arr);
+        });
+
+        it('should accept the full 32-bit signed integer range', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.intRange(-0x80000000, 0x7FFFFFFF)).not.toThrow();
+            expect(() => gen.intRange(7, 7)).not.toThrow();
+        });
+
+        it('should throw for bounds that are not 32-bit signed integers', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.intRange(0.5, 6)).toThrow('min must be an integer');
+            expect(() => gen.intRange(-0x80000001, 6)).toThrow('min must be an integer');
+            expect(() => gen.intRange(1, 0x80000000)).toThrow('max must be an integer');
+            expect(() => gen.intRangeArray(1, NaN)).toThrow('max must be an integer');
+            expect((gen as any)._instance.intRange).not.toHaveBeenCalled();
+            expect((gen as any)._instance.intRangeArray).not.toHaveBeenCalled();
+        });
+
+        it('should throw when min is greater than max', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.intRange(6, 1)).toThrow('min must not be greater than max');
+            expect(() => gen.intRangeArray(6, 1)).toThrow('min must not be greater than max');
+        });
+
+        it('should call smallIntRangeArray() with its bounds and the float output array', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const arr = gen.smallIntRangeArray(1, 6);
+
+            expect((gen as any)._instance.smallIntRangeArray).toHaveBeenCalledWith(1, 6, (gen as any)._arrayConfig.floatOutputArrayPtr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+        });
+
+        it('should throw when smallIntRangeArray() is given more than 65536 integers', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.smallIntRangeArray(0, 65535)).not.toThrow();
+            expect(() => gen.smallIntRangeArray(0, 65536)).toThrow('supports ranges of at most 65536 integers');
+            expect(() => gen.smallIntRangeArray(6, 1)).toThrow('min must not be greater than max');
+        });
+    });
+
+    describe('normal() and normalArray()', () => {
+        it('should call normal53() with a standard normal by default', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const val = gen.normal();
+
+            // Get the value that the mock returned
+            const mockReturnValue = ((gen as any)._instance.normal53 as any).mock.results[0].value;
+
+            expect((gen as any)._instance.normal53).toHaveBeenCalledWith(0, 1);
+            expect(val).toBe(mockReturnValue);
+        });
+
+        it('should pass mean and stddev through to normal53() and normal53Array()', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            gen.normal(100, 15);
+            const arr = gen.normalArray(-2, 0.5);
+
+            expect((gen as any)._instance.normal53).toHaveBeenCalledWith(100, 15);
+            expect((gen as any)._instance.normal53Array).toHaveBeenCalledWith(-2, 0.5, (gen as any)._arrayConfig.floatOutputArrayPtr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+            expect(gen.normalArray(0, 1, true)).not.toBe(arr);
+        });
+
+        it('should throw for a non-finite mean or a negative or non-finite stddev', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.normal(NaN)).toThrow('mean must be a finite number');
+            expect(() => gen.normal(0, -1)).toThrow('stddev must be a finite number of at least 0');
+            expect(() => gen.normalArray(0, Infinity)).toThrow('stddev must be a finite number of at least 0');
+            expect(() => gen.normal(0, 0)).not.toThrow();
+            expect((gen as any)._instance.normal53Array).not.toHaveBeenCalled();
+        });
+    });
+
+    describe('normalPairArray()', () => {
+        it('should pass mean and stddev through to normalPairArray()', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256Plus_SIMD, getSeedsForPRNG(PRNGType.Xoshiro256Plus_SIMD));
+            const arr = gen.normalPairArray(-2, 0.5);
+
+            expect((gen as any)._instance.normalPairArray).toHaveBeenCalledWith(-2, 0.5, (gen as any)._arrayConfig.floatOutputArrayPtr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+            expect(gen.normalPairArray(0, 1, true)).not.toBe(arr);
+        });
+
+        it('should use a standard normal by default', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus_SIMD, getSeedsForPRNG(PRNGType.Xoroshiro128Plus_SIMD));
+            gen.normalPairArray();
+
+            expect((gen as any)._instance.normalPairArray).toHaveBeenCalledWith(0, 1, expect.any(Number));
+        });
+
+        it('should throw for a non-finite mean or a negative or non-finite stddev', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256Plus_SIMD, getSeedsForPRNG(PRNGType.Xoshiro256Plus_SIMD));
+
+            expect(() => gen.normalPairArray(NaN)).toThrow('mean must be a finite number');
+            expect(() => gen.normalPairArray(0, -1)).toThrow('stddev must be a finite number of at least 0');
+            expect((gen as any)._instance.normalPairArray).not.toHaveBeenCalled();
+        });
+
+        it('should throw for generators without Box-Muller pairs', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256Plus, getSeedsForPRNG(PRNGType.Xoshiro256Plus));
+
+            expect(() => gen.normalPairArray()).toThrow('does not support normalPairArray()');
+        });
+    });
+
+    describe('exponential(), exponentialArray() and arrivalTimesArray()', () => {
+        it('should call exponential53() with rate 1 by default', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const val = gen.exponential();
+
+            // Get the value that the mock returned
+            const mockReturnValue = ((gen as any)._instance.exponential53 as any).mock.results[0].value;
+
+            expect((gen as any)._instance.exponential53).toHaveBeenCalledWith(1);
+            expect(val).toBe(mockReturnValue);
+        });
+
+        it('should pass rate and t0 through to the WASM array fills', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const ptr = (gen as any)._arrayConfig.floatOutputArrayPtr;
+            const arr = gen.exponentialArray(4);
+            gen.arrivalTimesArray(0.05);
+            gen.arrivalTimesArray(0.05, 1234.5);
+
+            expect((gen as any)._instance.exponential53Array).toHaveBeenCalledWith(4, ptr);
+            expect((gen as any)._instance.arrivalTimesArray).toHaveBeenCalledWith(0.05, 0, ptr);
+            expect((gen as any)._instance.arrivalTimesArray).toHaveBeenCalledWith(0.05, 1234.5, ptr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+            expect(gen.arrivalTimesArray(1, 0, true)).not.toBe(arr);
+        });
+
+        it('should throw for a rate that is not a finite number greater than 0, or a non-finite t0', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.exponential(0)).toThrow('rate must be a finite number greater than 0');
+            expect(() => gen.exponentialArray(-1)).toThrow('rate must be a finite number greater than 0');
+            expect(() => gen.arrivalTimesArray(Infinity)).toThrow('rate must be a finite number greater than 0');
+            expect(() => gen.arrivalTimesArray(1, NaN)).toThrow('t0 must be a finite number');
+            expect((gen as any)._instance.exponential53Array).not.toHaveBeenCalled();
+            expect((gen as any)._instance.arrivalTimesArray).not.toHaveBeenCalled();
+        });
+    });
+
+    describe('gamma(), beta() and chiSquared()', () => {
+        it('should pass parameters through to the WASM functions, with scale 1 by default', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const ptr = (gen as any)._arrayConfig.floatOutputArrayPtr;
+            const val = gen.gamma(2.5);
+            gen.beta(13, 89);
+            gen.chiSquared(4);
+            const arr = gen.gammaArray(44, 0.5);
+            gen.betaArray(0.5, 0.5);
+            gen.chiSquaredArray(3);
+
+            // Get the value that the mock returned
+            const mockReturnValue = ((gen as any)._instance.gamma53 as any).mock.results[0].value;
+
+            expect(val).toBe(mockReturnValue);
+            expect((gen as any)._instance.gamma53).toHaveBeenCalledWith(2.5, 1);
+            expect((gen as any)._instance.beta53).toHaveBeenCalledWith(13, 89);
+            expect((gen as any)._instance.chiSquared53).toHaveBeenCalledWith(4);
+            expect((gen as any)._instance.gamma53Array).toHaveBeenCalledWith(44, 0.5, ptr);
+            expect((gen as any)._instance.beta53Array).toHaveBeenCalledWith(0.5, 0.5, ptr);
+            expect((gen as any)._instance.chiSquared53Array).toHaveBeenCalledWith(3, ptr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+            expect(gen.betaArray(1, 1, true)).not.toBe(arr);
+        });
+
+        it('should throw for shapes, scales or degrees of freedom that are not finite numbers greater than 0', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.gamma(0)).toThrow('shape must be a finite number greater than 0');
+            expect(() => gen.gammaArray(1, -2)).toThrow('scale must be a finite number greater than 0');
+            expect(() => gen.beta(NaN, 1)).toThrow('a must be a finite number greater than 0');
+            expect(() => gen.betaArray(1, Infinity)).toThrow('b must be a finite number greater than 0');
+            expect(() => gen.chiSquaredArray(0)).toThrow('k must be a finite number greater than 0');
+            expect(() => gen.gamma(0.01)).not.toThrow();
+            expect((gen as any)._instance.gamma53Array).not.toHaveBeenCalled();
+            expect((gen as any)._instance.beta53Array).not.toHaveBeenCalled();
+            expect((gen as any)._instance.chiSquared53Array).not.toHaveBeenCalled();
+        });
+    });
+
+    describe('Inverse transform distributions', () => {
+        it('should pass parameters through to the WASM functions, with location 0 and scale 1 by default', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const instance = (gen as any)._instance;
+            const ptr = (gen as any)._arrayConfig.floatOutputArrayPtr;
+            const val = gen.cauchy();
+            gen.laplace(2, 0.5);
+            gen.logistic(-1);
+            gen.gumbel(3.2, 0.6);
+            gen.weibull(1.5);
+            gen.pareto(1.16, 4);
+            const arr = gen.cauchyArray(0, 0.1);
+            gen.laplaceArray();
+            gen.logisticArray(5, 2);
+            gen.gumbelArray(1);
+            gen.weibullArray(2, 8);
+            gen.paretoArray(3);
+
+            // Get the value that the mock returned
+            const mockReturnValue = (instance.cauchy53 as any).mock.results[0].value;
+
+            expect(val).toBe(mockReturnValue);
+            expect(instance.cauchy53).toHaveBeenCalledWith(0, 1);
+            expect(instance.laplace53).toHaveBeenCalledWith(2, 0.5);
+            expect(instance.logistic53).toHaveBeenCalledWith(-1, 1);
+            expect(instance.gumbel53).toHaveBeenCalledWith(3.2, 0.6);
+            expect(instance.weibull53).toHaveBeenCalledWith(1.5, 1);
+            expect(instance.pareto53).toHaveBeenCalledWith(1.16, 4);
+            expect(instance.cauchy53Array).toHaveBeenCalledWith(0, 0.1, ptr);
+            expect(instance.laplace53Array).toHaveBeenCalledWith(0, 1, ptr);
+            expect(instance.logistic53Array).toHaveBeenCalledWith(5, 2, ptr);
+            expect(instance.gumbel53Array).toHaveBeenCalledWith(1, 1, ptr);
+            expect(instance.weibull53Array).toHaveBeenCalledWith(2, 8, ptr);
+            expect(instance.pareto53Array).toHaveBeenCalledWith(3, 1, ptr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+            expect(gen.paretoArray(2, 1, true)).not.toBe(arr);
+        });
+
+        it('should throw for locations that are not finite, or shapes and scales that are not finite numbers greater than 0', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const instance = (gen as any)._instance;
+
+            expect(() => gen.cauchy(NaN)).toThrow('location must be a finite number, got NaN');
+            expect(() => gen.laplaceArray(Infinity)).toThrow('location must be a finite number');
+            expect(() => gen.logistic(0, 0)).toThrow('scale must be a finite number greater than 0, got 0');
+            expect(() => gen.gumbelArray(0, -1)).toThrow('scale must be a finite number greater than 0');
+            expect(() => gen.weibull(0)).toThrow('shape must be a finite number greater than 0');
+            expect(() => gen.weibullArray(1, Infinity)).toThrow('scale must be a finite number greater than 0');
+            expect(() => gen.paretoArray(-2)).toThrow('shape must be a finite number greater than 0');
+            expect(() => gen.pareto(1, NaN)).toThrow('scale must be a finite number greater than 0');
+            expect(() => gen.gumbel(-1e300, 1e-300)).not.toThrow();
+            for (const name of ['cauchy', 'laplace', 'logistic', 'gumbel', 'weibull', 'pareto']) {
+                expect(instance[`${name}53Array`]).not.toHaveBeenCalled();
+            }
+        });
+    });
+
+    describe('poisson(), binomial() and their arrays', () => {
+        it('should pass parameters through to the WASM functions', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const ptr = (gen as any)._arrayConfig.floatOutputArrayPtr;
+            const val = gen.poisson(3.5);
+            gen.binomial(40, 0.25);
+            const arr = gen.poissonArray(120);
+            gen.binomialArray(1000, 0.9);
+
+            // Get the value that the mock returned
+            const mockReturnValue = ((gen as any)._instance.poisson as any).mock.results[0].value;
+
+            expect(val).toBe(mockReturnValue);
+            expect((gen as any)._instance.poisson).toHaveBeenCalledWith(3.5);
+            expect((gen as any)._instance.binomial).toHaveBeenCalledWith(40, 0.25);
+            expect((gen as any)._instance.poissonArray).toHaveBeenCalledWith(120, ptr);
+            expect((gen as any)._instance.binomialArray).toHaveBeenCalledWith(1000, 0.9, ptr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+            expect(gen.binomialArray(10, 0.5, true)).not.toBe(arr);
+        });
+
+        it('should accept the degenerate parameters that always return 0 or n', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.poisson(0)).not.toThrow();
+            expect(() => gen.binomial(0, 0.5)).not.toThrow();
+            expect(() => gen.binomialArray(10, 0)).not.toThrow();
+            expect(() => gen.binomialArray(10, 1)).not.toThrow();
+        });
+
+        it('should throw for means, trial counts or probabilities out of range', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.poisson(-1)).toThrow('lambda must be a finite number of at least 0');
+            expect(() => gen.poissonArray(Infinity)).toThrow('lambda must be a finite number of at least 0');
+            expect(() => gen.binomial(2.5, 0.5)).toThrow('n must be an integer between 0 and 2147483647');
+            expect(() => gen.binomialArray(-1, 0.5)).toThrow('n must be an integer between 0 and 2147483647');
+            expect(() => gen.binomialArray(2 ** 31, 0.5)).toThrow('n must be an integer between 0 and 2147483647');
+            expect(() => gen.binomial(10, 1.5)).toThrow('p must be a number between 0 and 1');
+            expect(() => gen.binomialArray(10, NaN)).toThrow('p must be a number between 0 and 1');
+            expect((gen as any)._instance.poissonArray).not.toHaveBeenCalled();
+            expect((gen as any)._instance.binomialArray).not.toHaveBeenCalled();
+        });
+    });
+
+    describe('geometric(), sparseBernoulliIndices() and randomGraphEdges()', () => {
+        it('should pass parameters through to the WASM functions, starting from 0 by default', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const ptr = (gen as any)._arrayConfig.floatOutputArrayPtr;
+            const val = gen.geometric(0.25);
+            const arr = gen.geometricArray(1);
+            gen.sparseBernoulliIndices(1e6, 0.001);
+            gen.sparseBernoulliIndices(1e6, 0.001, 5000);
+            gen.randomGraphEdges(100, 0.05);
+
+            // Get the value that the mock returned
+            const mockReturnValue = ((gen as any)._instance.geometric as any).mock.results[0].value;
+
+            expect(val).toBe(mockReturnValue);
+            expect((gen as any)._instance.geometric).toHaveBeenCalledWith(0.25);
+            expect((gen as any)._instance.geometricArray).toHaveBeenCalledWith(1, ptr);
+            expect((gen as any)._instance.sparseBernoulliIndices).toHaveBeenCalledWith(1e6, 0.001, 0, ptr);
+            expect((gen as any)._instance.sparseBernoulliIndices).toHaveBeenCalledWith(1e6, 0.001, 5000, ptr);
+            expect((gen as any)._instance.randomGraphEdges).toHaveBeenCalledWith(100, 0.05, 0, ptr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+        });
+
+        it('should return views of just the indices or edges that WASM wrote', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const buffer = (gen as any)._arrayConfig.floatOutputArray as Float64Array;
+
+            const indices = gen.sparseBernoulliIndices(1000, 0.01);
+            expect(indices.length).toBe(3); // mock count
+            expect(indices.buffer).toBe(buffer.buffer);
+
+            const edges = gen.randomGraphEdges(100, 0.05);
+            expect(edges.length).toBe(4); // 2 edges, 2 nodes each
+            expect(edges.buffer).toBe(buffer.buffer);
+
+            const copied = gen.randomGraphEdges(100, 0.05, 0, true);
+            expect(copied.length).toBe(4);
+            expect(copied.buffer).not.toBe(buffer.buffer);
+        });
+
+        it('should throw for probabilities, counts or node counts out of range', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.geometric(0)).toThrow('p must be a number greater than 0 and at most 1');
+            expect(() => gen.geometricArray(1.5)).toThrow('p must be a number greater than 0 and at most 1');
+            expect(() => gen.sparseBernoulliIndices(1.5, 0.1)).toThrow('n must be a non-negative safe integer');
+            expect(() => gen.sparseBernoulliIndices(100, -0.1)).toThrow('p must be a number between 0 and 1');
+            expect(() => gen.sparseBernoulliIndices(100, 0.1, -1)).toThrow('start must be a non-negative safe integer');
+            expect(() => gen.randomGraphEdges(2 ** 26 + 1, 0.1)).toThrow('nodes must be an integer between 0 and 67108864');
+            expect(() => gen.randomGraphEdges(100, NaN)).toThrow('p must be a number between 0 and 1');
+            expect(() => gen.sparseBernoulliIndices(100, 0)).not.toThrow();
+            expect((gen as any)._instance.geometricArray).not.toHaveBeenCalled();
+            expect((gen as any)._instance.randomGraphEdges).not.toHaveBeenCalled();
+        });
+    });
+
+    describe('zipf()', () => {
+        it('should pass n and s through to the WASM functions', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const val = gen.zipf(1000, 1.2);
+            const arr = gen.zipfArray(1e9, 0);
+
+            // Get the value that the mock returned
+            const mockReturnValue = ((gen as any)._instance.zipf as any).mock.results[0].value;
+
+            expect(val).toBe(mockReturnValue);
+            expect((gen as any)._instance.zipf).toHaveBeenCalledWith(1000, 1.2);
+            expect((gen as any)._instance.zipfArray).toHaveBeenCalledWith(1e9, 0, (gen as any)._arrayConfig.floatOutputArrayPtr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+        });
+
+        it('should throw for rank counts or exponents out of range', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+
+            expect(() => gen.zipf(0, 1)).toThrow('n must be an integer between 1 and 9007199254740991');
+            expect(() => gen.zipf(10.5, 1)).toThrow('n must be an integer between 1 and 9007199254740991');
+            expect(() => gen.zipfArray(2 ** 53, 1)).toThrow('n must be an integer between 1 and 9007199254740991');
+            expect(() => gen.zipf(10, -0.5)).toThrow('s must be a finite number of at least 0');
+            expect(() => gen.zipfArray(10, Infinity)).toThrow('s must be a finite number of at least 0');
+            expect(() => gen.zipf(1, 0)).not.toThrow();
+            expect((gen as any)._instance.zipfArray).not.toHaveBeenCalled();
+        });
+    });
+
+    describe('aliasTable(), categorical() and categoricalArray()', () => {
+        it('should stage the weights in the float output array and build a new table from them', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const instance = (gen as any)._instance;
+            const floatPtr = (gen as any)._arrayConfig.floatOutputArrayPtr;
+            instance.allocUint64Array.mockClear();
+
+            const table = gen.aliasTable([90, 9, 1]);
+
+            expect(table.size).toBe(3);
+            expect(instance.allocUint64Array).toHaveBeenCalledWith(3);
+            expect(instance.aliasTableBuild).toHaveBeenCalledWith(floatPtr, table.ptr);
+            expect(Array.from((gen as any)._arrayConfig.floatOutputArray.subarray(0, 3))).toEqual([90, 9, 1]);
+        });
+
+        it('should rebuild an existing table in place, without allocating', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const instance = (gen as any)._instance;
+            const table = gen.aliasTable([1, 2, 3, 4]);
+            instance.allocUint64Array.mockClear();
+
+            expect(gen.aliasTable([4, 3, 2, 1], table)).toBe(table);
+            expect(instance.allocUint64Array).not.toHaveBeenCalled();
+            expect(instance.aliasTableBuild).toHaveBeenCalledTimes(2);
+        });
+
+        it('should throw before allocating a new table that would not fit in the remaining WASM memory', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const instance = (gen as any)._instance;
+            const weights = new Array(1000).fill(1);
+
+            // the mock's float output array ends at byte 10048 of 65536, leaving room for 6 tables of 8080 bytes
+            const tables: AliasTable[] = [];
+            for (let i = 0; i < 6; i++) {
+                tables.push(gen.aliasTable(weights));
+            }
+            instance.allocUint64Array.mockClear();
+
+            expect(() => gen.aliasTable(weights)).toThrow('table needs up to 8080 bytes of WASM memory, but this generator has only 7008 left');
+            expect(instance.allocUint64Array).not.toHaveBeenCalled();
+            expect(() => gen.aliasTable(weights, tables[0])).not.toThrow();
+            expect(() => gen.aliasTable([1, 2])).not.toThrow();
+        });
+
+        it('should pass the table through to the WASM functions', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const table = gen.aliasTable([1, 1]);
+            const val = gen.categorical(table);
+            const arr = gen.categoricalArray(table);
+
+            // Get the value that the mock returned
+            const mockReturnValue = ((gen as any)._instance.categorical as any).mock.results[0].value;
+
+            expect(val).toBe(mockReturnValue);
+            expect((gen as any)._instance.categorical).toHaveBeenCalledWith(table.ptr);
+            expect((gen as any)._instance.categoricalArray).toHaveBeenCalledWith(table.ptr, (gen as any)._arrayConfig.floatOutputArrayPtr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+        });
+
+        it('should throw for invalid weights, or tables from another generator or of another size', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const other = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const table = gen.aliasTable([1, 2]);
+            const otherTable = other.aliasTable([1, 2]);
+            (gen as any)._instance.aliasTableBuild.mockClear();
+
+            expect(() => gen.aliasTable([])).toThrow('weights must hold between 1 and 1000 values');
+            expect(() => gen.aliasTable(new Array(1001).fill(1))).toThrow('weights must hold between 1 and 1000 values');
+            expect(() => gen.aliasTable([1, -1])).toThrow('weights must be finite numbers of at least 0, got -1 at index 1');
+            expect(() => gen.aliasTable([NaN])).toThrow('weights must be finite numbers of at least 0');
+            expect(() => gen.aliasTable([0, 0])).toThrow('weights must have a positive, finite sum');
+            expect(() => gen.aliasTable([Number.MAX_VALUE, Number.MAX_VALUE])).toThrow('weights must have a positive, finite sum');
+            expect(() => gen.aliasTable([1, 2, 3], table)).toThrow('table has 2 categories, but there are 3 weights');
+            expect(() => gen.aliasTable([1, 2], otherTable)).toThrow('table must be an alias table built by this generator');
+            expect(() => gen.categorical(otherTable)).toThrow('table must be an alias table built by this generator');
+            expect(() => gen.categoricalArray({ size: 2, ptr: table.ptr })).toThrow('table must be an alias table built by this generator');
+            expect(() => gen.aliasTable([0, 1])).not.toThrow();
+            expect((gen as any)._instance.aliasTableBuild).toHaveBeenCalledTimes(1);
+            expect((gen as any)._instance.categoricalArray).not.toHaveBeenCalled();
+        });
+    });
+
+    describe('empiricalTable(), empirical() and empiricalArray()', () => {
+        it('should stage the points in the float output array and build a new table from them', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const instance = (gen as any)._instance;
+            const floatPtr = (gen as any)._arrayConfig.floatOutputArrayPtr;
+            instance.allocFloat64Array.mockClear();
+
+            const table = gen.empiricalTable([2, 12, 40], [0, 0.5, 1]);
+
+            expect(table.size).toBe(3);
+            expect(instance.allocFloat64Array).toHaveBeenCalledWith(8);
+            expect(instance.empiricalTableBuild).toHaveBeenCalledWith(floatPtr, table.ptr);
+            expect(Array.from((gen as any)._arrayConfig.floatOutputArray.subarray(0, 6))).toEqual([2, 0, 12, 0.5, 40, 1]);
+        });
+
+        it('should rebuild an existing table in place, without allocating', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const instance = (gen as any)._instance;
+            const table = gen.empiricalTable([1, 2, 3], [0, 0.5, 1]);
+            instance.allocFloat64Array.mockClear();
+
+            expect(gen.empiricalTable([1, 5, 9], [0, 0.1, 1], table)).toBe(table);
+            expect(instance.allocFloat64Array).not.toHaveBeenCalled();
+            expect(instance.empiricalTableBuild).toHaveBeenCalledTimes(2);
+        });
+
+        it('should throw before allocating a new table that would not fit in the remaining WASM memory', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const instance = (gen as any)._instance;
+            const points = Array.from({ length: 500 }, (_, i) => i);
+            const cdf = points.map(i => i / 499);
+
+            // the mock's float output array ends at byte 10048 of 65536, leaving room for 3 tables of 16048 bytes
+            const tables: EmpiricalTable[] = [];
+            for (let i = 0; i < 3; i++) {
+                tables.push(gen.empiricalTable(points, cdf));
+            }
+            instance.allocFloat64Array.mockClear();
+
+            expect(() => gen.empiricalTable(points, cdf)).toThrow('table needs up to 16048 bytes of WASM memory, but this generator has only 7344 left');
+            expect(() => gen.aliasTable(new Array(1000).fill(1))).toThrow('table needs up to 8080 bytes of WASM memory, but this generator has only 7344 left');
+            expect(instance.allocFloat64Array).not.toHaveBeenCalled();
+            expect(() => gen.empiricalTable(points, cdf, tables[0])).not.toThrow();
+            expect(() => gen.empiricalTable([0, 1], [0, 1])).not.toThrow();
+        });
+
+        it('should pass the table through to the WASM functions', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const table = gen.empiricalTable([0, 1], [0, 1]);
+            const val = gen.empirical(table);
+            const arr = gen.empiricalArray(table);
+
+            // Get the value that the mock returned
+            const mockReturnValue = ((gen as any)._instance.empirical as any).mock.results[0].value;
+
+            expect(val).toBe(mockReturnValue);
+            expect((gen as any)._instance.empirical).toHaveBeenCalledWith(table.ptr);
+            expect((gen as any)._instance.empiricalArray).toHaveBeenCalledWith(table.ptr, (gen as any)._arrayConfig.floatOutputArrayPtr);
+            expect(arr).toBe((gen as any)._arrayConfig.floatOutputArray);
+        });
+
+        it('should throw for invalid points, or tables from another generator or of another size', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const other = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            const table = gen.empiricalTable([0, 1], [0, 1]);
+            const otherTable = other.empiricalTable([0, 1], [0, 1]);
+            (gen as any)._instance.empiricalTableBuild.mockClear();
+
+            expect(() => gen.empiricalTable([0], [0])).toThrow('values must hold between 2 and 500 points');
+            expect(() => gen.empiricalTable(new Array(501).fill(0), new Array(501).fill(0))).toThrow('values must hold between 2 and 500 points');
+            expect(() => gen.empiricalTable([0, 1], [0, 0.5, 1])).toThrow('cdf must hold a probability for each of the 2 values, got 3');
+            expect(() => gen.empiricalTable([0, 2, 1], [0, 0.5, 1])).toThrow('values must be finite and non-decreasing, got 1 at index 2');
+            expect(() => gen.empiricalTable([0, Infinity], [0, 1])).toThrow('values must be finite and non-decreasing');
+            expect(() => gen.empiricalTable([0, 1], [0, NaN])).toThrow('cdf must be finite and non-decreasing');
+            expect(() => gen.empiricalTable([0, 1, 2], [0, 1, 0.5])).toThrow('cdf must be finite and non-decreasing, got 0.5 at index 2');
+            expect(() => gen.empiricalTable([0, 1], [0.5, 0.5])).toThrow('cdf must rise from its first point to its last, got 0.5 to 0.5');
+            expect(() => gen.empiricalTable([0, 1, 2], [0, 0.5, 1], table)).toThrow('table has 2 points, but there are 3 values');
+            expect(() => gen.empiricalTable([0, 1], [0, 1], otherTable)).toThrow('table must be an empirical table built by this generator');
+            expect(() => gen.empirical(otherTable)).toThrow('table must be an empirical table built by this generator');
+            expect(() => gen.empiricalArray({ size: 2, ptr: table.ptr })).toThrow('table must be an empirical table built by this generator');
+            expect(() => gen.empiricalTable([5, 5], [0.2, 0.3])).not.toThrow();
+            expect((gen as any)._instance.empiricalTableBuild).toHaveBeenCalledTimes(1);
+            expect((gen as any)._instance.empiricalArray).not.toHaveBeenCalled();
+        });
+    });
+
     describe('Monte Carlo method', () => {
         it('should call batchTestUnitCirclePoints()', () => {
             const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
@@ -487,43 +1255,147 @@ describe('RandomGenerator Unit Tests', () => {
     });
 
     describe('Stream ID (uniqueStreamId parameter)', () => {
-        // Generators that support jump() - all Xoshiro/Xoroshiro variants
+        // Generators that support jump() and jumpTo() - all Xoshiro/Xoroshiro, Philox and ChaCha variants
         const JUMP_CAPABLE_GENERATORS = [
+            { type: PRNGType.Philox, seeds: getSeedsForPRNG(PRNGType.Philox) },
+            { type: PRNGType.Philox_SIMD, seeds: getSeedsForPRNG(PRNGType.Philox_SIMD) },
+            { type: PRNGType.ChaCha8, seeds: getSeedsForPRNG(PRNGType.ChaCha8) },
+            { type: PRNGType.ChaCha12, seeds: getSeedsForPRNG(PRNGType.ChaCha12) },
+            { type: PRNGType.ChaCha20, seeds: getSeedsForPRNG(PRNGType.ChaCha20) },
             { type: PRNGType.Xoroshiro128Plus, seeds: getSeedsForPRNG(PRNGType.Xoroshiro128Plus) },
             { type: PRNGType.Xoroshiro128Plus_SIMD, seeds: getSeedsForPRNG(PRNGType.Xoroshiro128Plus_SIMD) },
+            { type: PRNGType.Xoroshiro128Plus_SIMDx4, seeds: getSeedsForPRNG(PRNGType.Xoroshiro128Plus_SIMDx4) },
             { type: PRNGType.Xoshiro256Plus, seeds: getSeedsForPRNG(PRNGType.Xoshiro256Plus) },
-            { type: PRNGType.Xoshiro256Plus_SIMD, seeds: getSeedsForPRNG(PRNGType.Xoshiro256Plus_SIMD) }
+            { type: PRNGType.Xoshiro256Plus_SIMD, seeds: getSeedsForPRNG(PRNGType.Xoshiro256Plus_SIMD) },
+            { type: PRNGType.Xoshiro256Plus_SIMDx4, seeds: getSeedsForPRNG(PRNGType.Xoshiro256Plus_SIMDx4) },
+            { type: PRNGType.Xoroshiro128PlusPlus, seeds: getSeedsForPRNG(PRNGType.Xoroshiro128PlusPlus) },
+            { type: PRNGType.Xoroshiro128PlusPlus_SIMD, seeds: getSeedsForPRNG(PRNGType.Xoroshiro128PlusPlus_SIMD) },
+            { type: PRNGType.Xoroshiro128StarStar, seeds: getSeedsForPRNG(PRNGType.Xoroshiro128StarStar) },
+            { type: PRNGType.Xoroshiro128StarStar_SIMD, seeds: getSeedsForPRNG(PRNGType.Xoroshiro128StarStar_SIMD) },
+            { type: PRNGType.Xoshiro256PlusPlus, seeds: getSeedsForPRNG(PRNGType.Xoshiro256PlusPlus) },
+            { type: PRNGType.Xoshiro256PlusPlus_SIMD, seeds: getSeedsForPRNG(PRNGType.Xoshiro256PlusPlus_SIMD) },
+            { type: PRNGType.Xoshiro256StarStar, seeds: getSeedsForPRNG(PRNGType.Xoshiro256StarStar) },
+            { type: PRNGType.Xoshiro256StarStar_SIMD, seeds: getSeedsForPRNG(PRNGType.Xoshiro256StarStar_SIMD) }
         ];
 
-        describe('Jump-capable generators (Xoshiro/Xoroshiro)', () => {
+        describe('Jump-capable generators (Xoshiro/Xoroshiro/Philox/ChaCha)', () => {
             for (const { type, seeds } of JUMP_CAPABLE_GENERATORS) {
-                it(`${type}: should call jump() with positive stream ID`, () => {
+                it(`${type}: should call jumpTo() once with positive stream ID`, () => {
                     const streamId = 3;
                     const gen = new RandomGenerator(type, seeds, streamId);
 
-                    // Verify jump was called the correct number of times
-                    expect((gen as any)._instance.jump).toHaveBeenCalledTimes(streamId);
+                    // Verify a single jumpTo() call replaces repeated jump() calls
+                    expect((gen as any)._instance.jumpTo).toHaveBeenCalledTimes(1);
+                    expect((gen as any)._instance.jumpTo).toHaveBeenCalledWith(BigInt(streamId));
+                    expect((gen as any)._instance.jump).not.toHaveBeenCalled();
                 });
 
-                it(`${type}: should not call jump() when stream ID is null`, () => {
+                it(`${type}: should pass 64-bit bigint stream IDs through to jumpTo()`, () => {
+                    const streamId = 0xFFFFFFFFFFFFFFFFn;
+                    const gen = new RandomGenerator(type, seeds, streamId);
+
+                    // Verify large stream IDs are passed intact
+                    expect((gen as any)._instance.jumpTo).toHaveBeenCalledWith(streamId);
+                });
+
+                it(`${type}: should round fractional stream IDs down`, () => {
+                    const gen = new RandomGenerator(type, seeds, 2.5);
+
+                    expect((gen as any)._instance.jumpTo).toHaveBeenCalledWith(2n);
+                    expect(() => new RandomGenerator(type, seeds, 0.5)).not.toThrow();
+                });
+
+                it(`${type}: should throw for stream IDs above 2^64 - 1 or not finite, rather than wrapping`, () => {
+                    expect(() => new RandomGenerator(type, seeds, 0x10000000000000005n))
+                        .toThrow('uniqueStreamId must be at most 2^64 - 1, got 18446744073709551621');
+                    expect(() => new RandomGenerator(type, seeds, 2 ** 64))
+                        .toThrow('uniqueStreamId must be at most 2^64 - 1');
+                    expect(() => new RandomGenerator(type, seeds, Infinity))
+                        .toThrow('uniqueStreamId must be a finite number or a bigint, got Infinity');
+                });
+
+                it(`${type}: should not call jumpTo() when stream ID is null`, () => {
                     const gen = new RandomGenerator(type, seeds, null);
 
-                    // Verify jump was not called
-                    expect((gen as any)._instance.jump).not.toHaveBeenCalled();
+                    // Verify jumpTo was not called
+                    expect((gen as any)._instance.jumpTo).not.toHaveBeenCalled();
                 });
 
-                it(`${type}: should not call jump() when stream ID is 0`, () => {
+                it(`${type}: should not call jumpTo() when stream ID is 0`, () => {
                     const gen = new RandomGenerator(type, seeds, 0);
 
-                    // Verify jump was not called
-                    expect((gen as any)._instance.jump).not.toHaveBeenCalled();
+                    // Verify jumpTo was not called
+                    expect((gen as any)._instance.jumpTo).not.toHaveBeenCalled();
                 });
 
-                it(`${type}: should not call jump() when stream ID is negative`, () => {
+                it(`${type}: should not call jumpTo() when stream ID is negative`, () => {
                     const gen = new RandomGenerator(type, seeds, -1);
 
-                    // Verify jump was not called
-                    expect((gen as any)._instance.jump).not.toHaveBeenCalled();
+                    // Verify jumpTo was not called
+                    expect((gen as any)._instance.jumpTo).not.toHaveBeenCalled();
+                });
+            }
+        });
+
+        describe('Hierarchical (nodeId, workerId) stream selection', () => {
+            for (const { type, seeds } of JUMP_CAPABLE_GENERATORS) {
+                it(`${type}: should call longJumpTo() with nodeId, then jumpTo() with workerId`, () => {
+                    const gen = new RandomGenerator(type, seeds, { nodeId: 3, workerId: 5n });
+                    const longJumpToMock = (gen as any)._instance.longJumpTo;
+                    const jumpToMock = (gen as any)._instance.jumpTo;
+
+                    expect(longJumpToMock).toHaveBeenCalledTimes(1);
+                    expect(longJumpToMock).toHaveBeenCalledWith(3n);
+                    expect(jumpToMock).toHaveBeenCalledTimes(1);
+                    expect(jumpToMock).toHaveBeenCalledWith(5n);
+
+                    // Worker jumps are made within the node's long jump slot
+                    expect(longJumpToMock.mock.invocationCallOrder[0]).toBeLessThan(jumpToMock.mock.invocationCallOrder[0]);
+                });
+
+                it(`${type}: should throw for negative nodeId or workerId`, () => {
+                    expect(() => new RandomGenerator(type, seeds, { nodeId: -1, workerId: 0 })).toThrow('nodeId must be between 0');
+                    expect(() => new RandomGenerator(type, seeds, { nodeId: 0, workerId: -1 })).toThrow('workerId must be between 0');
+                });
+            }
+
+            it('should limit Xoroshiro128Plus to 2^32 nodes and workers', () => {
+                const seeds = getSeedsForPRNG(PRNGType.Xoroshiro128Plus);
+
+                expect(() => new RandomGenerator(PRNGType.Xoroshiro128Plus, seeds, { nodeId: 0xFFFFFFFF, workerId: 0xFFFFFFFF })).not.toThrow();
+                expect(() => new RandomGenerator(PRNGType.Xoroshiro128Plus, seeds, { nodeId: 0x100000000, workerId: 0 })).toThrow('nodeId must be between 0 and 4294967295');
+                expect(() => new RandomGenerator(PRNGType.Xoroshiro128Plus, seeds, { nodeId: 0, workerId: 0x100000000 })).toThrow('workerId must be between 0 and 4294967295');
+            });
+
+            it('should limit Xoshiro256Plus to 2^64 nodes and workers', () => {
+                const seeds = getSeedsForPRNG(PRNGType.Xoshiro256Plus);
+
+                expect(() => new RandomGenerator(PRNGType.Xoshiro256Plus, seeds, { nodeId: 0xFFFFFFFFFFFFFFFFn, workerId: 0xFFFFFFFFFFFFFFFFn })).not.toThrow();
+                expect(() => new RandomGenerator(PRNGType.Xoshiro256Plus, seeds, { nodeId: 1n << 64n, workerId: 0 })).toThrow('nodeId must be between 0');
+            });
+
+            it('should throw for PCG', () => {
+                expect(() => new RandomGenerator(PRNGType.PCG, getSeedsForPRNG(PRNGType.PCG), { nodeId: 1, workerId: 1 }))
+                    .toThrow('does not support (nodeId, workerId) stream selection');
+            });
+
+            it('should throw for SFC64', () => {
+                expect(() => new RandomGenerator(PRNGType.SFC64, getSeedsForPRNG(PRNGType.SFC64), { nodeId: 1, workerId: 1 }))
+                    .toThrow('does not support (nodeId, workerId) stream selection');
+            });
+        });
+
+        describe('Generators without stream selection (SFC64/Romu)', () => {
+            for (const type of NO_STREAM_TYPES) {
+                it(`${type}: should throw with positive stream ID`, () => {
+                    expect(() => new RandomGenerator(type, getSeedsForPRNG(type), 1))
+                        .toThrow('does not support uniqueStreamId stream selection');
+                });
+
+                it(`${type}: should select the default stream when stream ID is null, 0 or negative`, () => {
+                    expect(() => new RandomGenerator(type, getSeedsForPRNG(type), null)).not.toThrow();
+                    expect(() => new RandomGenerator(type, getSeedsForPRNG(type), 0)).not.toThrow();
+                    expect(() => new RandomGenerator(type, getSeedsForPRNG(type), -1)).not.toThrow();
                 });
             }
         });
@@ -550,6 +1422,53 @@ describe('RandomGenerator Unit Tests', () => {
                 expect(setStreamIncrementOrder).toBeLessThan(setSeedsOrder);
             });
 
+            it('PCG_SIMD: should call setStreamIncrement() with one increment per lane BEFORE setSeeds()', () => {
+                const streamId = 5;
+                const gen = new RandomGenerator(PRNGType.PCG_SIMD, getSeedsForPRNG(PRNGType.PCG_SIMD), streamId);
+
+                const setStreamIncrementMock = (gen as any)._instance.setStreamIncrement;
+                const setSeedsMock = (gen as any)._instance.setSeeds;
+
+                // Each stream ID reserves 2 consecutive increments, so lanes never share a stream
+                expect(setStreamIncrementMock).toHaveBeenCalledWith(10n, 11n);
+                expect(setStreamIncrementMock.mock.invocationCallOrder[0])
+                    .toBeLessThan(setSeedsMock.mock.invocationCallOrder[0]);
+            });
+
+            it('PCG_SIMD: should throw for stream IDs whose lane increments would overflow u64', () => {
+                const seeds = getSeedsForPRNG(PRNGType.PCG_SIMD);
+                const gen = new RandomGenerator(PRNGType.PCG_SIMD, seeds, 0x7FFFFFFFFFFFFFFFn);
+                expect((gen as any)._instance.setStreamIncrement)
+                    .toHaveBeenCalledWith(0xFFFFFFFFFFFFFFFEn, 0xFFFFFFFFFFFFFFFFn);
+
+                expect(() => new RandomGenerator(PRNGType.PCG_SIMD, seeds, 0x8000000000000000n))
+                    .toThrow('uniqueStreamId must be at most 2^63 - 1 for PCG_SIMD, got 9223372036854775808');
+            });
+
+            it('PCG64: should call setStreamIncrement() BEFORE setSeeds()', () => {
+                const streamId = 5;
+                const gen = new RandomGenerator(PRNGType.PCG64, getSeedsForPRNG(PRNGType.PCG64), streamId);
+
+                const setStreamIncrementMock = (gen as any)._instance.setStreamIncrement;
+                const setSeedsMock = (gen as any)._instance.setSeeds;
+
+                expect(setStreamIncrementMock).toHaveBeenCalledWith(BigInt(streamId));
+                expect(setStreamIncrementMock.mock.invocationCallOrder[0])
+                    .toBeLessThan(setSeedsMock.mock.invocationCallOrder[0]);
+            });
+
+            it('should round fractional stream IDs down, and throw above 2^64 - 1', () => {
+                const gen = new RandomGenerator(PRNGType.PCG, getSeedsForPRNG(PRNGType.PCG), 7.9);
+                expect((gen as any)._instance.setStreamIncrement).toHaveBeenCalledWith(7n);
+
+                // 0.5 rounds down to the default stream, rather than an increment of 0
+                const defaultGen = new RandomGenerator(PRNGType.PCG, getSeedsForPRNG(PRNGType.PCG), 0.5);
+                expect((defaultGen as any)._instance.setStreamIncrement).not.toHaveBeenCalled();
+
+                expect(() => new RandomGenerator(PRNGType.PCG64, getSeedsForPRNG(PRNGType.PCG64), 2n ** 64n))
+                    .toThrow('uniqueStreamId must be at most 2^64 - 1');
+            });
+
             it('should not call setStreamIncrement() when stream ID is null', () => {
                 const gen = new RandomGenerator(PRNGType.PCG, getSeedsForPRNG(PRNGType.PCG), null);
 
@@ -573,6 +1492,98 @@ describe('RandomGenerator Unit Tests', () => {
         });
     });
 
+    describe('discard()', () => {
+        // ChaCha generators erase their keys as they go, so cannot seek, and SFC64 and Romu
+        // state updates are non-linear (both tested below)
+        const ADVANCEABLE_TYPES = Object.values(PRNGType)
+            .filter(type => !type.startsWith('ChaCha') && !NO_STREAM_TYPES.includes(type));
+
+        for (const type of ADVANCEABLE_TYPES) {
+            it(`${type}: should call advance() with a bigint step count`, () => {
+                const gen = new RandomGenerator(type, getSeedsForPRNG(type));
+                gen.discard(1000);
+
+                expect((gen as any)._instance.advance).toHaveBeenCalledTimes(1);
+                expect((gen as any)._instance.advance).toHaveBeenCalledWith(1000n);
+            });
+        }
+
+        it('should pass 64-bit bigint step counts through to advance()', () => {
+            const gen = new RandomGenerator(PRNGType.PCG, getSeedsForPRNG(PRNGType.PCG));
+            gen.discard(0xFFFFFFFFFFFFFFFFn);
+
+            expect((gen as any)._instance.advance).toHaveBeenCalledWith(0xFFFFFFFFFFFFFFFFn);
+        });
+
+        it('should throw for negative step counts', () => {
+            const gen = new RandomGenerator(PRNGType.PCG, getSeedsForPRNG(PRNGType.PCG));
+
+            expect(() => gen.discard(-1)).toThrow('discard count must be between 0 and 2^64 - 1');
+            expect((gen as any)._instance.advance).not.toHaveBeenCalled();
+        });
+
+        it('should throw for step counts of 2^64 or more', () => {
+            const gen = new RandomGenerator(PRNGType.PCG, getSeedsForPRNG(PRNGType.PCG));
+
+            expect(() => gen.discard(0x10000000000000000n)).toThrow('discard count must be between 0 and 2^64 - 1');
+            expect((gen as any)._instance.advance).not.toHaveBeenCalled();
+        });
+
+        it('should throw for generators without advance()', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
+            delete (gen as any)._instance.advance;
+
+            expect(() => gen.discard(1)).toThrow('does not support discard()');
+        });
+
+        it('should throw for ChaCha, which erases its keys rather than seeking', () => {
+            const gen = new RandomGenerator(PRNGType.ChaCha20, getSeedsForPRNG(PRNGType.ChaCha20));
+
+            expect(() => gen.discard(1)).toThrow('does not support discard()');
+        });
+
+        for (const type of NO_STREAM_TYPES) {
+            it(`${type}: should throw, as its state update is non-linear`, () => {
+                const gen = new RandomGenerator(type, getSeedsForPRNG(type));
+
+                expect(() => gen.discard(1)).toThrow('does not support discard()');
+            });
+        }
+    });
+
+    describe('int64ArrayAt()', () => {
+        it('should call fillAt() with a bigint counter and the output array', () => {
+            const gen = new RandomGenerator(PRNGType.Philox, getSeedsForPRNG(PRNGType.Philox));
+            const instance = (gen as any)._instance;
+            const result = gen.int64ArrayAt(42);
+
+            expect(instance.fillAt).toHaveBeenCalledWith(42n, (gen as any)._arrayConfig.bigIntOutputArrayPtr);
+            expect(result).toBe((gen as any)._arrayConfig.bigIntOutputArray);
+        });
+
+        it('should return an independent copy when copy is true', () => {
+            const gen = new RandomGenerator(PRNGType.Philox_SIMD, getSeedsForPRNG(PRNGType.Philox_SIMD));
+            const result = gen.int64ArrayAt(0xFFFFFFFFFFFFFFFFn, true);
+
+            expect((gen as any)._instance.fillAt).toHaveBeenCalledWith(0xFFFFFFFFFFFFFFFFn, expect.any(Number));
+            expect(result).not.toBe((gen as any)._arrayConfig.bigIntOutputArray);
+        });
+
+        it('should throw for counters outside 0 to 2^64 - 1', () => {
+            const gen = new RandomGenerator(PRNGType.Philox, getSeedsForPRNG(PRNGType.Philox));
+
+            expect(() => gen.int64ArrayAt(-1)).toThrow('counter must be between 0 and 2^64 - 1');
+            expect(() => gen.int64ArrayAt(0x10000000000000000n)).toThrow('counter must be between 0 and 2^64 - 1');
+            expect((gen as any)._instance.fillAt).not.toHaveBeenCalled();
+        });
+
+        it('should throw for generators that are not counter-based', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256Plus, getSeedsForPRNG(PRNGType.Xoshiro256Plus));
+
+            expect(() => gen.int64ArrayAt(0)).toThrow('does not support int64ArrayAt()');
+        });
+    });
+
     describe('All PRNG types', () => {
         it('should instantiate PCG', () => {
             const gen = new RandomGenerator(PRNGType.PCG, getSeedsForPRNG(PRNGType.PCG));
@@ -580,6 +1591,84 @@ describe('RandomGenerator Unit Tests', () => {
             expect(gen.seedCount).toBe(1);
         });
 
+        it('should instantiate PCG_SIMD', () => {
+            const gen = new RandomGenerator(PRNGType.PCG_SIMD, getSeedsForPRNG(PRNGType.PCG_SIMD));
+            expect(gen.prngType).toBe(PRNGType.PCG_SIMD);
+            expect(gen.seedCount).toBe(2);
+        });
+
+        it('should instantiate PCG64', () => {
+            const gen = new RandomGenerator(PRNGType.PCG64, getSeedsForPRNG(PRNGType.PCG64));
+            expect(gen.prngType).toBe(PRNGType.PCG64);
+            expect(gen.seedCount).toBe(2);
+        });
+
+        it('should instantiate Philox', () => {
+            const gen = new RandomGenerator(PRNGType.Philox, getSeedsForPRNG(PRNGType.Philox));
+            expect(gen.prngType).toBe(PRNGType.Philox);
+            expect(gen.seedCount).toBe(1);
+        });
+
+        it('should instantiate Philox_SIMD', () => {
+            const gen = new RandomGenerator(PRNGType.Philox_SIMD, getSeedsForPRNG(PRNGType.Philox_SIMD));
+            expect(gen.prngType).toBe(PRNGType.Philox_SIMD);
+            expect(gen.seedCount).toBe(1);
+        });
+
+        it('should instantiate ChaCha8', () => {
+            const gen = new RandomGenerator(PRNGType.ChaCha8, getSeedsForPRNG(PRNGType.ChaCha8));
+            expect(gen.prngType).toBe(PRNGType.ChaCha8);
+            expect(gen.seedCount).toBe(4);
+        });
+
+        it('should instantiate ChaCha12', () => {
+            const gen = new RandomGenerator(PRNGType.ChaCha12, getSeedsForPRNG(PRNGType.ChaCha12));
+            expect(gen.prngType).toBe(PRNGType.ChaCha12);
+            expect(gen.seedCount).toBe(4);
+        });
+
+        it('should instantiate ChaCha20', () => {
+            const gen = new RandomGenerator(PRNGType.ChaCha20, getSeedsForPRNG(PRNGType.ChaCha20));
+            expect(gen.prngType).toBe(PRNGType.ChaCha20);
+            expect(gen.seedCount).toBe(4);
+        });
+
+        it('should instantiate SFC64', () => {
+            const gen = new RandomGenerator(PRNGType.SFC64, getSeedsForPRNG(PRNGType.SFC64));
+            expect(gen.prngType).toBe(PRNGType.SFC64);
+            expect(gen.seedCount).toBe(3);
+        });
+
+        it('should instantiate SFC64_SIMD', () => {
+            const gen = new RandomGenerator(PRNGType.SFC64_SIMD, getSeedsForPRNG(PRNGType.SFC64_SIMD));
+            expect(gen.prngType).toBe(PRNGType.SFC64_SIMD);
+            expect(gen.seedCount).toBe(6);
+        });
+
+        it('should instantiate RomuTrio', () => {
+            const gen = new RandomGenerator(PRNGType.RomuTrio, getSeedsForPRNG(PRNGType.RomuTrio));
+            expect(gen.prngType).toBe(PRNGType.RomuTrio);
+            expect(gen.seedCount).toBe(3);
+        });
+
+        it('should instantiate RomuTrio_SIMD', () => {
+            const gen = new RandomGenerator(PRNGType.RomuTrio_SIMD, getSeedsForPRNG(PRNGType.RomuTrio_SIMD));
+            expect(gen.prngType).toBe(PRNGType.RomuTrio_SIMD);
+            expect(gen.seedCount).toBe(6);
+        });
+
+        it('should instantiate RomuDuoJr', () => {
+            const gen = new RandomGenerator(PRNGType.RomuDuoJr, getSeedsForPRNG(PRNGType.RomuDuoJr));
+            expect(gen.prngType).toBe(PRNGType.RomuDuoJr);
+            expect(gen.seedCount).toBe(2);
+        });
+
+        it('should instantiate RomuDuoJr_SIMD', () => {
+            const gen = new RandomGenerator(PRNGType.RomuDuoJr_SIMD, getSeedsForPRNG(PRNGType.RomuDuoJr_SIMD));
+            expect(gen.prngType).toBe(PRNGType.RomuDuoJr_SIMD);
+            expect(gen.seedCount).toBe(4);
+        });
+
         it('should instantiate Xoroshiro128Plus', () => {
             const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus, getSeedsForPRNG(PRNGType.Xoroshiro128Plus));
             expect(gen.prngType).toBe(PRNGType.Xoroshiro128Plus);
@@ -592,6 +1681,12 @@ describe('RandomGenerator Unit Tests', () => {
             expect(gen.seedCount).toBe(4);
         });
 
+        it('should instantiate Xoroshiro128Plus_SIMDx4', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128Plus_SIMDx4, getSeedsForPRNG(PRNGType.Xoroshiro128Plus_SIMDx4));
+            expect(gen.prngType).toBe(PRNGType.Xoroshiro128Plus_SIMDx4);
+            expect(gen.seedCount).toBe(8);
+        });
+
         it('should instantiate Xoshiro256Plus', () => {
             const gen = new RandomGenerator(PRNGType.Xoshiro256Plus, getSeedsForPRNG(PRNGType.Xoshiro256Plus));
             expect(gen.prngType).toBe(PRNGType.Xoshiro256Plus);
@@ -603,5 +1698,59 @@ describe('RandomGenerator Unit Tests', () => {
             expect(gen.prngType).toBe(PRNGType.Xoshiro256Plus_SIMD);
             expect(gen.seedCount).toBe(8);
         });
+
+        it('should instantiate Xoshiro256Plus_SIMDx4', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256Plus_SIMDx4, getSeedsForPRNG(PRNGType.Xoshiro256Plus_SIMDx4));
+            expect(gen.prngType).toBe(PRNGType.Xoshiro256Plus_SIMDx4);
+            expect(gen.seedCount).toBe(16);
+        });
+
+        it('should instantiate Xoroshiro128PlusPlus', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128PlusPlus, getSeedsForPRNG(PRNGType.Xoroshiro128PlusPlus));
+            expect(gen.prngType).toBe(PRNGType.Xoroshiro128PlusPlus);
+            expect(gen.seedCount).toBe(2);
+        });
+
+        it('should instantiate Xoroshiro128PlusPlus_SIMD', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128PlusPlus_SIMD, getSeedsForPRNG(PRNGType.Xoroshiro128PlusPlus_SIMD));
+            expect(gen.prngType).toBe(PRNGType.Xoroshiro128PlusPlus_SIMD);
+            expect(gen.seedCount).toBe(4);
+        });
+
+        it('should instantiate Xoroshiro128StarStar', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128StarStar, getSeedsForPRNG(PRNGType.Xoroshiro128StarStar));
+            expect(gen.prngType).toBe(PRNGType.Xoroshiro128StarStar);
+            expect(gen.seedCount).toBe(2);
+        });
+
+        it('should instantiate Xoroshiro128StarStar_SIMD', () => {
+            const gen = new RandomGenerator(PRNGType.Xoroshiro128StarStar_SIMD, getSeedsForPRNG(PRNGType.Xoroshiro128StarStar_SIMD));
+            expect(gen.prngType).toBe(PRNGType.Xoroshiro128StarStar_SIMD);
+            expect(gen.seedCount).toBe(4);
+        });
+
+        it('should instantiate Xoshiro256PlusPlus', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256PlusPlus, getSeedsForPRNG(PRNGType.Xoshiro256PlusPlus));
+            expect(gen.prngType).toBe(PRNGType.Xoshiro256PlusPlus);
+            expect(gen.seedCount).toBe(4);
+        });
+
+        it('should instantiate Xoshiro256PlusPlus_SIMD', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256PlusPlus_SIMD, getSeedsForPRNG(PRNGType.Xoshiro256PlusPlus_SIMD));
+            expect(gen.prngType).toBe(PRNGType.Xoshiro256PlusPlus_SIMD);
+            expect(gen.seedCount).toBe(8);
+        });
+
+        it('should instantiate Xoshiro256StarStar', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256StarStar, getSeedsForPRNG(PRNGType.Xoshiro256StarStar));
+            expect(gen.prngType).toBe(PRNGType.Xoshiro256StarStar);
+            expect(gen.seedCount).toBe(4);
+        });
+
+        it('should instantiate Xoshiro256StarStar_SIMD', () => {
+            const gen = new RandomGenerator(PRNGType.Xoshiro256StarStar_SIMD, getSeedsForPRNG(PRNGType.Xoshiro256StarStar_SIMD));
+            expect(gen.prngType).toBe(PRNGType.Xoshiro256StarStar_SIMD);
+            expect(gen.seedCount).toBe(8);
+        });
     });
 });
@@ -1,11 +1,12 @@
 /**
  * Seed Generation Tests
  *
- * Tests for SplitMix64 seeding algorithm and seed64Array utility function.
+ * Tests for SplitMix64 seeding algorithm, and the seed64Array and secureSeed64Array utility functions.
  *
  * Test Strategy:
  * - Verify SplitMix64 algorithm correctness against reference implementation
  * - Test determinism and uniqueness of generated seeds
+ * - Verify nextArray() (WASM for large counts) is bit-exact with the BigInt next()
  * - Validate seed64Array utility produces correct sizes and types
  * - Test both auto-seeding and custom seed scenarios
  *
@@ -14,7 +15,7 @@
  */
 
 import { describe, it, expect, vi, afterEach } from 'vitest';
-import { SplitMix64, seed64Array } from 'fast-prng-wasm';
+import { SplitMix64, seed64Array, secureSeed64Array } from 'fast-prng-wasm';
 
 describe('SplitMix64 Random Seed Generator', () => {
     describe('Constructor', () => {
@@ -121,6 +122,45 @@ describe('SplitMix64 Random Seed Generator', () => {
         });
     });
 
+    describe('nextArray()', () => {
+        it('should match repeated next() calls below and above the WASM threshold', () => {
+            for (const count of [10, 256, 3000]) {
+                const expected = new SplitMix64(12345n);
+                const sequence = Array.from({ length: count }, () => expected.next());
+
+                expect(new SplitMix64(12345n).nextArray(count)).toEqual(sequence);
+            }
+        });
+
+        it('should produce known output for known seed from WASM', () => {
+            const values = new SplitMix64(12345n).nextArray(1000);
+
+            expect(values.slice(0, 3)).toEqual([2454886589211414944n, 3778200017661327597n, 2205171434679333405n]);
+        });
+
+        it('should continue the same sequence with next() afterwards', () => {
+            const sm64 = new SplitMix64(12345n);
+            sm64.nextArray(1500);
+
+            const expected = new SplitMix64(12345n);
+            for (let i = 0; i < 1500; i++) {
+                expected.next();
+            }
+
+            expect(sm64._state).toBe(expected._state);
+            expect(sm64.next()).toBe(expected.next());
+        });
+
+        it('should wrap negative and oversized seeds to 64 bits like next()', () => {
+            for (const seed of [-1n, (1n << 64n) + 5n]) {
+                const expected = new SplitMix64(seed);
+                const sequence = Array.from({ length: 300 }, () => expected.next());
+
+                expect(new SplitMix64(seed).nextArray(300)).toEqual(sequence);
+            }
+        });
+    });
+
     describe('Seeding SplitMix64 Seed Generator with Crypto', () => {
         afterEach(() => {
             // Restore all mocks after each test
@@ -300,6 +340,13 @@ describe('SplitMix64 Random Seed Generator', () => {
             expect(seeds1).not.toEqual(seeds3);
         });
 
+        it('should generate large counts identically to SplitMix64.next()', () => {
+            const sm64 = new SplitMix64(42n);
+            const expected = Array.from({ length: 10000 }, () => sm64.next());
+
+            expect(seed64Array(10000, 42n)).toEqual(expected);
+        });
+
         it('should accept number seed', () => {
             const seeds = seed64Array(5, 123);
 
@@ -307,4 +354,45 @@ describe('SplitMix64 Random Seed Generator', () => {
             expect(seeds.length).toBe(5);
         });
     });
+
+    describe('secureSeed64Array', () => {
+        afterEach(() => {
+            vi.unstubAllGlobals();
+            vi.resetModules();
+        });
+
+        it('should generate array of default size (8)', () => {
+            const seeds = secureSeed64Array();
+
+            expect(seeds.length).toBe(8);
+            expect(seeds.every(s => typeof s === 'bigint' && s >= 0n && s <= 0xFFFFFFFFFFFFFFFFn)).toBe(true);
+        });
+
+        it('should generate array of specified size', () => {
+            expect(secureSeed64Array(4).length).toBe(4);
+        });
+
+        it('should fill every seed from crypto.getRandomValues', async () => {
+            const mockGetRandomValues = vi.fn((arr: BigUint64Array) => {
+                for (let i = 0; i < arr.length; i++) {
+                    arr[i] = 0x0123456789ABCDEFn + BigInt(i);
+                }
+                return arr;
+            });
+            vi.stubGlobal('crypto', { getRandomValues: mockGetRandomValues });
+
+            const { secureSeed64Array: freshSecureSeed64Array } = await import('../../src/seeds');
+
+            expect(freshSecureSeed64Array(2)).toEqual([0x0123456789ABCDEFn, 0x0123456789ABCDF0n]);
+            expect(mockGetRandomValues).toHaveBeenCalledTimes(1);
+        });
+
+        it('should throw when crypto is unavailable rather than fall back', async () => {
+            vi.stubGlobal('crypto', undefined);
+
+            const { secureSeed64Array: freshSecureSeed64Array } = await import('../../src/seeds');
+
+            expect(() => freshSecureSeed64Array()).toThrow('requires crypto.getRandomValues()');
+        });
+    });
 });
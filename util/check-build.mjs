@@ -16,10 +16,32 @@ const projectRoot = join(__dirname, '..');
 // Check for WASM binaries in bin/
 const wasmFiles = [
     'bin/pcg.wasm',
+    'bin/pcg-simd.wasm',
+    'bin/pcg64.wasm',
+    'bin/philox.wasm',
+    'bin/philox-simd.wasm',
+    'bin/chacha-simd.wasm',
+    'bin/splitmix64.wasm',
+    'bin/sfc64.wasm',
+    'bin/sfc64-simd.wasm',
+    'bin/romutrio.wasm',
+    'bin/romutrio-simd.wasm',
+    'bin/romuduojr.wasm',
+    'bin/romuduojr-simd.wasm',
     'bin/xoroshiro128plus.wasm',
     'bin/xoroshiro128plus-simd.wasm',
+    'bin/xoroshiro128plus-simd-x4.wasm',
+    'bin/xoroshiro128plusplus.wasm',
+    'bin/xoroshiro128plusplus-simd.wasm',
+    'bin/xoroshiro128starstar.wasm',
+    'bin/xoroshiro128starstar-simd.wasm',
     'bin/xoshiro256plus.wasm',
-    'bin/xoshiro256plus-simd.wasm'
+    'bin/xoshiro256plus-simd.wasm',
+    'bin/xoshiro256plus-simd-x4.wasm',
+    'bin/xoshiro256plusplus.wasm',
+    'bin/xoshiro256plusplus-simd.wasm',
+    'bin/xoshiro256starstar.wasm',
+    'bin/xoshiro256starstar-simd.wasm'
 ];
 
 // Check for bundled lib files in dist/
@@ -0,0 +1,139 @@
+#!/usr/bin/env node
+
+/**
+ * Generates the 256-layer ziggurat tables used by every generator's normal and exponential
+ * distribution functions, and writes them to src/assembly/common/ziggurat-tables.ts as
+ * static data, so they're compiled into each WASM binary rather than computed on instantiation.
+ *
+ * Based on "The Ziggurat Method for Generating Random Variables"
+ * George Marsaglia and Wai Wan Tsang, Journal of Statistical Software, 2000
+ * https://www.jstatsoft.org/article/view/v005i08
+ *
+ * Usage: node util/gen-ziggurat-tables.mjs
+ */
+
+import { writeFileSync } from 'fs';
+import { fileURLToPath } from 'url';
+import { dirname, join } from 'path';
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+const outputPath = join(__dirname, '../src/assembly/common/ziggurat-tables.ts');
+
+const LAYERS = 256;
+
+// area under the unnormalized normal density beyond r, by Simpson's rule
+// (the integrand is negligible 40 past r)
+function normalTailArea(r) {
+    const f = x => Math.exp(-0.5 * x * x);
+    const steps = 400000;
+    const h = 40 / steps;
+    let sum = f(r) + f(r + 40);
+    for (let i = 1; i < steps; i++) {
+        sum += (i % 2 ? 4 : 2) * f(r + i * h);
+    }
+    return sum * h / 3;
+}
+
+const DISTRIBUTIONS = [
+    {
+        name: 'NORMAL',
+        description: 'the standard normal distribution',
+        density: 'exp(-x^2 / 2)',
+        f: x => Math.exp(-0.5 * x * x),
+        fInverse: y => Math.sqrt(-2 * Math.log(y)),
+        tailArea: normalTailArea,
+        low: 3,
+        high: 4
+    },
+    {
+        name: 'EXPONENTIAL',
+        description: 'the exponential distribution with rate 1',
+        density: 'exp(-x)',
+        f: x => Math.exp(-x),
+        fInverse: y => -Math.log(y),
+        tailArea: r => Math.exp(-r),
+        low: 6,
+        high: 9
+    }
+];
+
+// builds the layer edges for a given base layer edge `r`, where every layer has area `v`.
+// Returns how far the topmost layer overshoots f(0) = 1, which is 0 for the right `r`
+function buildLayers({ f, fInverse, tailArea }, r) {
+    const v = r * f(r) + tailArea(r);
+    const x = new Array(LAYERS + 1);
+    x[0] = v / f(r);
+    x[1] = r;
+    for (let i = 1; i < LAYERS - 1; i++) {
+        const y = v / x[i] + f(x[i]);
+        if (y >= 1) return { x, v, overshoot: y - 1 + (LAYERS - 1 - i) };
+        x[i + 1] = fInverse(y);
+    }
+    x[LAYERS] = 0;
+    return { x, v, overshoot: v / x[LAYERS - 1] + f(x[LAYERS - 1]) - 1 };
+}
+
+// a larger r leaves more area for the tail and less for the layers, so they overshoot less
+function solve(distribution) {
+    let { low, high } = distribution;
+    for (let i = 0; i < 200; i++) {
+        const mid = (low + high) / 2;
+        if (buildLayers(distribution, mid).overshoot > 0) low = mid; else high = mid;
+    }
+    return buildLayers(distribution, high);
+}
+
+const formatNumber = n => n === 0 ? '0.0' : n === 1 ? '1.0' : n.toPrecision(17);
+const format = values => values.map(n => `    ${formatNumber(n)}`).join(',\n');
+
+const sections = DISTRIBUTIONS.map(distribution => {
+    const { name, description, density, f } = distribution;
+    const { x, v } = solve(distribution);
+    const y = x.map(f);
+
+    console.log(`${name}: r = ${x[1]}, v = ${v}`);
+
+    return `
+// ${LAYERS}-layer ziggurat for ${description}
+
+/** Right edge of the base layer's rectangle, where the tail begins. */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const ${name}_R: f64 = ${formatNumber(x[1])};
+
+/** Area of every layer, including the base layer's tail. */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const ${name}_V: f64 = ${formatNumber(v)};
+
+/**
+ * Width of each layer's rectangle, from the base layer (index 0) up to the
+ * topmost layer (index ${LAYERS - 1}), followed by 0 at the peak.
+ */
+export const ${name}_X: StaticArray<f64> = [
+${format(x)}
+];
+
+/**
+ * Unnormalized density ${density} at each of the {@link ${name}_X} widths,
+ * the lower edge of each layer, followed by 1 at the peak.
+ */
+export const ${name}_Y: StaticArray<f64> = [
+${format(y)}
+];
+`;
+});
+
+writeFileSync(outputPath, `/**
+ * Ziggurat tables for the normal and exponential distributions, generated by
+ * util/gen-ziggurat-tables.mjs. Do not edit by hand.
+ * @packageDocumentation
+ */
+
+/** Number of layers in every ziggurat. */
+// @ts-ignore: top level decorators are supported in AssemblyScript
+@inline
+export const ZIGGURAT_LAYERS: i32 = ${LAYERS};
+${sections.join('')}`);
+
+console.log(`Wrote ${LAYERS}-layer ziggurat tables to ${outputPath}`);